@@ -173,6 +173,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/EclipseState/Tables/BrineDensityTable.cpp
   opm/input/eclipse/EclipseState/Tables/SolventDensityTable.cpp
   opm/input/eclipse/EclipseState/Tables/Tabdims.cpp
+  opm/input/eclipse/Parser/DeckCache.cpp
   opm/input/eclipse/Parser/ErrorGuard.cpp
   opm/input/eclipse/Parser/InputErrorAction.cpp
   opm/input/eclipse/Parser/ParseContext.cpp
@@ -226,6 +227,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/Action/Actions.cpp
   opm/input/eclipse/Schedule/Action/ActionX.cpp
   opm/input/eclipse/Schedule/Action/ActionParser.cpp
+  opm/input/eclipse/Schedule/Action/ActionProgram.cpp
   opm/input/eclipse/Schedule/Action/ActionValue.cpp
   opm/input/eclipse/Schedule/Action/ASTNode.cpp
   opm/input/eclipse/Schedule/Action/Condition.cpp
@@ -278,12 +280,14 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/UDQ/UDQConfig.cpp
   opm/input/eclipse/Schedule/UDQ/UDQContext.cpp
   opm/input/eclipse/Schedule/UDQ/UDQDefine.cpp
+  opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.cpp
   opm/input/eclipse/Schedule/UDQ/UDQEnums.cpp
   opm/input/eclipse/Schedule/UDQ/UDQFunction.cpp
   opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.cpp
   opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
   opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
   opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+  opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
   opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
   opm/input/eclipse/Schedule/UDQ/UDQState.cpp
   opm/input/eclipse/Schedule/UDQ/UDQToken.cpp
@@ -331,6 +335,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/io/eclipse/EclFile.cpp
   opm/io/eclipse/EclOutput.cpp
   opm/io/eclipse/EclUtil.cpp
+  opm/io/eclipse/MappedFile.cpp
   opm/io/eclipse/EGrid.cpp
   opm/io/eclipse/EInit.cpp
   opm/io/eclipse/ERft.cpp
@@ -341,6 +346,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/io/eclipse/ESmry_write_rsm.cpp
   opm/io/eclipse/OutputStream.cpp
   opm/io/eclipse/ExtSmryOutput.cpp
+  opm/io/eclipse/ChunkedSmry.cpp
   opm/io/eclipse/RestartFileView.cpp
   opm/io/eclipse/SummaryNode.cpp
   opm/io/eclipse/rst/action.cpp
@@ -396,6 +402,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/material/thermal/EclThermalLawManager.cpp
   opm/ml/ml_model.cpp
   opm/output/data/Aquifer.cpp
+  opm/output/data/DenseWells.cpp
   opm/output/data/InterRegFlowMap.cpp
   opm/output/data/RegionsetVariableDescriptor.cpp
   opm/output/data/RegionVariableMapping.cpp
@@ -522,6 +529,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_data_regionvariablevalues.cpp
   tests/test_data_regionvariableview.cpp
   tests/test_DatumDepth.cpp
+  tests/test_densead_batch.cpp
   tests/test_DoubHEAD.cpp
   tests/test_EclipseIO.cpp
   tests/test_EclipseIO_LGR.cpp
@@ -533,6 +541,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_ERst.cpp
   tests/test_ESmry.cpp
   tests/test_ExtESmry.cpp
+  tests/test_ChunkedSmry.cpp
   tests/test_FastSmallVector.cpp
   tests/test_FIPRegionStatistics.cpp
   tests/test_GroupSatelliteInjection.cpp
@@ -588,9 +597,11 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_Wells.cpp
   tests/test_WindowedArray.cpp
   tests/material/test_2dtables.cpp
+  tests/material/test_brinesolubility.cpp
   tests/material/test_eclmateriallawmanager.cpp
   tests/material/test_hysteresis.cpp
   tests/material/test_spline.cpp
+  tests/material/test_tabulated1dfunction.cpp
   tests/ml/test_ml_model.cpp
   tests/ml/test_ml_layer.cpp
   tests/parser/ACTIONX.cpp
@@ -868,6 +879,11 @@ list(APPEND TEST_DATA_FILES
 list(APPEND EXAMPLE_SOURCE_FILES
   examples/wellgraph.cpp
   examples/networkgraph.cpp
+  examples/eclio_decode_bench.cpp
+  examples/deck_token_bench.cpp
+  examples/pvt_batch_bench.cpp
+  examples/ml_batch_bench.cpp
+  examples/densead_batch_bench.cpp
 )
 
 # programs listed here will not only be compiled, but also marked for
@@ -1114,6 +1130,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/EclipseState/checkDeck.hpp
   opm/input/eclipse/Generator/KeywordGenerator.hpp
   opm/input/eclipse/Generator/KeywordLoader.hpp
+  opm/input/eclipse/Parser/DeckCache.hpp
   opm/input/eclipse/Parser/ErrorGuard.hpp
   opm/input/eclipse/Parser/InputErrorAction.hpp
   opm/input/eclipse/Parser/ParseContext.hpp
@@ -1128,6 +1145,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Schedule/Action/Actdims.hpp
   opm/input/eclipse/Schedule/Action/ActionAST.hpp
   opm/input/eclipse/Schedule/Action/ActionContext.hpp
+  opm/input/eclipse/Schedule/Action/ActionProgram.hpp
   opm/input/eclipse/Schedule/Action/ActionResult.hpp
   opm/input/eclipse/Schedule/Action/ActionValue.hpp
   opm/input/eclipse/Schedule/Action/ActionX.hpp
@@ -1202,11 +1220,13 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp
   opm/input/eclipse/Schedule/UDQ/UDQContext.hpp
   opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp
+  opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp
   opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp
   opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp
   opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp
   opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
   opm/input/eclipse/Schedule/UDQ/UDQParams.hpp
+  opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp
   opm/input/eclipse/Schedule/UDQ/UDQSet.hpp
   opm/input/eclipse/Schedule/UDQ/UDQState.hpp
   opm/input/eclipse/Schedule/UDQ/UDQToken.hpp
@@ -1262,6 +1282,8 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/io/eclipse/EclUtil.hpp
   opm/io/eclipse/ExtESmry.hpp
   opm/io/eclipse/ExtSmryOutput.hpp
+  opm/io/eclipse/ChunkedSmry.hpp
+  opm/io/eclipse/MappedFile.hpp
   opm/io/eclipse/OutputStream.hpp
   opm/io/eclipse/PaddedOutputString.hpp
   opm/io/eclipse/RestartFileView.hpp
@@ -1302,10 +1324,12 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/common/Means.hpp
   opm/material/common/PolynomialUtils.hpp
   opm/material/common/ResetLocale.hpp
+  opm/material/common/SegmentSearch.hpp
   opm/material/common/Spline.hpp
   opm/material/common/Tabulated1DFunction.hpp
   opm/material/common/TridiagonalMatrix.hpp
   opm/material/common/UniformTabulated2DFunction.hpp
+  opm/material/common/UniformTabulated3DFunction.hpp
   opm/material/common/UniformXTabulated2DFunction.hpp
   opm/material/common/Valgrind.hpp
   opm/material/common/quad.hpp
@@ -1354,6 +1378,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/densead/Evaluation7.hpp
   opm/material/densead/Evaluation8.hpp
   opm/material/densead/Evaluation9.hpp
+  opm/material/densead/EvaluationBatch.hpp
   opm/material/densead/EvaluationFormat.hpp
   opm/material/densead/EvaluationSpecializations.hpp
   opm/material/densead/Math.hpp
@@ -1509,6 +1534,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/ml/ml_model.hpp
   opm/output/data/Aquifer.hpp
   opm/output/data/Cells.hpp
+  opm/output/data/DenseWells.hpp
   opm/output/data/Groups.hpp
   opm/output/data/GuideRateValue.hpp
   opm/output/data/InterRegFlow.hpp
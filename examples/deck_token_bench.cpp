@@ -0,0 +1,274 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Measure conversion throughput of numeric deck tokens, e.g., the
+// contents of COORD, ZCORN, or PERMX include files.
+//
+// Usage: deck_token_bench [number of values (default 50000000)]
+//        deck_token_bench include_file [include_file ...]
+
+#include <opm/input/eclipse/Parser/raw/StarToken.hpp>
+
+#include <boost/spirit/include/qi.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+// Reference: Boost.Spirit real parser with Fortran exponents, as used by
+// the previous implementation of readValueToken<double>().
+template <typename T>
+struct FortranDouble : boost::spirit::qi::real_policies<T>
+{
+    template <typename It>
+    static bool parse_exp(It& first, const It& last)
+    {
+        if ((first == last) ||
+            ((*first != 'e') && (*first != 'E') &&
+             (*first != 'd') && (*first != 'D')))
+        {
+            return false;
+        }
+
+        ++first;
+        return true;
+    }
+};
+
+double spiritDouble(std::string_view view)
+{
+    namespace qi = boost::spirit::qi;
+
+    double n = 0.0;
+    qi::real_parser<double, FortranDouble<double>> double_;
+
+    auto cursor = view.begin();
+    const auto ok = qi::parse(cursor, view.end(), double_, n);
+    if (!ok || (cursor != view.end())) {
+        throw std::invalid_argument {
+            fmt::format("Malformed floating point number '{}'", view)
+        };
+    }
+
+    return n;
+}
+
+// Synthetic ZCORN-like data.  Mostly plain decimals, with some Fortran
+// exponents and repeat counts.
+std::string makeValues(const std::size_t numValues)
+{
+    auto rng = std::mt19937 { 1234 };
+    auto depth = std::uniform_real_distribution<double> { 1500.0, 2500.0 };
+    auto perm = std::uniform_real_distribution<double> { -3.0, 4.0 };
+
+    std::string text;
+    text.reserve(numValues * 11);
+
+    text += "ZCORN\n";
+    for (std::size_t i = 0; i < numValues; ++i) {
+        switch (i % 16) {
+        case 5:  text += fmt::format("{:.6E}", std::pow(10.0, perm(rng))); break;
+        case 11: text += fmt::format("{:.4f}D-2", depth(rng)); break;
+        case 15: text += fmt::format("4*{:.3f}", depth(rng)); i += 3; break;
+        default: text += fmt::format("{:.4f}", depth(rng)); break;
+        }
+
+        text += ((i % 8) == 7) ? '\n' : ' ';
+    }
+    text += "\n/\n";
+
+    return text;
+}
+
+std::string readFile(const std::string& filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is) {
+        throw std::invalid_argument {
+            fmt::format("Unable to open {}", filename)
+        };
+    }
+
+    std::ostringstream os;
+    os << is.rdbuf();
+
+    return os.str();
+}
+
+// Split deck text into numeric tokens, skipping comments, keyword names,
+// and record terminators.
+std::vector<std::string_view> numericTokens(std::string_view text)
+{
+    auto tokens = std::vector<std::string_view>{};
+
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        const auto c = text[pos];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++pos;
+            continue;
+        }
+
+        if (text.substr(pos, 2) == "--") {
+            pos = text.find('\n', pos);
+            continue;
+        }
+
+        const auto end = std::min(text.find_first_of(" \t\r\n", pos), text.size());
+        const auto token = text.substr(pos, end - pos);
+        pos = end;
+
+        if (std::isalpha(static_cast<unsigned char>(token.front())) ||
+            (token.front() == '/'))
+        {
+            continue;
+        }
+
+        tokens.push_back(token);
+    }
+
+    return tokens;
+}
+
+// Convert tokens the way the deck parser does for items of type double,
+// including repeat counts.
+template <typename Convert>
+double convertTokens(const std::vector<std::string_view>& tokens,
+                     std::size_t& numValues, Convert&& convert)
+{
+    std::string countString;
+    std::string valueString;
+
+    auto sum = 0.0;
+    numValues = 0;
+
+    for (const auto& token : tokens) {
+        if (!Opm::isStarToken(token, countString, valueString)) {
+            sum += convert(token);
+            ++numValues;
+            continue;
+        }
+
+        const Opm::StarToken st(token, countString, valueString);
+        if (st.hasValue()) {
+            sum += st.count() * convert(st.valueString());
+        }
+
+        numValues += st.count();
+    }
+
+    return sum;
+}
+
+template <typename Function>
+double elapsedSeconds(Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>
+        { std::chrono::steady_clock::now() - start }.count();
+}
+
+bool benchmark(const std::string& name, const std::string& text)
+{
+    const auto tokens = numericTokens(text);
+
+    std::size_t numRef = 0;
+    auto sumRef = 0.0;
+    const auto refTime = elapsedSeconds([&]()
+    {
+        sumRef = convertTokens(tokens, numRef, spiritDouble);
+    });
+
+    std::size_t numFast = 0;
+    auto sumFast = 0.0;
+    const auto fastTime = elapsedSeconds([&]()
+    {
+        sumFast = convertTokens(tokens, numFast, [](std::string_view token)
+        { return Opm::readValueToken<double>(token); });
+    });
+
+    const auto megabytes = text.size() / 1.0e6;
+    std::cout << fmt::format("{}: {} tokens, {} values ({:.2f} MB)\n",
+                             name, tokens.size(), numFast, megabytes)
+              << fmt::format("  Boost.Spirit reference: {:8.2f} MB/s {:8.2f} Mtokens/s\n",
+                             megabytes / refTime, tokens.size() / refTime / 1.0e6)
+              << fmt::format("  readValueToken<double>: {:8.2f} MB/s {:8.2f} Mtokens/s\n",
+                             megabytes / fastTime, tokens.size() / fastTime / 1.0e6);
+
+    // The fast path is correctly rounded while the reference may be off
+    // by an ulp or two, so only expect close agreement.
+    const auto tol = 1.0e-12 * std::max(1.0, std::abs(sumRef));
+    if ((numRef != numFast) || (std::abs(sumRef - sumFast) > tol)) {
+        std::cerr << "Converted values do not match reference\n";
+        return false;
+    }
+
+    return true;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    try {
+        auto numValues = std::size_t{50'000'000};
+        if (argc > 1) {
+            std::size_t pos = 0;
+            try {
+                numValues = std::stoull(argv[1], &pos);
+            }
+            catch (const std::exception&) {
+                pos = 0;
+            }
+
+            if (argv[1][pos] != '\0') {
+                auto ok = true;
+                for (int i = 1; i < argc; ++i) {
+                    ok = benchmark(argv[i], readFile(argv[i])) && ok;
+                }
+
+                return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
+        }
+
+        return benchmark("Synthetic ZCORN", makeValues(numValues))
+            ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+}
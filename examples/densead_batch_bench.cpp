@@ -0,0 +1,357 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Compare per-cell evaluation of saturation functions and live oil PVT
+// properties with evaluation of batches of cells in EvaluationBatch
+// objects.  The batches are packed from, and unpacked to, per-cell
+// evaluations as part of the timed work.
+//
+// Usage: densead_batch_bench [number of cells (default 1000000)]
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/EvaluationBatch.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidmatrixinteractions/EclTwoPhaseMaterial.hpp>
+#include <opm/material/fluidmatrixinteractions/EclTwoPhaseMaterialParams.hpp>
+#include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
+#include <opm/material/fluidmatrixinteractions/PiecewiseLinearTwoPhaseMaterial.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/LiveOilPvt.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+using Eval = Opm::DenseAd::Evaluation<double, 3>;
+
+using ThreePhaseTraits = Opm::ThreePhaseMaterialTraits<double,
+                                                       /*wettingPhaseIdx=*/0,
+                                                       /*nonWettingPhaseIdx=*/1,
+                                                       /*gasPhaseIdx=*/2,
+                                                       /*enableHysteresis=*/false,
+                                                       /*enableEndpointScaling=*/false>;
+using TwoPhaseTraits = Opm::TwoPhaseMaterialTraits<double, 0, 1>;
+using TwoPhaseLaw = Opm::PiecewiseLinearTwoPhaseMaterial<TwoPhaseTraits>;
+using MaterialLaw = Opm::EclTwoPhaseMaterial<ThreePhaseTraits, TwoPhaseLaw, TwoPhaseLaw, TwoPhaseLaw>;
+
+using Pvt = Opm::LiveOilPvt<double>;
+
+constexpr double bar = 1.0e5;
+
+// Minimal fluid state for the two-phase saturation functions.
+template <class Evaluation>
+struct SaturationState
+{
+    std::array<Evaluation, 3> saturations;
+
+    const Evaluation& saturation(unsigned phaseIdx) const
+    { return saturations[phaseIdx]; }
+};
+
+// Corey type oil-water curves sampled at 20 saturations.
+MaterialLaw::Params makeMaterialParams()
+{
+    constexpr int numSamples = 20;
+    constexpr double swc = 0.15;
+    constexpr double sor = 0.2;
+
+    auto sw = std::vector<double>(numSamples);
+    auto krw = std::vector<double>(numSamples);
+    auto krn = std::vector<double>(numSamples);
+    auto pcnw = std::vector<double>(numSamples);
+    for (int i = 0; i < numSamples; ++i) {
+        const double s = static_cast<double>(i) / (numSamples - 1);
+        sw[i] = swc + s*(1.0 - swc - sor);
+        krw[i] = 0.6*s*s;
+        krn[i] = (1.0 - s)*(1.0 - s)*(1.0 - s);
+        pcnw[i] = 2.0*bar*(1.0 - s)*(1.0 - s);
+    }
+
+    auto twoPhaseParams = std::make_shared<TwoPhaseLaw::Params>();
+    twoPhaseParams->setKrwSamples(sw, krw);
+    twoPhaseParams->setKrnSamples(sw, krn);
+    twoPhaseParams->setPcnwSamples(sw, pcnw);
+    twoPhaseParams->finalize();
+
+    auto params = MaterialLaw::Params{};
+    params.setApproach(Opm::EclTwoPhaseApproach::OilWater);
+    params.setGasOilParams(twoPhaseParams);
+    params.setOilWaterParams(twoPhaseParams);
+    params.setGasWaterParams(twoPhaseParams);
+    params.finalize();
+
+    return params;
+}
+
+// Synthetic PVTO-like table: 20 saturated states, each with 12
+// undersaturated pressure nodes.
+Pvt makePvt()
+{
+    constexpr std::size_t numRs = 20;
+    constexpr std::size_t numP = 12;
+
+    auto pvt = Pvt{};
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 0.9, 1000.0);
+
+    auto rsSat = std::vector<std::pair<double, double>>{};
+    auto muSat = std::vector<std::pair<double, double>>{};
+    for (std::size_t i = 0; i < numRs; ++i) {
+        const auto pSat = (10.0 + 20.0*i) * bar;
+        rsSat.emplace_back(pSat, 5.0 + 8.0*i);
+        muSat.emplace_back(pSat, 2.0e-3 / (1.0 + 0.05*i));
+    }
+
+    pvt.setSaturatedOilGasDissolutionFactor(0, rsSat);
+    pvt.setSaturatedOilViscosity(0, muSat);
+
+    auto invB = Pvt::TabulatedTwoDFunction { Pvt::TabulatedTwoDFunction::LeftExtreme };
+    auto mu = Pvt::TabulatedTwoDFunction { Pvt::TabulatedTwoDFunction::LeftExtreme };
+    for (std::size_t i = 0; i < numRs; ++i) {
+        const auto [pSat, rs] = rsSat[i];
+        invB.appendXPos(rs);
+        mu.appendXPos(rs);
+
+        for (std::size_t j = 0; j < numP; ++j) {
+            const auto p = pSat + 25.0*j*bar;
+            invB.appendSamplePoint(i, p, (1.0 + 1.0e-4*rs) * (1.0 + 1.5e-10*(p - pSat)));
+            mu.appendSamplePoint(i, p, muSat[i].second * (1.0 + 4.0e-10*(p - pSat)));
+        }
+    }
+
+    pvt.setInverseOilFormationVolumeFactor(0, invB);
+    pvt.setOilViscosity(0, mu);
+    pvt.initEnd();
+
+    return pvt;
+}
+
+template <typename Function>
+double elapsedSeconds(Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>
+        { std::chrono::steady_clock::now() - start }.count();
+}
+
+double maxRelDiff(const std::vector<Eval>& a, const std::vector<Eval>& b)
+{
+    auto diff = 0.0;
+    for (std::size_t k = 0; k < a.size(); ++k) {
+        const auto scale = std::max(std::abs(a[k].value()), 1.0e-30);
+        diff = std::max(diff, std::abs(a[k].value() - b[k].value()) / scale);
+
+        for (int d = 0; d < Eval::numVars; ++d) {
+            const auto dscale = std::max(std::abs(a[k].derivative(d)), 1.0e-30);
+            diff = std::max(diff, std::abs(a[k].derivative(d) - b[k].derivative(d)) / dscale);
+        }
+    }
+
+    return diff;
+}
+
+// Batch of the cells starting at the given one.  The last batch repeats
+// the last cell in its excess lanes.
+template <class Batch>
+Batch pack(const std::vector<Eval>& cells, const std::size_t start)
+{
+    Batch batch;
+    for (int k = 0; k < Batch::numLanes; ++k) {
+        batch.setLane(k, cells[std::min(start + k, cells.size() - 1)]);
+    }
+
+    return batch;
+}
+
+template <class Batch>
+void unpack(const Batch& batch, std::vector<Eval>& cells, const std::size_t start)
+{
+    const auto n = std::min<std::size_t>(Batch::numLanes, cells.size() - start);
+    for (std::size_t k = 0; k < n; ++k) {
+        cells[start + k] = batch.lane(k);
+    }
+}
+
+void report(const std::string& name,
+            const std::size_t numCells,
+            const double refTime,
+            const double batchTime,
+            const double diff)
+{
+    std::cout << fmt::format("{}: {} cells\n", name, numCells)
+              << fmt::format("  Per cell: {:8.2f} Mcells/s\n", numCells / refTime / 1.0e6)
+              << fmt::format("  Batched:  {:8.2f} Mcells/s ({:.2f}x)\n",
+                             numCells / batchTime / 1.0e6, refTime / batchTime)
+              << fmt::format("  Max. relative difference: {:.3e}\n", diff);
+}
+
+template <int width>
+bool benchmarkSatFunc(const MaterialLaw::Params& params, const std::size_t numCells)
+{
+    using Batch = Opm::DenseAd::EvaluationBatch<double, Eval::numVars, width>;
+
+    auto rng = std::mt19937 { 1234 };
+    auto swDist = std::uniform_real_distribution<double> { 0.1, 0.9 };
+
+    auto sw = std::vector<Eval>(numCells);
+    for (auto& s : sw) {
+        s = Eval::createVariable(swDist(rng), 0);
+    }
+
+    auto krwRef = std::vector<Eval>(numCells);
+    auto krnRef = std::vector<Eval>(numCells);
+    auto pcRef = std::vector<Eval>(numCells);
+    const auto refTime = elapsedSeconds([&]()
+    {
+        auto fs = SaturationState<Eval>{};
+        auto kr = std::array<Eval, 3>{};
+        auto pc = std::array<Eval, 3>{};
+        for (std::size_t k = 0; k < numCells; ++k) {
+            fs.saturations[0] = sw[k];
+            fs.saturations[1] = 1.0 - sw[k];
+            MaterialLaw::relativePermeabilities(kr, params, fs);
+            MaterialLaw::capillaryPressures(pc, params, fs);
+            krwRef[k] = kr[0];
+            krnRef[k] = kr[1];
+            pcRef[k] = pc[1];
+        }
+    });
+
+    auto krw = std::vector<Eval>(numCells);
+    auto krn = std::vector<Eval>(numCells);
+    auto pcnw = std::vector<Eval>(numCells);
+    const auto batchTime = elapsedSeconds([&]()
+    {
+        auto fs = SaturationState<Batch>{};
+        auto kr = std::array<Batch, 3>{};
+        auto pc = std::array<Batch, 3>{};
+        for (std::size_t start = 0; start < numCells; start += width) {
+            fs.saturations[0] = pack<Batch>(sw, start);
+            fs.saturations[1] = 1.0 - fs.saturations[0];
+            MaterialLaw::relativePermeabilities(kr, params, fs);
+            MaterialLaw::capillaryPressures(pc, params, fs);
+            unpack(kr[0], krw, start);
+            unpack(kr[1], krn, start);
+            unpack(pc[1], pcnw, start);
+        }
+    });
+
+    const auto diff = std::max({ maxRelDiff(krwRef, krw),
+                                 maxRelDiff(krnRef, krn),
+                                 maxRelDiff(pcRef, pcnw) });
+
+    report(fmt::format("EclTwoPhaseMaterial, {} lanes", width), numCells, refTime, batchTime, diff);
+
+    if (diff > 1.0e-10) {
+        std::cerr << "Batched results do not match per cell results\n";
+        return false;
+    }
+
+    return true;
+}
+
+template <int width>
+bool benchmarkPvt(const Pvt& pvt, const std::size_t numCells)
+{
+    using Batch = Opm::DenseAd::EvaluationBatch<double, Eval::numVars, width>;
+
+    auto rng = std::mt19937 { 1234 };
+    auto pDist = std::uniform_real_distribution<double> { 20.0*bar, 600.0*bar };
+    auto rsDist = std::uniform_real_distribution<double> { 5.0, 150.0 };
+
+    auto T = std::vector<Eval>(numCells, Eval{ 350.0 });
+    auto p = std::vector<Eval>(numCells);
+    auto rs = std::vector<Eval>(numCells);
+    for (std::size_t k = 0; k < numCells; ++k) {
+        p[k] = Eval::createVariable(pDist(rng), 0);
+        rs[k] = Eval::createVariable(rsDist(rng), 1);
+    }
+
+    auto muRef = std::vector<Eval>(numCells);
+    auto invBRef = std::vector<Eval>(numCells);
+    const auto refTime = elapsedSeconds([&]()
+    {
+        for (std::size_t k = 0; k < numCells; ++k) {
+            muRef[k] = pvt.viscosity(0, T[k], p[k], rs[k]);
+            invBRef[k] = pvt.inverseFormationVolumeFactor(0, T[k], p[k], rs[k]);
+        }
+    });
+
+    auto mu = std::vector<Eval>(numCells);
+    auto invB = std::vector<Eval>(numCells);
+    const auto batchTime = elapsedSeconds([&]()
+    {
+        for (std::size_t start = 0; start < numCells; start += width) {
+            const auto TBatch = pack<Batch>(T, start);
+            const auto pBatch = pack<Batch>(p, start);
+            const auto rsBatch = pack<Batch>(rs, start);
+            unpack(pvt.viscosity(0, TBatch, pBatch, rsBatch), mu, start);
+            unpack(pvt.inverseFormationVolumeFactor(0, TBatch, pBatch, rsBatch), invB, start);
+        }
+    });
+
+    const auto diff = std::max(maxRelDiff(muRef, mu), maxRelDiff(invBRef, invB));
+
+    report(fmt::format("LiveOilPvt, {} lanes", width), numCells, refTime, batchTime, diff);
+
+    if (diff > 1.0e-10) {
+        std::cerr << "Batched results do not match per cell results\n";
+        return false;
+    }
+
+    return true;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    try {
+        const auto numCells = (argc > 1)
+            ? std::stoull(argv[1]) : std::size_t{1'000'000};
+
+        const auto params = makeMaterialParams();
+        const auto pvt = makePvt();
+
+        auto ok = benchmarkSatFunc<4>(params, numCells);
+        ok = benchmarkSatFunc<8>(params, numCells) && ok;
+        ok = benchmarkPvt<4>(pvt, numCells) && ok;
+        ok = benchmarkPvt<8>(pvt, numCells) && ok;
+
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+}
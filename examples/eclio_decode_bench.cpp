@@ -0,0 +1,136 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Measure decode throughput of binary DOUB arrays.
+//
+// Usage: eclio_decode_bench [number of elements (default 100000000)]
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+// Serialise 'values' in unformatted ECLIPSE record layout.
+std::vector<char> makeDoubRecords(const std::vector<double>& values)
+{
+    using namespace Opm::EclIO;
+
+    const auto maxNum = static_cast<std::size_t>(MaxBlockSizeDoub / sizeOfDoub);
+
+    std::vector<char> buffer;
+    buffer.reserve(sizeOnDiskBinary(values.size(), DOUB, sizeOfDoub));
+
+    auto append = [&buffer](const void* p, const std::size_t n)
+    {
+        const auto* c = static_cast<const char*>(p);
+        buffer.insert(buffer.end(), c, c + n);
+    };
+
+    std::vector<double> record(maxNum);
+    for (std::size_t offset = 0; offset < values.size(); offset += maxNum) {
+        const auto num = std::min(maxNum, values.size() - offset);
+        const int marker = flipEndianInt(static_cast<int>(num * sizeof(double)));
+
+        flipEndian(std::span<const double>{ values }.subspan(offset, num),
+                   std::span<double>{ record });
+
+        append(&marker, sizeof marker);
+        append(record.data(), num * sizeof(double));
+        append(&marker, sizeof marker);
+    }
+
+    return buffer;
+}
+
+template <typename Function>
+double gigabytesPerSecond(const std::size_t numBytes, Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto elapsed = std::chrono::duration<double>
+        { std::chrono::steady_clock::now() - start }.count();
+
+    return (numBytes / 1.0e9) / elapsed;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numElements = (argc > 1)
+        ? std::stoull(argv[1]) : std::size_t{100'000'000};
+
+    std::vector<double> values(numElements);
+    std::iota(values.begin(), values.end(), 0.5);
+
+    const auto buffer = makeDoubRecords(values);
+    const auto numBytes = numElements * sizeof(double);
+
+    // Reference: element-by-element conversion, as used by the previous
+    // implementation.
+    std::vector<double> scalar(numElements);
+    const auto scalarRate = gigabytesPerSecond(numBytes, [&]()
+    {
+        for (std::size_t i = 0; i < numElements; ++i) {
+            scalar[i] = Opm::EclIO::flipEndianDouble(values[i]);
+        }
+    });
+
+    std::vector<double> bulk(numElements);
+    const auto bulkRate = gigabytesPerSecond(numBytes, [&]()
+    {
+        Opm::EclIO::flipEndian(std::span<const double>{ values }, std::span<double>{ bulk });
+    });
+
+    std::vector<double> decoded;
+    const auto decodeRate = gigabytesPerSecond(numBytes, [&]()
+    {
+        decoded = Opm::EclIO::readBinaryDoubArray(std::span<const char>{ buffer },
+                                                  static_cast<std::int64_t>(numElements));
+    });
+
+    if ((decoded != values) ||
+        (std::memcmp(scalar.data(), bulk.data(), numBytes) != 0))
+    {
+        std::cerr << "Decoded values do not match input\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << fmt::format("DOUB array of {} elements ({:.2f} GB)\n",
+                             numElements, numBytes / 1.0e9)
+              << fmt::format("  Per-element flipEndianDouble: {:8.2f} GB/s\n", scalarRate)
+              << fmt::format("  Bulk flipEndian kernel:       {:8.2f} GB/s\n", bulkRate)
+              << fmt::format("  readBinaryDoubArray (memory): {:8.2f} GB/s\n", decodeRate);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,199 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Compare per-cell and batched inference of a neural network with ten
+// dense layers.
+//
+// Usage: ml_batch_bench [number of cells (default 1000000)]
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/ml/ml_model.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+constexpr int numInputs = 3;
+constexpr int numOutputs = 2;
+constexpr int numHidden = 32;
+constexpr int numLayers = 10;
+
+template <typename T>
+void write(std::ofstream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+// Model with random weights in the format written by kerasify: ten dense
+// layers, with ReLU activation on all but the last one.
+void writeModel(const std::filesystem::path& fname)
+{
+    auto rng = std::mt19937 { 4321 };
+
+    std::ofstream os(fname, std::ios::binary);
+    write(os, static_cast<unsigned int>(numLayers));
+
+    for (int layer = 0; layer < numLayers; ++layer) {
+        const auto rows = (layer == 0) ? numInputs : numHidden;
+        const auto cols = (layer == numLayers - 1) ? numOutputs : numHidden;
+
+        auto weight = std::normal_distribution<float> { 0.0f, std::sqrt(2.0f / rows) };
+
+        write(os, static_cast<unsigned int>(3)); // Dense
+        write(os, static_cast<unsigned int>(rows));
+        write(os, static_cast<unsigned int>(cols));
+        write(os, static_cast<unsigned int>(cols));
+        for (int k = 0; k < rows*cols; ++k) {
+            write(os, weight(rng));
+        }
+        for (int k = 0; k < cols; ++k) {
+            write(os, 0.01f*weight(rng));
+        }
+
+        const auto activation = (layer == numLayers - 1)
+            ? Opm::ML::ActivationType::kLinear
+            : Opm::ML::ActivationType::kRelu;
+        write(os, static_cast<unsigned int>(activation));
+    }
+}
+
+template <typename Function>
+double elapsedSeconds(Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>
+        { std::chrono::steady_clock::now() - start }.count();
+}
+
+template <class Evaluation>
+double maxRelDiff(const std::vector<Evaluation>& a,
+                  const std::vector<Evaluation>& b)
+{
+    auto diff = 0.0;
+    for (std::size_t k = 0; k < a.size(); ++k) {
+        const double scale = std::max<double>(std::abs(Opm::getValue(a[k])), 1.0);
+        diff = std::max<double>(diff, std::abs(Opm::getValue(a[k] - b[k])) / scale);
+
+        if constexpr (! std::is_floating_point_v<Evaluation>) {
+            for (int d = 0; d < Evaluation::numVars; ++d) {
+                const auto dscale = std::max(std::abs(a[k].derivative(d)), 1.0);
+                diff = std::max(diff, std::abs(a[k].derivative(d) - b[k].derivative(d)) / dscale);
+            }
+        }
+    }
+
+    return diff;
+}
+
+template <class Evaluation>
+bool benchmark(const std::string& name,
+               const std::filesystem::path& modelFile,
+               const int numCells)
+{
+    auto model = Opm::ML::NNModel<Evaluation>{};
+    model.loadModel(modelFile.string());
+
+    auto rng = std::mt19937 { 1234 };
+    auto dist = std::uniform_real_distribution<double> { -1.0, 1.0 };
+
+    auto in = Opm::ML::Tensor<Evaluation>(numCells, numInputs);
+    for (int cell = 0; cell < numCells; ++cell) {
+        for (int i = 0; i < numInputs; ++i) {
+            in(cell, i) = dist(rng);
+            if constexpr (! std::is_floating_point_v<Evaluation>) {
+                in(cell, i).setDerivative(i, 1.0);
+            }
+        }
+    }
+
+    auto ref = std::vector<Evaluation>(static_cast<std::size_t>(numCells) * numOutputs);
+    const auto refTime = elapsedSeconds([&]()
+    {
+        auto cellIn = Opm::ML::Tensor<Evaluation>(numInputs);
+        auto cellOut = Opm::ML::Tensor<Evaluation>(numOutputs);
+        for (int cell = 0; cell < numCells; ++cell) {
+            std::copy_n(in.data_.begin() + cell*numInputs, numInputs, cellIn.data_.begin());
+            model.apply(cellIn, cellOut);
+            std::ranges::copy(cellOut.data_, ref.begin() + cell*numOutputs);
+        }
+    });
+
+    auto out = Opm::ML::Tensor<Evaluation>{};
+    const auto batchTime = elapsedSeconds([&]() { model.applyBatch(in, out); });
+
+    const auto diff = maxRelDiff(ref, out.data_);
+    const auto tolerance = std::is_same_v<typename Opm::MathToolbox<Evaluation>::Scalar, float>
+        ? 1.0e-4 : 1.0e-10;
+
+    std::cout << fmt::format("{}: {} cells, {} dense layers\n", name, numCells, numLayers)
+              << fmt::format("  Per cell: {:8.3f} Mcells/s\n", numCells / refTime / 1.0e6)
+              << fmt::format("  Batched:  {:8.3f} Mcells/s ({:.2f}x)\n",
+                             numCells / batchTime / 1.0e6, refTime / batchTime)
+              << fmt::format("  Max. relative difference: {:.3e}\n", diff);
+
+    if (diff > tolerance) {
+        std::cerr << "Batched results do not match per cell results\n";
+        return false;
+    }
+
+    return true;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const auto modelFile = std::filesystem::temp_directory_path()
+        / fmt::format("ml_batch_bench-{:08x}.model", std::random_device{}());
+
+    try {
+        const auto numCells = (argc > 1) ? std::stoi(argv[1]) : 1'000'000;
+
+        writeModel(modelFile);
+
+        auto ok = benchmark<float>("float", modelFile, numCells);
+        ok = benchmark<double>("double", modelFile, numCells) && ok;
+        ok = benchmark<Opm::DenseAd::Evaluation<double, 3>>("Evaluation<double,3>", modelFile, numCells) && ok;
+
+        std::filesystem::remove(modelFile);
+
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const std::exception& e) {
+        std::filesystem::remove(modelFile);
+        std::cerr << "Error: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+}
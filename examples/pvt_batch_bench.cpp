@@ -0,0 +1,197 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Compare per-cell and batched evaluation of live oil viscosity and
+// inverse formation volume factor.
+//
+// Usage: pvt_batch_bench [number of cells (default 1000000)]
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/LiveOilPvt.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+using Pvt = Opm::LiveOilPvt<double>;
+
+constexpr double bar = 1.0e5;
+
+// Synthetic PVTO-like table: 20 saturated states, each with 12
+// undersaturated pressure nodes.
+Pvt makePvt()
+{
+    constexpr std::size_t numRs = 20;
+    constexpr std::size_t numP = 12;
+
+    auto pvt = Pvt{};
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 0.9, 1000.0);
+
+    auto rsSat = std::vector<std::pair<double, double>>{};
+    auto muSat = std::vector<std::pair<double, double>>{};
+    for (std::size_t i = 0; i < numRs; ++i) {
+        const auto pSat = (10.0 + 20.0*i) * bar;
+        rsSat.emplace_back(pSat, 5.0 + 8.0*i);
+        muSat.emplace_back(pSat, 2.0e-3 / (1.0 + 0.05*i));
+    }
+
+    pvt.setSaturatedOilGasDissolutionFactor(0, rsSat);
+    pvt.setSaturatedOilViscosity(0, muSat);
+
+    auto invB = Pvt::TabulatedTwoDFunction { Pvt::TabulatedTwoDFunction::LeftExtreme };
+    auto mu = Pvt::TabulatedTwoDFunction { Pvt::TabulatedTwoDFunction::LeftExtreme };
+    for (std::size_t i = 0; i < numRs; ++i) {
+        const auto [pSat, rs] = rsSat[i];
+        invB.appendXPos(rs);
+        mu.appendXPos(rs);
+
+        for (std::size_t j = 0; j < numP; ++j) {
+            const auto p = pSat + 25.0*j*bar;
+            invB.appendSamplePoint(i, p, (1.0 + 1.0e-4*rs) * (1.0 + 1.5e-10*(p - pSat)));
+            mu.appendSamplePoint(i, p, muSat[i].second * (1.0 + 4.0e-10*(p - pSat)));
+        }
+    }
+
+    pvt.setInverseOilFormationVolumeFactor(0, invB);
+    pvt.setOilViscosity(0, mu);
+    pvt.initEnd();
+
+    return pvt;
+}
+
+template <typename Function>
+double elapsedSeconds(Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>
+        { std::chrono::steady_clock::now() - start }.count();
+}
+
+template <class Evaluation>
+double maxRelDiff(const std::vector<Evaluation>& a,
+                  const std::vector<Evaluation>& b)
+{
+    auto diff = 0.0;
+    for (std::size_t k = 0; k < a.size(); ++k) {
+        const auto scale = std::max(std::abs(Opm::getValue(a[k])), 1.0e-30);
+        diff = std::max(diff, std::abs(Opm::getValue(a[k] - b[k])) / scale);
+
+        if constexpr (! std::is_floating_point_v<Evaluation>) {
+            for (int d = 0; d < Evaluation::numVars; ++d) {
+                const auto dscale = std::max(std::abs(a[k].derivative(d)), 1.0e-30);
+                diff = std::max(diff, std::abs(a[k].derivative(d) - b[k].derivative(d)) / dscale);
+            }
+        }
+    }
+
+    return diff;
+}
+
+template <class Evaluation>
+bool benchmark(const std::string& name, const Pvt& pvt, const std::size_t numCells)
+{
+    auto rng = std::mt19937 { 1234 };
+    auto pDist = std::uniform_real_distribution<double> { 20.0*bar, 600.0*bar };
+    auto rsDist = std::uniform_real_distribution<double> { 5.0, 150.0 };
+
+    auto T = std::vector<Evaluation>(numCells, Evaluation{ 350.0 });
+    auto p = std::vector<Evaluation>(numCells);
+    auto rs = std::vector<Evaluation>(numCells);
+    for (std::size_t k = 0; k < numCells; ++k) {
+        p[k] = pDist(rng);
+        rs[k] = rsDist(rng);
+        if constexpr (! std::is_floating_point_v<Evaluation>) {
+            p[k].setDerivative(0, 1.0);
+            rs[k].setDerivative(1, 1.0);
+        }
+    }
+
+    auto muRef = std::vector<Evaluation>(numCells);
+    auto invBRef = std::vector<Evaluation>(numCells);
+    const auto refTime = elapsedSeconds([&]()
+    {
+        for (std::size_t k = 0; k < numCells; ++k) {
+            muRef[k] = pvt.viscosity(0, T[k], p[k], rs[k]);
+            invBRef[k] = pvt.inverseFormationVolumeFactor(0, T[k], p[k], rs[k]);
+        }
+    });
+
+    auto mu = std::vector<Evaluation>(numCells);
+    auto invB = std::vector<Evaluation>(numCells);
+    const auto batchTime = elapsedSeconds([&]()
+    {
+        pvt.viscosity(0, std::span<const Evaluation>{T}, std::span<const Evaluation>{p},
+                      std::span<const Evaluation>{rs}, std::span<Evaluation>{mu});
+        pvt.inverseFormationVolumeFactor(0, std::span<const Evaluation>{T}, std::span<const Evaluation>{p},
+                                         std::span<const Evaluation>{rs}, std::span<Evaluation>{invB});
+    });
+
+    const auto diff = std::max(maxRelDiff(muRef, mu), maxRelDiff(invBRef, invB));
+
+    std::cout << fmt::format("{}: {} cells\n", name, numCells)
+              << fmt::format("  Per cell: {:8.2f} Mcells/s\n", numCells / refTime / 1.0e6)
+              << fmt::format("  Batched:  {:8.2f} Mcells/s ({:.2f}x)\n",
+                             numCells / batchTime / 1.0e6, refTime / batchTime)
+              << fmt::format("  Max. relative difference: {:.3e}\n", diff);
+
+    if (diff > 1.0e-12) {
+        std::cerr << "Batched results do not match per cell results\n";
+        return false;
+    }
+
+    return true;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    try {
+        const auto numCells = (argc > 1)
+            ? std::stoull(argv[1]) : std::size_t{1'000'000};
+
+        const auto pvt = makePvt();
+
+        auto ok = benchmark<double>("double", pvt, numCells);
+        ok = benchmark<Opm::DenseAd::Evaluation<double, 3>>("Evaluation<double,3>", pvt, numCells) && ok;
+
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+}
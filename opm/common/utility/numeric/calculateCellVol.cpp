@@ -124,13 +124,26 @@ double calculateCellVol(const std::array<double,8>& X,
     double volume = 0.0;
     const double* vect[3];
     const std::array<std::array<double,8>,3> data = {{X, Y, Z}};
+
+    // The expansion coefficients C(i1,i2,i3) of each coordinate direction,
+    // indexed by i1 + 2*i2 + 4*i3, are used many times over in the sum
+    // below.  Compute them once up front.
+    std::array<std::array<double,8>,3> coeff;
+    for (std::size_t dir = 0; dir < 3; dir++) {
+        for (int g = 0; g < 8; g++) {
+            coeff[dir][g] = C(data[dir].data(), g & 1, (g >> 1) & 1, g >> 2);
+        }
+    }
+
     double perm_sign = 1;
     for (const auto& perm : permutation) {
         for (std::size_t perm_index = 0; perm_index < 3; perm_index++)
-            vect[perm_index] = data[perm[perm_index]].data();
+            vect[perm_index] = coeff[perm[perm_index]].data();
 
         for (const auto& pqr : pqr_array) {
-            const double cprod = C(vect[0], 1, pqr.pb, pqr.pg)*C(vect[1], pqr.qa, 1, pqr.qg)*C(vect[2], pqr.ra, pqr.rb, 1);
+            const double cprod = vect[0][1 + 2*pqr.pb + 4*pqr.pg]
+                * vect[1][pqr.qa + 2 + 4*pqr.qg]
+                * vect[2][pqr.ra + 2*pqr.rb + 4];
             const double denom = (pqr.qa + pqr.ra + 1) * (pqr.pb + pqr.rb + 1) * (pqr.pg + pqr.qg + 1);
             volume += perm_sign * cprod / denom;
         }
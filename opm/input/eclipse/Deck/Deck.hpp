@@ -104,6 +104,7 @@ namespace Opm {
                 serializer(activeUnits);
                 serializer(m_dataFile);
                 serializer(input_path);
+                serializer(file_tree);
                 serializer(unit_system_access_count);
             }
 
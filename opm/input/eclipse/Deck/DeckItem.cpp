@@ -28,12 +28,96 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace {
+
+/// Process-wide set of immutable values.  Elements are never removed, so
+/// their addresses remain valid until program exit.
+///
+/// Look-ups first consult a per-thread cache, so interning a value which
+/// has been seen before on the same thread does not lock.
+template <typename T, typename Hash = std::hash<T>>
+class InternPool
+{
+public:
+    static const T* intern(const T& value)
+    {
+        thread_local std::unordered_map<T, const T*, Hash> cache{};
+
+        auto pos = cache.find(value);
+        if (pos == cache.end()) {
+            pos = cache.emplace(value, instance().insert(value)).first;
+        }
+
+        return pos->second;
+    }
+
+private:
+    std::mutex mutex_{};
+    std::unordered_set<T, Hash> values_{};
+
+    static InternPool& instance()
+    {
+        static InternPool pool{};
+        return pool;
+    }
+
+    const T* insert(const T& value)
+    {
+        std::lock_guard lock { this->mutex_ };
+        return &*this->values_.insert(value).first;
+    }
+};
+
+/// Hash function consistent with Dimension::operator==(), which treats
+/// all dimensions with a NaN scaling factor as equal.  Those are the
+/// context dependent dimensions, whose getSIScaling() throws, so they are
+/// identified by comparison instead.
+struct DimensionsHash
+{
+    std::size_t operator()(const std::vector<Opm::Dimension>& dimensions) const
+    {
+        static const auto contextDependent =
+            Opm::Dimension { std::numeric_limits<double>::quiet_NaN() };
+
+        auto seed = dimensions.size();
+
+        for (const auto& dim : dimensions) {
+            const auto h = (dim == contextDependent)
+                ? std::size_t{0x9e3779b9}
+                : std::hash<double>{}(dim.getSIScaling()) ^ (std::hash<double>{}(dim.getSIOffset()) << 1);
+
+            seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+};
+
+} // Anonymous namespace
 
 namespace Opm {
 
+const std::string* DeckItem::intern(const std::string& name)
+{
+    return InternPool<std::string>::intern(name);
+}
+
+const std::vector<Dimension>* DeckItem::intern(const std::vector<Dimension>& dimensions)
+{
+    return InternPool<std::vector<Dimension>, DimensionsHash>::intern(dimensions);
+}
+
 template< typename T >
 std::vector< T >& DeckItem::value_ref() {
     return const_cast< std::vector< T >& >(
@@ -46,13 +130,13 @@ const std::vector< int >& DeckItem::value_ref< int >() const {
     if( this->type != get_type< int >() )
         throw std::invalid_argument( "DeckItem::value_ref<int> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->ival;
+    return std::get< std::vector< int > >(this->values);
 }
 
 template<>
 const std::vector< double >& DeckItem::value_ref< double >() const {
     if (this->type == get_type<double>())
-        return this->dval;
+        return std::get< std::vector< double > >(this->values);
 
     throw std::invalid_argument( "DeckItem::value_ref<double> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 }
@@ -62,7 +146,7 @@ const std::vector< std::string >& DeckItem::value_ref< std::string >() const {
     if( this->type != get_type< std::string >() )
         throw std::invalid_argument( "DeckItem::value_ref<std::string> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->sval;
+    return std::get< std::vector< std::string > >(this->values);
 }
 
 template<>
@@ -70,7 +154,7 @@ const std::vector< RawString >& DeckItem::value_ref< RawString >() const {
     if( this->type != get_type< RawString >() )
         throw std::invalid_argument( "DeckItem::value_ref<RawString> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->rsval;
+    return std::get< std::vector< RawString > >(this->values);
 }
 
 template<>
@@ -78,58 +162,60 @@ const std::vector< UDAValue >& DeckItem::value_ref< UDAValue >() const {
     if( this->type != get_type< UDAValue >() )
         throw std::invalid_argument( "DeckItem::value_ref<UDAValue> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->uval;
+    return std::get< std::vector< UDAValue > >(this->values);
 }
 
 
 DeckItem::DeckItem( const std::string& nm, int) :
+    values( std::in_place_type< std::vector< int > > ),
     type( get_type< int >() ),
-    item_name( nm )
+    item_name( intern(nm) )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, std::string) :
+    values( std::in_place_type< std::vector< std::string > > ),
     type( get_type< std::string >() ),
-    item_name( nm )
+    item_name( intern(nm) )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, RawString) :
+    values( std::in_place_type< std::vector< RawString > > ),
     type( get_type< RawString >() ),
-    item_name( nm )
+    item_name( intern(nm) )
 {
 }
 
 
 DeckItem::DeckItem( const std::string& nm, double, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    values( std::in_place_type< std::vector< double > > ),
     type( get_type< double >() ),
-    item_name( nm ),
-    active_dimensions(active_dim),
-    default_dimensions(default_dim)
+    item_name( intern(nm) ),
+    active_dimensions( intern(active_dim) ),
+    default_dimensions( intern(default_dim) )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, UDAValue, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    values( std::in_place_type< std::vector< UDAValue > > ),
     type( get_type< UDAValue >() ),
-    item_name( nm ),
-    active_dimensions(active_dim),
-    default_dimensions(default_dim)
+    item_name( intern(nm) ),
+    active_dimensions( intern(active_dim) ),
+    default_dimensions( intern(default_dim) )
 {
 }
 
 DeckItem DeckItem::serializationTestObject()
 {
     DeckItem result;
-    result.dval = {1.0};
-    result.ival = {2};
-    result.sval = {"test1"};
-    result.uval = {UDAValue(3.0)};
+    result.values = std::vector<std::string>{"test1"};
     result.type = type_tag::string;
-    result.item_name = "test2";
+    result.item_name = intern("test2");
     result.value_status = {value::status::deck_value};
     result.raw_data = false;
-    result.active_dimensions = {Dimension::serializationTestObject()};
-    result.default_dimensions = {Dimension::serializationTestObject()};
+    result.active_dimensions = intern({Dimension::serializationTestObject()});
+    result.default_dimensions = intern({Dimension::serializationTestObject()});
 
     return result;
 }
@@ -138,11 +224,7 @@ DeckItem DeckItem::emptyStructuralCopy() const
 {
     auto ret = *this;
 
-    ret.dval .clear();
-    ret.ival .clear();
-    ret.sval .clear();
-    ret.rsval.clear();
-    ret.uval .clear();
+    std::visit([](auto& v) { v.clear(); }, ret.values);
 
     ret.value_status.clear();
     ret.raw_data = true;
@@ -151,7 +233,7 @@ DeckItem DeckItem::emptyStructuralCopy() const
 }
 
 const std::string& DeckItem::name() const {
-    return this->item_name;
+    return *this->item_name;
 }
 
 bool DeckItem::defaultApplied( std::size_t index ) const {
@@ -188,36 +270,38 @@ T DeckItem::get( std::size_t index ) const {
 template<>
 UDAValue DeckItem::get( std::size_t index ) const {
     auto value = this->value_ref<UDAValue>().at(index);
-    if (this->active_dimensions.empty())
+    const auto& active_dims = *this->active_dimensions;
+    if (active_dims.empty())
         return value;
 
     // The UDA value held internally by the DeckItem does not have dimension set
     // correctly we therefor need to create a new one with the correct dimension
     // attached before returning.
-    std::size_t dim_index = index % this->active_dimensions.size();
+    const auto& default_dims = *this->default_dimensions;
+    std::size_t dim_index = index % active_dims.size();
     if (value::defaulted(this->value_status[index])) {
         if (value.is<std::string>())
-            return UDAValue(value.get<std::string>(), this->default_dimensions[dim_index]);
+            return UDAValue(value.get<std::string>(), default_dims[dim_index]);
         else
-            return UDAValue(this->default_dimensions[dim_index]);
+            return UDAValue(default_dims[dim_index]);
     } else {
         if (value.is<std::string>())
-            return UDAValue(value.get<std::string>(), this->active_dimensions[dim_index]);
+            return UDAValue(value.get<std::string>(), active_dims[dim_index]);
         else if (value.is<double>())
-            return UDAValue(value.get<double>(), this->active_dimensions[dim_index]);
+            return UDAValue(value.get<double>(), active_dims[dim_index]);
         else
-            return UDAValue(this->active_dimensions[dim_index]);
+            return UDAValue(active_dims[dim_index]);
     }
 }
 
 template <>
 void DeckItem::shrink_to_fit<int>() {
-    this->ival.shrink_to_fit();
+    this->value_ref<int>().shrink_to_fit();
 }
 
 template <>
 void DeckItem::shrink_to_fit<double>() {
-    this->dval.shrink_to_fit();
+    this->value_ref<double>().shrink_to_fit();
 }
 
 template <typename T>
@@ -336,14 +420,14 @@ const std::vector<double>& DeckItem::getData() const {
     if (this->raw_data)
         return data;
 
-    const auto dim_size = this->active_dimensions.size();
+    const auto dim_size = this->active_dimensions->size();
     for( std::size_t index = 0; index < data.size(); index++ ) {
         const auto dimIndex = index % dim_size;
         if (value::defaulted(this->value_status[index])) {
-            const auto& dim = this->default_dimensions[dimIndex];
+            const auto& dim = (*this->default_dimensions)[dimIndex];
             data[ index ] = dim.convertSiToRaw( data[ index ] );
         } else {
-            const auto& dim = this->active_dimensions[dimIndex];
+            const auto& dim = (*this->active_dimensions)[dimIndex];
             data[ index ] = dim.convertSiToRaw( data[ index ] );
         }
     }
@@ -358,7 +442,7 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
         return data;
     }
 
-    if (this->active_dimensions.empty()) {
+    if (this->active_dimensions->empty()) {
         throw std::invalid_argument {
             "No dimension defined for item '"
             + this->name()
@@ -369,12 +453,12 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
     // This is an unobservable state change - SIData is lazily converted to
     // SI units, so externally the object still behaves as const.
 
-    const auto dim_size = this->active_dimensions.size();
+    const auto dim_size = this->active_dimensions->size();
     const auto sz = data.size();
     for (auto index = 0*sz; index < sz; ++index) {
         const auto& dim = value::defaulted(this->value_status[index])
-            ? this->default_dimensions
-            : this->active_dimensions;
+            ? *this->default_dimensions
+            : *this->active_dimensions;
 
         data[index] = dim[index % dim_size].convertRawToSi(data[index]);
     }
@@ -405,7 +489,7 @@ void DeckItem::write_vector(DeckOutput& stream, const std::vector<T>& data) cons
 void DeckItem::write(DeckOutput& stream) const {
     switch( this->type ) {
     case type_tag::integer:
-        this->write_vector( stream, this->ival );
+        this->write_vector( stream, this->value_ref< int >() );
         break;
     case type_tag::fdouble:
         {
@@ -414,13 +498,13 @@ void DeckItem::write(DeckOutput& stream) const {
             break;
         }
     case type_tag::string:
-        this->write_vector( stream,  this->sval );
+        this->write_vector( stream,  this->value_ref< std::string >() );
         break;
     case type_tag::raw_string:
-        this->write_vector( stream,  this->rsval );
+        this->write_vector( stream,  this->value_ref< RawString >() );
         break;
     case type_tag::uda:
-        this->write_vector( stream,  this->uval );
+        this->write_vector( stream,  this->value_ref< UDAValue >() );
         break;
     default:
         throw std::logic_error( "DeckItem::write: Type not set." );
@@ -457,7 +541,7 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
     if (this->data_size() != other.data_size())
         return false;
 
-    if (this->item_name != other.item_name)
+    if (this->name() != other.name())
         return false;
 
     if (cmp_default)
@@ -466,11 +550,11 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
 
     switch( this->type ) {
     case type_tag::integer:
-        if (this->ival != other.ival)
+        if (this->value_ref< int >() != other.value_ref< int >())
             return false;
         break;
     case type_tag::string:
-        if (this->sval != other.sval)
+        if (this->value_ref< std::string >() != other.value_ref< std::string >())
             return false;
         break;
     case type_tag::fdouble:
@@ -485,7 +569,7 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
             }
         } else {
             if (this->raw_data == other.raw_data)
-                return (this->dval == other.dval);
+                return (this->value_ref< double >() == other.value_ref< double >());
             else {
                 const auto& this_data = this->getData<double>();
                 const auto& other_data = other.getData<double>();
@@ -549,7 +633,15 @@ bool DeckItem::to_bool(std::string string_value) {
 
 void DeckItem::reserve_additionalRawString(std::size_t n)
 {
-    this->rsval.reserve(rsval.size() + n);
+    if (auto* rsval = std::get_if< std::vector< RawString > >(&this->values); rsval != nullptr) {
+        rsval->reserve(rsval->size() + n);
+    }
+}
+
+void DeckItem::reserve_additional(std::size_t n)
+{
+    std::visit([n](auto& values) { values.reserve(values.size() + n); }, this->values);
+    this->value_status.reserve(this->value_status.size() + n);
 }
 
 /*
@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace Opm {
@@ -81,7 +82,7 @@ namespace Opm {
         const std::vector<value::status>& getValueStatus() const;
         const std::vector<Dimension>& getActiveDimensions() const
         {
-            return this->active_dimensions;
+            return *this->active_dimensions;
         }
 
         template< typename T>
@@ -137,45 +138,70 @@ namespace Opm {
         bool is_string() { return  type == get_type< std::string >(); };
         bool is_raw_string() { return  type == get_type< RawString >(); };
 
-        UDAValue& get_uda() { return uval[0]; };
+        UDAValue& get_uda() { return std::get<std::vector<UDAValue>>(values)[0]; };
 
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
-            serializer(dval);
-            serializer(ival);
-            serializer(sval);
-            serializer(rsval);
-            serializer(uval);
+            // Interned members are serialized by value.
+            auto name = *this->item_name;
+            auto active_dims = *this->active_dimensions;
+            auto default_dims = *this->default_dimensions;
+
+            serializer(values);
             serializer(type);
-            serializer(item_name);
+            serializer(name);
             serializer(value_status);
             serializer(raw_data);
-            serializer(active_dimensions);
-            serializer(default_dimensions);
+            serializer(active_dims);
+            serializer(default_dims);
+
+            if (! serializer.isSerializing()) {
+                this->item_name = intern(name);
+                this->active_dimensions = intern(active_dims);
+                this->default_dimensions = intern(default_dims);
+            }
         }
 
         void reserve_additionalRawString(std::size_t);
 
+        /// Reserve space for at least n more values, and their status
+        /// flags, of the item's value type.
+        void reserve_additional(std::size_t n);
+
     private:
-        mutable std::vector< double > dval;
-        std::vector< int > ival;
-        std::vector< std::string > sval;
-        std::vector< RawString > rsval;
-        std::vector< UDAValue > uval;
+        /*
+          Item values.  Only the alternative matching 'type' is ever
+          populated, so a single vector is stored rather than one vector
+          per value type.
+
+          To save space we mutate the double values in place when asking
+          for SI data; the current state of the double values is tracked
+          with the raw_data bool member.
+        */
+        mutable std::variant< std::vector< int >,
+                              std::vector< double >,
+                              std::vector< std::string >,
+                              std::vector< RawString >,
+                              std::vector< UDAValue > > values;
 
         type_tag type = type_tag::unknown;
+        mutable bool raw_data = true;
 
-        std::string item_name;
         std::vector<value::status> value_status;
+
         /*
-          To save space we mutate the dval object in place when asking for SI
-          data; the current state of of the dval member is tracked with the
-          raw_data bool member.
+          Item names and dimensions are shared by all items created from
+          the same parser item, typically many thousands of records, so
+          they are interned.  Interned objects are immutable and live
+          until program exit.
         */
-        mutable bool raw_data = true;
-        std::vector< Dimension > active_dimensions;
-        std::vector< Dimension > default_dimensions;
+        const std::string* item_name = intern(std::string{});
+        const std::vector< Dimension >* active_dimensions = intern(std::vector<Dimension>{});
+        const std::vector< Dimension >* default_dimensions = intern(std::vector<Dimension>{});
+
+        static const std::string* intern(const std::string& name);
+        static const std::vector< Dimension >* intern(const std::vector< Dimension >& dimensions);
 
         template< typename T > std::vector< T >& value_ref();
         template< typename T > const std::vector< T >& value_ref() const;
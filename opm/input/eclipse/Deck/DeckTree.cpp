@@ -19,6 +19,8 @@
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 
 #include <filesystem>
+#include <string>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -93,6 +95,15 @@ void DeckTree::add_include(std::string parent_file, std::string include_file) {
     parent_node.add_include( include_file );
 }
 
+std::vector<std::string> DeckTree::files() const {
+    std::vector<std::string> fnames;
+    fnames.reserve(this->nodes.size());
+    for (const auto& node : this->nodes)
+        fnames.push_back(node.first);
+
+    return fnames;
+}
+
 bool DeckTree::has_include(const std::string& fname) const {
     const auto fileIt = this->nodes.find(fname);
     return (fileIt != this->nodes.end()) && !fileIt->second.include_files.empty();
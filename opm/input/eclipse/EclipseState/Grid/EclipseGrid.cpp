@@ -101,6 +101,48 @@ void apply_GRIDUNIT(const UnitSystem& deck_units, const UnitSystem& grid_units,
                            [scale_factor](const auto& v) { return v * scale_factor; });
 }
 
+std::array<double, 3> cell_center(const std::array<double,8>& X,
+                                  const std::array<double,8>& Y,
+                                  const std::array<double,8>& Z)
+{
+    return { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+             std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+             std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 };
+}
+
+std::array<double, 3> cell_dims(const std::array<double,8>& X,
+                                const std::array<double,8>& Y,
+                                const std::array<double,8>& Z)
+{
+    // calculate dx
+    double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+    double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+    double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+    double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+    const double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+
+    // calculate dy
+    x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+    y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+    x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+    y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+    const double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+
+    // calculate dz
+    const double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    const double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    const double dz = z2-z1;
+
+    return {dx, dy, dz};
+}
+
+double cell_depth(const std::array<double,8>& Z)
+{
+    const double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    const double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return (z1 + z2)/2.0;
+}
+
 }
 EclipseGrid::EclipseGrid()
     : GridDims(),
@@ -155,7 +197,6 @@ EclipseGrid::EclipseGrid(const GridDims& gd)
       m_pinchMaxEmptyGap(ParserKeywords::PINCH::MAX_EMPTY_GAP::defaultValue)
 {
     this->m_nactive = this->getCartesianSize();
-    this->active_volume = std::nullopt;
     // Nothing else initialized. Leaving in particular as empty:
     // m_actnum,
     // m_global_to_active,
@@ -1554,54 +1595,116 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return m_minpvMode == MinpvMode::Inactive || cell_porv >= m_minpvVector[globalIndex];
     }
 
-    const std::vector<double>& EclipseGrid::activeVolume() const {
-        if (!this->active_volume.has_value()) {
-            std::vector<double> volume(this->m_nactive);
-
-            #pragma omp parallel for schedule(static)
-            for (std::int64_t active_index = 0; active_index < static_cast<std::int64_t>(this->m_active_to_global.size()); active_index++) {
-                std::array<double,8> X;
-                std::array<double,8> Y;
-                std::array<double,8> Z;
-                auto global_index = this->m_active_to_global[active_index];
-                this->getCellCorners(global_index, X, Y, Z );
-                if (m_rv && m_thetav) {
-                    const auto[i,j,k] = this->getIJK(global_index);
-                    const auto& r = *m_rv;
-                    const auto& t = *m_thetav;
-                    volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-                } else
-                    volume[active_index] = calculateCellVol(X, Y, Z);
-            }
+    template <typename CellFunction>
+    void EclipseGrid::forEachActiveCell(CellFunction&& cellFunction) const {
+        const auto dims = this->getNXYZ();
+
+        #pragma omp parallel for schedule(static)
+        for (std::int64_t active_index = 0; active_index < static_cast<std::int64_t>(this->m_active_to_global.size()); active_index++) {
+            std::array<double,8> X;
+            std::array<double,8> Y;
+            std::array<double,8> Z;
+            const auto global_index = this->m_active_to_global[active_index];
+            this->getCellCorners(this->getIJK(global_index), dims, X, Y, Z);
+            cellFunction(static_cast<std::size_t>(active_index),
+                         static_cast<std::size_t>(global_index), X, Y, Z);
+        }
+    }
 
-            this->active_volume = std::move(volume);
+    std::array<std::vector<double>, 3> EclipseGrid::activeCellDims() const {
+        std::array<std::vector<double>, 3> cellDims;
+        for (auto& v : cellDims) {
+            v.resize(this->m_nactive);
         }
 
-        return this->active_volume.value();
+        this->forEachActiveCell([&cellDims](const std::size_t active_index,
+                                            const std::size_t,
+                                            const auto& X, const auto& Y, const auto& Z)
+        {
+            const auto cdims = cell_dims(X, Y, Z);
+            for (std::size_t d = 0; d < 3; ++d) {
+                cellDims[d][active_index] = cdims[d];
+            }
+        });
+
+        return cellDims;
     }
 
+    std::vector<double> EclipseGrid::activeCellDepth() const {
+        auto depth = std::vector<double>{};
 
-    double EclipseGrid::getCellVolume(std::size_t globalIndex) const {
-        assertGlobalIndex( globalIndex );
-        if (this->cellActive(globalIndex) && this->active_volume.has_value()) {
-            auto active_index = this->activeIndex(globalIndex);
-            return this->active_volume.value()[active_index];
+        if (this->m_depth.has_value()) {
+            depth = *this->m_depth;
+        }
+        else {
+            depth.resize(this->m_nactive);
+            this->forEachActiveCell([&depth](const std::size_t active_index,
+                                             const std::size_t,
+                                             const auto&, const auto&, const auto& Z)
+            {
+                depth[active_index] = cell_depth(Z);
+            });
         }
 
-        std::array<double,8> X;
-        std::array<double,8> Y;
-        std::array<double,8> Z;
-        this->getCellCorners(globalIndex, X, Y, Z );
+        for (const auto& [global_index, aquifer_depth] : this->m_aquifer_cell_depths) {
+            if (const auto active_index = this->m_global_to_active[global_index];
+                active_index >= 0)
+            {
+                depth[active_index] = aquifer_depth;
+            }
+        }
+
+        return depth;
+    }
+
+    const std::vector<double>& EclipseGrid::activeVolume() const {
+        auto& cache = *this->active_volume;
+        std::call_once(cache.computed, [this, &cache]()
+        {
+            cache.volume.resize(this->m_nactive);
+
+            this->forEachActiveCell([this, &cache](const std::size_t active_index,
+                                                   const std::size_t global_index,
+                                                   const auto& X, const auto& Y, const auto& Z)
+            {
+                cache.volume[active_index] = this->cellVolume(global_index, X, Y, Z);
+            });
+
+            cache.ready.store(true, std::memory_order_release);
+        });
+
+        return cache.volume;
+    }
+
+    double EclipseGrid::cellVolume(std::size_t globalIndex,
+                                   const std::array<double,8>& X,
+                                   const std::array<double,8>& Y,
+                                   const std::array<double,8>& Z) const {
         if (m_rv && m_thetav) {
             const auto[i,j,k] = this->getIJK(globalIndex);
             const auto& r = *m_rv;
             const auto& t = *m_thetav;
-           return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
+            return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
         } else {
             return calculateCellVol(X, Y, Z);
         }
     }
 
+    double EclipseGrid::getCellVolume(std::size_t globalIndex) const {
+        assertGlobalIndex( globalIndex );
+        if (const auto& cache = *this->active_volume;
+            this->cellActive(globalIndex) && cache.ready.load(std::memory_order_acquire))
+        {
+            return cache.volume[this->activeIndex(globalIndex)];
+        }
+
+        std::array<double,8> X;
+        std::array<double,8> Y;
+        std::array<double,8> Z;
+        this->getCellCorners(globalIndex, X, Y, Z );
+        return this->cellVolume(globalIndex, X, Y, Z);
+    }
+
     double EclipseGrid::getCellVolume(std::size_t i , std::size_t j , std::size_t k) const {
         this->assertIJK(i,j,k);
         std::size_t globalIndex = getGlobalIndex(i,j,k);
@@ -1638,28 +1741,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
 
-        // calculate dx
-        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
-        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
-        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
-
-        // calculate dy
-        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
-        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
-        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
-
-        // calculate dz
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-
-
-        return std::array<double,3> {{dx, dy, dz}};
+        return cell_dims(X, Y, Z);
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(std::size_t i , std::size_t j , std::size_t k) const {
@@ -1727,9 +1809,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
-                                        std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
-                                        std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+        return cell_center(X, Y, Z);
     }
 
 
@@ -1838,10 +1918,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        return (z1 + z2)/2.0;
+        return cell_depth(Z);
     }
 
     double EclipseGrid::getCellDepth(std::size_t i, std::size_t j, std::size_t k) const {
@@ -1868,6 +1945,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
+        this->active_volume = std::make_shared<ActiveVolumeCache>();
         return mapper.fixupZCORN( m_zcorn );
     }
 
@@ -2655,7 +2733,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         this->m_global_to_active.resize(global_size);
         std::iota(this->m_global_to_active.begin(), this->m_global_to_active.end(), 0);
         this->m_active_to_global = this->m_global_to_active;
-        this->active_volume = std::nullopt;
+        this->active_volume = std::make_shared<ActiveVolumeCache>();
     }
 
     void EclipseGrid::resetACTNUM(const int* actnum) {
@@ -2683,7 +2761,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
                 }
             }
-            this->active_volume = std::nullopt;
+            this->active_volume = std::make_shared<ActiveVolumeCache>();
         }
     }
 
@@ -3006,6 +3084,7 @@ namespace Opm {
     {
         m_coord = coord;
         m_zcorn = zcorn;
+        this->active_volume = std::make_shared<ActiveVolumeCache>();
     }
 
     void EclipseGridLGR::init_father_global()
@@ -3029,6 +3108,7 @@ namespace Opm {
     {
         m_coord = generate_refined_coord(parent_coord,  parent_nxyz);
         m_zcorn = generate_refined_zcorn(parent_zcorn, parent_nxyz);
+        this->active_volume = std::make_shared<ActiveVolumeCache>();
         EclipseGrid::perform_refinement();
     }
 
@@ -28,9 +28,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -246,6 +248,21 @@ namespace Opm {
         std::array<double, 3> getCellCenter(std::size_t i,std::size_t j, std::size_t k) const;
         std::array<double, 3> getCellCenter(std::size_t globalIndex) const;
         std::array<double, 3> getCornerPos(std::size_t i,std::size_t j, std::size_t k, std::size_t corner_index) const;
+
+        /// Dimensions (DX, DY, DZ) of all active cells, ordered by active
+        /// index.  Same values as getCellDims().
+        std::array<std::vector<double>, 3> activeCellDims() const;
+
+        /// Depth of all active cells, ordered by active index.  Same
+        /// values as getCellDepth(), including DEPTH and numerical aquifer
+        /// overrides.
+        std::vector<double> activeCellDepth() const;
+
+        /// Bulk volume of all active cells, ordered by active index.
+        ///
+        /// Computed once, also when called concurrently, and cached
+        /// until the set of active cells or the cell corners change.
+        /// getCellVolume() uses the cached values once available.
         const std::vector<double>& activeVolume() const;
         double getCellVolume(std::size_t globalIndex) const;
         double getCellVolume(std::size_t i , std::size_t j , std::size_t k) const;
@@ -352,6 +369,15 @@ namespace Opm {
         // Input grid data.
         mutable std::optional<std::vector<double>> m_input_zcorn;
         mutable std::optional<std::vector<double>> m_input_coord;
+        // Cached bulk volume of active cells.  Shared between copies of
+        // the grid and replaced whenever ACTNUM, COORD or ZCORN change.
+        struct ActiveVolumeCache
+        {
+            std::once_flag computed{};
+            std::atomic<bool> ready{false};
+            std::vector<double> volume{};
+        };
+        std::shared_ptr<ActiveVolumeCache> active_volume = std::make_shared<ActiveVolumeCache>();
         void save_children(Opm::EclIO::EclOutput& egridfile, const Opm::UnitSystem& units) const;
 
 
@@ -368,7 +394,6 @@ namespace Opm {
         PinchMode m_pinchGapMode;
         double    m_pinchMaxEmptyGap;
         bool lgr_grid = false;
-        mutable std::optional<std::vector<double>> active_volume;
 
         bool m_circle = false;
         std::size_t zcorn_fixed = 0;
@@ -397,6 +422,16 @@ namespace Opm {
         void updateNumericalAquiferCells(const Deck&);
         double computeCellGeometricDepth(std::size_t globalIndex) const;
 
+        // Call cellFunction(activeIndex, globalIndex, X, Y, Z) with the
+        // corner coordinates of each active cell, in parallel.
+        template <typename CellFunction>
+        void forEachActiveCell(CellFunction&& cellFunction) const;
+
+        double cellVolume(std::size_t globalIndex,
+                          const std::array<double,8>& X,
+                          const std::array<double,8>& Y,
+                          const std::array<double,8>& Z) const;
+
         void initGridFromEGridFile(Opm::EclIO::EclFile& egridfile,
                                    const std::string& fileName);
         void resetACTNUM( const int* actnum);
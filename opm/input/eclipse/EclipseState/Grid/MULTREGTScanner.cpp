@@ -34,7 +34,10 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <map>
+#include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -154,6 +157,8 @@ namespace Opm {
 
         this->template fillSearchMap<0>(m_records);
         this->template fillSearchMap<1>(m_records_same);
+
+        this->compileTables();
     }
 
     template<int index>
@@ -212,6 +217,8 @@ namespace Opm {
         result.regions = {{"test3", {11}}};
         result.aquifer_cells = { std::size_t{17}, std::size_t{29} };
 
+        result.compileTables();
+
         return result;
     }
 
@@ -237,6 +244,9 @@ namespace Opm {
         this->regions = data.regions;
         this->aquifer_cells = data.aquifer_cells;
 
+        // Tables refer to this object's region arrays.
+        this->compileTables();
+
         return *this;
     }
 
@@ -275,80 +285,79 @@ namespace Opm {
                                                 const std::size_t globalIndex2,
                                                 const FaceDir::DirEnum faceDir) const
     {
+        auto multiplier = 1.0;
+
+        this->getRegionMultipliers({ &globalIndex1, 1 }, { &globalIndex2, 1 },
+                                   { &faceDir, 1 }, { &multiplier, 1 });
+
+        return multiplier;
+    }
+
+    void MULTREGTScanner::getRegionMultipliers(std::span<const std::size_t>      globalCellIdx1,
+                                               std::span<const std::size_t>      globalCellIdx2,
+                                               std::span<const FaceDir::DirEnum> faceDir,
+                                               std::span<double>                 multipliers) const
+    {
+        assert (globalCellIdx2.size() == globalCellIdx1.size());
+        assert (faceDir.size() == globalCellIdx1.size());
+        assert (multipliers.size() == globalCellIdx1.size());
+
         // If multiple records, from different region sets and region
         // IDs--e.g., both regions 1/2 in 'M' (MULTNUM) and regions 2/3 in
         // 'F' (FLUXNUM) apply to the same connection--then the total
         // multiplier value is the product of the values from each record.
-        auto multiplier = 1.0;
+        std::ranges::fill(multipliers, 1.0);
 
-        if (this->m_searchMap.empty()) {
-            return multiplier;
-        }
-
-        auto regPairFoundDifferent = [faceDir, this](const auto& regMap, const auto& regPairPos)
+        auto applyRecord = [this, globalCellIdx1, globalCellIdx2, multipliers]
+            (const MULTREGTRecord& record, const std::size_t conn)
         {
-            return (regPairPos != regMap.end())
-                && ((this->m_records[regPairPos->second].directions & faceDir) != 0);
-        };
-
-        auto regPairFoundSame = [faceDir, this](const auto& regMap, const auto& regPairPos)
-        {
-            return (regPairPos != regMap.end())
-                && ((this->m_records_same[regPairPos->second].directions & faceDir) != 0);
+            if (this->appliesToConnection(record, globalCellIdx1[conn], globalCellIdx2[conn])) {
+                multipliers[conn] *= record.trans_mult;
+            }
         };
 
-        auto ignoreMultiplierRecord =
-            [is_adj = is_adjacent(this->gridDims, globalIndex1, globalIndex2),
-             is_aqu = this->isAquNNC(globalIndex1, globalIndex2)]
-            (const MULTREGT::NNCBehaviourEnum nnc_behaviour)
-        {
-            // We ignore the record if either of the following conditions hold
-            //
-            //   1. Cells are adjacent, but record stipulates NNCs only
-            //   2. Connection is an NNC, but record stipulates no NNCs
-            //   3. Connection is associated to a numerical aquifer, but
-            //      record stipulates that no such connections apply.
-            return ((is_adj && !is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NNC))
-                || ((!is_adj || is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC))
-                || (is_aqu              && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
-        };
+        for (const auto& table : this->m_tables) {
+            if (table.regions == nullptr) {
+                throw std::out_of_range { "MULTREGT region set has no region array" };
+            }
 
+            const auto& region_data = *table.regions;
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
+            for (auto conn = 0*multipliers.size(); conn < multipliers.size(); ++conn) {
+                auto regionId1 = region_data[globalCellIdx1[conn]];
+                auto regionId2 = region_data[globalCellIdx2[conn]];
 
-            auto regionId1 = region_data[globalIndex1];
-            auto regionId2 = region_data[globalIndex2];
+                if (regionId1 > regionId2) {
+                    std::swap(regionId1, regionId2);
+                }
 
-            if (regionId1 > regionId2) {
-                std::swap(regionId1, regionId2);
-            }
+                if (const auto recordIx = table.pairRecord(regionId1, regionId2); recordIx >= 0) {
+                    const auto& record = this->m_records[recordIx];
+                    if ((record.directions & faceDir[conn]) != 0) {
+                        applyRecord(record, conn);
+                    }
+                }
 
-            const auto applyMultiplier = [ignoreMultiplierRecord](const MULTREGTRecord& record)
-            {
-                return (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) ||
-                ! ignoreMultiplierRecord(record.nnc_behaviour);
-            };
+                // Same region.  Note that a pair where both region indices
+                // are the same is special.  For connections between it and
+                // all other regions the multipliers will not override
+                // otherwise explicitly specified (as pairs with different
+                // ids) multipliers, but accumulated to these.
+                for (const auto regionId : { regionId1, regionId2 }) {
+                    const auto recordIx = table.sameRecord(regionId);
+                    if (recordIx >= 0) {
+                        const auto& record = this->m_records_same[recordIx];
+                        if ((record.directions & faceDir[conn]) != 0) {
+                            applyRecord(record, conn);
+                        }
+                    }
 
-            multiplier = this->applyMultiplierDifferentRegion(regMaps,
-                                                              multiplier,
-                                                              regionId1,
-                                                              regionId2,
-                                                              applyMultiplier,
-                                                              regPairFoundDifferent);
-            // same region. Note that a pair where both region indices are the same is special.
-            // For connections between it and all other regions the multipliers
-            // will not override otherwise explicitly specified (as pairs with
-            // different ids) multipliers, but accumulated to these.
-            multiplier = this->applyMultiplierSameRegion(regMaps,
-                                                         multiplier,
-                                                         regionId1,
-                                                         regionId2,
-                                                         applyMultiplier,
-                                                         regPairFoundSame);
+                    if (regionId1 == regionId2) {
+                        break;
+                    }
+                }
+            }
         }
-
-        return multiplier;
     }
 
     double MULTREGTScanner::getRegionMultiplierNNC(const std::size_t globalCellIdx1,
@@ -360,119 +369,51 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_tables.empty()) {
             return multiplier;
         }
 
-        auto ignoreMultiplierRecord =
-            [is_aqu = this->isAquNNC(globalCellIdx1, globalCellIdx2)]
-            (const MULTREGT::NNCBehaviourEnum nnc_behaviour)
+        const auto is_aqu = this->isAquNNC(globalCellIdx1, globalCellIdx2);
+        const auto applyMultiplier = [is_aqu, &multiplier](const MULTREGTRecord& record)
         {
-            return (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC)
-                || (is_aqu && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
+            // All entries match no matter what FaceDir says.
+            const auto ignore = (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC)
+                || (is_aqu && (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
+
+            if (! ignore) {
+                multiplier *= record.trans_mult;
+            }
         };
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
+        for (const auto& table : this->m_tables) {
+            if (table.regions == nullptr) {
+                throw std::out_of_range { "MULTREGT region set has no region array" };
+            }
 
-            auto regionId1 = region_data[globalCellIdx1];
-            auto regionId2 = region_data[globalCellIdx2];
+            auto regionId1 = (*table.regions)[globalCellIdx1];
+            auto regionId2 = (*table.regions)[globalCellIdx2];
 
-            if (regionId1> regionId2) {
+            if (regionId1 > regionId2) {
                 std::swap(regionId1, regionId2);
             }
 
-            const auto applyMultiplier = [ignoreMultiplierRecord](const auto& record){
-                return ! ignoreMultiplierRecord(record.nnc_behaviour);
-            };
-
-            const auto regPairFound = [](const auto& regMap, const auto& regPairPos)
-            {
-                // all entries match no matter what FaceDir says.
-                return (regPairPos != regMap.end());
-            };
-
-            multiplier = this->applyMultiplierSameRegion(regMaps,
-                                                         multiplier,
-                                                         regionId1,
-                                                         regionId2,
-                                                         applyMultiplier,
-                                                         regPairFound);
-            // same region. Note that a pair where both region indices are the same is special.
-            // For connections between it and all other regions the multipliers
-            // will not override otherwise explicitly specified (as pairs with
-            // different ids) multipliers, but accumulated to these.
-            multiplier = this->applyMultiplierDifferentRegion(regMaps,
-                                                              multiplier,
-                                                              regionId1,
-                                                              regionId2,
-                                                              applyMultiplier,
-                                                              regPairFound);
-        }
-
-        return multiplier;
-    }
-
-    template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                                           double multiplier,
-                                                           std::size_t regionId1,
-                                                           std::size_t regionId2,
-                                                           const ApplyDecision& applyMultiplier,
-                                                           const RegPairFound& regPairFound) const
-    {
-        const auto& myMap = std::get<0>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
-        regPairPos = myMap.find({ regionId1, regionId2 });
-
-        if (!regPairFound(myMap, regPairPos)) {
-            // Pair not found.
-            return multiplier;
-        }
-        const auto& record = this->m_records[regPairPos->second];
-
-        if (applyMultiplier(record)) {
-            multiplier *= record.trans_mult;
-        }
-
-        return multiplier;
-    }
-
-
-    template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                                      double multiplier,
-                                                      std::size_t regionId1,
-                                                      std::size_t regionId2,
-                                                      const ApplyDecision& applyMultiplier,
-                                                      const RegPairFound& regPairFound) const
-    {
-        const auto& myMap = std::get<1>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
-        // search for entry where the two region ids are the same
-        // where one of those is a region of ours.
-        regPairPos = myMap.find({ regionId1, regionId1 });
-
-        if (regPairFound(myMap, regPairPos)) {
-            const auto& record = this->m_records_same[regPairPos->second];
+            // Same region first.  Note that a pair where both region
+            // indices are the same is special.  For connections between it
+            // and all other regions the multipliers will not override
+            // otherwise explicitly specified (as pairs with different ids)
+            // multipliers, but accumulated to these.
+            for (const auto regionId : { regionId1, regionId2 }) {
+                if (const auto recordIx = table.sameRecord(regionId); recordIx >= 0) {
+                    applyMultiplier(this->m_records_same[recordIx]);
+                }
 
-            if (applyMultiplier(record)) {
-                multiplier *= record.trans_mult;
+                if (regionId1 == regionId2) {
+                    break;
+                }
             }
-        }
-        if (regionId1 != regionId2)
-        {
-            // also try to apply other region multiplier.
-            regPairPos = myMap.find({ regionId2, regionId2 });
 
-            if (regPairFound(myMap, regPairPos)) {
-                const auto& record = this->m_records_same[regPairPos->second];
-
-                if (applyMultiplier(record)) {
-                    multiplier *= record.trans_mult;
-                }
+            if (const auto recordIx = table.pairRecord(regionId1, regionId2); recordIx >= 0) {
+                applyMultiplier(this->m_records[recordIx]);
             }
         }
 
@@ -537,6 +478,127 @@ namespace Opm {
         }
     }
 
+    void MULTREGTScanner::compileTables()
+    {
+        // Region pairs are looked up in a dense matrix if that matrix is
+        // small, or if the records fill a sizeable part of it.  Sparse
+        // region sets--e.g., a single record for a large region ID--use
+        // hash tables instead.
+        constexpr auto maxSmallDense = std::size_t{128 * 128};
+        constexpr auto entriesPerRecord = std::size_t{64};
+
+        this->m_tables.clear();
+        this->m_tables.reserve(this->m_searchMap.size());
+
+        for (const auto& [regName, regMaps] : this->m_searchMap) {
+            auto& table = this->m_tables.emplace_back();
+
+            if (const auto regPos = this->regions.find(regName);
+                regPos != this->regions.end())
+            {
+                table.regions = &regPos->second;
+            }
+
+            for (const auto& regPair : std::views::keys(std::get<0>(regMaps))) {
+                table.numRegions = std::max(table.numRegions, regPair.second + 1);
+            }
+
+            for (const auto& regPair : std::views::keys(std::get<1>(regMaps))) {
+                table.numRegions = std::max(table.numRegions, regPair.second + 1);
+            }
+
+            const auto numRecords = std::get<0>(regMaps).size() + std::get<1>(regMaps).size();
+            const auto numEntries = static_cast<std::size_t>(table.numRegions)
+                * static_cast<std::size_t>(table.numRegions);
+
+            const auto dense = numEntries <= std::max(maxSmallDense, entriesPerRecord * numRecords);
+            if (dense) {
+                table.pairs.assign(table.numRegions * table.numRegions, -1);
+                table.same.assign(table.numRegions, -1);
+            }
+
+            for (const auto& [regPair, recordIx] : std::get<0>(regMaps)) {
+                const auto [r1, r2] = regPair;
+                if ((r1 < 0) || (r2 < 0)) {
+                    continue;
+                }
+
+                if (dense) {
+                    table.pairs[r1*table.numRegions + r2] = static_cast<int>(recordIx);
+                    table.pairs[r2*table.numRegions + r1] = static_cast<int>(recordIx);
+                }
+                else {
+                    table.pairsHashed.insert_or_assign((std::uint64_t(r1) << 32) | std::uint64_t(r2),
+                                                       static_cast<int>(recordIx));
+                }
+            }
+
+            for (const auto& [regPair, recordIx] : std::get<1>(regMaps)) {
+                const auto r = regPair.first;
+                if ((r < 0) || (regPair.second != r)) {
+                    continue;
+                }
+
+                if (dense) {
+                    table.same[r] = static_cast<int>(recordIx);
+                }
+                else {
+                    table.sameHashed.insert_or_assign(r, static_cast<int>(recordIx));
+                }
+            }
+        }
+    }
+
+    int MULTREGTScanner::RegionSetTable::pairRecord(const int r1, const int r2) const
+    {
+        if ((r1 < 0) || (r2 >= this->numRegions)) {
+            return -1;
+        }
+
+        if (! this->pairs.empty()) {
+            return this->pairs[r1*this->numRegions + r2];
+        }
+
+        const auto pos = this->pairsHashed.find((std::uint64_t(r1) << 32) | std::uint64_t(r2));
+        return (pos == this->pairsHashed.end()) ? -1 : pos->second;
+    }
+
+    int MULTREGTScanner::RegionSetTable::sameRecord(const int r) const
+    {
+        if ((r < 0) || (r >= this->numRegions)) {
+            return -1;
+        }
+
+        if (! this->same.empty()) {
+            return this->same[r];
+        }
+
+        const auto pos = this->sameHashed.find(r);
+        return (pos == this->sameHashed.end()) ? -1 : pos->second;
+    }
+
+    bool MULTREGTScanner::appliesToConnection(const MULTREGTRecord& record,
+                                              const std::size_t    globalCellIdx1,
+                                              const std::size_t    globalCellIdx2) const
+    {
+        if (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) {
+            return true;
+        }
+
+        const auto is_adj = is_adjacent(this->gridDims, globalCellIdx1, globalCellIdx2);
+        const auto is_aqu = this->isAquNNC(globalCellIdx1, globalCellIdx2);
+
+        // We ignore the record if either of the following conditions hold
+        //
+        //   1. Cells are adjacent, but record stipulates NNCs only
+        //   2. Connection is an NNC, but record stipulates no NNCs
+        //   3. Connection is associated to a numerical aquifer, but
+        //      record stipulates that no such connections apply.
+        return ! (((is_adj && !is_aqu) && (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::NNC))
+                  || ((!is_adj || is_aqu) && (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC))
+                  || (is_aqu              && (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC)));
+    }
+
     bool MULTREGTScanner::isAquNNC(const std::size_t globalCellIdx1,
                                    const std::size_t globalCellIdx2) const
     {
@@ -25,9 +25,12 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -106,6 +109,28 @@ namespace Opm {
                                    std::size_t globalCellIdx2,
                                    FaceDir::DirEnum faceDir) const;
 
+        /// Region multipliers of a batch of connections.
+        ///
+        /// Same result as getRegionMultiplier() for each connection, but
+        /// each region set's look-up table is traversed once for the whole
+        /// batch.
+        ///
+        /// \param[in] globalCellIdx1 Global index of first cell of each
+        ///   connection.
+        ///
+        /// \param[in] globalCellIdx2 Global index of second cell of each
+        ///   connection.  Same size as \p globalCellIdx1.
+        ///
+        /// \param[in] faceDir Face direction of each connection.  Same
+        ///   size as \p globalCellIdx1.
+        ///
+        /// \param[out] multipliers Region multiplier of each connection.
+        ///   Same size as \p globalCellIdx1.
+        void getRegionMultipliers(std::span<const std::size_t>      globalCellIdx1,
+                                  std::span<const std::size_t>      globalCellIdx2,
+                                  std::span<const FaceDir::DirEnum> faceDir,
+                                  std::span<double>                 multipliers) const;
+
         double getRegionMultiplierNNC(std::size_t globalCellIdx1,
                                       std::size_t globalCellIdx2) const;
 
@@ -120,9 +145,55 @@ namespace Opm {
 
             serializer(regions);
             serializer(aquifer_cells);
+
+            if (! serializer.isSerializing()) {
+                this->compileTables();
+            }
         }
 
     private:
+        /// Precompiled record look-up for a single region set.
+        ///
+        /// Built from m_searchMap and regions, which remain the
+        /// authoritative representation for comparison and serialisation.
+        struct RegionSetTable
+        {
+            /// Region IDs of all cells.  Nullptr if region set has no
+            /// region array.
+            const std::vector<int>* regions{nullptr};
+
+            /// One more than the largest region ID of any record in this
+            /// region set.
+            int numRegions{0};
+
+            /// Index into m_records of each region pair.  Dense, symmetric,
+            /// row-major matrix of size numRegions * numRegions, -1 for
+            /// pairs without a record.  Empty if a dense matrix would be
+            /// large and sparsely populated, in which case pairsHashed is
+            /// used.
+            std::vector<int> pairs{};
+
+            /// Index into m_records of each region pair (r1 <= r2), keyed
+            /// on r1 and r2 in the upper and lower 32 bits respectively.
+            std::unordered_map<std::uint64_t, int> pairsHashed{};
+
+            /// Index into m_records_same of each region, -1 for regions
+            /// without a record.  Empty if pairs is empty.
+            std::vector<int> same{};
+
+            /// Index into m_records_same of each region.  Used only if
+            /// same is empty.
+            std::unordered_map<int, int> sameHashed{};
+
+            /// Index into m_records of region pair, -1 if none.
+            ///
+            /// \param[in] r1 First region ID.
+            /// \param[in] r2 Second region ID.  Not less than \p r1.
+            int pairRecord(int r1, int r2) const;
+
+            /// Index into m_records_same of region, -1 if none.
+            int sameRecord(int r) const;
+        };
 
         // For any key k in the map k.first <= k.second holds.
         using MULTREGTSearchMap = std::map<
@@ -130,43 +201,6 @@ namespace Opm {
             std::vector<MULTREGTRecord>::size_type
         >;
 
-        /// \brief Apply regionMultiplier from entries where source and target region differ
-        ///
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
-        /// \param regionId1 Id of egion for first cell
-        /// \param regionId Id of regions for the second cell (not less than regionId1!)
-        /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
-        template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                              double multiplier,
-                                              std::size_t regionId1,
-                                              std::size_t regionId2,
-                                              const ApplyDecision& applyMultiplier,
-                                              const RegPairFound& regPairFound) const;
-
-        /// \brief Apply region multipliers from entries with same source and target region
-        ///
-        /// Note that a pair where both region indices are the same is special.
-        /// For connections between it and all other regions the multipliers
-        /// will not override otherwise explicitly specified (as pairs with
-        /// different ids) multipliers, but accumulated to these.
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
-        /// \param regionId1 Id of egion for first cell
-        /// \param regionId Id of regions for the second cell (not less than regionId1!)
-        /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
-        template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                         double multiplier,
-                                         std::size_t regionId1,
-                                         std::size_t regionId2,
-                                         const ApplyDecision& applyMultiplier,
-                                         const RegPairFound& regPairFound) const;
         template<int index>
         void fillSearchMap(const std::vector<MULTREGTRecord>& records);
 
@@ -187,8 +221,20 @@ namespace Opm {
         std::map<std::string, std::vector<int>> regions{};
         std::vector<std::size_t> aquifer_cells{};
 
+        /// Look-up tables of all region sets, in m_searchMap order.
+        std::vector<RegionSetTable> m_tables{};
+
         void addKeyword(const DeckKeyword& deckKeyword);
 
+        /// Build m_tables from m_searchMap and regions.
+        void compileTables();
+
+        /// Whether or not a record applies to a connection, according to
+        /// the record's NNC behaviour.
+        bool appliesToConnection(const MULTREGTRecord& record,
+                                 std::size_t          globalCellIdx1,
+                                 std::size_t          globalCellIdx2) const;
+
         bool isAquNNC(std::size_t globalCellIdx1, std::size_t globalCellIdx2) const;
         bool isAquCell(std::size_t globalCellIdx) const;
     };
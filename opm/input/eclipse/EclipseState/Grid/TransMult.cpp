@@ -122,6 +122,13 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplierNNC(globalCellIndex1, globalCellIndex2);
     }
 
+    void TransMult::getRegionMultipliers(std::span<const std::size_t>      globalCellIndex1,
+                                         std::span<const std::size_t>      globalCellIndex2,
+                                         std::span<const FaceDir::DirEnum> faceDir,
+                                         std::span<double>                 multipliers) const {
+        m_multregtScanner.getRegionMultipliers(globalCellIndex1, globalCellIndex2, faceDir, multipliers);
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
@@ -35,6 +35,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <span>
 
 namespace Opm {
     namespace data {
@@ -60,6 +61,14 @@ namespace Opm {
         double getMultiplier(std::size_t i , std::size_t j , std::size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( std::size_t globalCellIndex1, std::size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplierNNC(std::size_t globalCellIndex1, std::size_t globalCellIndex2) const;
+
+        /// Region multipliers of a batch of connections.  Same as
+        /// MULTREGTScanner::getRegionMultipliers().
+        void getRegionMultipliers(std::span<const std::size_t>      globalCellIndex1,
+                                  std::span<const std::size_t>      globalCellIndex2,
+                                  std::span<const FaceDir::DirEnum> faceDir,
+                                  std::span<double>                 multipliers) const;
+
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
@@ -0,0 +1,442 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+
+#include <opm/common/OpmLog/LogBackend.hpp>
+#include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    /// Cache entry format version.  Increment whenever the layout of the
+    /// entry, or of the serialised Deck, changes.
+    constexpr int formatVersion = 2;
+
+    const std::string entryMagic { "OPM-DECK-CACHE" };
+
+    /// Serializer exposing its byte buffer, so that serialised objects
+    /// can be written to and read from files.
+    class BufferSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+    {
+    public:
+        BufferSerializer()
+            : Opm::Serializer<Opm::Serialization::MemPacker> { packer_ }
+        {}
+
+        std::vector<char>& buffer() { return this->m_buffer; }
+
+    private:
+        static const Opm::Serialization::MemPacker packer_;
+    };
+
+    const Opm::Serialization::MemPacker BufferSerializer::packer_{};
+
+    std::optional<std::string> readFile(const std::filesystem::path& fname)
+    {
+        std::ifstream is(fname, std::ios::binary);
+        if (! is) {
+            return std::nullopt;
+        }
+
+        return std::string { std::istreambuf_iterator<char>{is},
+                             std::istreambuf_iterator<char>{} };
+    }
+
+    std::size_t contentHash(std::string_view content)
+    {
+        return std::hash<std::string_view>{}(content);
+    }
+
+    std::int64_t modificationTime(const std::filesystem::path& fname,
+                                  std::error_code&             ec)
+    {
+        return std::filesystem::last_write_time(fname, ec)
+            .time_since_epoch().count();
+    }
+
+    /// Log backend recording all messages it receives.
+    class RecordingLog : public Opm::LogBackend
+    {
+    public:
+        RecordingLog()
+            : Opm::LogBackend { Opm::Log::DefaultMessageTypes }
+        {}
+
+        const std::vector<std::pair<std::int64_t, std::string>>& messages() const
+        {
+            return this->messages_;
+        }
+
+    protected:
+        void addMessageUnconditionally(const std::int64_t messageFlag,
+                                       const std::string& message) override
+        {
+            this->messages_.emplace_back(messageFlag, message);
+        }
+
+    private:
+        std::vector<std::pair<std::int64_t, std::string>> messages_{};
+    };
+
+    /// Identity of a single input file at the time the deck was parsed.
+    struct FileStamp
+    {
+        std::string path{};
+        std::uintmax_t size{0};
+        std::int64_t mtime{0};
+        std::size_t hash{0};
+        bool exists{true};
+
+        /// Whether or not file is unchanged since stamp was created.
+        bool unchanged() const
+        {
+            auto ec = std::error_code{};
+
+            if (! this->exists) {
+                return ! std::filesystem::exists(this->path, ec) && ! ec;
+            }
+
+            const auto currentSize = std::filesystem::file_size(this->path, ec);
+            if (ec || (currentSize != this->size)) {
+                return false;
+            }
+
+            const auto currentMtime = modificationTime(this->path, ec);
+            if (! ec && (currentMtime == this->mtime)) {
+                return true;
+            }
+
+            const auto content = readFile(this->path);
+            return content.has_value()
+                && (contentHash(*content) == this->hash);
+        }
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->path);
+            serializer(this->size);
+            serializer(this->mtime);
+            serializer(this->hash);
+            serializer(this->exists);
+        }
+    };
+
+    /// Leading part of a cache entry.  Read and validated before the
+    /// considerably larger serialised deck which follows it.
+    struct EntryHeader
+    {
+        std::string magic{};
+        int version{0};
+        std::string dataFile{};
+        std::size_t configuration{0};
+        std::vector<FileStamp> files{};
+        Opm::DeckCache::Diagnostics diagnostics{};
+        std::size_t deckSize{0};
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->magic);
+            serializer(this->version);
+            serializer(this->dataFile);
+            serializer(this->configuration);
+            serializer(this->files);
+            serializer(this->diagnostics);
+            serializer(this->deckSize);
+        }
+    };
+
+    /// Canonical names of all files from which the deck was parsed.  This
+    /// includes the .DATA file, all INCLUDE files, and any other file
+    /// from which keywords were loaded, e.g., through IMPORT.
+    std::vector<std::string> inputFiles(const Opm::Deck& deck)
+    {
+        auto files = deck.tree().files();
+
+        for (const auto& keyword : deck) {
+            auto ec = std::error_code{};
+            const auto fname = std::filesystem::canonical(keyword.location().filename, ec);
+            if (! ec) {
+                files.push_back(fname.generic_string());
+            }
+        }
+
+        std::ranges::sort(files);
+        const auto dup = std::ranges::unique(files);
+        files.erase(dup.begin(), dup.end());
+
+        return files;
+    }
+
+    std::optional<FileStamp> makeStamp(const std::string& fname)
+    {
+        auto stamp = FileStamp { fname };
+
+        auto ec = std::error_code{};
+        stamp.mtime = modificationTime(fname, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+
+        const auto content = readFile(fname);
+        if (! content.has_value()) {
+            return std::nullopt;
+        }
+
+        stamp.size = content->size();
+        stamp.hash = contentHash(*content);
+
+        return stamp;
+    }
+
+    void writeBlock(std::ofstream& os, std::vector<char>& block)
+    {
+        const std::uint64_t size = block.size();
+
+        os.write(reinterpret_cast<const char*>(&size), sizeof size);
+        os.write(block.data(), block.size());
+    }
+
+    bool readBlock(std::ifstream& is, std::vector<char>& block)
+    {
+        auto size = std::uint64_t{0};
+        if (! is.read(reinterpret_cast<char*>(&size), sizeof size)) {
+            return false;
+        }
+
+        block.resize(size);
+
+        return static_cast<bool>(is.read(block.data(), size));
+    }
+
+} // Anonymous namespace
+
+Opm::DeckCache::Recorder::Recorder(const ErrorGuard& errors)
+    : errors_       { errors }
+    , firstWarning_ { errors.warnings().size() }
+    , backendName_  { fmt::format("DeckCacheRecorder-{}", static_cast<const void*>(this)) }
+    , backend_      { std::make_shared<RecordingLog>() }
+{
+    OpmLog::addBackend(this->backendName_, this->backend_);
+}
+
+Opm::DeckCache::Recorder::~Recorder()
+{
+    OpmLog::removeBackend(this->backendName_);
+}
+
+Opm::DeckCache::Diagnostics
+Opm::DeckCache::Recorder::diagnostics(std::vector<std::string> missingFiles) const
+{
+    const auto& warnings = this->errors_.warnings();
+
+    return {
+        static_cast<const RecordingLog&>(*this->backend_).messages(),
+        { warnings.begin() + this->firstWarning_, warnings.end() },
+        std::move(missingFiles)
+    };
+}
+
+Opm::DeckCache::DeckCache(std::filesystem::path directory)
+    : directory_ { std::move(directory) }
+{}
+
+std::optional<Opm::Deck>
+Opm::DeckCache::load(const std::filesystem::path& dataFile,
+                     const std::size_t            configuration,
+                     ErrorGuard&                  errors) const
+{
+    try {
+        std::ifstream is(this->entryFile(dataFile, configuration), std::ios::binary);
+        if (! is) {
+            return std::nullopt;
+        }
+
+        auto serializer = BufferSerializer{};
+        auto header = EntryHeader{};
+
+        if (! readBlock(is, serializer.buffer())) {
+            return std::nullopt;
+        }
+
+        serializer.unpack(header);
+
+        const auto canonicalDataFile = std::filesystem::canonical(dataFile).generic_string();
+        if ((header.magic != entryMagic) ||
+            (header.version != formatVersion) ||
+            (header.dataFile != canonicalDataFile) ||
+            (header.configuration != configuration) ||
+            ! std::ranges::all_of(header.files, &FileStamp::unchanged))
+        {
+            return std::nullopt;
+        }
+
+        if (! readBlock(is, serializer.buffer()) ||
+            (serializer.buffer().size() != header.deckSize))
+        {
+            return std::nullopt;
+        }
+
+        auto deck = Deck{};
+        serializer.unpack(deck);
+
+        // Emit the diagnostics of the original parse, as if the deck had
+        // been parsed again.
+        for (const auto& [messageType, message] : header.diagnostics.logMessages) {
+            OpmLog::addMessage(messageType, message);
+        }
+
+        for (const auto& [errorKey, message] : header.diagnostics.warnings) {
+            errors.addWarning(errorKey, message);
+        }
+
+        return deck;
+    }
+    catch (const std::exception&) {
+        // Unreadable or corrupt entry.  Treat as cache miss.
+        return std::nullopt;
+    }
+}
+
+bool Opm::DeckCache::store(const std::filesystem::path& dataFile,
+                           const std::size_t            configuration,
+                           const Deck&                  deck,
+                           const Diagnostics&           diagnostics) const
+{
+    try {
+        auto header = EntryHeader {
+            entryMagic, formatVersion,
+            std::filesystem::canonical(dataFile).generic_string(),
+            configuration
+        };
+
+        for (const auto& fname : inputFiles(deck)) {
+            auto stamp = makeStamp(fname);
+            if (! stamp.has_value()) {
+                return false;
+            }
+
+            header.files.push_back(std::move(*stamp));
+        }
+
+        // Files which were missing must still be missing when the entry
+        // is loaded.  Otherwise the deck would lack their keywords.
+        for (const auto& fname : diagnostics.missingFiles) {
+            auto ec = std::error_code{};
+            if (std::filesystem::exists(fname, ec) || ec) {
+                return false;
+            }
+
+            header.files.push_back({ .path = fname, .exists = false });
+        }
+
+        header.diagnostics = diagnostics;
+
+        auto deckSerializer = BufferSerializer{};
+        deckSerializer.pack(deck);
+        header.deckSize = deckSerializer.buffer().size();
+
+        auto headerSerializer = BufferSerializer{};
+        headerSerializer.pack(header);
+
+        std::filesystem::create_directories(this->directory_);
+
+        const auto entry = this->entryFile(dataFile, configuration);
+        auto tmpFile = entry;
+        tmpFile += fmt::format(".{:08x}.tmp", std::random_device{}());
+
+        {
+            std::ofstream os(tmpFile, std::ios::binary);
+            writeBlock(os, headerSerializer.buffer());
+            writeBlock(os, deckSerializer.buffer());
+
+            if (! os) {
+                os.close();
+                std::filesystem::remove(tmpFile);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tmpFile, entry);
+
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+std::size_t
+Opm::DeckCache::configuration(const ParseContext&             parseContext,
+                              const std::vector<std::string>& settings)
+{
+    auto serializer = BufferSerializer{};
+    serializer.pack(parseContext, settings);
+
+    const auto& buffer = serializer.buffer();
+
+    return contentHash({ buffer.data(), buffer.size() });
+}
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+std::filesystem::path
+Opm::DeckCache::entryFile(const std::filesystem::path& dataFile,
+                          const std::size_t            configuration) const
+{
+    const auto canonicalDataFile = std::filesystem::canonical(dataFile);
+
+    return this->directory_ /
+        fmt::format("{}-{:016x}-{:016x}.deck",
+                    canonicalDataFile.stem().string(),
+                    std::hash<std::string>{}(canonicalDataFile.generic_string()),
+                    configuration);
+}
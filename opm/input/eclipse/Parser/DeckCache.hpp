@@ -0,0 +1,189 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+    class Deck;
+    class ErrorGuard;
+    class LogBackend;
+    class ParseContext;
+
+} // namespace Opm
+
+namespace Opm {
+
+/// On-disk cache of parsed input decks.
+///
+/// Each cache entry holds a parsed Deck, in the Serializer/MemPacker
+/// binary format, along with the size, modification time and content hash
+/// of every input file from which the deck was parsed.  An entry is used
+/// only if none of those files have changed.  A file whose modification
+/// time differs from the recorded time is still considered unchanged if
+/// its size and content hash match the recorded values.  Files which did
+/// not exist when the deck was parsed, such as missing INCLUDE files whose
+/// error handling is WARN or IGNORE, are recorded as absent and the entry
+/// is used only if they still do not exist.
+///
+/// Each entry also holds the diagnostics emitted while parsing the deck,
+/// i.e., log messages and input error warnings, and loading the deck from
+/// the cache emits those diagnostics again.
+///
+/// Entries are keyed by the canonical path of the run's .DATA file and a
+/// caller-defined configuration hash, which should identify every parser
+/// setting that affects the resulting deck.
+class DeckCache
+{
+public:
+    /// Diagnostics emitted while parsing a deck.
+    struct Diagnostics
+    {
+        /// Log messages, as (message type, message) pairs.
+        std::vector<std::pair<std::int64_t, std::string>> logMessages{};
+
+        /// Input error warnings, as (error key, message) pairs.
+        std::vector<std::pair<std::string, std::string>> warnings{};
+
+        /// Canonical or absolute names of files which were referenced by
+        /// the deck but did not exist.
+        std::vector<std::string> missingFiles{};
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->logMessages);
+            serializer(this->warnings);
+            serializer(this->missingFiles);
+        }
+    };
+
+    /// Records diagnostics emitted while parsing a deck.
+    ///
+    /// Log messages are recorded through an OpmLog backend which exists
+    /// for the lifetime of the recorder.  Warnings are those added to an
+    /// ErrorGuard during the lifetime of the recorder.
+    class Recorder
+    {
+    public:
+        /// Constructor.
+        ///
+        /// \param[in] errors Error guard of the parse.  Must outlive the
+        ///   recorder.
+        explicit Recorder(const ErrorGuard& errors);
+
+        /// Destructor.  Removes the recording log backend.
+        ~Recorder();
+
+        Recorder(const Recorder&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+
+        /// Diagnostics recorded so far.
+        ///
+        /// \param[in] missingFiles Names of files which were referenced
+        ///   by the deck but did not exist.
+        Diagnostics diagnostics(std::vector<std::string> missingFiles) const;
+
+    private:
+        const ErrorGuard& errors_;
+        std::size_t firstWarning_{0};
+        std::string backendName_{};
+        std::shared_ptr<LogBackend> backend_{};
+    };
+
+    /// Constructor.
+    ///
+    /// \param[in] directory Location of cache entries.  Created on first
+    ///   store() if it does not already exist.
+    explicit DeckCache(std::filesystem::path directory);
+
+    /// Retrieve cached deck.
+    ///
+    /// \param[in] dataFile Run's .DATA file.
+    ///
+    /// \param[in] configuration Hash of parser settings.
+    ///
+    /// \param[in,out] errors Error guard receiving the entry's recorded
+    ///   warnings.  The entry's recorded log messages are emitted through
+    ///   OpmLog.  Not modified unless the deck is loaded.
+    ///
+    /// \return Cached deck.  Nullopt if no entry exists for \p dataFile
+    ///   and \p configuration, if any of the deck's input files have
+    ///   changed since the entry was stored, or if the entry cannot be
+    ///   read.
+    std::optional<Deck> load(const std::filesystem::path& dataFile,
+                             std::size_t                  configuration,
+                             ErrorGuard&                  errors) const;
+
+    /// Store parsed deck.
+    ///
+    /// Replaces any existing entry for \p dataFile and \p configuration.
+    /// Entries are written to a temporary file and then renamed, so
+    /// concurrent runs sharing a cache directory never see partially
+    /// written entries.
+    ///
+    /// \param[in] dataFile Run's .DATA file.
+    ///
+    /// \param[in] configuration Hash of parser settings.
+    ///
+    /// \param[in] deck Deck parsed from \p dataFile.
+    ///
+    /// \param[in] diagnostics Diagnostics emitted while parsing \p deck.
+    ///
+    /// \return Whether or not the entry was successfully written.
+    bool store(const std::filesystem::path& dataFile,
+               std::size_t                  configuration,
+               const Deck&                  deck,
+               const Diagnostics&           diagnostics) const;
+
+    /// Configuration hash of a set of parser settings.
+    ///
+    /// \param[in] parseContext Error handling settings and ignored
+    ///   keywords.
+    ///
+    /// \param[in] settings Any other settings affecting the parsed deck,
+    ///   e.g., the set of known keywords, in textual form.
+    ///
+    /// \return Hash value suitable as the configuration of load() and
+    ///   store().
+    static std::size_t configuration(const ParseContext&             parseContext,
+                                     const std::vector<std::string>& settings);
+
+private:
+    /// Location of cache entries.
+    std::filesystem::path directory_;
+
+    /// Name of cache entry file.
+    std::filesystem::path entryFile(const std::filesystem::path& dataFile,
+                                    std::size_t                  configuration) const;
+};
+
+} // namespace Opm
+
+#endif // OPM_DECK_CACHE_HPP
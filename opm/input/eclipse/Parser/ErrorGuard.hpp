@@ -23,6 +23,7 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -35,6 +36,10 @@ public:
 
     explicit operator bool() const { return !this->error_list.empty(); }
 
+    /// Warnings added so far, as (error key, message) pairs.
+    const std::vector<std::pair<std::string, std::string>>& warnings() const
+    { return this->warning_list; }
+
     /*
       Observe that this destructor has somewhat special semantics. If there
       are errors in the error list it will print all warnings and errors on
@@ -629,6 +629,19 @@ namespace Opm {
         /// which should be treated as a critical failure if encountered.
         const static std::string SIMULATOR_KEYWORD_ITEM_NOT_SUPPORTED_CRITICAL;
 
+        /// Convert between byte array and object representation.
+        ///
+        /// \tparam Serializer Byte array conversion protocol.
+        ///
+        /// \param[in,out] serializer Byte array conversion object.
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->m_errorContexts);
+            serializer(this->ignore_keywords);
+            serializer(this->m_input_skip_mode);
+        }
+
     private:
         /// Current action for all known context categories.
         std::map<std::string, InputErrorAction> m_errorContexts{};
@@ -23,6 +23,7 @@
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
@@ -61,15 +62,19 @@
 #include <cctype>
 #include <cstddef>
 #include <cstdio>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <regex>
 #include <stack>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -483,6 +488,181 @@ void InputStack::push( std::string&& input, std::filesystem::path p ) {
     this->emplace( p, this->string_storage.back() );
 }
 
+/*
+ * Read the input file C-style. This is done for performance reasons, as
+ * streams are slow.  Returns nullopt if the file cannot be opened.
+ */
+std::optional<std::string> readInputFile(const std::filesystem::path& inputFile) {
+    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+    std::unique_ptr<std::FILE, decltype(closer)> ufp{
+        std::fopen( inputFile.generic_string().c_str(), "rb" ),
+        closer
+    };
+
+    if( !ufp )
+        return {};
+
+    auto* fp = ufp.get();
+    std::string buffer;
+    std::fseek( fp, 0, SEEK_END );
+    buffer.resize( std::ftell( fp ) + 1 );
+    std::rewind( fp );
+    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
+    buffer.back() = '\n';
+
+    if( std::ferror( fp ) || readc != buffer.size() - 1 )
+        throw std::runtime_error( "Error when reading input file '"
+                                  + inputFile.string() + "'" );
+
+    return buffer;
+}
+
+/*
+ * Files named by the INCLUDE keywords of a cleaned input string, in order
+ * of appearance.  This is a best effort look-ahead: file names using path
+ * aliases, or which do not name an existing file, are skipped and left for
+ * the parser to handle when it reaches the INCLUDE keyword.
+ */
+std::vector<std::filesystem::path>
+includeCandidates(std::string_view input, const std::filesystem::path& rootPath) {
+    std::vector<std::filesystem::path> files;
+
+    std::string_view line;
+    while (str::getline(input, line)) {
+        if (str::make_deck_name(line) != RawConsts::include)
+            continue;
+
+        // The file name is on the next non-empty line.
+        while (str::getline(input, line) && line.empty())
+            ;
+
+        const auto record = str::del_after_first_slash(line);
+        if (record.empty() || (record.back() != RawConsts::slash))
+            continue;
+
+        auto name = str::trim(record.substr(0, record.size() - 1));
+        if (name.find('$') != std::string_view::npos)
+            continue;
+
+        if ((name.size() > 1) && (name.front() == RawConsts::quote)) {
+            name.remove_prefix(1);
+            name = name.substr(0, name.find(RawConsts::quote));
+        }
+
+        std::string path { str::trim(name) };
+        if (path.empty())
+            continue;
+
+        std::replace(path.begin(), path.end(), '\\', '/');
+
+        std::filesystem::path includeFile(path);
+        if (includeFile.is_relative())
+            includeFile = rootPath / includeFile;
+
+        std::error_code ec;
+        includeFile = std::filesystem::canonical(includeFile, ec);
+        if (!ec)
+            files.push_back(std::move(includeFile));
+    }
+
+    return files;
+}
+
+/*
+ * Reads and cleans INCLUDE files on background threads ahead of the
+ * parser.  Files are queued in the order in which the parser is expected
+ * to include them and at most 'max_pending' files are read, or held in
+ * memory, ahead of the parser at any one time.  The parser still consumes
+ * its input sequentially, so the resulting deck does not depend on the
+ * number of background threads.
+ */
+class IncludePrefetcher {
+    public:
+        IncludePrefetcher( std::size_t max_pending,
+                           const std::vector<std::pair<std::string, std::string>>& code_keywords );
+
+        /// Queue files to be included before any file already queued.
+        void schedule( const std::vector<std::filesystem::path>& files );
+
+        /// Cleaned contents of a queued file.  Nullopt if the file was
+        /// not queued, or could not be read in the background, in which
+        /// case the caller should read the file itself.
+        std::optional<std::string> take( const std::filesystem::path& inputFile );
+
+    private:
+        struct Entry {
+            std::filesystem::path path;
+            std::future<std::optional<std::string>> input;
+        };
+
+        std::size_t max_pending;
+        const std::vector<std::pair<std::string, std::string>>& code_keywords;
+        std::deque<Entry> queue;
+
+        void launch();
+};
+
+IncludePrefetcher::IncludePrefetcher( std::size_t max_pending_arg,
+                                      const std::vector<std::pair<std::string, std::string>>& code_keywords_arg ) :
+    max_pending( max_pending_arg ),
+    code_keywords( code_keywords_arg )
+{}
+
+void IncludePrefetcher::schedule( const std::vector<std::filesystem::path>& files ) {
+    for (auto file = files.rbegin(); file != files.rend(); ++file)
+        this->queue.push_front( Entry{ *file, {} } );
+
+    this->launch();
+}
+
+std::optional<std::string> IncludePrefetcher::take( const std::filesystem::path& inputFile ) {
+    auto pos = std::ranges::find(this->queue, inputFile, &Entry::path);
+    if (pos == this->queue.end())
+        return {};
+
+    auto entry = std::move(*pos);
+
+    // Files queued ahead of this one were not included after all.
+    this->queue.erase(this->queue.begin(), pos + 1);
+    this->launch();
+
+    if (!entry.input.valid())
+        return {};
+
+    try {
+        return entry.input.get();
+    } catch (const std::exception&) {
+        // Let the caller read the file again and report the problem.
+        return {};
+    }
+}
+
+void IncludePrefetcher::launch() {
+    auto running = std::ranges::count_if(this->queue, [](const Entry& entry)
+                                         { return entry.input.valid(); });
+
+    for (auto& entry : this->queue) {
+        if (static_cast<std::size_t>(running) >= this->max_pending)
+            break;
+
+        if (entry.input.valid())
+            continue;
+
+        entry.input = std::async(std::launch::async,
+                                 [path = entry.path, &code_keywords = this->code_keywords]()
+                                 -> std::optional<std::string>
+        {
+            auto buffer = readInputFile(path);
+            if (!buffer)
+                return {};
+
+            return str::clean(code_keywords, *buffer);
+        });
+
+        ++running;
+    }
+}
+
 class ParserState {
     public:
         ParserState( const std::vector<std::pair<std::string,std::string>>&,
@@ -494,7 +674,8 @@ class ParserState {
                      const ParseContext&, ErrorGuard&,
                      const std::filesystem::path&,
                      std::shared_ptr<Python> python,
-                     const std::set<Opm::Ecl::SectionType>& ignore = {});
+                     const std::set<Opm::Ecl::SectionType>& ignore = {},
+                     std::size_t include_prefetch = 0);
 
         void loadString( const std::string& );
         void loadFile( const std::filesystem::path& );
@@ -526,6 +707,7 @@ class ParserState {
     private:
         const std::vector<std::pair<std::string, std::string>> code_keywords;
         InputStack input_stack;
+        std::unique_ptr<IncludePrefetcher> prefetcher;
 
         std::set<Opm::Ecl::SectionType> ignore_sections;
         std::map< std::string, std::string > pathMap;
@@ -543,6 +725,10 @@ class ParserState {
         const ParseContext& parseContext;
         ErrorGuard& errors;
         bool unknown_keyword = false;
+        bool has_python_input = false;
+
+        // Referenced input files which do not exist.
+        mutable std::vector<std::string> missing_files;
 };
 
 const std::filesystem::path& ParserState::current_path() const {
@@ -609,7 +795,8 @@ ParserState::ParserState( const std::vector<std::pair<std::string, std::string>>
                           ErrorGuard& errors_arg,
                           const std::filesystem::path& p,
                           std::shared_ptr<Python> interpreter,
-                          const std::set<Opm::Ecl::SectionType>& ignore ) :
+                          const std::set<Opm::Ecl::SectionType>& ignore,
+                          std::size_t include_prefetch ) :
     code_keywords(code_keywords_arg),
     ignore_sections(ignore),
     rootPath( std::filesystem::canonical( p ).parent_path() ),
@@ -617,6 +804,9 @@ ParserState::ParserState( const std::vector<std::pair<std::string, std::string>>
     parseContext( context ),
     errors( errors_arg )
 {
+    if (include_prefetch > 0)
+        this->prefetcher = std::make_unique<IncludePrefetcher>(include_prefetch, this->code_keywords);
+
     openRootFile( p );
 }
 
@@ -667,37 +857,26 @@ void ParserState::loadString(const std::string& input) {
 
 void ParserState::loadFile(const std::filesystem::path& inputFile) {
 
-    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
-    std::unique_ptr<std::FILE, decltype(closer)> ufp{
-        std::fopen( inputFile.generic_string().c_str(), "rb" ),
-        closer
-    };
+    auto input = this->prefetcher ? this->prefetcher->take( inputFile ) : std::nullopt;
 
-    // make sure the file we'd like to parse is readable
-    if( !ufp ) {
-        std::string msg = "Could not read from file: " + inputFile.string();
-        parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, {}, errors);
-        return;
-    }
+    if (!input) {
+        const auto buffer = readInputFile( inputFile );
 
-    /*
-     * read the input file C-style. This is done for performance
-     * reasons, as streams are slow
-     */
+        // make sure the file we'd like to parse is readable
+        if( !buffer ) {
+            this->missing_files.push_back(std::filesystem::absolute(inputFile).lexically_normal().generic_string());
+            std::string msg = "Could not read from file: " + inputFile.string();
+            parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, {}, errors);
+            return;
+        }
 
-    auto* fp = ufp.get();
-    std::string buffer;
-    std::fseek( fp, 0, SEEK_END );
-    buffer.resize( std::ftell( fp ) + 1 );
-    std::rewind( fp );
-    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
-    buffer.back() = '\n';
+        input = str::clean( this->code_keywords, *buffer );
+    }
 
-    if( std::ferror( fp ) || readc != buffer.size() - 1 )
-        throw std::runtime_error( "Error when reading input file '"
-                                  + inputFile.string() + "'" );
+    if (this->prefetcher)
+        this->prefetcher->schedule( includeCandidates( *input, this->rootPath ) );
 
-    this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+    this->input_stack.push( std::move( *input ), inputFile );
 }
 
 /*
@@ -774,6 +953,7 @@ std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::strin
     try {
         includeFilePath = std::filesystem::canonical(includeFilePath);
     } catch (const std::filesystem::filesystem_error& fs_error) {
+        this->missing_files.push_back(includeFilePath.lexically_normal().generic_string());
         parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE ,
                                   fmt::format("File '{}' included via INCLUDE"
                                               " directive does not exist.",
@@ -1559,6 +1739,7 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
                     if (parserState.python) {
+                        parserState.has_python_input = true;
                         std::string python_string = rawKeyword->getFirstRecord().getRecordString();
                         parserState.python->exec(python_string, parser, parserState.deck);
                     }
@@ -1734,13 +1915,48 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
         else
             data_file = std::filesystem::proximate(std::filesystem::canonical(dataFileName)).generic_string();
 
+        /*
+          The deck cache is keyed on every setting which affects the parsed
+          deck, including the .DATA file name as internalized in the deck.
+          Decks with errors, or with keywords generated by PYINPUT, are
+          never cached.  Log messages and warnings of the parse are stored
+          with the deck and emitted again when it is loaded.
+        */
+        std::optional<DeckCache> cache;
+        std::optional<DeckCache::Recorder> recorder;
+        std::size_t cache_configuration = 0;
+        if (! this->cacheDirectory().empty()) {
+            auto settings = this->getAllDeckNames();
+            for (const auto& [code_begin, code_end] : this->codeKeywords()) {
+                settings.push_back(code_begin);
+                settings.push_back(code_end);
+            }
+            for (const auto& section : ignore_sections)
+                settings.push_back(fmt::format("ignore section {}", static_cast<int>(section)));
+
+            settings.push_back(data_file);
+            settings.push_back(std::filesystem::current_path().generic_string());
+
+            cache.emplace(this->cacheDirectory());
+            cache_configuration = DeckCache::configuration(parseContext, settings);
+
+            auto deck = cache->load(data_file, cache_configuration, errors);
+            if (deck.has_value()) {
+                ++this->deckCacheHitCount;
+                return std::move(*deck);
+            }
+
+            recorder.emplace(errors);
+        }
+
         ParserState parserState {
             this->codeKeywords(),
             parseContext,
             errors,
             data_file,
             this->m_python,
-            ignore_sections
+            ignore_sections,
+            this->includePrefetch()
         };
 
         parseState(parserState, *this, errors);
@@ -1750,6 +1966,10 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
         if (ignore.size() > 0)
             cleanup_deck_keyword_list(parserState, ignore);
 
+        if (cache.has_value() && !errors && !parserState.has_python_input)
+            cache->store(data_file, cache_configuration, parserState.deck,
+                         recorder->diagnostics(std::move(parserState.missing_files)));
+
         return std::move( parserState.deck );
     }
 
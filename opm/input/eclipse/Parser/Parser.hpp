@@ -172,12 +172,33 @@ namespace Opm {
         bool silent() const { return silentMode; }
         void silent(bool newSilentMode) { silentMode = newSilentMode; }
 
+        /// Number of INCLUDE files which parseFile() may read and strip of
+        /// comments on background threads, ahead of the keyword parser.
+        /// Keywords are still parsed sequentially, in deck order.  Zero,
+        /// the default, reads each file once the parser reaches it.
+        std::size_t includePrefetch() const { return includePrefetchCount; }
+        void includePrefetch(std::size_t numFiles) { includePrefetchCount = numFiles; }
+
+        /// Directory of on-disk deck cache used by parseFile().  Runs
+        /// whose input files are all unchanged since a previous run with
+        /// the same parser settings load the deck from the cache instead
+        /// of parsing it.  Empty, the default, disables the cache.
+        const std::string& cacheDirectory() const { return deckCacheDirectory; }
+        void cacheDirectory(const std::string& directory) { deckCacheDirectory = directory; }
+
+        /// Number of parseFile() calls which loaded the deck from the
+        /// on-disk deck cache.
+        std::size_t cacheHits() const { return deckCacheHitCount; }
+
         static constexpr int SILENT_MODE_MIN_DEBUG_VERBOSITY_LEVEL {3}; // Debug level at which to emit silenced messeages to the debug log
 
     private:
         std::shared_ptr<Python> m_python{};
 
         bool silentMode {false}; // Silence information messages (warnings and errors are still emitted)
+        std::size_t includePrefetchCount {0}; // INCLUDE files to read ahead of the parser
+        std::string deckCacheDirectory {}; // On-disk deck cache, empty if disabled
+        mutable std::size_t deckCacheHitCount {0}; // parseFile() calls served from deck cache
 
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
         std::list<ParserKeyword> keyword_storage{};
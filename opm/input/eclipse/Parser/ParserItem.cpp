@@ -453,6 +453,10 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
             return;
         }
 
+        // Bulk arrays such as ZCORN or PERMX hold one value per element
+        // unless repeat counts are used, so size the item's storage once.
+        deck_item.reserve_additional(record.size());
+
         while( record.size() > 0 ) {
             auto token = record.pop_front();
 
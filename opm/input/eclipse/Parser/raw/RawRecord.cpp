@@ -24,7 +24,7 @@
 #include "RawConsts.hpp"
 
 #include <algorithm>
-#include <deque>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -35,34 +35,6 @@ namespace Opm {
 
 namespace {
 
-std::deque< std::string_view > splitSingleRecordString( const std::string_view& record ) {
-    auto first_nonspace = []( std::string_view::const_iterator begin,
-                              std::string_view::const_iterator end ) {
-        return std::find_if_not( begin, end, RawConsts::is_separator() );
-    };
-
-    std::deque< std::string_view > dst;
-    auto current = record.begin();
-    while( (current = first_nonspace( current, record.end() )) != record.end() )
-    {
-        if( *current == RawConsts::quote ) {
-            auto quote_end = std::find( current + 1, record.end(), RawConsts::quote ) + 1;
-            const std::size_t beg = std::distance(record.begin(), current);
-            const std::size_t size = std::distance(current, quote_end);
-            dst.push_back(record.substr(beg, size));
-            current = quote_end;
-        } else {
-            const auto token_end = std::find_if(current, record.end(), RawConsts::is_separator());
-            const std::size_t beg = std::distance(record.begin(), current);
-            const std::size_t size = std::distance(current, token_end);
-            dst.push_back(record.substr(beg, size));
-            current = token_end;
-        }
-    }
-
-    return dst;
-}
-
 /*
     * It is assumed that after a record is terminated, there is no quote marks
     * in the subsequent comment. This is in accordance with the Eclipse user
@@ -84,17 +56,24 @@ inline bool even_quotes( const T& str ) {
         m_sanitizedRecordString( singleRecordString )
     {
 
-        if (text)
-            this->m_recordItems.push_back(this->m_sanitizedRecordString);
+        if (text) {
+            this->m_pushedItems.emplace_back(this->m_sanitizedRecordString, 1);
+            this->m_next = this->m_sanitizedRecordString.size();
+            this->m_size = 1;
+        }
         else {
-            this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
-
             if( !even_quotes( singleRecordString ) ) {
                 std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
                 throw OpmInputError(error, location);
             }
+
+            // Count the elements without storing them.  They are split off
+            // the record string again as they are consumed.
+            auto pos = std::size_t{0};
+            while (! this->splitToken(pos).empty())
+                ++this->m_size;
         }
-        this->m_max_size = this->m_recordItems.size();
+        this->m_max_size = this->m_size;
     }
 
     RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location) :
@@ -102,7 +81,11 @@ inline bool even_quotes( const T& str ) {
     {}
 
     void RawRecord::push_front( std::string_view tok, std::size_t count ) {
-        this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
+        if (count == 0)
+            return;
+
+        this->m_pushedItems.emplace_back(tok, count);
+        this->m_size += count;
         this->m_max_size += count;
     }
 
@@ -113,4 +96,49 @@ inline bool even_quotes( const T& str ) {
     std::size_t RawRecord::max_size() const {
         return this->m_max_size;
     }
+
+    std::string_view RawRecord::getItem(std::size_t index) const {
+        if (index >= this->m_size)
+            throw std::out_of_range {
+                fmt::format("Record item index {} out of range [0, {})", index, this->m_size)
+            };
+
+        for (auto item = this->m_pushedItems.rbegin(); item != this->m_pushedItems.rend(); ++item) {
+            if (index < item->second)
+                return item->first;
+
+            index -= item->second;
+        }
+
+        auto pos = this->m_next;
+        auto token = this->splitToken(pos);
+        for (; index > 0; --index)
+            token = this->splitToken(pos);
+
+        return token;
+    }
+
+    std::string_view RawRecord::splitToken(std::size_t& pos) const {
+        const auto& record = this->m_sanitizedRecordString;
+
+        const auto begin = std::find_if_not(record.begin() + pos, record.end(), RawConsts::is_separator());
+        if (begin == record.end()) {
+            pos = record.size();
+            return {};
+        }
+
+        auto end = record.end();
+        if (*begin == RawConsts::quote) {
+            // Keep the closing quote as part of the element.
+            end = std::find(begin + 1, record.end(), RawConsts::quote);
+            if (end != record.end())
+                ++end;
+        } else
+            end = std::find_if(begin, record.end(), RawConsts::is_separator());
+
+        const std::size_t beg = std::distance(record.begin(), begin);
+        pos = std::distance(record.begin(), end);
+
+        return record.substr(beg, pos - beg);
+    }
 }
@@ -21,18 +21,21 @@
 #define RECORD_HPP
 
 #include <cstddef>
-#include <deque>
-#include <list>
-#include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace Opm {
 class KeywordLocation;
 
     /// Class representing the lowest level of the Raw datatypes, a record. A record is simply
-    /// a vector containing the record elements, represented as strings. Some logic is present
+    /// a sequence of record elements, represented as strings. Some logic is present
     /// to handle special elements in a record string, particularly with quote characters.
+    ///
+    /// Elements are split off the record string on demand rather than up
+    /// front, so a record holding the millions of values of a bulk GRID
+    /// array, e.g., ZCORN or PERMX, does not need any per-element storage.
 
     class RawRecord {
     public:
@@ -46,12 +49,23 @@ class KeywordLocation;
         std::size_t max_size() const;
 
         std::string getRecordString() const;
-        inline std::string_view getItem(std::size_t index) const;
+        std::string_view getItem(std::size_t index) const;
 
     private:
         std::string_view m_sanitizedRecordString;
-        std::deque< std::string_view > m_recordItems;
-        std::size_t m_max_size;
+
+        /// Position in m_sanitizedRecordString from which to split off the
+        /// next element.
+        std::size_t m_next{0};
+
+        /// Elements reinserted by push_front(), each repeated a number of
+        /// times.  The front of the record is the back of the vector.
+        std::vector< std::pair< std::string_view, std::size_t > > m_pushedItems;
+
+        std::size_t m_size{0};
+        std::size_t m_max_size{0};
+
+        std::string_view splitToken(std::size_t& pos) const;
     };
 
     /*
@@ -59,21 +73,29 @@ class KeywordLocation;
      * inlining the calls gives a decent low-effort performance benefit.
      */
     std::string_view RawRecord::pop_front() {
-        auto result = m_recordItems.front();
-        this->m_recordItems.pop_front();
+        --this->m_size;
+
+        if (this->m_pushedItems.empty())
+            return this->splitToken(this->m_next);
+
+        auto& [token, count] = this->m_pushedItems.back();
+        const auto result = token;
+        if (--count == 0)
+            this->m_pushedItems.pop_back();
+
         return result;
     }
 
     std::string_view RawRecord::front() const {
-        return this->m_recordItems.front();
-    }
+        if (! this->m_pushedItems.empty())
+            return this->m_pushedItems.back().first;
 
-    std::size_t RawRecord::size() const {
-        return m_recordItems.size();
+        auto pos = this->m_next;
+        return this->splitToken(pos);
     }
 
-    std::string_view RawRecord::getItem(std::size_t index) const {
-        return this->m_recordItems.at( index );
+    std::size_t RawRecord::size() const {
+        return this->m_size;
     }
 }
 
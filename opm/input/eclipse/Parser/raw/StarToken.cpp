@@ -25,13 +25,164 @@
 #include <boost/spirit/include/qi.hpp>
 
 #include <cctype>
+#include <charconv>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 
 namespace qi = boost::spirit::qi;
 
+namespace {
+
+    bool isDigit(const char c)
+    {
+        return (c >= '0') && (c <= '9');
+    }
+
+    // Fast path for the common forms of integer tokens, e.g., "123" or
+    // "-45".  Nullopt for anything else, including out of range values,
+    // which is left to the general parser.
+    std::optional<int> fastInt(std::string_view view)
+    {
+        if (view.empty() || (view.front() == '+')) {
+            return std::nullopt;
+        }
+
+        int n = 0;
+        const auto* last = view.data() + view.size();
+        const auto [ptr, ec] = std::from_chars(view.data(), last, n);
+
+        if ((ec == std::errc{}) && (ptr == last)) {
+            return n;
+        }
+
+        return std::nullopt;
+    }
+
+    // Fast path for the common forms of floating point tokens, i.e.,
+    //
+    //   [+-]digits[.digits][(E|e|D|d)[+-]digits]
+    //
+    // with at least one digit in the mantissa on either side of an
+    // optional decimal point, e.g., "0.25", "-1.5E+03", ".5", or "2.0D-3".
+    // Nullopt for anything else, including out of range values and special
+    // values such as "inf", which are left to the general parser.
+    //
+    // Values whose decimal significand and power of ten are both exactly
+    // representable, which covers the vast majority of deck input, are
+    // converted with a single multiplication or division.  Others go
+    // through std::from_chars().  Both are correctly rounded.
+    std::optional<double> fastDouble(std::string_view view)
+    {
+        static constexpr double powers_of_ten[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+        };
+
+        const auto* p = view.data();
+        const auto* const end = p + view.size();
+
+        if (p == end) {
+            return std::nullopt;
+        }
+
+        const auto negative = *p == '-';
+        if (negative || (*p == '+')) {
+            ++p;
+        }
+
+        // Leading zeros count towards 'num_digits', so the significand
+        // is only known to be exact if there are few digits in total.
+        auto significand = std::uint64_t{0};
+        auto num_digits = 0;
+        auto exponent = 0;
+
+        for (; (p != end) && isDigit(*p); ++p, ++num_digits) {
+            significand = 10*significand + (*p - '0');
+        }
+
+        if ((p != end) && (*p == '.')) {
+            for (++p; (p != end) && isDigit(*p); ++p, ++num_digits) {
+                significand = 10*significand + (*p - '0');
+                --exponent;
+            }
+        }
+
+        if (num_digits == 0) {
+            return std::nullopt;
+        }
+
+        if (p != end) {
+            if ((*p != 'e') && (*p != 'E') && (*p != 'd') && (*p != 'D')) {
+                return std::nullopt;
+            }
+
+            ++p;
+
+            const auto exp_negative = (p != end) && (*p == '-');
+            if ((p != end) && ((*p == '+') || (*p == '-'))) {
+                ++p;
+            }
+
+            if ((p == end) || !isDigit(*p)) {
+                return std::nullopt;
+            }
+
+            auto exp_value = 0;
+            for (; (p != end) && isDigit(*p); ++p) {
+                if (exp_value < 10000) {
+                    exp_value = 10*exp_value + (*p - '0');
+                }
+            }
+
+            if (p != end) {
+                return std::nullopt;
+            }
+
+            exponent += exp_negative ? -exp_value : exp_value;
+        }
+
+        if ((num_digits <= 15) && (exponent >= -22) && (exponent <= 22)) {
+            // Significand below 10^15 < 2^53 and power of ten are exact.
+            auto value = static_cast<double>(significand);
+            value = (exponent < 0)
+                ? value / powers_of_ten[-exponent]
+                : value * powers_of_ten[exponent];
+
+            return negative ? -value : value;
+        }
+
+        // std::from_chars() accepts neither a leading '+' nor the Fortran
+        // 'D' exponent, so normalise into a local buffer.  Numbers longer
+        // than this are unusual enough to take the slow path.
+        char buffer[64];
+        if (view.size() > sizeof buffer) {
+            return std::nullopt;
+        }
+
+        auto len = std::size_t{0};
+        for (auto i = std::size_t{view.front() == '+'}; i < view.size(); ++i) {
+            const auto c = view[i];
+            buffer[len++] = ((c == 'd') || (c == 'D')) ? 'e' : c;
+        }
+
+        double n = 0.0;
+        const auto [ptr, ec] = std::from_chars(buffer, buffer + len, n);
+
+        if ((ec == std::errc{}) && (ptr == buffer + len)) {
+            return n;
+        }
+
+        return std::nullopt;
+    }
+
+} // Anonymous namespace
+
 namespace Opm {
 
     StarToken::StarToken(const std::string_view& token)
@@ -79,6 +230,9 @@ namespace Opm {
 
     template<>
     int readValueToken< int >( std::string_view view ) {
+        if (const auto fast = fastInt(view); fast.has_value())
+            return *fast;
+
         int n = 0;
         auto cursor = view.begin();
         const bool ok = qi::parse( cursor, view.end(), qi::int_, n );
@@ -104,6 +258,9 @@ namespace Opm {
 
     template<>
     double readValueToken< double >( std::string_view view ) {
+        if (const auto fast = fastDouble(view); fast.has_value())
+            return *fast;
+
         double n = 0;
         qi::real_parser< double, fortran_double< double > > double_;
         auto cursor = view.begin();
@@ -133,6 +290,9 @@ namespace Opm {
 
     template<>
     UDAValue readValueToken< UDAValue >( std::string_view view ) {
+        if (const auto fast = fastDouble(view); fast.has_value())
+            return UDAValue(*fast);
+
         double n = 0;
         qi::real_parser< double, fortran_double< double > > double_;
         auto cursor = view.begin();
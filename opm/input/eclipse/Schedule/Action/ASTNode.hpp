@@ -30,6 +30,7 @@
 
 namespace Opm::Action {
     class Context;
+    class Program;
 } // namespace Opm::Action
 
 namespace Opm::Action {
@@ -165,6 +166,8 @@ public:
     }
 
 private:
+    friend class Program;
+
     // Note: data member order here is dictated by initialisation list in
     // four-argument constructor.
 
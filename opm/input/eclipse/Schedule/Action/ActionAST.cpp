@@ -22,6 +22,7 @@
 #include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionParser.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionProgram.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 
 #include <memory>
@@ -33,7 +34,9 @@ Opm::Action::AST::AST() = default;
 
 Opm::Action::AST::AST(const std::vector<std::string>& tokens)
     : condition { Parser::parseCondition(tokens) }
-{}
+{
+    this->compile();
+}
 
 Opm::Action::AST::~AST() = default;
 
@@ -42,10 +45,13 @@ Opm::Action::AST::AST(const AST& rhs)
     if (rhs.condition != nullptr) {
         this->condition = std::make_unique<ASTNode>(*rhs.condition);
     }
+
+    this->compile();
 }
 
 Opm::Action::AST::AST(AST&& rhs)
     : condition { std::move(rhs.condition) }
+    , program   { std::move(rhs.program) }
 {}
 
 Opm::Action::AST&
@@ -58,6 +64,8 @@ Opm::Action::AST::operator=(const AST& rhs)
         else {
             this->condition = std::make_unique<ASTNode>(*rhs.condition);
         }
+
+        this->compile();
     }
 
     return *this;
@@ -68,6 +76,7 @@ Opm::Action::AST::operator=(AST&& rhs)
 {
     if (this != &rhs) {
         this->condition = std::move(rhs.condition);
+        this->program = std::move(rhs.program);
     }
 
     return *this;
@@ -77,6 +86,7 @@ Opm::Action::AST Opm::Action::AST::serializationTestObject()
 {
     AST result;
     result.condition = std::make_unique<ASTNode>(ASTNode::serializationTestObject());
+    result.compile();
 
     return result;
 }
@@ -88,6 +98,10 @@ Opm::Action::AST::eval(const Action::Context& context) const
         return Result { false };
     }
 
+    if (this->program != nullptr) {
+        return this->program->eval(context);
+    }
+
     return this->condition->eval(context);
 }
 
@@ -107,3 +121,16 @@ void Opm::Action::AST::required_summary(std::unordered_set<std::string>& require
 
     this->condition->required_summary(required_summary);
 }
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+void Opm::Action::AST::compile()
+{
+    this->program.reset();
+
+    if ((this->condition != nullptr) && ! this->condition->empty()) {
+        this->program = Program::compile(*this->condition);
+    }
+}
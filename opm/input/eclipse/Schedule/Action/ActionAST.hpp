@@ -31,6 +31,7 @@ namespace Opm::Action {
 
 class Context;
 class ASTNode;
+class Program;
 
 } // namespace Opm::Action
 
@@ -41,6 +42,10 @@ namespace Opm::Action {
 /// There is no additional context such as current summary vector values or
 /// a set of active wells.  This must be supplied through an Action::Context
 /// instace when invoking the eval() member function.
+///
+/// The expression tree is compiled into a flat Program on construction,
+/// copying, and deserialisation, and eval() uses that program whenever the
+/// condition could be compiled.
 
 class AST
 {
@@ -119,6 +124,10 @@ public:
     void serializeOp(Serializer& serializer)
     {
         serializer(condition);
+
+        if (! serializer.isSerializing()) {
+            this->compile();
+        }
     }
 
     /// Export all summary vectors needed to evaluate the expression tree.
@@ -132,6 +141,13 @@ public:
 private:
     /// Internalised condition object in expression tree form.
     std::unique_ptr<ASTNode> condition{};
+
+    /// Compiled form of condition.  Null if the condition is empty or
+    /// could not be compiled.
+    std::unique_ptr<Program> program{};
+
+    /// Form compiled program from current condition.
+    void compile();
 };
 
 } // namespace Opm::Action
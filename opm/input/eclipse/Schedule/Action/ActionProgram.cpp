@@ -0,0 +1,451 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Action/ActionProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+
+#include <opm/common/utility/shmatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace {
+
+bool isComparisonOperator(const Opm::Action::TokenType op)
+{
+    return (op == Opm::Action::TokenType::op_gt)
+        || (op == Opm::Action::TokenType::op_ge)
+        || (op == Opm::Action::TokenType::op_lt)
+        || (op == Opm::Action::TokenType::op_le)
+        || (op == Opm::Action::TokenType::op_eq)
+        || (op == Opm::Action::TokenType::op_ne)
+        ;
+}
+
+bool comparisonHolds(const double                 lhs,
+                     const Opm::Action::TokenType op,
+                     const double                 rhs)
+{
+    switch (op) {
+    case Opm::Action::TokenType::op_gt: return lhs >  rhs;
+    case Opm::Action::TokenType::op_ge: return lhs >= rhs;
+    case Opm::Action::TokenType::op_lt: return lhs <  rhs;
+    case Opm::Action::TokenType::op_le: return lhs <= rhs;
+    case Opm::Action::TokenType::op_eq: return lhs == rhs;
+    default:                            return lhs != rhs;
+    }
+}
+
+/// Same as ASTNode's handling of well name templates with a leading
+/// backslash, e.g., '\*P*'.
+std::string normalisePattern(const std::string& patt)
+{
+    return (patt.front() == '\\') ? patt.substr(1) : patt;
+}
+
+bool lessByName(const std::string* w1, const std::string* w2)
+{
+    return *w1 < *w2;
+}
+
+} // Anonymous namespace
+
+std::unique_ptr<Opm::Action::Program>
+Opm::Action::Program::compile(const ASTNode& root)
+{
+    auto program = std::make_unique<Program>();
+
+    if (! program->lower(root, 0).has_value()) {
+        return {};
+    }
+
+    program->selections_.resize(program->num_selections_);
+
+    return program;
+}
+
+Opm::Action::Result
+Opm::Action::Program::eval(const Context& context) const
+{
+    auto state = EvalState{};
+    state.stack.resize(this->max_depth_);
+    state.selections.resize(this->num_selections_);
+
+    auto depth = std::size_t{0};
+
+    for (auto pc = 0*this->code_.size(); pc < this->code_.size();) {
+        const auto& insn = this->code_[pc];
+
+        const MatchSet* done = nullptr;
+        switch (insn.op) {
+        case OpCode::Begin: {
+            auto& acc = state.stack[depth++];
+
+            acc.op = insn.type;
+            acc.value = insn.type == TokenType::op_and;
+            acc.has_wells = false;
+            acc.wells.clear();
+
+            ++pc;
+            continue;
+        }
+
+        case OpCode::Compare:
+            this->compare(insn, context, state);
+            done = &state.leaf;
+            break;
+
+        case OpCode::End:
+            done = &state.stack[--depth];
+            break;
+        }
+
+        if (depth == 0) {
+            return this->make_result(*done);
+        }
+
+        auto& parent = state.stack[depth - 1];
+        this->combine(parent, *done, state);
+
+        const auto decided = (parent.op == TokenType::op_and)
+            ? !parent.value : parent.value;
+
+        pc = decided ? insn.skip : pc + 1;
+    }
+
+    return Result { false };
+}
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+std::optional<bool>
+Opm::Action::Program::lower(const ASTNode& node, const std::size_t depth)
+{
+    // Returns whether or not the (sub-)expression may contribute matching
+    // wells, or nullopt if the expression cannot be compiled.
+
+    if (node.empty()) {
+        return std::nullopt;
+    }
+
+    if ((node.type == TokenType::op_and) || (node.type == TokenType::op_or)) {
+        this->max_depth_ = std::max(this->max_depth_, depth + 1);
+        this->code_.push_back({ .op = OpCode::Begin, .type = node.type });
+
+        auto start = std::vector<std::size_t>{};
+        auto has_wells = std::vector<bool>{};
+        for (const auto& child : node.children) {
+            start.push_back(this->code_.size());
+
+            const auto child_wells = this->lower(child, depth + 1);
+            if (! child_wells.has_value()) {
+                return std::nullopt;
+            }
+
+            has_wells.push_back(*child_wells);
+        }
+
+        const auto end = this->code_.size();
+        this->code_.push_back({ .op = OpCode::End, .type = node.type });
+
+        // A false conjunction stays false, so skip to its end.  A true
+        // disjunction stays true, but must still collect matching wells
+        // from the next sub-expression that may provide them.
+        auto next_with_wells = end;
+        for (auto i = start.size(); i > 0; --i) {
+            const auto last = ((i < start.size()) ? start[i] : end) - 1;
+
+            this->code_[last].skip = (node.type == TokenType::op_and)
+                ? end : next_with_wells;
+
+            if (has_wells[i - 1]) {
+                next_with_wells = start[i - 1];
+            }
+        }
+
+        return std::ranges::any_of(has_wells, [](const bool w) { return w; });
+    }
+
+    if (! isComparisonOperator(node.type) ||
+        (node.size() != 2) ||
+        ! node.children[0].empty() ||
+        ! node.children[1].empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto& lhs_node = node.children[0];
+    const auto& rhs_node = node.children[1];
+
+    auto insn = Instruction { .op = OpCode::Compare, .type = node.type };
+
+    auto lhs = this->lower_operand(lhs_node);
+    auto rhs = this->lower_operand(rhs_node);
+    if (! lhs.has_value() || ! rhs.has_value() ||
+        ((rhs->kind != OperandKind::Number) &&
+         (rhs->kind != OperandKind::Scalar)))
+    {
+        return std::nullopt;
+    }
+
+    // Numeric month indices are compared to the nearest integer, see
+    // ASTNode::evalComparison().
+    if ((lhs_node.func_type == FuncType::time_month) &&
+        (rhs->kind == OperandKind::Number))
+    {
+        rhs->value = std::round(rhs->value);
+    }
+
+    insn.lhs = *lhs;
+    insn.rhs = *rhs;
+    this->code_.push_back(insn);
+
+    return (lhs->kind != OperandKind::Number)
+        && (lhs->kind != OperandKind::Scalar);
+}
+
+std::optional<Opm::Action::Program::Operand>
+Opm::Action::Program::lower_operand(const ASTNode& leaf)
+{
+    auto operand = Operand{};
+
+    if (leaf.type == TokenType::number) {
+        operand.kind = OperandKind::Number;
+        operand.value = leaf.number;
+
+        return operand;
+    }
+
+    if (leaf.arg_list.empty()) {
+        operand.kind = OperandKind::Scalar;
+        operand.key = this->name_index(leaf.func);
+
+        return operand;
+    }
+
+    if (leaf.argListIsPattern()) {
+        if (leaf.func_type != FuncType::well) {
+            return std::nullopt;
+        }
+
+        const auto is_list = leaf.argListIsWellList();
+
+        operand.kind = is_list ? OperandKind::WellList : OperandKind::WellPattern;
+        operand.key = this->name_index(leaf.func);
+        operand.name = this->name_index(is_list
+                                        ? leaf.arg_list.front()
+                                        : normalisePattern(leaf.arg_list.front()));
+
+        operand.selection = this->num_selections_++;
+
+        return operand;
+    }
+
+    operand.key = this->name_index
+        (fmt::format("{}:{}", leaf.func, fmt::join(leaf.arg_list, ":")));
+
+    if (leaf.func_type != FuncType::well) {
+        operand.kind = OperandKind::Scalar;
+    }
+    else {
+        operand.kind = OperandKind::Well;
+        operand.name = this->name_index(leaf.arg_list.front());
+    }
+
+    return operand;
+}
+
+std::size_t Opm::Action::Program::name_index(const std::string& name)
+{
+    auto pos = std::ranges::find(this->names_, name);
+    if (pos == this->names_.end()) {
+        pos = this->names_.insert(pos, name);
+    }
+
+    return std::distance(this->names_.begin(), pos);
+}
+
+double Opm::Action::Program::scalar_value(const Operand&  operand,
+                                          const Context& context) const
+{
+    return (operand.kind == OperandKind::Number)
+        ? operand.value
+        : context.get(this->names_[operand.key]);
+}
+
+const Opm::Action::Program::WellSelection&
+Opm::Action::Program::select(const Operand&  operand,
+                             const Context&  context,
+                             EvalState&      state) const
+{
+    const auto& func = this->names_[operand.key];
+    const auto& name = this->names_[operand.name];
+
+    auto candidates = (operand.kind == OperandKind::WellList)
+        ? context.wlist_manager().wells(name)
+        : context.wells(func);
+
+    auto& selection = state.selections[operand.selection];
+    {
+        std::lock_guard<std::mutex> lock { this->selection_lock_ };
+        selection = this->selections_[operand.selection];
+    }
+
+    if ((selection != nullptr) && (candidates == selection->candidates)) {
+        return *selection;
+    }
+
+    auto fresh = std::make_shared<WellSelection>();
+    fresh->candidates.swap(candidates);
+
+    for (const auto& well : fresh->candidates) {
+        if ((operand.kind == OperandKind::WellList) || shmatch(name, well)) {
+            fresh->wells.push_back(well);
+            fresh->keys.push_back(fmt::format("{}:{}", func, well));
+        }
+    }
+
+    selection = std::move(fresh);
+    {
+        std::lock_guard<std::mutex> lock { this->selection_lock_ };
+        this->selections_[operand.selection] = selection;
+    }
+
+    return *selection;
+}
+
+void Opm::Action::Program::compare(const Instruction& insn,
+                                   const Context&     context,
+                                   EvalState&         state) const
+{
+    // Right hand side first, as in ASTNode::evalComparison(), so that
+    // missing summary vectors are reported in the same order.
+    const auto rhs = this->scalar_value(insn.rhs, context);
+
+    auto& leaf = state.leaf;
+    leaf.wells.clear();
+
+    switch (insn.lhs.kind) {
+    case OperandKind::Number:
+    case OperandKind::Scalar:
+        leaf.value = comparisonHolds(this->scalar_value(insn.lhs, context), insn.type, rhs);
+        leaf.has_wells = false;
+        return;
+
+    case OperandKind::Well:
+        if (comparisonHolds(context.get(this->names_[insn.lhs.key]), insn.type, rhs)) {
+            leaf.wells.push_back(&this->names_[insn.lhs.name]);
+        }
+        break;
+
+    case OperandKind::WellPattern:
+    case OperandKind::WellList: {
+        const auto& selection = this->select(insn.lhs, context, state);
+
+        for (auto i = 0*selection.wells.size(); i < selection.wells.size(); ++i) {
+            if (comparisonHolds(context.get(selection.keys[i]), insn.type, rhs)) {
+                leaf.wells.push_back(&selection.wells[i]);
+            }
+        }
+
+        std::ranges::sort(leaf.wells, lessByName);
+        const auto dup = std::ranges::unique(leaf.wells, [](const auto* w1, const auto* w2)
+                                             { return *w1 == *w2; });
+        leaf.wells.erase(dup.begin(), dup.end());
+    }
+        break;
+    }
+
+    leaf.value = ! leaf.wells.empty();
+    leaf.has_wells = true;
+}
+
+void Opm::Action::Program::combine(MatchSet&       acc,
+                                   const MatchSet& rhs,
+                                   EvalState&      state) const
+{
+    // Mirrors Result::makeSetUnion() and Result::makeSetIntersection().
+
+    const auto is_or = acc.op == TokenType::op_or;
+
+    acc.value = is_or
+        ? (acc.value || rhs.value)
+        : (acc.value && rhs.value);
+
+    if (! acc.value) {
+        acc.wells.clear();
+        return;
+    }
+
+    if (! rhs.has_wells) {
+        return;
+    }
+
+    if (! acc.has_wells) {
+        acc.has_wells = true;
+        acc.wells.assign(rhs.wells.begin(), rhs.wells.end());
+        return;
+    }
+
+    state.buffer.clear();
+
+    if (is_or) {
+        std::ranges::set_union(acc.wells, rhs.wells,
+                               std::back_inserter(state.buffer), lessByName);
+    }
+    else {
+        std::ranges::set_intersection(acc.wells, rhs.wells,
+                                      std::back_inserter(state.buffer), lessByName);
+    }
+
+    acc.wells.swap(state.buffer);
+}
+
+Opm::Action::Result
+Opm::Action::Program::make_result(const MatchSet& set) const
+{
+    auto result = Result { set.value };
+
+    if (set.has_wells) {
+        auto wells = std::vector<std::string>{};
+        wells.reserve(set.wells.size());
+
+        std::ranges::transform(set.wells, std::back_inserter(wells),
+                               [](const std::string* well) { return *well; });
+
+        result.wells(wells);
+    }
+
+    return result;
+}
@@ -0,0 +1,214 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACTION_PROGRAM_HPP
+#define ACTION_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm::Action {
+
+class ASTNode;
+class Context;
+
+} // namespace Opm::Action
+
+namespace Opm::Action {
+
+/// ACTIONX condition lowered to a flat instruction sequence.
+///
+/// Summary vector keys--e.g., "WOPR:OP1" for a single well--are formed
+/// once at compile time, and the wells selected by a name pattern or a
+/// well list, along with their summary vector keys, are recomputed only
+/// when the set of candidate wells changes.  Conjunctions ('AND') stop
+/// evaluating their conditions once the result is known to be false.
+/// Disjunctions ('OR') skip any remaining conditions which cannot add
+/// matching wells once the result is known to be true.  The result,
+/// including the set of matching wells, is otherwise identical to that of
+/// ASTNode::eval().
+///
+/// Not every condition tree can be compiled.  Trees for which the AST
+/// evaluator would raise an exception, for instance because a group name
+/// pattern is used, are left to the AST evaluator in order to report the
+/// problem through the usual channels.
+///
+/// The state of an evaluation is local to each call to eval(), and the
+/// cached well selections are immutable and replaced under a lock, so a
+/// single program may be evaluated concurrently.
+class Program
+{
+public:
+    /// Lower condition tree into instruction sequence.
+    ///
+    /// \param[in] root Root of condition's syntax tree.
+    ///
+    /// \return Compiled program.  Null if the condition uses features not
+    /// supported by the compiled evaluator.
+    static std::unique_ptr<Program> compile(const ASTNode& root);
+
+    /// Evaluate condition at current dynamic state.
+    ///
+    /// \param[in] context Current summary vectors and wells.
+    ///
+    /// \return Condition value.  Any wells for which the condition is true
+    /// will be included in the result set.
+    Result eval(const Context& context) const;
+
+    /// Number of instructions in program.
+    std::size_t size() const { return this->code_.size(); }
+
+private:
+    enum class OpCode : std::uint8_t {
+        Begin,    //!< Start conjunction or disjunction
+        Compare,  //!< Leaf-level comparison
+        End,      //!< Complete conjunction or disjunction
+    };
+
+    enum class OperandKind : std::uint8_t {
+        Number,       //!< Numeric literal
+        Scalar,       //!< Field, group, or other scalar quantity
+        Well,         //!< Well level quantity for named well
+        WellPattern,  //!< Well level quantity for well name template
+        WellList,     //!< Well level quantity for well list (template)
+    };
+
+    struct Operand
+    {
+        OperandKind kind{OperandKind::Number};
+
+        /// Numeric literal.
+        double value{0.0};
+
+        /// Summary vector key, or function name for patterns and well
+        /// lists.  Index into names_.
+        std::size_t key{0};
+
+        /// Well name, normalised well name template, or well list name.
+        /// Index into names_.
+        std::size_t name{0};
+
+        /// Cached well selection for patterns and well lists.  Index into
+        /// selections_.
+        std::size_t selection{0};
+    };
+
+    struct Instruction
+    {
+        OpCode op{OpCode::Compare};
+
+        /// Logical operator for Begin, comparison operator for Compare.
+        TokenType type{TokenType::error};
+
+        /// Left and right hand sides of comparison.  The right hand side
+        /// is always a scalar.
+        Operand lhs{};
+        Operand rhs{};
+
+        /// Position at which to resume when the enclosing conjunction is
+        /// known to be false, or the enclosing disjunction is known to be
+        /// true, after executing this instruction.
+        std::size_t skip{0};
+    };
+
+    /// Wells selected by a well name template or well list.
+    struct WellSelection
+    {
+        /// Candidate wells from which the selection was made.
+        std::vector<std::string> candidates{};
+
+        /// Selected wells, in candidate order.
+        std::vector<std::string> wells{};
+
+        /// Summary vector keys of selected wells.
+        std::vector<std::string> keys{};
+    };
+
+    /// Condition value and matching wells of a partially evaluated
+    /// (sub-)expression.  Mirrors the state of an Action::Result.
+    struct MatchSet
+    {
+        /// Logical operator combining sub-expressions into this set.
+        TokenType op{TokenType::op_or};
+
+        /// Condition value.
+        bool value{false};
+
+        /// Whether or not the set of matching wells exists, even if empty.
+        bool has_wells{false};
+
+        /// Matching wells, unique and sorted by name.
+        std::vector<const std::string*> wells{};
+    };
+
+    /// State of a single evaluation.
+    struct EvalState
+    {
+        /// Partial results of enclosing conjunctions and disjunctions.
+        std::vector<MatchSet> stack{};
+
+        /// Result of most recent comparison.
+        MatchSet leaf{};
+
+        /// Work area for combining sets of matching wells.
+        std::vector<const std::string*> buffer{};
+
+        /// Well selections used in this evaluation.  Keeps the well names
+        /// referenced by the match sets alive.
+        std::vector<std::shared_ptr<const WellSelection>> selections{};
+    };
+
+    std::vector<Instruction> code_{};
+    std::vector<std::string> names_{};
+
+    /// Maximum nesting depth of conjunctions and disjunctions.
+    std::size_t max_depth_{0};
+
+    /// Number of well name template and well list operands.
+    std::size_t num_selections_{0};
+
+    /// Most recent well selection of each well name template or well list
+    /// operand, shared by all evaluations.  Guarded by selection_lock_.
+    mutable std::vector<std::shared_ptr<const WellSelection>> selections_{};
+    mutable std::mutex selection_lock_{};
+
+    std::optional<bool> lower(const ASTNode& node, std::size_t depth);
+    std::optional<Operand> lower_operand(const ASTNode& leaf);
+    std::size_t name_index(const std::string& name);
+
+    double scalar_value(const Operand& operand, const Context& context) const;
+    const WellSelection& select(const Operand& operand,
+                                const Context& context,
+                                EvalState&     state) const;
+    void compare(const Instruction& insn, const Context& context, EvalState& state) const;
+    void combine(MatchSet& acc, const MatchSet& rhs, EvalState& state) const;
+    Result make_result(const MatchSet& set) const;
+};
+
+} // namespace Opm::Action
+
+#endif // ACTION_PROGRAM_HPP
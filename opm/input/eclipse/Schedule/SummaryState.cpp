@@ -23,17 +23,21 @@
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
 #include <limits>
+#include <numeric>
 #include <ostream>
 #include <regex>
 #include <set>
@@ -47,6 +51,14 @@
 
 namespace {
 
+    /// Next value in the process wide sequence of change stamps.
+    std::uint64_t next_stamp()
+    {
+        static std::atomic<std::uint64_t> counter{0};
+
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
     bool is_udq(std::string_view keyword)
     {
         // Does 'keyword' match one of the patterns
@@ -143,61 +155,6 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
-    template <class T>
-    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
-
-    template <class T>
-    bool has_var(const map2<T>& values,
-                 const std::string& var1,
-                 const std::string& var2)
-    {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return false;
-
-        const auto& var2_iter = var1_iter->second.find(var2);
-        if (var2_iter == var1_iter->second.end())
-            return false;
-
-        return true;
-    }
-
-    template <class T>
-    void erase_var(map2<T>& values,
-                   std::set<std::string>& var2_set,
-                   const std::string& var1,
-                   const std::string& var2)
-    {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return;
-
-        var1_iter->second.erase(var2);
-        var2_set.clear();
-        for (const auto& [_, var2_map] : values) {
-            (void)_;
-            for (const auto& [v2, __] : var2_map) {
-                (void)__;
-                var2_set.insert(v2);
-            }
-        }
-    }
-
-    template <class T>
-    std::vector<std::string>
-    var2_list(const map2<T>& values, const std::string& var1)
-    {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return {};
-
-        std::vector<std::string> l;
-        std::ranges::transform(var1_iter->second, std::back_inserter(l),
-                               [](const auto& pair) { return pair.first; });
-
-        return l;
-    }
-
     std::string normalise_encoded_well_completion_quantity(const std::string& keyword)
     {
         // regular expresssion to extarct kezword, completion number and
@@ -258,6 +215,7 @@ namespace Opm
                                const double     udqUndefined)
         : sim_start     { sim_start_arg }
         , udq_undefined { udqUndefined }
+        , generation    { next_stamp() }
     {
         this->update_elapsed(0);
     }
@@ -269,61 +227,131 @@ namespace Opm
 
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        const auto [pos, inserted] = this->values.try_emplace(key, value);
+
+        if (inserted && this->find_well_or_group_value(key).has_value()) {
+            this->hidden_keys.insert(key);
+        }
+
+        if (inserted || (pos->second != value)) {
+            pos->second = value;
+            this->touch(key);
+        }
     }
 
-    bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+    bool SummaryState::erase(const std::string& key)
+    {
+        if (this->values.erase(key) > 0) {
+            this->touch(key);
+            return true;
+        }
+
+        // A well or group level value remains available through the
+        // specialized accessors.
+        if (this->find_well_or_group_value(key).has_value()) {
+            this->hidden_keys.insert(key);
+            this->touch(key);
+            return true;
+        }
+
+        return false;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
     {
-        std::string key = var + ":" + well;
-        if (!this->erase(key))
+        const auto var_id = this->well_values.find_var(var);
+        const auto well_id = this->well_values.find_entity(well);
+        const auto defined = var_id.has_value() && well_id.has_value()
+            && this->well_values.is_defined(*var_id, *well_id);
+
+        if (!this->erase_key(fmt::format("{}:{}", var, well), defined)) {
             return false;
+        }
+
+        if (defined) {
+            this->well_values.erase(*var_id, *well_id);
+
+            if (!this->well_values.entity_has_defined(*well_id)) {
+                this->m_wells.erase(well);
+                this->well_names.reset();
+            }
+        }
 
-        erase_var(this->well_values, this->m_wells, var, well);
-        this->well_names.reset();
         return true;
     }
 
     bool SummaryState::erase_group_var(const std::string& group, const std::string& var)
     {
-        std::string key = var + ":" + group;
-        if (!this->erase(key))
+        const auto var_id = this->group_values.find_var(var);
+        const auto group_id = this->group_values.find_entity(group);
+        const auto defined = var_id.has_value() && group_id.has_value()
+            && this->group_values.is_defined(*var_id, *group_id);
+
+        if (!this->erase_key(fmt::format("{}:{}", var, group), defined)) {
             return false;
+        }
+
+        if (defined) {
+            this->group_values.erase(*var_id, *group_id);
+
+            if (!this->group_values.entity_has_defined(*group_id)) {
+                this->m_groups.erase(group);
+                this->group_names.reset();
+            }
+        }
 
-        erase_var(this->group_values, this->m_groups, var, group);
-        this->group_names.reset();
         return true;
     }
 
     bool SummaryState::has(const std::string& key) const
     {
-        return (this->values.find(key) != this->values.end()) || is_udq(key);
+        return (this->values.find(key) != this->values.end())
+            || is_udq(key)
+            || this->find_well_or_group_value(key).has_value();
     }
 
     bool SummaryState::has_well_var(const std::string& well,
                                     const std::string& var) const
     {
-        return has_var(this->well_values, var, well)
-            || is_well_udq(var);
+        if (is_well_udq(var)) {
+            return true;
+        }
+
+        const auto var_id = this->well_values.find_var(var);
+        const auto well_id = this->well_values.find_entity(well);
+
+        return var_id.has_value() && well_id.has_value()
+            && this->well_values.is_defined(*var_id, *well_id);
     }
 
     bool SummaryState::has_well_var(const std::string& var) const
     {
-        return (this->well_values.count(var) != 0) || is_well_udq(var);
+        const auto var_id = this->well_values.find_var(var);
+
+        return (var_id.has_value() && this->well_values.has_defined(*var_id))
+            || is_well_udq(var);
     }
 
     bool SummaryState::has_group_var(const std::string& group,
                                      const std::string& var) const
     {
-        return has_var(this->group_values, var, group) || is_group_udq(var);
+        if (is_group_udq(var)) {
+            return true;
+        }
+
+        const auto var_id = this->group_values.find_var(var);
+        const auto group_id = this->group_values.find_entity(group);
+
+        return var_id.has_value() && group_id.has_value()
+            && this->group_values.is_defined(*var_id, *group_id);
     }
 
     bool SummaryState::has_group_var(const std::string& var) const
     {
-        return (this->group_values.count(var) != 0) || is_group_udq(var);
+        const auto var_id = this->group_values.find_var(var);
+
+        return (var_id.has_value() && this->group_values.has_defined(*var_id))
+            || is_group_udq(var);
     }
 
     bool SummaryState::has_conn_var(const std::string& well,
@@ -386,13 +414,22 @@ namespace Opm
 
     void SummaryState::update(const std::string& key, double value)
     {
-        auto& val_ref = this->values[key];
+        const auto [pos, inserted] = this->values.try_emplace(key, 0.0);
+        const auto prev = pos->second;
+
+        if (inserted && this->find_well_or_group_value(key).has_value()) {
+            this->hidden_keys.insert(key);
+        }
 
         if (is_total(key)) {
-            val_ref += value;
+            pos->second += value;
         }
         else {
-            val_ref = value;
+            pos->second = value;
+        }
+
+        if (inserted || (pos->second != prev)) {
+            this->touch(key);
         }
     }
 
@@ -400,21 +437,10 @@ namespace Opm
                                        const std::string& var,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            wval_ref += value;
-        }
-        else {
-            val_ref = wval_ref = value;
-        }
+        const auto var_id = this->well_var_id(var);
 
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        this->update_well_value(var_id, this->well_values.entity_id(well),
+                                this->well_var_total[var_id] != 0, value);
     }
 
     void SummaryState::update_group_var(const std::string& group,
@@ -429,21 +455,10 @@ namespace Opm
                                         const SummaryConfigNode::Type type,
                                         const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
-
-        if (type == SummaryConfigNode::Type::Total) {
-            val_ref  += value;
-            gval_ref += value;
-        }
-        else {
-            val_ref = gval_ref = value;
-        }
-
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+        this->update_group_value(this->group_values.var_id(var),
+                                 this->group_values.entity_id(group),
+                                 type == SummaryConfigNode::Type::Total,
+                                 value);
     }
 
     void SummaryState::update_elapsed(double delta)
@@ -481,6 +496,31 @@ namespace Opm
         }
     }
 
+    void SummaryState::update_udq(const std::string& name, const UDQDenseSet& udq_set)
+    {
+        const auto var_type = udq_set.var_type;
+        if (var_type == UDQVarType::WELL_VAR) {
+            const auto var_id = this->well_var_id(name);
+            const auto total = this->well_var_total[var_id] != 0;
+
+            for (auto i = 0*udq_set.size(); i < udq_set.size(); ++i) {
+                this->update_well_value(var_id, this->well_values.entity_id((*udq_set.wgnames)[i]), total,
+                                        udq_set.defined(i) ? udq_set.values[i] : this->udq_undefined);
+            }
+        }
+        else if (var_type == UDQVarType::GROUP_VAR) {
+            const auto var_id = this->group_values.var_id(name);
+
+            for (auto i = 0*udq_set.size(); i < udq_set.size(); ++i) {
+                this->update_group_value(var_id, this->group_values.entity_id((*udq_set.wgnames)[i]), false,
+                                         udq_set.defined(i) ? udq_set.values[i] : this->udq_undefined);
+            }
+        }
+        else {
+            this->update(name, udq_set.defined(0) ? udq_set.values[0] : this->udq_undefined);
+        }
+    }
+
     void SummaryState::update_conn_var(const std::string& well,
                                        const std::string& var,
                                        const std::size_t  global_index,
@@ -552,6 +592,12 @@ namespace Opm
             return iter->second;
         }
 
+        if (const auto wg_value = this->find_well_or_group_value(key);
+            wg_value.has_value())
+        {
+            return *wg_value;
+        }
+
         if (is_udq(key)) {
             return this->udq_undefined;
         }
@@ -577,6 +623,12 @@ namespace Opm
             return iter->second;
         }
 
+        if (const auto wg_value = this->find_well_or_group_value(key);
+            wg_value.has_value())
+        {
+            return *wg_value;
+        }
+
         if (is_udq(key)) {
             return this->udq_undefined;
         }
@@ -594,8 +646,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_well_udq(var);
 
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
+        const auto var_id = this->well_values.find_var(var);
+        if (!var_id.has_value() || !this->well_values.has_defined(*var_id)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -606,8 +658,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto well_id = this->well_values.find_entity(well);
+        if (!well_id.has_value() || !this->well_values.is_defined(*var_id, *well_id)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -619,7 +671,7 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return wellPos->second;
+        return this->well_values.value(*var_id, *well_id);
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -627,8 +679,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_group_udq(var);
 
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
+        const auto var_id = this->group_values.find_var(var);
+        if (!var_id.has_value() || !this->group_values.has_defined(*var_id)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -639,8 +691,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto groupPos = varPos->second.find(group);
-        if (groupPos == varPos->second.end()) {
+        const auto group_id = this->group_values.find_entity(group);
+        if (!group_id.has_value() || !this->group_values.is_defined(*var_id, *group_id)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -652,7 +704,7 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return groupPos->second;
+        return this->group_values.value(*var_id, *group_id);
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -782,15 +834,13 @@ namespace Opm
             ? this->udq_undefined
             : default_value;
 
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
-            return fallback;
-        }
+        const auto var_id = this->well_values.find_var(var);
+        const auto well_id = this->well_values.find_entity(well);
 
-        auto wellPos = varPos->second.find(well);
-        return (wellPos == varPos->second.end())
-            ? fallback
-            : wellPos->second;
+        return (var_id.has_value() && well_id.has_value() &&
+                this->well_values.is_defined(*var_id, *well_id))
+            ? this->well_values.value(*var_id, *well_id)
+            : fallback;
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -801,15 +851,13 @@ namespace Opm
             ? this->udq_undefined
             : default_value;
 
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
-            return fallback;
-        }
+        const auto var_id = this->group_values.find_var(var);
+        const auto group_id = this->group_values.find_entity(group);
 
-        auto groupPos = varPos->second.find(group);
-        return (groupPos == varPos->second.end())
-            ? fallback
-            : groupPos->second;
+        return (var_id.has_value() && group_id.has_value() &&
+                this->group_values.is_defined(*var_id, *group_id))
+            ? this->group_values.value(*var_id, *group_id)
+            : fallback;
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -865,7 +913,11 @@ namespace Opm
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
-        return var2_list(this->well_values, var);
+        const auto var_id = this->well_values.find_var(var);
+
+        return var_id.has_value()
+            ? this->well_values.defined_entities(*var_id)
+            : std::vector<std::string>{};
     }
 
     const std::vector<std::string>& SummaryState::groups() const
@@ -879,7 +931,11 @@ namespace Opm
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const
     {
-        return var2_list(this->group_values, var);
+        const auto var_id = this->group_values.find_var(var);
+
+        return var_id.has_value()
+            ? this->group_values.defined_entities(*var_id)
+            : std::vector<std::string>{};
     }
 
     void SummaryState::append(const SummaryState& buffer)
@@ -887,18 +943,41 @@ namespace Opm
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
         this->values = buffer.values;
+        this->value_stamps.clear();
+        this->generation = next_stamp();
         this->well_names.reset();
         this->group_names.reset();
 
+        // The general keys are replaced by those of 'buffer'.  Well and
+        // group level values of variables which are not in 'buffer' are
+        // retained, but no longer as general keys.
+        this->hidden_keys = buffer.hidden_keys;
+
+        auto hide_retained = [this](const InternedValues& table, const InternedValues& other)
+        {
+            table.for_each_defined([this, &other](const std::string& var,
+                                                  const std::string& entity,
+                                                  const double)
+            {
+                const auto other_var = other.find_var(var);
+                if (!other_var.has_value() || !other.has_defined(*other_var)) {
+                    this->hidden_keys.insert(fmt::format("{}:{}", var, entity));
+                }
+            });
+        };
+
+        hide_retained(this->well_values, buffer.well_values);
+        hide_retained(this->group_values, buffer.group_values);
+
         this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
+        this->well_values.replace_vars(buffer.well_values);
+
+        for (std::size_t var = 0; var < this->well_values.num_vars(); ++var) {
+            this->well_var_id(this->well_values.var_name(var));
         }
 
         this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
-        }
+        this->group_values.replace_vars(buffer.group_values);
 
         for (const auto& [var, vals] : buffer.conn_values) {
             this->conn_values.insert_or_assign(var, vals);
@@ -911,12 +990,12 @@ namespace Opm
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return { *this, false };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return { *this, true };
     }
 
     std::size_t SummaryState::num_wells() const
@@ -926,7 +1005,10 @@ namespace Opm
 
     std::size_t SummaryState::size() const
     {
-        return this->values.size();
+        return this->values.size()
+            + this->well_values.size()
+            + this->group_values.size()
+            - this->hidden_keys.size();
     }
 
     bool SummaryState::operator==(const SummaryState& other) const
@@ -941,22 +1023,569 @@ namespace Opm
             && (this->group_values == other.group_values)
             && (this->m_groups == other.m_groups)
             && (this->groups() == other.groups())
+            && (this->hidden_keys == other.hidden_keys)
             && (this->conn_values == other.conn_values)
             && (this->segment_values == other.segment_values)
             && (this->region_values == other.region_values)
             ;
     }
 
+    void SummaryState::intern(const SummaryConfig& summary_config)
+    {
+        for (const auto& node : summary_config) {
+            if (node.namedEntity().empty()) {
+                continue;
+            }
+
+            switch (node.category()) {
+            case SummaryConfigNode::Category::Well:
+                this->well_var_handle(node.namedEntity(), node.keyword());
+                break;
+
+            case SummaryConfigNode::Category::Group:
+            case SummaryConfigNode::Category::Node:
+                this->group_var_handle(node.namedEntity(), node.keyword(), node.type());
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    SummaryState::VarHandle
+    SummaryState::well_var_handle(const std::string& well, const std::string& var)
+    {
+        const auto var_id = this->well_var_id(var);
+
+        return { var_id, this->well_values.entity_id(well),
+                 false, this->well_var_total[var_id] != 0 };
+    }
+
+    SummaryState::VarHandle
+    SummaryState::group_var_handle(const std::string& group, const std::string& var)
+    {
+        return this->group_var_handle(group, var, parseKeywordType(var));
+    }
+
+    SummaryState::VarHandle
+    SummaryState::group_var_handle(const std::string&            group,
+                                   const std::string&            var,
+                                   const SummaryConfigNode::Type type)
+    {
+        return { this->group_values.var_id(var),
+                 this->group_values.entity_id(group),
+                 true, type == SummaryConfigNode::Type::Total };
+    }
+
+    std::optional<std::size_t>
+    SummaryState::find_well_id(const std::string& well) const
+    {
+        return this->well_values.find_entity(well);
+    }
+
+    std::optional<std::size_t>
+    SummaryState::find_group_id(const std::string& group) const
+    {
+        return this->group_values.find_entity(group);
+    }
+
+    std::optional<SummaryState::VarHandle>
+    SummaryState::find_well_var_handle(const std::string& var) const
+    {
+        const auto var_id = this->well_values.find_var(var);
+        if (! var_id.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto total = (*var_id < this->well_var_total.size())
+            && (this->well_var_total[*var_id] != 0);
+
+        return VarHandle { *var_id, 0, false, total };
+    }
+
+    std::optional<SummaryState::VarHandle>
+    SummaryState::find_group_var_handle(const std::string& var) const
+    {
+        const auto var_id = this->group_values.find_var(var);
+        if (! var_id.has_value()) {
+            return std::nullopt;
+        }
+
+        return VarHandle {
+            *var_id, 0, true,
+            parseKeywordType(var) == SummaryConfigNode::Type::Total
+        };
+    }
+
+    bool SummaryState::has(const VarHandle& handle) const
+    {
+        const auto& table = handle.group ? this->group_values : this->well_values;
+
+        return table.is_defined(handle.var, handle.entity);
+    }
+
+    void SummaryState::update(const VarHandle& handle, const double value)
+    {
+        if (handle.group) {
+            this->update_group_value(handle.var, handle.entity, handle.total, value);
+        }
+        else {
+            this->update_well_value(handle.var, handle.entity, handle.total, value);
+        }
+    }
+
+    double SummaryState::get(const VarHandle& handle) const
+    {
+        const auto& table = handle.group ? this->group_values : this->well_values;
+
+        if (table.is_defined(handle.var, handle.entity)) {
+            return table.value(handle.var, handle.entity);
+        }
+
+        const auto& var = table.var_name(handle.var);
+        if (handle.group ? is_group_udq(var) : is_well_udq(var)) {
+            return this->udq_undefined;
+        }
+
+        throw std::invalid_argument {
+            fmt::format("Summary vector {} does not exist at the {} level for {} {}",
+                        var, handle.group ? "group" : "well",
+                        handle.group ? "group" : "well",
+                        table.entity_name(handle.entity))
+        };
+    }
+
+    double SummaryState::get(const VarHandle& handle, const double default_value) const
+    {
+        const auto& table = handle.group ? this->group_values : this->well_values;
+
+        if (table.is_defined(handle.var, handle.entity)) {
+            return table.value(handle.var, handle.entity);
+        }
+
+        const auto& var = table.var_name(handle.var);
+        return (handle.group ? is_group_udq(var) : is_well_udq(var))
+            ? this->udq_undefined
+            : default_value;
+    }
+
+    std::uint64_t SummaryState::handle_stamp() const
+    {
+        // Stamps are unique, so the most recent stamp of the two tables
+        // identifies both layouts.
+        return std::max(this->well_values.layout_stamp(),
+                        this->group_values.layout_stamp());
+    }
+
+    std::uint64_t SummaryState::var_stamp(const std::string& var) const
+    {
+        auto stamp = this->generation;
+
+        if (const auto pos = this->value_stamps.find(var);
+            pos != this->value_stamps.end())
+        {
+            stamp = std::max(stamp, pos->second);
+        }
+
+        for (const auto* table : { &this->well_values, &this->group_values }) {
+            if (const auto var_id = table->find_var(var); var_id.has_value()) {
+                stamp = std::max(stamp, table->stamp(*var_id));
+            }
+        }
+
+        return stamp;
+    }
+
+    void SummaryState::touch(const std::string& key)
+    {
+        this->value_stamps.insert_or_assign(key, next_stamp());
+    }
+
+    void SummaryState::reset_stamps()
+    {
+        this->value_stamps.clear();
+        this->well_values.reset_stamps();
+        this->group_values.reset_stamps();
+        this->generation = next_stamp();
+    }
+
+    std::size_t SummaryState::well_var_id(const std::string& var)
+    {
+        const auto var_id = this->well_values.var_id(var);
+
+        if (var_id >= this->well_var_total.size()) {
+            this->well_var_total.resize(var_id + 1, 0);
+            this->well_var_total[var_id] = is_total(var);
+        }
+
+        return var_id;
+    }
+
+    void SummaryState::update_well_value(const std::size_t var,
+                                         const std::size_t well,
+                                         const bool        total,
+                                         const double      value)
+    {
+        if (!this->hidden_keys.empty() || !this->well_values.is_defined(var, well)) {
+            this->attach_key(this->well_values, var, well);
+        }
+
+        if (this->well_values.assign(var, well, value, total) &&
+            this->m_wells.insert(this->well_values.entity_name(well)).second)
+        {
+            this->well_names.reset();
+        }
+    }
+
+    void SummaryState::update_group_value(const std::size_t var,
+                                          const std::size_t group,
+                                          const bool        total,
+                                          const double      value)
+    {
+        if (!this->hidden_keys.empty() || !this->group_values.is_defined(var, group)) {
+            this->attach_key(this->group_values, var, group);
+        }
+
+        if (this->group_values.assign(var, group, value, total) &&
+            this->m_groups.insert(this->group_values.entity_name(group)).second)
+        {
+            this->group_names.reset();
+        }
+    }
+
+    void SummaryState::attach_key(const InternedValues& table,
+                                  const std::size_t     var,
+                                  const std::size_t     entity)
+    {
+        const auto key = fmt::format("{}:{}", table.var_name(var), table.entity_name(entity));
+
+        this->hidden_keys.erase(key);
+        if (this->values.erase(key) > 0) {
+            this->touch(key);
+        }
+    }
+
+    bool SummaryState::erase_key(const std::string& key, const bool table_defined)
+    {
+        if (this->values.erase(key) > 0) {
+            this->hidden_keys.erase(key);
+            this->touch(key);
+            return true;
+        }
+
+        return table_defined && !this->hidden_keys.contains(key);
+    }
+
+    std::optional<double>
+    SummaryState::find_well_or_group_value(const std::string& key) const
+    {
+        const auto sep_pos = key.find(':');
+        if ((sep_pos == std::string::npos) || (sep_pos == 0)) {
+            return std::nullopt;
+        }
+
+        if (this->hidden_keys.contains(key)) {
+            return std::nullopt;
+        }
+
+        const auto var = std::string_view { key }.substr(0, sep_pos);
+        const auto name = std::string_view { key }.substr(sep_pos + 1);
+
+        for (const auto* table : { &this->well_values, &this->group_values }) {
+            const auto var_id = table->find_var(var);
+            if (!var_id.has_value()) {
+                continue;
+            }
+
+            const auto entity_id = table->find_entity(name);
+            if (entity_id.has_value() && table->is_defined(*var_id, *entity_id)) {
+                return table->value(*var_id, *entity_id);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    // -----------------------------------------------------------------------
+
+    SummaryState::const_iterator::const_iterator(const SummaryState& st, const bool at_end)
+        : st_        { &st }
+        , source_    { at_end ? Source::End : Source::General }
+        , value_pos_ { at_end ? st.values.end() : st.values.begin() }
+    {
+        this->settle();
+    }
+
+    SummaryState::const_iterator& SummaryState::const_iterator::operator++()
+    {
+        if (this->source_ == Source::General) {
+            ++this->value_pos_;
+        }
+        else {
+            ++this->entity_;
+        }
+
+        this->settle();
+
+        return *this;
+    }
+
+    SummaryState::const_iterator SummaryState::const_iterator::operator++(int)
+    {
+        auto prev = *this;
+        ++(*this);
+        return prev;
+    }
+
+    bool SummaryState::const_iterator::operator==(const const_iterator& that) const
+    {
+        return (this->st_ == that.st_)
+            && (this->source_ == that.source_)
+            && (this->value_pos_ == that.value_pos_)
+            && (this->var_ == that.var_)
+            && (this->entity_ == that.entity_);
+    }
+
+    void SummaryState::const_iterator::settle()
+    {
+        if (this->source_ == Source::General) {
+            if (this->value_pos_ != this->st_->values.end()) {
+                this->current_ = *this->value_pos_;
+                return;
+            }
+
+            this->source_ = Source::Well;
+        }
+
+        for (; this->source_ != Source::End; this->var_ = this->entity_ = 0) {
+            const auto& table = (this->source_ == Source::Well)
+                ? this->st_->well_values
+                : this->st_->group_values;
+
+            for (; this->var_ < table.num_vars(); ++this->var_, this->entity_ = 0) {
+                for (; this->entity_ < table.num_entities(); ++this->entity_) {
+                    if (! table.is_defined(this->var_, this->entity_)) {
+                        continue;
+                    }
+
+                    auto key = fmt::format("{}:{}", table.var_name(this->var_),
+                                           table.entity_name(this->entity_));
+
+                    if (! this->st_->hidden_keys.contains(key)) {
+                        this->current_ = { std::move(key), table.value(this->var_, this->entity_) };
+                        return;
+                    }
+                }
+            }
+
+            this->source_ = (this->source_ == Source::Well)
+                ? Source::Group : Source::End;
+        }
+
+        this->current_ = {};
+    }
+
+    // -----------------------------------------------------------------------
+
+    std::size_t SummaryState::InternedValues::var_id(const std::string& var)
+    {
+        const auto [pos, inserted] = this->var_index.try_emplace(var, this->vars.size());
+
+        if (inserted) {
+            this->vars.push_back(var);
+            this->data.emplace_back(this->entities.size(), 0.0);
+            this->defined.emplace_back(this->entities.size(), 0);
+            this->num_defined_var.push_back(0);
+            this->stamps.push_back(0);
+            this->layout = next_stamp();
+        }
+
+        return pos->second;
+    }
+
+    std::size_t SummaryState::InternedValues::entity_id(const std::string& entity)
+    {
+        const auto [pos, inserted] = this->entity_index.try_emplace(entity, this->entities.size());
+
+        if (inserted) {
+            this->entities.push_back(entity);
+            this->num_defined_entity.push_back(0);
+            this->layout = next_stamp();
+        }
+
+        return pos->second;
+    }
+
+    void SummaryState::InternedValues::reset_stamps()
+    {
+        this->stamps.assign(this->vars.size(), 0);
+        this->layout = next_stamp();
+    }
+
+    std::optional<std::size_t>
+    SummaryState::InternedValues::find_var(const std::string_view var) const
+    {
+        const auto pos = this->var_index.find(var);
+        if (pos == this->var_index.end()) {
+            return std::nullopt;
+        }
+
+        return pos->second;
+    }
+
+    std::optional<std::size_t>
+    SummaryState::InternedValues::find_entity(const std::string_view entity) const
+    {
+        const auto pos = this->entity_index.find(entity);
+        if (pos == this->entity_index.end()) {
+            return std::nullopt;
+        }
+
+        return pos->second;
+    }
+
+    bool SummaryState::InternedValues::assign(const std::size_t var,
+                                              const std::size_t entity,
+                                              const double      value,
+                                              const bool        accumulate)
+    {
+        if (entity >= this->defined[var].size()) {
+            this->resize_var(var);
+        }
+
+        auto& x = this->data[var][entity];
+        auto& is_defined = this->defined[var][entity];
+
+        if (is_defined == 0) {
+            is_defined = 1;
+            x = value;
+            this->stamps[var] = next_stamp();
+
+            ++this->num_defined_var[var];
+            return ++this->num_defined_entity[entity] == 1;
+        }
+
+        const auto prev = x;
+
+        if (accumulate) {
+            x += value;
+        }
+        else {
+            x = value;
+        }
+
+        if (x != prev) {
+            this->stamps[var] = next_stamp();
+        }
+
+        return false;
+    }
+
+    bool SummaryState::InternedValues::erase(const std::size_t var,
+                                             const std::size_t entity)
+    {
+        if (! this->is_defined(var, entity)) {
+            return false;
+        }
+
+        this->defined[var][entity] = 0;
+        this->data[var][entity] = 0.0;
+        this->stamps[var] = next_stamp();
+
+        --this->num_defined_var[var];
+        --this->num_defined_entity[entity];
+
+        return true;
+    }
+
+    std::vector<std::string>
+    SummaryState::InternedValues::defined_entities(const std::size_t var) const
+    {
+        std::vector<std::string> names;
+        names.reserve(this->num_defined_var[var]);
+
+        for (std::size_t entity = 0; entity < this->defined[var].size(); ++entity) {
+            if (this->defined[var][entity] != 0) {
+                names.push_back(this->entities[entity]);
+            }
+        }
+
+        return names;
+    }
+
+    std::size_t SummaryState::InternedValues::size() const
+    {
+        return std::accumulate(this->num_defined_var.begin(),
+                               this->num_defined_var.end(), std::size_t{0});
+    }
+
+    void SummaryState::InternedValues::replace_vars(const InternedValues& other)
+    {
+        for (std::size_t other_var = 0; other_var < other.vars.size(); ++other_var) {
+            if (! other.has_defined(other_var)) {
+                continue;
+            }
+
+            const auto var = this->var_id(other.vars[other_var]);
+            for (std::size_t entity = 0; entity < this->defined[var].size(); ++entity) {
+                this->erase(var, entity);
+            }
+
+            for (std::size_t other_entity = 0; other_entity < other.defined[other_var].size(); ++other_entity) {
+                if (other.defined[other_var][other_entity] != 0) {
+                    this->assign(var, this->entity_id(other.entities[other_entity]),
+                                 other.data[other_var][other_entity], false);
+                }
+            }
+        }
+    }
+
+    bool SummaryState::InternedValues::operator==(const InternedValues& that) const
+    {
+        // IDs depend on the order of interning, so compare the defined
+        // values by name.
+        if (this->size() != that.size()) {
+            return false;
+        }
+
+        bool equal = true;
+        this->for_each_defined([&that, &equal](const std::string& var,
+                                               const std::string& entity,
+                                               const double       value)
+        {
+            const auto var_id = that.find_var(var);
+            const auto entity_id = that.find_entity(entity);
+
+            equal = equal
+                && var_id.has_value() && entity_id.has_value()
+                && that.is_defined(*var_id, *entity_id)
+                && (that.value(*var_id, *entity_id) == value);
+        });
+
+        return equal;
+    }
+
+    void SummaryState::InternedValues::resize_var(const std::size_t var)
+    {
+        this->data[var].resize(this->entities.size(), 0.0);
+        this->defined[var].resize(this->entities.size(), 0);
+    }
+
+    // -----------------------------------------------------------------------
+
     SummaryState SummaryState::serializationTestObject()
     {
         auto st = SummaryState{TimeService::from_time_t(101), 1.234};
 
         st.elapsed = 1.0;
         st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
+        st.update_well_value(st.well_var_id("test2"),
+                             st.well_values.entity_id("test3"), false, 3.0);
         st.m_wells = {"test4"};
         st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
+        st.update_group_value(st.group_values.var_id("test6"),
+                              st.group_values.entity_id("test7"), false, 4.0);
         st.m_groups = {"test7"};
         st.group_names = {"test8"},
         st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
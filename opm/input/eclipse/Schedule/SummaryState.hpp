@@ -24,16 +24,24 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
+#include <functional>
 #include <iosfwd>
+#include <iterator>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace Opm {
 
+class SummaryConfig;
+struct UDQDenseSet;
 class UDQSet;
 
 } // namespace Opm
@@ -66,13 +74,96 @@ class UDQSet;
 //     // accessible through the specialized st.has_well_var("OPY", "WGOR").
 //     st.has("WGOR:OPY") => True
 //     st.has_well_var("OPY", "WGOR") => False
+//
+// Well and group level values are stored in dense tables, indexed by
+// integer IDs assigned to each well/group name and each variable.  The
+// string based well and group accessors look up these IDs, while callers
+// on hot paths may resolve a VarHandle once and then read and update the
+// value without any string lookups:
+//
+//     st.intern(summaryConfig);    // Optional, assign IDs up front
+//     const auto h = st.well_var_handle("OPX", "WWCT");
+//
+//     st.update(h, 0.75);
+//     st.get(h) => 0.75
+//     st.get_well_var("OPX", "WWCT") => 0.75
+//
+// Well and group values are part of the general key/value range exposed
+// by begin() and end() under their 'VAR:NAME' keys.  As before, the
+// general and the specialized accessors behave as if backed by separate
+// containers: erase("WWCT:OPX") and set("WWCT:OPX", x) only affect the
+// general key, while the specialized update_well_var() also redefines
+// the general key.
+//
+// Each well, group or field level variable carries a change stamp, which
+// is updated whenever one of the variable's values is created, altered or
+// erased.  Clients which derive quantities from the summary state, such
+// as the UDQ evaluator, may compare stamps to detect that their inputs
+// are unchanged:
+//
+//     const auto s0 = st.var_stamp("WWCT");
+//     st.update_well_var("OPX", "WWCT", 0.75);  // Same value as before
+//     st.var_stamp("WWCT") == s0 => True
 
 namespace Opm {
 
 class SummaryState
 {
 public:
-    using const_iterator = std::unordered_map<std::string, double>::const_iterator;
+    // Forward iterator over all general keys, including the 'VAR:NAME'
+    // keys of well and group level values.  Well and group keys are
+    // formatted on the fly, so the referenced pair is owned by the
+    // iterator.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return this->current_; }
+        pointer operator->() const { return &this->current_; }
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& that) const;
+
+    private:
+        friend class SummaryState;
+
+        enum class Source { General, Well, Group, End };
+
+        const_iterator(const SummaryState& st, bool at_end);
+
+        const SummaryState* st_{nullptr};
+        Source source_{Source::End};
+        std::unordered_map<std::string, double>::const_iterator value_pos_{};
+        std::size_t var_{0};
+        std::size_t entity_{0};
+        value_type current_{};
+
+        // Advance to the first element at or after the current position.
+        void settle();
+    };
+
+    /// Resolved location of a well or group level summary variable.
+    ///
+    /// Created by well_var_handle() or group_var_handle() and valid for
+    /// the SummaryState object which created it, copies of that object,
+    /// and other objects to which the same sequence of intern() and
+    /// handle requests has been applied.
+    struct VarHandle
+    {
+        std::size_t var{};
+        std::size_t entity{};
+        bool group{false};
+        bool total{false};
+    };
 
     explicit SummaryState(time_point sim_start_arg, double udqUndefined);
 
@@ -109,6 +200,7 @@ public:
     void update_group_var(const std::string& group, const std::string& var, EclIO::SummaryNode::Type type, double value);
     void update_elapsed(double delta);
     void update_udq(const UDQSet& udq_set);
+    void update_udq(const std::string& name, const UDQDenseSet& udq_set);
     void update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value);
     void update_conn_var(const std::string& well, const std::string& var, EclIO::SummaryNode::Type type, std::size_t global_index, double value);
 
@@ -130,8 +222,48 @@ public:
     double get_region_var(const std::string& regSet, const std::string& var, std::size_t region, double) const;
     double get_udq_undefined() const { return udq_undefined; }
 
+    // Assign dense IDs to all well and group level variables and all
+    // named wells and groups in the summary configuration.  Values are
+    // not defined by interning.
+    void intern(const SummaryConfig& summary_config);
+
+    VarHandle well_var_handle(const std::string& well, const std::string& var);
+    VarHandle group_var_handle(const std::string& group, const std::string& var);
+    VarHandle group_var_handle(const std::string& group, const std::string& var, EclIO::SummaryNode::Type type);
+
+    // IDs of known wells or groups, and handles of known well or group
+    // level variables, resolved without assigning new IDs.  A handle
+    // from find_well_var_handle() or find_group_var_handle() may be
+    // retargeted to any well or group with a known ID by assigning the
+    // ID to its 'entity' member.  Nullopt if the name is not known.
+    std::optional<std::size_t> find_well_id(const std::string& well) const;
+    std::optional<std::size_t> find_group_id(const std::string& group) const;
+    std::optional<VarHandle> find_well_var_handle(const std::string& var) const;
+    std::optional<VarHandle> find_group_var_handle(const std::string& var) const;
+
+    // Handle based equivalents of has_xxx_var(), update_xxx_var() and
+    // get_xxx_var().  The get() function throws std::invalid_argument if
+    // the value is not defined.
+    bool has(const VarHandle& handle) const;
+    void update(const VarHandle& handle, double value);
+    double get(const VarHandle& handle) const;
+    double get(const VarHandle& handle, double default_value) const;
+
+    // Stamp of the current assignment of well and group IDs.  Renewed
+    // whenever new IDs are assigned or the IDs are replaced wholesale.
+    // Handles resolved at a particular stamp are valid for all objects,
+    // including copies, which report the same stamp.
+    std::uint64_t handle_stamp() const;
+
     bool is_undefined_value(const double val) const { return val == udq_undefined; }
 
+    // Change stamp of well, group, or field level variable 'var', e.g.,
+    // "WOPR" or "FU_X".  Stamps are drawn from a single, process wide,
+    // increasing sequence so equal stamps imply equal values, also across
+    // copies of the same object.  Connection, segment and region level
+    // values are not tracked.
+    std::uint64_t var_stamp(const std::string& var) const;
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -156,29 +288,174 @@ public:
         serializer(group_values);
         serializer(m_groups);
         serializer(group_names);
+        serializer(hidden_keys);
+        serializer(well_var_total);
         serializer(conn_values);
         serializer(segment_values);
         serializer(this->region_values);
+
+        if (!serializer.isSerializing()) {
+            this->reset_stamps();
+        }
     }
 
     static SummaryState serializationTestObject();
 
+    friend std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
+
 private:
     time_point sim_start;
     double udq_undefined{};
     double elapsed = 0;
     std::unordered_map<std::string,double> values;
 
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    // Change stamps of the general key/value entries, and lower bound on
+    // all change stamps.  The latter is renewed whenever the values are
+    // replaced wholesale.  Neither is part of the object's value.
+    std::unordered_map<std::string, std::uint64_t> value_stamps{};
+    std::uint64_t generation{};
+
+    // Well or group level values.  Variables and named entities (wells
+    // or groups) are assigned dense IDs on first use, and the values of
+    // each variable are stored contiguously, indexed by entity ID.
+    class InternedValues
+    {
+    public:
+        std::size_t var_id(const std::string& var);
+        std::size_t entity_id(const std::string& entity);
+
+        std::optional<std::size_t> find_var(std::string_view var) const;
+        std::optional<std::size_t> find_entity(std::string_view entity) const;
+
+        const std::string& var_name(const std::size_t var) const
+        { return this->vars[var]; }
+
+        const std::string& entity_name(const std::size_t entity) const
+        { return this->entities[entity]; }
+
+        std::size_t num_vars() const { return this->vars.size(); }
+        std::size_t num_entities() const { return this->entities.size(); }
+
+        std::uint64_t stamp(const std::size_t var) const
+        { return this->stamps[var]; }
+
+        // Stamp of the current assignment of IDs.
+        std::uint64_t layout_stamp() const { return this->layout; }
+
+        // Forget all change stamps and renew the layout stamp.  Called
+        // when the values have been replaced wholesale, e.g., on
+        // deserialisation.
+        void reset_stamps();
+
+        bool is_defined(const std::size_t var, const std::size_t entity) const
+        {
+            return (entity < this->defined[var].size())
+                && (this->defined[var][entity] != 0);
+        }
+
+        double value(const std::size_t var, const std::size_t entity) const
+        { return this->data[var][entity]; }
+
+        // Returns true if this is the first defined value of the entity.
+        bool assign(std::size_t var, std::size_t entity, double value, bool accumulate);
+
+        // Returns true if a defined value was erased.
+        bool erase(std::size_t var, std::size_t entity);
+
+        bool has_defined(const std::size_t var) const
+        { return this->num_defined_var[var] > 0; }
+
+        bool entity_has_defined(const std::size_t entity) const
+        { return this->num_defined_entity[entity] > 0; }
+
+        std::size_t size() const;
+
+        // Replace all values of each variable which has defined values
+        // in 'other'.
+        void replace_vars(const InternedValues& other);
+
+        template <typename Function>
+        void for_each_defined(Function&& f) const
+        {
+            for (std::size_t var = 0; var < this->vars.size(); ++var) {
+                for (std::size_t entity = 0; entity < this->defined[var].size(); ++entity) {
+                    if (this->defined[var][entity] != 0) {
+                        f(this->vars[var], this->entities[entity], this->data[var][entity]);
+                    }
+                }
+            }
+        }
+
+        std::vector<std::string> defined_entities(std::size_t var) const;
+
+        bool operator==(const InternedValues& that) const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(vars);
+            serializer(entities);
+            serializer(data);
+            serializer(defined);
+            serializer(num_defined_var);
+            serializer(num_defined_entity);
+            serializer(var_index);
+            serializer(entity_index);
+        }
+
+    private:
+        // String hash which also accepts std::string_view, for look-up
+        // without constructing a key string.
+        struct NameHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(const std::string_view name) const
+            { return std::hash<std::string_view>{}(name); }
+        };
+
+        using NameIndex = std::unordered_map<std::string, std::size_t, NameHash, std::equal_to<>>;
+
+        std::vector<std::string> vars{};
+        std::vector<std::string> entities{};
+
+        // [var][entity]
+        std::vector<std::vector<double>> data{};
+        std::vector<std::vector<unsigned char>> defined{};
+
+        std::vector<std::size_t> num_defined_var{};
+        std::vector<std::size_t> num_defined_entity{};
+
+        // Change stamp of each variable.  Not part of the object's value.
+        std::vector<std::uint64_t> stamps{};
+
+        // Stamp of the last assignment of a new ID.  Not part of the
+        // object's value.
+        std::uint64_t layout{};
+
+        NameIndex var_index{};
+        NameIndex entity_index{};
+
+        void resize_var(std::size_t var);
+    };
+
+    InternedValues well_values;
     std::set<std::string> m_wells;
     mutable std::optional<std::vector<std::string>> well_names;
 
-    // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
+    // Whether or not each well level variable, by ID, is a cumulative
+    // quantity.
+    std::vector<unsigned char> well_var_total;
+
+    InternedValues group_values;
     std::set<std::string> m_groups;
     mutable std::optional<std::vector<std::string>> group_names;
 
+    // 'VAR:NAME' keys of defined well or group level values which are not
+    // the value of the general key, because the key has been erased or
+    // assigned through the general interface.  Usually empty.
+    std::unordered_set<std::string> hidden_keys;
+
     // The first key is the variable and the second key is the well and the
     // third is the global index. NB: The global_index has offset 1!
     std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
@@ -193,6 +470,25 @@ private:
 
     // Reusable buffer for formatting connection keys in update_conn_var to avoid allocation.
     mutable std::string conn_key_buffer_;
+
+    std::size_t well_var_id(const std::string& var);
+
+    void touch(const std::string& key);
+    void reset_stamps();
+
+    void update_well_value(std::size_t var, std::size_t well, bool total, double value);
+    void update_group_value(std::size_t var, std::size_t group, bool total, double value);
+
+    // Make the well or group level value the value of its general key.
+    void attach_key(const InternedValues& table, std::size_t var, std::size_t entity);
+
+    // Remove general key 'VAR:NAME' of a well or group level value, which
+    // is defined if 'table_defined' is set.  Returns false if there is no
+    // such general key.
+    bool erase_key(const std::string& key, bool table_defined);
+
+    // Well or group value for a general 'VAR:NAME' key, if any.
+    std::optional<double> find_well_or_group_value(const std::string& key) const;
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
@@ -306,6 +306,23 @@ void UDQASTNode::required_summary(std::unordered_set<std::string>& summary_keys)
     }
 }
 
+void UDQASTNode::required_quantities(std::unordered_set<std::string>& quantities) const
+{
+    if ((this->type == UDQTokenType::ecl_expr) &&
+        std::holds_alternative<std::string>(this->value))
+    {
+        quantities.insert(std::get<std::string>(this->value));
+    }
+
+    if (this->left) {
+        this->left->required_quantities(quantities);
+    }
+
+    if (this->right) {
+        this->right->required_quantities(quantities);
+    }
+}
+
 void UDQASTNode::requiredObjects(UDQ::RequisiteEvaluationObjects& objects) const
 {
     if ((this->type == UDQTokenType::ecl_expr) &&
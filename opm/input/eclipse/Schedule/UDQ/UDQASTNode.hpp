@@ -74,6 +74,15 @@ public:
     bool operator==(const UDQASTNode& data) const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
 
+    /// Collect all named quantities read when evaluating this node.
+    ///
+    /// Like required_summary(), but also includes user defined
+    /// quantities.
+    ///
+    /// \param[in,out] quantities Named quantities.  On exit also contains
+    /// the quantities read by this node and, recursively, its children.
+    void required_quantities(std::unordered_set<std::string>& quantities) const;
+
     /// Populate collection of requisite objects needed to evaluate this node.
     ///
     /// \param[in,out] objects Specific Schedule objects named in containing
@@ -94,6 +103,8 @@ public:
     }
 
 private:
+    friend class UDQProgram;
+
     UDQTokenType type;
 
     std::variant<std::string, double> value;
@@ -43,8 +43,10 @@
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <stdexcept>
 #include <string>
@@ -681,6 +683,9 @@ namespace Opm {
 
     void UDQConfig::add_node(const std::string& quantity, const UDQAction action)
     {
+        // New or changed UDQ, so the evaluation schedule is out of date.
+        this->definitions_version_ = next_definitions_version();
+
         auto index_iter = this->input_index.find(quantity);
         if (this->input_index.find(quantity) == this->input_index.end()) {
             auto var_type = UDQ::varType(quantity);
@@ -756,7 +761,7 @@ namespace Opm {
     }
 
     void UDQConfig::eval_define(const std::size_t report_step,
-                                const UDQState&   udq_state,
+                                UDQState&         udq_state,
                                 UDQContext&       context) const
     {
         auto var_type_bit = [](const UDQVarType var_type)
@@ -770,6 +775,8 @@ namespace Opm {
         select_var_type |= var_type_bit(UDQVarType::FIELD_VAR);
         select_var_type |= var_type_bit(UDQVarType::SEGMENT_VAR);
 
+        auto defines = std::vector<const UDQDefine*>{};
+
         for (const auto& [keyword, index] : this->input_index) {
             if (index.action != UDQAction::DEFINE) {
                 continue;
@@ -783,16 +790,23 @@ namespace Opm {
                 };
             }
 
-            const auto& def = def_pos->second;
-            if (((select_var_type & var_type_bit(def.var_type())) == 0) || // Unwanted Var Type
-                ! udq_state.define(def.status())) // UDQ def not applicable now
-            {
-                continue;
+            if ((select_var_type & var_type_bit(def_pos->second.var_type())) != 0) {
+                defines.push_back(&def_pos->second);
             }
-
-            context.update_define(report_step, keyword, def.eval(context));
-            def.clear_next();
         }
+
+        // The evaluation schedule lives in the caller's UDQState, as it
+        // changes on every evaluation, and is rebuilt only if these
+        // definitions differ from those it was built for.
+        auto& graph = udq_state.dependency_graph();
+        graph.prepare(defines, this->definitions_version_);
+        graph.eval(report_step, udq_state, context);
+    }
+
+    std::uint64_t UDQConfig::next_definitions_version()
+    {
+        static std::atomic<std::uint64_t> version{0};
+        return ++version;
     }
 
     void UDQConfig::add_enumerated_assign(const std::string&              quantity,
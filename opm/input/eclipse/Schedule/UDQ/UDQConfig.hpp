@@ -33,6 +33,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -554,6 +555,7 @@ namespace Opm {
             // just construct a new instance here.
             if (!serializer.isSerializing()) {
                 udqft = UDQFunctionTable(udq_params);
+                definitions_version_ = next_definitions_version();
             }
         }
 
@@ -615,6 +617,17 @@ namespace Opm {
         ///    UDQConfig::eval_assign(step, sched, context) const
         mutable std::vector<std::string> pending_assignments_{};
 
+        /// Version of the collection of DEFINE statements.
+        ///
+        /// Drawn from a process wide sequence and renewed whenever a UDQ
+        /// is added or redefined.  Identifies the evaluation schedule
+        /// which the UDQState object caches for these definitions.  Not
+        /// part of the object's value, so neither compared nor serialised.
+        std::uint64_t definitions_version_{next_definitions_version()};
+
+        /// Next value in process wide sequence of definition versions.
+        static std::uint64_t next_definitions_version();
+
         /// Incorporate operation for new or existing UDQ
         ///
         /// Preserves order of operations in input_index.
@@ -652,8 +665,9 @@ namespace Opm {
 
         /// Compute new values for all UDQs
         ///
-        /// Evaluates all applicable defining expressions.  Assigns new UDQ
-        /// values to both the summary and UDQ state objects.
+        /// Evaluates all applicable defining expressions whose inputs have
+        /// changed since their previous evaluation.  Assigns new UDQ values
+        /// to both the summary and UDQ state objects.
         ///
         /// \param[in] report_step Current report step.
         ///
@@ -661,9 +675,9 @@ namespace Opm {
         ///
         /// \param[in,out] context Pattern matchers and state objects.
         /// Values pertaining to UDQs being evaluated here will be updated.
-        void eval_define(std::size_t     report_step,
-                         const UDQState& udq_state,
-                         UDQContext&     context) const;
+        void eval_define(std::size_t report_step,
+                         UDQState&   udq_state,
+                         UDQContext& context) const;
 
         /// Incorporate an enumerated assignment statement into known UDQ
         /// collection.
@@ -23,6 +23,7 @@
 
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDT.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
@@ -30,9 +31,12 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -83,6 +87,11 @@ namespace Opm {
         this->add("TCPU", 0.0);
     }
 
+    std::uint64_t UDQContext::change_stamp(const std::string& key) const
+    {
+        return this->summary_state.var_stamp(key);
+    }
+
     void UDQContext::add(const std::string& key, double value)
     {
         this->values.insert_or_assign(key, value);
@@ -157,6 +166,42 @@ namespace Opm {
         };
     }
 
+    void UDQContext::well_ids(const std::vector<std::string>&          wells,
+                              std::vector<std::optional<std::size_t>>& ids) const
+    {
+        ids.clear();
+
+        for (const auto& well : wells) {
+            ids.push_back(this->summary_state.find_well_id(well));
+        }
+    }
+
+    void UDQContext::group_ids(const std::vector<std::string>&          groups,
+                               std::vector<std::optional<std::size_t>>& ids) const
+    {
+        ids.clear();
+
+        for (const auto& group : groups) {
+            ids.push_back(this->summary_state.find_group_id(group));
+        }
+    }
+
+    void UDQContext::get_well_var(const std::string&                             var,
+                                  const std::vector<std::string>&                wells,
+                                  const std::vector<std::optional<std::size_t>>& ids,
+                                  double*                                        out) const
+    {
+        this->get_wg_var(false, var, wells, ids, out);
+    }
+
+    void UDQContext::get_group_var(const std::string&                             var,
+                                   const std::vector<std::string>&                groups,
+                                   const std::vector<std::optional<std::size_t>>& ids,
+                                   double*                                        out) const
+    {
+        this->get_wg_var(true, var, groups, ids, out);
+    }
+
     std::optional<double>
     UDQContext::get_segment_var(const std::string& well,
                                 const std::string& var,
@@ -234,6 +279,17 @@ namespace Opm {
         return rgroups;
     }
 
+    void UDQContext::nonFieldGroups(std::vector<std::string>& groups) const
+    {
+        groups.clear();
+
+        for (const auto& gname : this->group_order_.names()) {
+            if (gname != "FIELD") {
+                groups.push_back(gname);
+            }
+        }
+    }
+
     std::vector<std::string> UDQContext::groups(const std::string& pattern) const
     {
         return this->group_order_.names(pattern);
@@ -307,6 +363,78 @@ namespace Opm {
         this->summary_state.update_udq(udq_result);
     }
 
+    void UDQContext::update_define(const std::size_t  report_step,
+                                   const std::string& keyword,
+                                   const UDQDenseSet& udq_result)
+    {
+        this->udq_state.add_define(report_step, keyword, udq_result);
+        this->summary_state.update_udq(keyword, udq_result);
+    }
+
+    void UDQContext::get_wg_var(const bool                                     group,
+                                const std::string&                             var,
+                                const std::vector<std::string>&                names,
+                                const std::vector<std::optional<std::size_t>>& ids,
+                                double*                                        out) const
+    {
+        constexpr auto undefined = std::numeric_limits<double>::quiet_NaN();
+
+        const auto n = names.size();
+
+        if (is_udq(var)) {
+            const auto* udq_values = group
+                ? this->udq_state.find_group_values(var)
+                : this->udq_state.find_well_values(var);
+
+            std::fill_n(out, n, undefined);
+
+            if (udq_values == nullptr) {
+                return;
+            }
+
+            for (auto i = 0*n; i < n; ++i) {
+                if (const auto pos = udq_values->find(names[i]);
+                    pos != udq_values->end())
+                {
+                    out[i] = pos->second;
+                }
+            }
+
+            return;
+        }
+
+        const auto handle = group
+            ? this->summary_state.find_group_var_handle(var)
+            : this->summary_state.find_well_var_handle(var);
+
+        if (! (group ? this->summary_state.has_group_var(var)
+                     : this->summary_state.has_well_var(var)) ||
+            ! handle.has_value())
+        {
+            throw std::logic_error {
+                fmt::format("Summary {} variable: {} not registered",
+                            group ? "group" : "well", var)
+            };
+        }
+
+        auto h = *handle;
+        for (auto i = 0*n; i < n; ++i) {
+            if (ids[i].has_value()) {
+                h.entity = *ids[i];
+                out[i] = this->summary_state.has(h)
+                    ? this->summary_state.get(h) : undefined;
+            }
+            else {
+                // Name unknown when the IDs were resolved.
+                const auto value = group
+                    ? this->get_group_var(names[i], var)
+                    : this->get_well_var(names[i], var);
+
+                out[i] = value.value_or(undefined);
+            }
+        }
+    }
+
     void UDQContext::ensure_segment_matcher_exists() const
     {
         if (this->matchers_.segments == nullptr) {
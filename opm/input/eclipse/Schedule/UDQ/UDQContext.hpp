@@ -24,6 +24,7 @@
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -36,6 +37,7 @@ namespace Opm {
     class GroupOrder;
     class SegmentSet;
     class SummaryState;
+    struct UDQDenseSet;
     class UDQFunctionTable;
     class UDQSet;
     class UDQState;
@@ -71,6 +73,47 @@ namespace Opm {
         std::optional<double>
         get_group_var(const std::string& group, const std::string& var) const;
 
+        /// Summary state IDs of named wells or groups.
+        ///
+        /// For use with the bulk forms of get_well_var() and
+        /// get_group_var().  Nullopt for names which are not yet known to
+        /// the summary state.  Reuses the existing capacity of \p ids.
+        void well_ids(const std::vector<std::string>&         wells,
+                      std::vector<std::optional<std::size_t>>& ids) const;
+
+        void group_ids(const std::vector<std::string>&         groups,
+                       std::vector<std::optional<std::size_t>>& ids) const;
+
+        /// Well level quantity for multiple wells.
+        ///
+        /// Bulk form of get_well_var() which resolves \p var once rather
+        /// than once per well.  Throws in the same situations.
+        ///
+        /// \param[in] var Quantity name, e.g., WOPR or WUX.
+        ///
+        /// \param[in] wells Well names.
+        ///
+        /// \param[in] ids Summary state IDs of \p wells, from well_ids().
+        ///
+        /// \param[out] out One value for each of \p wells.  NaN if
+        /// undefined.
+        void get_well_var(const std::string&                             var,
+                          const std::vector<std::string>&                wells,
+                          const std::vector<std::optional<std::size_t>>& ids,
+                          double*                                        out) const;
+
+        /// Group level quantity for multiple groups.
+        ///
+        /// Bulk form of get_group_var(), analogous to the bulk form of
+        /// get_well_var().
+        ///
+        /// \param[out] out One value for each of \p groups.  NaN if
+        /// undefined.
+        void get_group_var(const std::string&                             var,
+                           const std::vector<std::string>&                groups,
+                           const std::vector<std::optional<std::size_t>>& ids,
+                           double*                                        out) const;
+
         std::optional<double>
         get_segment_var(const std::string& well,
                         const std::string& var,
@@ -89,11 +132,32 @@ namespace Opm {
                            const std::string& keyword,
                            const UDQSet& udq_result);
 
+        /// Store result of compiled UDQ evaluation.
+        ///
+        /// Equivalent to update_define() for the corresponding UDQSet, but
+        /// without forming the intermediate set.
+        void update_define(std::size_t report_step,
+                           const std::string& keyword,
+                           const UDQDenseSet& udq_result);
+
         const UDQFunctionTable& function_table() const;
 
+        /// Change stamp of named quantity in underlying summary state.
+        ///
+        /// Equal stamps at two points in time imply that the quantity's
+        /// values are unchanged in between.
+        ///
+        /// \param[in] key Quantity name such as WOPR, FU_X, or GUGRP.
+        std::uint64_t change_stamp(const std::string& key) const;
+
         const std::vector<std::string>& wells() const;
         std::vector<std::string> wells(const std::string& pattern) const;
         std::vector<std::string> nonFieldGroups() const;
+
+        /// Non-field groups, in group order, stored in caller's container.
+        ///
+        /// Reuses the existing capacity of \p groups.
+        void nonFieldGroups(std::vector<std::string>& groups) const;
         std::vector<std::string> groups(const std::string& pattern) const;
         SegmentSet segments() const;
         SegmentSet segments(const std::vector<std::string>& set_descriptor) const;
@@ -123,6 +187,12 @@ namespace Opm {
         //std::unordered_map<std::string, UDQSet> udq_results;
         std::unordered_map<std::string, double> values;
 
+        void get_wg_var(bool                                           group,
+                        const std::string&                             var,
+                        const std::vector<std::string>&                names,
+                        const std::vector<std::optional<std::size_t>>& ids,
+                        double*                                        out) const;
+
         void ensure_segment_matcher_exists() const;
         void ensure_region_matcher_exists() const;
     };
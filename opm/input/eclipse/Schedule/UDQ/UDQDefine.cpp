@@ -25,6 +25,7 @@
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQToken.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
@@ -37,6 +38,7 @@
 #include <cstddef>
 #include <cstring>
 #include <exception>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -291,6 +293,8 @@ UDQDefine::UDQDefine(const UDQParams&                udq_params,
                                    this->m_tokens,
                                    parseContext,
                                    errors);
+
+    this->compile();
 }
 
 void UDQDefine::update_status(const UDQUpdate   update,
@@ -330,6 +334,11 @@ void UDQDefine::required_summary(std::unordered_set<std::string>& summary_keys)
     this->ast->required_summary(summary_keys);
 }
 
+void UDQDefine::required_quantities(std::unordered_set<std::string>& quantities) const
+{
+    this->ast->required_quantities(quantities);
+}
+
 UDQSet UDQDefine::eval(const UDQContext& context) const
 {
     auto res = std::optional<UDQSet>{};
@@ -367,6 +376,43 @@ UDQSet UDQDefine::eval(const UDQContext& context) const
     return *std::move(res);
 }
 
+void UDQDefine::eval_update(const std::size_t report_step,
+                            UDQContext&       context,
+                            UDQScratch&       scratch) const
+{
+    if (const auto res = this->eval_compiled(context, scratch); res.has_value()) {
+        context.update_define(report_step, this->m_keyword, *res);
+        return;
+    }
+
+    context.update_define(report_step, this->m_keyword, this->eval(context));
+}
+
+std::optional<UDQDenseSet>
+UDQDefine::eval_compiled(const UDQContext& context, UDQScratch& scratch) const
+{
+    if (this->program_ == nullptr) {
+        return std::nullopt;
+    }
+
+    try {
+        return this->program_->execute(context, scratch);
+    }
+    catch (const std::exception&) {
+        // Let the AST evaluator diagnose the problem.
+        return std::nullopt;
+    }
+}
+
+void UDQDefine::compile()
+{
+    this->program_.reset();
+
+    if (this->ast != nullptr) {
+        this->program_ = UDQProgram::compile(*this->ast, this->m_var_type);
+    }
+}
+
 const KeywordLocation& UDQDefine::location() const
 {
     return this->m_location;
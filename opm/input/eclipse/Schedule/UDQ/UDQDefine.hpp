@@ -40,6 +40,9 @@
 namespace Opm {
 
 class UDQASTNode;
+struct UDQDenseSet;
+class UDQProgram;
+class UDQScratch;
 class ParseContext;
 class ErrorGuard;
 
@@ -85,12 +88,52 @@ public:
     UDQ::RequisiteEvaluationObjects requiredObjects() const;
 
     UDQSet eval(const UDQContext& context) const;
+
+    /// Evaluate defining expression and store result in context.
+    ///
+    /// Runs the compiled form of the expression, if available, using
+    /// caller's work area for intermediate values.  Otherwise, or if the
+    /// compiled program cannot produce the result, equivalent to
+    ///
+    /// \code
+    ///    context.update_define(report_step, this->keyword(), this->eval(context))
+    /// \endcode
+    ///
+    /// \param[in] report_step Current report step.
+    ///
+    /// \param[in,out] context Evaluation context.  On exit, holds the
+    /// new values of this UDQ.
+    ///
+    /// \param[in,out] scratch Work area.  Must have been prepared for \p
+    /// context.
+    void eval_update(std::size_t report_step,
+                     UDQContext& context,
+                     UDQScratch& scratch) const;
+
+    /// Evaluate compiled form of defining expression.
+    ///
+    /// Does not modify the context, so may be called concurrently for
+    /// different definitions provided each call uses its own work area.
+    ///
+    /// \param[in] context Evaluation context.
+    ///
+    /// \param[in,out] scratch Work area.  Must have been prepared for \p
+    /// context.  Holds result on successful return.
+    ///
+    /// \return Result set, backed by \p scratch.  Nullopt if there is no
+    /// compiled form or if the result must be computed by eval() instead.
+    std::optional<UDQDenseSet>
+    eval_compiled(const UDQContext& context, UDQScratch& scratch) const;
+
+    /// Whether or not the defining expression has a compiled form.
+    bool compiled() const { return this->program_ != nullptr; }
     const std::string& keyword() const;
     const std::string& input_string() const { return this->input_string_; }
     const KeywordLocation& location() const;
     UDQVarType var_type() const;
     std::set<UDQTokenType> func_tokens() const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
+    void required_quantities(std::unordered_set<std::string>& quantities) const;
     void update_status(UDQUpdate update_status, std::size_t report_step);
     std::pair<UDQUpdate, std::size_t> status() const;
     const std::vector<Opm::UDQToken>& tokens() const;
@@ -140,6 +183,10 @@ public:
         serializer(m_location);
         serializer(m_update_status);
         serializer(m_report_step);
+
+        if (!serializer.isSerializing()) {
+            this->compile();
+        }
     }
 
 private:
@@ -152,6 +199,12 @@ private:
     std::size_t m_report_step{};
     mutable UDQUpdate m_update_status{UDQUpdate::NEXT};
 
+    /// Compiled form of 'ast'.  Null if the expression is not supported
+    /// by the compiled evaluator.  Immutable, so shared between copies.
+    std::shared_ptr<const UDQProgram> program_{};
+
+    void compile();
+
     UDQSet scatter_scalar_value(UDQSet&& res, const UDQContext& context) const;
     UDQSet scatter_scalar_well_value(const UDQContext& context, const std::optional<double>& value) const;
     UDQSet scatter_scalar_group_value(const UDQContext& context, const std::optional<double>& value) const;
@@ -0,0 +1,360 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+/// Whether or not the value of a UDQ definition is fully determined by
+/// the current values of the named quantities it reads, and the current
+/// set of wells and groups.
+bool isTrackable(const Opm::UDQDefine&                  def,
+                 const std::unordered_set<std::string>& quantities)
+{
+    using Opm::UDQTokenType;
+    using Opm::UDQVarType;
+
+    const auto var_type = def.var_type();
+    if ((var_type != UDQVarType::WELL_VAR) &&
+        (var_type != UDQVarType::GROUP_VAR) &&
+        (var_type != UDQVarType::FIELD_VAR))
+    {
+        return false;
+    }
+
+    const auto untracked_quantity = [&def](const std::string& quantity)
+    {
+        if (quantity == def.keyword()) {
+            return true;
+        }
+
+        switch (Opm::UDQ::targetType(quantity)) {
+        case UDQVarType::WELL_VAR:
+        case UDQVarType::GROUP_VAR:
+        case UDQVarType::FIELD_VAR:
+        case UDQVarType::SCALAR:
+        case UDQVarType::NONE:
+            return false;
+
+        default:
+            return true;
+        }
+    };
+
+    if (std::ranges::any_of(quantities, untracked_quantity)) {
+        return false;
+    }
+
+    const auto untracked_function = [](const UDQTokenType token)
+    {
+        return (token == UDQTokenType::elemental_func_randn)
+            || (token == UDQTokenType::elemental_func_randu)
+            || (token == UDQTokenType::elemental_func_rrandn)
+            || (token == UDQTokenType::elemental_func_rrandu)
+            || (token == UDQTokenType::table_lookup)
+            || (token == UDQTokenType::table_lookup_start)
+            || (token == UDQTokenType::table_lookup_end);
+    };
+
+    if (std::ranges::any_of(def.func_tokens(), untracked_function)) {
+        return false;
+    }
+
+    // Well list membership may change without the set of wells changing.
+    return std::ranges::none_of(def.requiredObjects().wells,
+                                [](const std::string& well)
+                                { return well.starts_with('*'); });
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+void UDQDependencyGraph::clear()
+{
+    this->nodes_.clear();
+    this->levels_.clear();
+    this->version_.reset();
+    this->report_step_.reset();
+    this->wells_.clear();
+    this->groups_.clear();
+    this->evaluated_.clear();
+}
+
+void UDQDependencyGraph::build(const std::vector<const UDQDefine*>& defines)
+{
+    this->clear();
+
+    auto index = std::unordered_map<std::string, std::size_t>{};
+    for (auto i = 0*defines.size(); i < defines.size(); ++i) {
+        index.emplace(defines[i]->keyword(), i);
+    }
+
+    // Highest level of any definition so far which reads a particular
+    // quantity.  Redefining that quantity must not happen earlier.
+    auto reader_level = std::unordered_map<std::string, std::size_t>{};
+
+    this->nodes_.resize(defines.size());
+    auto node_level = std::vector<std::size_t>(defines.size(), 0);
+
+    for (auto i = 0*defines.size(); i < defines.size(); ++i) {
+        auto& node = this->nodes_[i];
+        node.def = defines[i];
+
+        auto quantities = std::unordered_set<std::string>{};
+        node.def->required_quantities(quantities);
+
+        auto level = std::size_t{0};
+        if (const auto pos = reader_level.find(node.def->keyword());
+            pos != reader_level.end())
+        {
+            level = pos->second;
+        }
+
+        for (const auto& quantity : quantities) {
+            if (const auto pos = index.find(quantity);
+                (pos != index.end()) && (pos->second < i))
+            {
+                level = std::max(level, node_level[pos->second] + 1);
+            }
+        }
+
+        node_level[i] = level;
+
+        for (const auto& quantity : quantities) {
+            auto& rlevel = reader_level[quantity];
+            rlevel = std::max(rlevel, level);
+        }
+
+        node.tracked = isTrackable(*node.def, quantities);
+        if (node.tracked) {
+            node.inputs.assign(quantities.begin(), quantities.end());
+            std::ranges::sort(node.inputs);
+        }
+
+        if (level >= this->levels_.size()) {
+            this->levels_.resize(level + 1);
+        }
+
+        this->levels_[level].push_back(i);
+    }
+}
+
+void UDQDependencyGraph::prepare(const std::vector<const UDQDefine*>& defines,
+                                 const std::uint64_t                  version)
+{
+    if ((this->version_ != version) || (this->nodes_.size() != defines.size())) {
+        this->build(defines);
+        this->version_ = version;
+        return;
+    }
+
+    for (auto i = 0*defines.size(); i < defines.size(); ++i) {
+        this->nodes_[i].def = defines[i];
+    }
+}
+
+void UDQDependencyGraph::eval(const std::size_t report_step,
+                              const UDQState&   udq_state,
+                              UDQContext&       context)
+{
+    this->num_prepared_ = 0;
+    this->evaluated_.clear();
+
+    this->validate_stamps(report_step, context);
+
+    for (const auto& level : this->levels_) {
+        this->batch_.clear();
+
+        for (const auto i : level) {
+            auto& node = this->nodes_[i];
+
+            if (! udq_state.define(node.def->status())) {
+                continue;
+            }
+
+            if (this->up_to_date(node, context)) {
+                node.def->clear_next();
+                continue;
+            }
+
+            this->batch_.push_back(i);
+        }
+
+        this->execute_batch(context);
+        this->store_batch(report_step, context);
+    }
+}
+
+std::optional<std::size_t>
+UDQDependencyGraph::level(const std::string& keyword) const
+{
+    for (auto level = 0*this->levels_.size(); level < this->levels_.size(); ++level) {
+        if (std::ranges::any_of(this->levels_[level],
+                                [&keyword, this](const std::size_t i)
+                                { return this->nodes_[i].def->keyword() == keyword; }))
+        {
+            return level;
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::vector<std::string> UDQDependencyGraph::evaluated() const
+{
+    auto names = std::vector<std::string>{};
+    names.reserve(this->evaluated_.size());
+
+    for (const auto i : this->evaluated_) {
+        names.push_back(this->nodes_[i].def->keyword());
+    }
+
+    return names;
+}
+
+void UDQDependencyGraph::validate_stamps(const std::size_t report_step,
+                                         const UDQContext& context)
+{
+    this->prepare_scratch(1, context);
+
+    const auto& wells = context.wells();
+    const auto& groups = this->scratch_.front().groups();
+
+    if ((this->report_step_ == report_step) &&
+        (this->wells_ == wells) &&
+        (this->groups_ == groups))
+    {
+        return;
+    }
+
+    // Recorded stamps were taken under different circumstances, for
+    // instance before a new well was opened.  Start afresh.
+    this->report_step_ = report_step;
+    this->wells_ = wells;
+    this->groups_ = groups;
+
+    for (auto& node : this->nodes_) {
+        node.stamps.clear();
+    }
+}
+
+void UDQDependencyGraph::prepare_scratch(const std::size_t num_scratch,
+                                         const UDQContext& context)
+{
+    if (this->scratch_.size() < num_scratch) {
+        // Work areas do not retain their contents when relocated.
+        this->scratch_.resize(num_scratch);
+        this->num_prepared_ = 0;
+    }
+
+    for (; this->num_prepared_ < num_scratch; ++this->num_prepared_) {
+        this->scratch_[this->num_prepared_].prepare(context);
+    }
+}
+
+bool UDQDependencyGraph::up_to_date(Node& node, const UDQContext& context) const
+{
+    if (! node.tracked) {
+        return false;
+    }
+
+    node.current.resize(node.inputs.size());
+    std::ranges::transform(node.inputs, node.current.begin(),
+                           [&context](const std::string& input)
+                           { return context.change_stamp(input); });
+
+    return (node.stamps.size() == node.current.size() + 1)
+        && std::equal(node.current.begin(), node.current.end(), node.stamps.begin())
+        && (node.stamps.back() == context.change_stamp(node.def->keyword()));
+}
+
+void UDQDependencyGraph::execute_batch(const UDQContext& context)
+{
+    // Compiled definitions only read the context, so definitions in the
+    // same level may run concurrently.  Others, which might for instance
+    // create segment matchers or draw random numbers, run in
+    // store_batch().
+
+    const auto num_nodes = static_cast<int>(this->batch_.size());
+
+    this->results_.assign(num_nodes, std::nullopt);
+    this->prepare_scratch(num_nodes, context);
+
+    [[maybe_unused]] const auto num_compiled =
+        std::ranges::count_if(this->batch_, [this](const std::size_t i)
+        { return this->nodes_[i].def->compiled(); });
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(num_compiled > 1)
+#endif
+    for (int n = 0; n < num_nodes; ++n) {
+        const auto* def = this->nodes_[this->batch_[n]].def;
+        if (! def->compiled()) {
+            continue;
+        }
+
+        try {
+            this->results_[n] = def->eval_compiled(context, this->scratch_[n]);
+        }
+        catch (...) {
+            // Leave failure handling to store_batch().
+        }
+    }
+}
+
+void UDQDependencyGraph::store_batch(const std::size_t report_step,
+                                     UDQContext&       context)
+{
+    for (auto n = 0*this->batch_.size(); n < this->batch_.size(); ++n) {
+        auto& node = this->nodes_[this->batch_[n]];
+        const auto& keyword = node.def->keyword();
+
+        if (this->results_[n].has_value()) {
+            context.update_define(report_step, keyword, *this->results_[n]);
+        }
+        else {
+            context.update_define(report_step, keyword, node.def->eval(context));
+        }
+
+        node.def->clear_next();
+        this->evaluated_.push_back(this->batch_[n]);
+
+        if (node.tracked) {
+            node.stamps.assign(node.current.begin(), node.current.end());
+            node.stamps.push_back(context.change_stamp(keyword));
+        }
+    }
+}
+
+} // namespace Opm
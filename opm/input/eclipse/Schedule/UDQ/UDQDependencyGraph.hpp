@@ -0,0 +1,181 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_DEPENDENCY_GRAPH_HPP
+#define UDQ_DEPENDENCY_GRAPH_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQContext;
+class UDQDefine;
+class UDQState;
+
+} // namespace Opm
+
+namespace Opm {
+
+/// Evaluation schedule for a collection of UDQ DEFINE statements.
+///
+/// Groups the definitions into levels such that no definition reads a
+/// quantity defined in the same level.  A definition which reads a
+/// quantity defined later in the input sees that quantity's previous
+/// value, so is never placed in a level after the one defining that
+/// quantity.  The compiled definitions of a level are executed
+/// concurrently, while the results are stored in input order.
+///
+/// The schedule also records, for each definition, the change stamps of
+/// its inputs and of its own result at the time of its most recent
+/// evaluation.  A definition is not reevaluated if none of those stamps
+/// have changed since, i.e., if its transitive inputs in the summary
+/// state are unchanged.  Definitions using random numbers, table lookups,
+/// segment or region level quantities, well lists, or their own previous
+/// value are always evaluated.  All recorded stamps are discarded when
+/// the report step, the set of wells, or the set of groups changes.
+///
+/// Like UDQScratch, this is a cache whose copies start out empty.  It is
+/// owned by the UDQState object against which the definitions are
+/// evaluated, so evaluation does not alter the UDQConfig.
+class UDQDependencyGraph
+{
+public:
+    UDQDependencyGraph() = default;
+    UDQDependencyGraph(const UDQDependencyGraph&) {}
+    UDQDependencyGraph(UDQDependencyGraph&&) noexcept {}
+    UDQDependencyGraph& operator=(const UDQDependencyGraph&) { this->clear(); return *this; }
+    UDQDependencyGraph& operator=(UDQDependencyGraph&&) noexcept { this->clear(); return *this; }
+
+    /// Forget evaluation schedule and all recorded change stamps.
+    ///
+    /// Must be called whenever any of the definitions used to build the
+    /// schedule is changed or destroyed.
+    void clear();
+
+    /// Whether or not the evaluation schedule must be built before use.
+    bool empty() const { return this->nodes_.empty(); }
+
+    /// Build evaluation schedule.
+    ///
+    /// \param[in] defines UDQ definitions, in input order.  Must outlive
+    /// the schedule.
+    void build(const std::vector<const UDQDefine*>& defines);
+
+    /// Prepare evaluation schedule for a particular version of a
+    /// collection of definitions.
+    ///
+    /// Rebuilds the schedule unless it was built for the same \p version.
+    /// Otherwise only refers to \p defines, which may be a different copy
+    /// of the same definitions.
+    ///
+    /// \param[in] defines UDQ definitions, in input order.  Must outlive
+    /// the next call to eval().
+    ///
+    /// \param[in] version Identifies the contents of \p defines.
+    void prepare(const std::vector<const UDQDefine*>& defines,
+                 std::uint64_t                        version);
+
+    /// Evaluate all applicable definitions whose inputs have changed.
+    ///
+    /// \param[in] report_step Current report step.
+    ///
+    /// \param[in] udq_state Current UDQ state.  Decides which definitions
+    /// are applicable.
+    ///
+    /// \param[in,out] context Evaluation context.  On exit, holds the new
+    /// values of all evaluated UDQs.
+    void eval(std::size_t report_step,
+              const UDQState& udq_state,
+              UDQContext& context);
+
+    /// Number of levels in evaluation schedule.
+    std::size_t num_levels() const { return this->levels_.size(); }
+
+    /// Level of named UDQ in evaluation schedule.  Nullopt if the UDQ is
+    /// not part of the schedule.
+    std::optional<std::size_t> level(const std::string& keyword) const;
+
+    /// Names of UDQs evaluated in most recent call to eval(), in order of
+    /// storing results.
+    std::vector<std::string> evaluated() const;
+
+private:
+    struct Node
+    {
+        /// Defining expression.
+        const UDQDefine* def{nullptr};
+
+        /// Whether or not reevaluation may be skipped when the inputs are
+        /// unchanged.
+        bool tracked{false};
+
+        /// Named quantities read by the definition.  Empty unless tracked.
+        std::vector<std::string> inputs{};
+
+        /// Change stamps of 'inputs' and, as the last element, of the
+        /// result when the definition was last evaluated.  Empty if the
+        /// definition has not been evaluated since the stamps were last
+        /// discarded.
+        std::vector<std::uint64_t> stamps{};
+
+        /// Change stamps of 'inputs' as of the current evaluation.
+        std::vector<std::uint64_t> current{};
+    };
+
+    std::vector<Node> nodes_{};
+
+    /// Node indices of each level, in input order.
+    std::vector<std::vector<std::size_t>> levels_{};
+
+    /// Version of the definitions for which the schedule was built.
+    std::optional<std::uint64_t> version_{};
+
+    /// Work areas for concurrent execution of compiled definitions, and
+    /// number of those prepared for the current evaluation context.
+    std::vector<UDQScratch> scratch_{};
+    std::size_t num_prepared_{0};
+
+    /// Report step, wells, and groups for which the stamps are recorded.
+    std::optional<std::size_t> report_step_{};
+    std::vector<std::string> wells_{};
+    std::vector<std::string> groups_{};
+
+    /// Nodes evaluated in current level and in most recent eval().
+    std::vector<std::size_t> batch_{};
+    std::vector<std::size_t> evaluated_{};
+
+    /// Results of compiled execution of nodes in 'batch_'.
+    std::vector<std::optional<UDQDenseSet>> results_{};
+
+    void validate_stamps(std::size_t report_step, const UDQContext& context);
+    void prepare_scratch(std::size_t num_scratch, const UDQContext& context);
+    bool up_to_date(Node& node, const UDQContext& context) const;
+    void execute_batch(const UDQContext& context);
+    void store_batch(std::size_t report_step, UDQContext& context);
+};
+
+} // namespace Opm
+
+#endif // UDQ_DEPENDENCY_GRAPH_HPP
@@ -0,0 +1,659 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+
+std::size_t numWords(const std::size_t n)
+{
+    return (n + 63) / 64;
+}
+
+bool isSet(const std::uint64_t* bits, const std::size_t i)
+{
+    return (bits[i / 64] >> (i % 64)) & std::uint64_t{1};
+}
+
+void setBit(std::uint64_t* bits, const std::size_t i)
+{
+    bits[i / 64] |= std::uint64_t{1} << (i % 64);
+}
+
+void clearBit(std::uint64_t* bits, const std::size_t i)
+{
+    bits[i / 64] &= ~(std::uint64_t{1} << (i % 64));
+}
+
+// Mirrors UDQScalar::assign(double): non-finite values are undefined.
+void assign(double* values, std::uint64_t* bits,
+            const std::size_t i, const double x)
+{
+    if (std::isfinite(x)) {
+        values[i] = x;
+        setBit(bits, i);
+    }
+    else {
+        clearBit(bits, i);
+    }
+}
+
+void assign(double* values, std::uint64_t* bits,
+            const std::size_t i, const std::optional<double>& x)
+{
+    if (x.has_value()) {
+        assign(values, bits, i, *x);
+    }
+    else {
+        clearBit(bits, i);
+    }
+}
+
+bool supportedUnary(const Opm::UDQTokenType func)
+{
+    using T = Opm::UDQTokenType;
+
+    return (func == T::elemental_func_abs)
+        || (func == T::elemental_func_def)
+        || (func == T::elemental_func_exp)
+        || (func == T::elemental_func_idv)
+        || (func == T::elemental_func_ln)
+        || (func == T::elemental_func_log)
+        || (func == T::elemental_func_nint);
+}
+
+bool supportedBinary(const Opm::UDQTokenType func)
+{
+    using T = Opm::UDQTokenType;
+
+    return (func == T::binary_op_add)
+        || (func == T::binary_op_sub)
+        || (func == T::binary_op_mul)
+        || (func == T::binary_op_div)
+        || (func == T::binary_op_pow)
+        || (func == T::binary_cmp_lt)
+        || (func == T::binary_cmp_gt);
+}
+
+bool supportedReduction(const Opm::UDQTokenType func)
+{
+    // All scalar functions are supported.
+    return Opm::UDQ::scalarFunc(func);
+}
+
+/// Apply elemental function in place.
+///
+/// \return Whether or not all arguments were valid.
+bool applyUnary(const Opm::UDQTokenType func, const std::size_t n,
+                double* x, std::uint64_t* bits)
+{
+    using T = Opm::UDQTokenType;
+
+    if (func == T::elemental_func_idv) {
+        for (auto i = 0*n; i < n; ++i) {
+            x[i] = isSet(bits, i) ? 1.0 : 0.0;
+            setBit(bits, i);
+        }
+
+        return true;
+    }
+
+    for (auto i = 0*n; i < n; ++i) {
+        if (! isSet(bits, i)) {
+            continue;
+        }
+
+        switch (func) {
+        case T::elemental_func_abs:
+            assign(x, bits, i, std::fabs(x[i]));
+            break;
+
+        case T::elemental_func_def:
+            x[i] = 1.0;
+            break;
+
+        case T::elemental_func_exp:
+            assign(x, bits, i, std::exp(x[i]));
+            break;
+
+        case T::elemental_func_ln:
+            if (! (x[i] > 0.0)) { return false; }
+            assign(x, bits, i, std::log(x[i]));
+            break;
+
+        case T::elemental_func_log:
+            if (! (x[i] > 0.0)) { return false; }
+            assign(x, bits, i, std::log10(x[i]));
+            break;
+
+        case T::elemental_func_nint:
+            assign(x, bits, i, std::nearbyint(x[i]));
+            break;
+
+        default:
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Reduce defined elements to scalar, result in x[0].
+///
+/// Accumulation order matches UDQScalarFunction, which works on the
+/// defined values in element order.
+///
+/// \return Whether or not the reduction is well defined.
+bool applyReduction(const Opm::UDQTokenType func, const std::size_t n,
+                    double* x, std::uint64_t* bits)
+{
+    using T = Opm::UDQTokenType;
+
+    auto count = std::size_t{0};
+    auto acc = 0.0;
+    switch (func) {
+    case T::scalar_func_prod: acc = 1.0; break;
+    default: break;
+    }
+
+    auto first = true;
+    for (auto i = 0*n; i < n; ++i) {
+        if (! isSet(bits, i)) {
+            continue;
+        }
+
+        const auto y = x[i];
+        ++count;
+
+        switch (func) {
+        case T::scalar_func_sum:
+        case T::scalar_func_avea:  acc += y; break;
+        case T::scalar_func_prod:  acc *= y; break;
+        case T::scalar_func_aveh:  acc += 1.0 / y; break;
+        case T::scalar_func_norm1: acc += std::fabs(y); break;
+        case T::scalar_func_norm2: acc += y * y; break;
+        case T::scalar_func_normi: acc = std::max(acc, std::fabs(y)); break;
+
+        case T::scalar_func_aveg:
+            if (y <= 0) { return false; }
+            acc += std::log(y);
+            break;
+
+        case T::scalar_func_min:
+            acc = first ? y : std::min(acc, y);
+            break;
+
+        case T::scalar_func_max:
+            acc = first ? y : std::max(acc, y);
+            break;
+
+        default:
+            return false;
+        }
+
+        first = false;
+    }
+
+    if (count == 0) {
+        // The scalar functions return an empty set in this case.
+        return false;
+    }
+
+    switch (func) {
+    case T::scalar_func_avea:  acc /= count; break;
+    case T::scalar_func_aveg:  acc = std::exp(acc / count); break;
+    case T::scalar_func_aveh:  acc = count / acc; break;
+    case T::scalar_func_norm2: acc = std::sqrt(acc); break;
+    default: break;
+    }
+
+    bits[0] = 0;
+    assign(x, bits, 0, acc);
+
+    return true;
+}
+
+double applyBinary(const Opm::UDQTokenType func, const double a, const double b)
+{
+    using T = Opm::UDQTokenType;
+
+    switch (func) {
+    case T::binary_op_add: return a + b;
+    case T::binary_op_sub: return a - b;
+    case T::binary_op_mul: return a * b;
+    case T::binary_op_div: return a / b;
+    case T::binary_op_pow: return std::pow(a, b);
+
+    // UDQBinaryFunction::LT and GT compare the sign of the difference.
+    // The difference must be finite for the result to be defined.
+    case T::binary_cmp_lt: {
+        const auto d = a - b;
+        return std::isfinite(d) ? static_cast<double>(d < 0.0) : d;
+    }
+
+    case T::binary_cmp_gt: {
+        const auto d = a - b;
+        return std::isfinite(d) ? static_cast<double>(d > 0.0) : d;
+    }
+
+    default:
+        return std::nan("");
+    }
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+// ---------------------------------------------------------------------------
+// UDQScratch
+// ---------------------------------------------------------------------------
+
+void UDQScratch::prepare(const UDQContext& context)
+{
+    context.nonFieldGroups(this->groups_);
+
+    context.well_ids(context.wells(), this->well_ids_);
+    context.group_ids(this->groups_, this->group_ids_);
+}
+
+void UDQScratch::reserve(const std::size_t num_registers,
+                         const std::size_t stride)
+{
+    this->stride_ = stride;
+    this->words_ = numWords(stride);
+
+    if (this->values_.size() < num_registers * this->stride_) {
+        this->values_.resize(num_registers * this->stride_);
+    }
+
+    if (this->valid_.size() < num_registers * this->words_) {
+        this->valid_.resize(num_registers * this->words_);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// UDQProgram
+// ---------------------------------------------------------------------------
+
+std::unique_ptr<UDQProgram>
+UDQProgram::compile(const UDQASTNode& ast, const UDQVarType target_type)
+{
+    if ((target_type != UDQVarType::WELL_VAR) &&
+        (target_type != UDQVarType::GROUP_VAR) &&
+        (target_type != UDQVarType::FIELD_VAR))
+    {
+        return {};
+    }
+
+    auto program = std::make_unique<UDQProgram>();
+    program->target_type_ = target_type;
+
+    const auto result = program->lower(ast, 0);
+    if (! result.has_value()) {
+        return {};
+    }
+
+    switch (result->shape) {
+    case Shape::Wells:  program->result_type_ = UDQVarType::WELL_VAR;  break;
+    case Shape::Groups: program->result_type_ = UDQVarType::GROUP_VAR; break;
+    case Shape::Scalar: program->result_type_ = result->scalar_type;   break;
+    }
+
+    // Mirrors the dynamic type check in UDQDefine::eval().
+    if ((program->result_type_ != target_type) &&
+        (program->result_type_ != UDQVarType::SCALAR))
+    {
+        return {};
+    }
+
+    return program;
+}
+
+std::optional<UDQProgram::NodeType>
+UDQProgram::lower(const UDQASTNode& node, const std::size_t dest)
+{
+    this->num_registers_ = std::max(this->num_registers_, dest + 1);
+
+    auto ins = Instruction{};
+    ins.dest = dest;
+    ins.func = node.type;
+    ins.sign = node.sign;
+
+    auto type = NodeType{};
+
+    if (node.type == UDQTokenType::number) {
+        if (! std::holds_alternative<double>(node.value)) {
+            return std::nullopt;
+        }
+
+        ins.op = OpCode::Number;
+        ins.value = std::get<double>(node.value);
+
+        // Numeric literals take the shape of the evaluation target, as
+        // in UDQASTNode::eval_number().
+        switch (this->target_type_) {
+        case UDQVarType::WELL_VAR:  type.shape = Shape::Wells;  break;
+        case UDQVarType::GROUP_VAR: type.shape = Shape::Groups; break;
+        default: type.scalar_type = UDQVarType::FIELD_VAR;      break;
+        }
+    }
+    else if (node.type == UDQTokenType::ecl_expr) {
+        if (! std::holds_alternative<std::string>(node.value)) {
+            return std::nullopt;
+        }
+
+        const auto& name = std::get<std::string>(node.value);
+        const auto data_type = UDQ::targetType(name);
+
+        ins.name = this->name_index(name);
+
+        if ((data_type == UDQVarType::WELL_VAR) ||
+            (data_type == UDQVarType::GROUP_VAR))
+        {
+            const auto is_well = data_type == UDQVarType::WELL_VAR;
+
+            if (node.selector.empty()) {
+                ins.op = is_well ? OpCode::WellVar : OpCode::GroupVar;
+                type.shape = is_well ? Shape::Wells : Shape::Groups;
+            }
+            else if (node.selector.front().find('*') == std::string::npos) {
+                ins.op = is_well ? OpCode::WellScalar : OpCode::GroupScalar;
+                ins.entity = this->name_index(node.selector.front());
+            }
+            else {
+                // Well and group name patterns.
+                return std::nullopt;
+            }
+        }
+        else if (data_type == UDQVarType::FIELD_VAR) {
+            ins.op = OpCode::FieldScalar;
+        }
+        else {
+            return std::nullopt;
+        }
+    }
+    else if (UDQ::scalarFunc(node.type) || UDQ::elementalUnaryFunc(node.type)) {
+        const auto is_reduction = UDQ::scalarFunc(node.type);
+
+        if ((node.left == nullptr) ||
+            (is_reduction ? ! supportedReduction(node.type)
+                          : ! supportedUnary(node.type)))
+        {
+            return std::nullopt;
+        }
+
+        const auto arg = this->lower(*node.left, dest);
+        if (! arg.has_value()) {
+            return std::nullopt;
+        }
+
+        ins.op = is_reduction ? OpCode::Reduce : OpCode::Unary;
+        ins.arg_shape = arg->shape;
+
+        if (! is_reduction) {
+            type = *arg;
+        }
+    }
+    else if (UDQ::binaryFunc(node.type)) {
+        if ((node.left == nullptr) || (node.right == nullptr) ||
+            ! supportedBinary(node.type))
+        {
+            return std::nullopt;
+        }
+
+        const auto lhs = this->lower(*node.left, dest);
+        if (! lhs.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto rhs = this->lower(*node.right, dest + 1);
+        if (! rhs.has_value()) {
+            return std::nullopt;
+        }
+
+        if ((lhs->shape != Shape::Scalar) &&
+            (rhs->shape != Shape::Scalar) &&
+            (lhs->shape != rhs->shape))
+        {
+            // Well set combined with group set.
+            return std::nullopt;
+        }
+
+        ins.op = OpCode::Binary;
+        ins.arg_shape = lhs->shape;
+        ins.rhs_shape = rhs->shape;
+
+        type = *lhs;
+        if (lhs->shape == Shape::Scalar) {
+            type.shape = rhs->shape;
+        }
+    }
+    else {
+        return std::nullopt;
+    }
+
+    ins.shape = type.shape;
+    this->code_.push_back(ins);
+
+    return type;
+}
+
+std::size_t UDQProgram::name_index(const std::string& name)
+{
+    auto pos = std::find(this->names_.begin(), this->names_.end(), name);
+    if (pos == this->names_.end()) {
+        pos = this->names_.insert(pos, name);
+    }
+
+    return std::distance(this->names_.begin(), pos);
+}
+
+std::optional<UDQDenseSet>
+UDQProgram::execute(const UDQContext& context, UDQScratch& scratch) const
+{
+    const auto& wells = context.wells();
+    const auto& groups = scratch.groups();
+
+    auto size = [&wells, &groups](const Shape shape) -> std::size_t
+    {
+        switch (shape) {
+        case Shape::Wells:  return wells.size();
+        case Shape::Groups: return groups.size();
+        default:            return 1;
+        }
+    };
+
+    if ((scratch.well_ids_.size() != wells.size()) ||
+        (scratch.group_ids_.size() != groups.size()))
+    {
+        // Work area not prepared for this context.
+        return std::nullopt;
+    }
+
+    scratch.reserve(this->num_registers_,
+                    std::max({ wells.size(), groups.size(), std::size_t{1} }));
+
+    auto values = [&scratch](const std::size_t r)
+    { return scratch.values_.data() + r*scratch.stride_; };
+
+    auto valid = [&scratch](const std::size_t r)
+    { return scratch.valid_.data() + r*scratch.words_; };
+
+    for (const auto& ins : this->code_) {
+        auto* x = values(ins.dest);
+        auto* bits = valid(ins.dest);
+        const auto n = size(ins.shape);
+
+        switch (ins.op) {
+        case OpCode::Number:
+            std::fill_n(bits, numWords(n), std::uint64_t{0});
+            for (auto i = 0*n; i < n; ++i) {
+                assign(x, bits, i, ins.value);
+            }
+            break;
+
+        case OpCode::WellVar:
+            context.get_well_var(this->names_[ins.name], wells, scratch.well_ids_, x);
+            std::fill_n(bits, numWords(n), std::uint64_t{0});
+            for (auto i = 0*n; i < n; ++i) {
+                assign(x, bits, i, x[i]);
+            }
+            break;
+
+        case OpCode::GroupVar:
+            context.get_group_var(this->names_[ins.name], groups, scratch.group_ids_, x);
+            std::fill_n(bits, numWords(n), std::uint64_t{0});
+            for (auto i = 0*n; i < n; ++i) {
+                assign(x, bits, i, x[i]);
+            }
+            break;
+
+        case OpCode::WellScalar:
+            bits[0] = 0;
+            assign(x, bits, 0, context.get_well_var(this->names_[ins.entity],
+                                                    this->names_[ins.name]));
+            break;
+
+        case OpCode::GroupScalar:
+            bits[0] = 0;
+            assign(x, bits, 0, context.get_group_var(this->names_[ins.entity],
+                                                     this->names_[ins.name]));
+            break;
+
+        case OpCode::FieldScalar:
+            bits[0] = 0;
+            assign(x, bits, 0, context.get(this->names_[ins.name]));
+            break;
+
+        case OpCode::Unary:
+            if (! applyUnary(ins.func, n, x, bits)) {
+                return std::nullopt;
+            }
+            break;
+
+        case OpCode::Reduce:
+            if (! applyReduction(ins.func, size(ins.arg_shape), x, bits)) {
+                return std::nullopt;
+            }
+            break;
+
+        case OpCode::Binary: {
+            const auto* y = values(ins.dest + 1);
+            const auto* ybits = valid(ins.dest + 1);
+
+            const auto lhs_scalar = ins.arg_shape == Shape::Scalar;
+            const auto rhs_scalar = ins.rhs_shape == Shape::Scalar;
+
+            // Scalars promoted to sets must be defined, otherwise the
+            // set operators throw.  Leave that to the AST evaluator.
+            if ((lhs_scalar != rhs_scalar) &&
+                ((lhs_scalar && ! isSet(bits, 0)) ||
+                 (rhs_scalar && ! isSet(ybits, 0))))
+            {
+                return std::nullopt;
+            }
+
+            const auto a0 = x[0];
+            const auto a0_defined = isSet(bits, 0);
+            for (auto i = 0*n; i < n; ++i) {
+                const auto a_defined = lhs_scalar ? a0_defined : isSet(bits, i);
+                const auto b_defined = isSet(ybits, rhs_scalar ? 0 : i);
+
+                if (a_defined && b_defined) {
+                    assign(x, bits, i, applyBinary(ins.func,
+                                                   lhs_scalar ? a0 : x[i],
+                                                   y[rhs_scalar ? 0 : i]));
+                }
+                else {
+                    clearBit(bits, i);
+                }
+            }
+            break;
+        }
+        }
+
+        if (ins.sign != 1.0) {
+            for (auto i = 0*n; i < n; ++i) {
+                if (isSet(bits, i)) {
+                    assign(x, bits, i, ins.sign * x[i]);
+                }
+            }
+        }
+    }
+
+    auto* x = values(0);
+    auto* bits = valid(0);
+
+    auto result = UDQDenseSet{};
+    result.var_type = this->result_type_;
+
+    const auto shape = this->code_.back().shape;
+    if ((shape == Shape::Scalar) && (this->target_type_ != UDQVarType::FIELD_VAR)) {
+        // Distribute scalar result to all wells or groups, as in
+        // UDQDefine::scatter_scalar_value().
+        const auto target_shape = (this->target_type_ == UDQVarType::WELL_VAR)
+            ? Shape::Wells : Shape::Groups;
+
+        const auto n = size(target_shape);
+        const auto value = x[0];
+        const auto defined = isSet(bits, 0);
+
+        std::fill_n(bits, numWords(n), defined ? ~std::uint64_t{0} : std::uint64_t{0});
+        std::fill_n(x, n, value);
+
+        result.var_type = this->target_type_;
+        result.wgnames = (target_shape == Shape::Wells) ? &wells : &groups;
+        result.values = std::span<const double> { x, n };
+        result.valid = std::span<const std::uint64_t> { bits, numWords(n) };
+    }
+    else {
+        const auto n = size(shape);
+
+        if (shape == Shape::Wells) {
+            result.wgnames = &wells;
+        }
+        else if (shape == Shape::Groups) {
+            result.wgnames = &groups;
+        }
+
+        result.values = std::span<const double> { x, n };
+        result.valid = std::span<const std::uint64_t> { bits, numWords(n) };
+    }
+
+    return result;
+}
+
+} // namespace Opm
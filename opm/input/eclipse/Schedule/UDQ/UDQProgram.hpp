@@ -0,0 +1,244 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_PROGRAM_HPP
+#define UDQ_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+} // namespace Opm
+
+namespace Opm {
+
+/// Non-owning view of the result of executing a compiled UDQ program.
+///
+/// Values are stored densely, one element per well or group in the
+/// context's well or group order, with a separate validity bitmask
+/// instead of per-element optional values.
+struct UDQDenseSet
+{
+    /// Type of result set.  WELL_VAR, GROUP_VAR, FIELD_VAR, or SCALAR.
+    UDQVarType var_type{UDQVarType::NONE};
+
+    /// Element names for well and group sets.  Null for scalars.
+    const std::vector<std::string>* wgnames{nullptr};
+
+    /// Element values.  Unspecified for undefined elements.
+    std::span<const double> values{};
+
+    /// Element validity.  Bit (i % 64) of word (i / 64) is set if
+    /// element 'i' is defined.
+    std::span<const std::uint64_t> valid{};
+
+    /// Number of elements in set.
+    std::size_t size() const { return this->values.size(); }
+
+    /// Whether or not element \p i has a defined value.
+    bool defined(const std::size_t i) const
+    {
+        return (this->valid[i / 64] >> (i % 64)) & std::uint64_t{1};
+    }
+};
+
+/// Reusable work area for executing compiled UDQ programs.
+///
+/// Holds the dense register file, a cached copy of the context's
+/// non-field group names, and the summary state IDs of the context's
+/// wells and groups.  Storage only ever grows, so repeated execution
+/// against contexts of the same size does not allocate.  Copying a work
+/// area yields an empty one, since the contents are only meaningful for
+/// the duration of a single evaluation.
+class UDQScratch
+{
+public:
+    UDQScratch() = default;
+    UDQScratch(const UDQScratch&) {}
+    UDQScratch(UDQScratch&&) noexcept {}
+    UDQScratch& operator=(const UDQScratch&) { return *this; }
+    UDQScratch& operator=(UDQScratch&&) noexcept { return *this; }
+
+    /// Prepare work area for evaluating UDQs in a particular context.
+    ///
+    /// Must be called whenever the set of wells or groups in the
+    /// context may have changed, typically once at the start of each
+    /// round of UDQ evaluation.
+    void prepare(const UDQContext& context);
+
+    /// Non-field groups of most recently prepared context.
+    const std::vector<std::string>& groups() const { return this->groups_; }
+
+private:
+    friend class UDQProgram;
+
+    /// Values of all registers.  Register 'r' starts at r*stride_.
+    std::vector<double> values_{};
+
+    /// Validity bits of all registers.  Register 'r' starts at
+    /// r*words_.
+    std::vector<std::uint64_t> valid_{};
+
+    /// Number of elements in each register.
+    std::size_t stride_{0};
+
+    /// Number of validity words in each register.
+    std::size_t words_{0};
+
+    /// Cached non-field group names.
+    std::vector<std::string> groups_{};
+
+    /// Summary state IDs of the context's wells and of groups_.
+    std::vector<std::optional<std::size_t>> well_ids_{};
+    std::vector<std::optional<std::size_t>> group_ids_{};
+
+    /// Size register file for \p num_registers registers of \p stride
+    /// elements each.  Never shrinks.
+    void reserve(std::size_t num_registers, std::size_t stride);
+};
+
+/// UDQ defining expression lowered to a flat instruction sequence.
+///
+/// Each instruction operates on a register holding either a single
+/// scalar value or one value per well or per non-field group.  Registers
+/// are allocated in stack order, so the result of the expression is
+/// always in register zero.  Elementwise arithmetic, the supported
+/// elemental functions, and the scalar reductions reproduce the
+/// semantics--including definedness--of the corresponding UDQSet
+/// operations.
+///
+/// Not every UDQ expression can be compiled.  Wildcard selectors,
+/// segment and region level quantities, table lookups, set sorting,
+/// random numbers, tolerance based comparisons, and the union functions
+/// are left to the AST evaluator.  Similarly, execution reports failure
+/// instead of throwing in situations where the AST evaluator would raise
+/// an exception, so that the caller can fall back to AST evaluation and
+/// report the problem through the usual channels.
+class UDQProgram
+{
+public:
+    /// Lower UDQ defining expression into instruction sequence.
+    ///
+    /// \param[in] ast Root of defining expression's syntax tree.
+    ///
+    /// \param[in] target_type Type of the defined quantity.
+    ///
+    /// \return Compiled program.  Null if the expression uses features
+    /// not supported by the compiled evaluator.
+    static std::unique_ptr<UDQProgram>
+    compile(const UDQASTNode& ast, UDQVarType target_type);
+
+    /// Execute program.
+    ///
+    /// \param[in] context Summary and UDQ values, and current well and
+    /// group orders.
+    ///
+    /// \param[in,out] scratch Work area.  Must have been prepared for
+    /// \p context.  Holds result on successful return.
+    ///
+    /// \return View of result set, backed by \p scratch and valid until
+    /// the next execution using the same work area.  Nullopt if the
+    /// result must be computed by the AST evaluator instead.
+    std::optional<UDQDenseSet>
+    execute(const UDQContext& context, UDQScratch& scratch) const;
+
+    /// Number of instructions in program.
+    std::size_t size() const { return this->code_.size(); }
+
+    /// Number of registers needed to execute program.
+    std::size_t num_registers() const { return this->num_registers_; }
+
+private:
+    /// Element layout of a register.
+    enum class Shape : std::uint8_t { Scalar, Wells, Groups };
+
+    enum class OpCode : std::uint8_t {
+        Number,       //!< Numeric literal, broadcast to register shape
+        WellVar,      //!< Well level quantity for all wells
+        GroupVar,     //!< Group level quantity for all non-field groups
+        WellScalar,   //!< Well level quantity for named well
+        GroupScalar,  //!< Group level quantity for named group
+        FieldScalar,  //!< Field level or scalar quantity
+        Unary,        //!< Elemental function, in place
+        Binary,       //!< Binary operator, result replaces left operand
+        Reduce,       //!< Scalar function, in place
+    };
+
+    struct Instruction
+    {
+        OpCode op{};
+        UDQTokenType func{UDQTokenType::error};
+
+        /// Shape of destination register on completion.
+        Shape shape{Shape::Scalar};
+
+        /// Shape of right hand operand of binary operator.  Left operand
+        /// and, for unary functions and reductions, the argument is in
+        /// 'dest' with shape 'arg_shape'.
+        Shape rhs_shape{Shape::Scalar};
+        Shape arg_shape{Shape::Scalar};
+
+        /// Destination register.  Right hand operand of binary operator
+        /// is in dest + 1.
+        std::size_t dest{0};
+
+        /// Quantity name, index into names_.
+        std::size_t name{0};
+
+        /// Well or group name for WellScalar and GroupScalar, index into
+        /// names_.
+        std::size_t entity{0};
+
+        /// Numeric literal.
+        double value{0.0};
+
+        /// Sign factor applied to result.
+        double sign{1.0};
+    };
+
+    std::vector<Instruction> code_{};
+    std::vector<std::string> names_{};
+    std::size_t num_registers_{0};
+    UDQVarType target_type_{UDQVarType::NONE};
+    UDQVarType result_type_{UDQVarType::NONE};
+
+    struct NodeType
+    {
+        Shape shape{Shape::Scalar};
+        UDQVarType scalar_type{UDQVarType::SCALAR};
+    };
+
+    std::optional<NodeType> lower(const UDQASTNode& node, std::size_t dest);
+    std::size_t name_index(const std::string& name);
+};
+
+} // namespace Opm
+
+#endif // UDQ_PROGRAM_HPP
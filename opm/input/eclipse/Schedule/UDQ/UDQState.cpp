@@ -20,6 +20,7 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 
 #include <opm/output/eclipse/WindowedArray.hpp>
 
@@ -316,6 +317,44 @@ void UDQState::add_define(std::size_t report_step, const std::string& udq_key, c
     this->add(udq_key, result);
 }
 
+void UDQState::add_define(const std::size_t  report_step,
+                          const std::string& udq_key,
+                          const UDQDenseSet& result)
+{
+    if (!is_udq(udq_key)) {
+        throw std::logic_error {
+            fmt::format("{} is not a UDQ variable", udq_key)
+        };
+    }
+
+    this->defines[udq_key] = report_step;
+
+    if ((result.var_type == UDQVarType::WELL_VAR) ||
+        (result.var_type == UDQVarType::GROUP_VAR))
+    {
+        auto& udq_values = (result.var_type == UDQVarType::WELL_VAR)
+            ? this->well_values[udq_key]
+            : this->group_values[udq_key];
+
+        for (auto i = 0*result.size(); i < result.size(); ++i) {
+            const auto& wgname = (*result.wgnames)[i];
+
+            if (result.defined(i)) {
+                udq_values.insert_or_assign(wgname, result.values[i]);
+            }
+            else {
+                udq_values.erase(wgname);
+            }
+        }
+    }
+    else if (result.defined(0)) {
+        this->scalar_values.insert_or_assign(udq_key, result.values[0]);
+    }
+    else {
+        this->scalar_values.erase(udq_key);
+    }
+}
+
 void UDQState::add_assign(const std::string& udq_key, const UDQSet& result)
 {
     this->add(udq_key, result);
@@ -344,6 +383,20 @@ double UDQState::get_well_var(const std::string& well, const std::string& key) c
     return get_wg(this->well_values, well, key, this->undef_value);
 }
 
+const std::unordered_map<std::string, double>*
+UDQState::find_well_values(const std::string& key) const
+{
+    const auto pos = this->well_values.find(key);
+    return (pos != this->well_values.end()) ? &pos->second : nullptr;
+}
+
+const std::unordered_map<std::string, double>*
+UDQState::find_group_values(const std::string& key) const
+{
+    const auto pos = this->group_values.find(key);
+    return (pos != this->group_values.end()) ? &pos->second : nullptr;
+}
+
 double UDQState::get_segment_var(const std::string& well,
                                  const std::string& var,
                                  const std::size_t  segment) const
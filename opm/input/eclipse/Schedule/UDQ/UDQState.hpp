@@ -20,6 +20,7 @@
 #ifndef UDQSTATE_HPP_
 #define UDQSTATE_HPP_
 
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 
 #include <opm/output/eclipse/WindowedArray.hpp>
@@ -36,6 +37,8 @@ namespace Opm::RestartIO {
 
 namespace Opm {
 
+struct UDQDenseSet;
+
 class UDQState
 {
 public:
@@ -56,15 +59,28 @@ public:
     double get_well_var(const std::string& well, const std::string& var) const;
     double get_segment_var(const std::string& well, const std::string& var, const std::size_t segment) const;
 
+    /// Defined values of well or group level UDQ, keyed by well or
+    /// group name.  Null if no values of \p key have been stored.
+    const std::unordered_map<std::string, double>*
+    find_well_values(const std::string& key) const;
+
+    const std::unordered_map<std::string, double>*
+    find_group_values(const std::string& key) const;
+
     void exportSegmentUDQ(const std::string& var,
                           const std::string& well,
                           ExportRange&       output) const;
 
     void add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result);
+    void add_define(std::size_t report_step, const std::string& udq_key, const UDQDenseSet& result);
     void add_assign(const std::string& udq_key, const UDQSet& result);
     bool define(const std::pair<UDQUpdate, std::size_t>& update_status) const;
     double undefined_value() const;
 
+    /// Evaluation schedule of the UDQ definitions most recently evaluated
+    /// against this state.  Cache, so neither compared nor serialised.
+    UDQDependencyGraph& dependency_graph() { return this->dependency_graph_; }
+
     bool operator==(const UDQState& other) const;
 
     static UDQState serializationTestObject();
@@ -95,6 +111,8 @@ private:
 
     std::unordered_map<std::string, std::size_t> defines{};
 
+    UDQDependencyGraph dependency_graph_{};
+
     void add(const std::string& udq_key, const UDQSet& result);
     double get_wg_var(const std::string& well, const std::string& key, UDQVarType var_type) const;
 };
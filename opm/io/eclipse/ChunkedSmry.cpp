@@ -0,0 +1,810 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/ChunkedSmry.hpp>
+
+#include <opm/common/utility/shmatch.hpp>
+#include <opm/common/utility/TimeService.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace {
+
+constexpr std::string_view fileMagic   = "OPMCSMRY";
+constexpr std::string_view footerMagic = "CSMRYEND";
+constexpr std::uint32_t formatVersion  = 2;
+
+// Size in bytes of file magic, version and header size.
+constexpr std::size_t prefixSize = fileMagic.size() + 4 + 4;
+
+// Size in bytes of each vector block entry in a chunk index.
+constexpr std::size_t blockEntrySize = 8 + 4 + 1;
+
+// Size in bytes of each chunk's footer.
+constexpr std::size_t footerSize = 8 + 8 + 4 + 8;
+
+// Size in bytes of trailing footer offset and footer magic.
+constexpr std::size_t trailerSize = 8 + footerMagic.size();
+
+enum class BlockEncoding : std::uint8_t
+{
+    Raw = 0,            // Little endian IEEE single precision values
+    DeltaShuffle = 1,   // Delta coded bit patterns, byte planes, zero runs
+};
+
+class ByteWriter
+{
+public:
+    void putU8(const std::uint8_t v) { this->buffer_.push_back(static_cast<char>(v)); }
+
+    void putU32(const std::uint32_t v)
+    {
+        for (int shift = 0; shift < 32; shift += 8) {
+            this->putU8(static_cast<std::uint8_t>(v >> shift));
+        }
+    }
+
+    void putU64(const std::uint64_t v)
+    {
+        for (int shift = 0; shift < 64; shift += 8) {
+            this->putU8(static_cast<std::uint8_t>(v >> shift));
+        }
+    }
+
+    void putI32(const int v) { this->putU32(static_cast<std::uint32_t>(v)); }
+
+    void putString(std::string_view s)
+    {
+        this->putU32(static_cast<std::uint32_t>(s.size()));
+        this->buffer_.insert(this->buffer_.end(), s.begin(), s.end());
+    }
+
+    const std::vector<char>& buffer() const { return this->buffer_; }
+
+private:
+    std::vector<char> buffer_{};
+};
+
+class ByteReader
+{
+public:
+    explicit ByteReader(std::span<const char> buffer) : buffer_(buffer) {}
+
+    std::uint8_t getU8()
+    {
+        if (this->pos_ >= this->buffer_.size()) {
+            throw std::runtime_error("Unexpected end of data in chunked summary file");
+        }
+
+        return static_cast<std::uint8_t>(this->buffer_[this->pos_++]);
+    }
+
+    std::uint32_t getU32()
+    {
+        std::uint32_t v = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            v |= static_cast<std::uint32_t>(this->getU8()) << shift;
+        }
+
+        return v;
+    }
+
+    std::uint64_t getU64()
+    {
+        std::uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 8) {
+            v |= static_cast<std::uint64_t>(this->getU8()) << shift;
+        }
+
+        return v;
+    }
+
+    int getI32() { return static_cast<int>(this->getU32()); }
+
+    std::string getString()
+    {
+        const auto size = this->getU32();
+        if (size > this->buffer_.size() - this->pos_) {
+            throw std::runtime_error("Unexpected end of data in chunked summary file");
+        }
+
+        std::string s(this->buffer_.data() + this->pos_, size);
+        this->pos_ += size;
+
+        return s;
+    }
+
+    bool atEnd() const { return this->pos_ == this->buffer_.size(); }
+
+private:
+    std::span<const char> buffer_;
+    std::size_t pos_{0};
+};
+
+std::uint32_t floatBits(const float v)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &v, sizeof bits);
+    return bits;
+}
+
+float bitsToFloat(const std::uint32_t bits)
+{
+    float v;
+    std::memcpy(&v, &bits, sizeof v);
+    return v;
+}
+
+std::vector<char> encodeRaw(const std::vector<float>& values)
+{
+    ByteWriter out;
+    for (const auto& v : values) {
+        out.putU32(floatBits(v));
+    }
+
+    return out.buffer();
+}
+
+// Delta code the bit patterns of consecutive values, split the deltas
+// into four byte planes and replace runs of zero bytes by a zero byte
+// followed by the LEB128 encoded run length.  Summary vectors that are
+// constant, or change slowly, over a chunk compress to a few bytes.
+std::vector<char> encodeDeltaShuffle(const std::vector<float>& values)
+{
+    const auto n = values.size();
+    std::vector<std::uint8_t> planes(4 * n);
+
+    std::uint32_t prev = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto bits = floatBits(values[i]);
+        const auto delta = bits - prev;
+        prev = bits;
+
+        for (std::size_t k = 0; k < 4; ++k) {
+            planes[k*n + i] = static_cast<std::uint8_t>(delta >> (8 * k));
+        }
+    }
+
+    ByteWriter out;
+    for (std::size_t i = 0; i < planes.size(); ) {
+        if (planes[i] != 0) {
+            out.putU8(planes[i++]);
+            continue;
+        }
+
+        auto run = std::uint64_t{0};
+        while ((i < planes.size()) && (planes[i] == 0)) {
+            ++run;
+            ++i;
+        }
+
+        out.putU8(0);
+        do {
+            const auto byte = static_cast<std::uint8_t>(run & 0x7F);
+            run >>= 7;
+            out.putU8(byte | ((run != 0) ? 0x80 : 0x00));
+        } while (run != 0);
+    }
+
+    return out.buffer();
+}
+
+std::vector<float> decodeBlock(std::span<const char> block,
+                               const BlockEncoding encoding,
+                               const std::size_t n)
+{
+    std::vector<float> values(n);
+    ByteReader in { block };
+
+    if (encoding == BlockEncoding::Raw) {
+        for (auto& v : values) {
+            v = bitsToFloat(in.getU32());
+        }
+
+        return values;
+    }
+
+    if (encoding != BlockEncoding::DeltaShuffle) {
+        throw std::runtime_error {
+            fmt::format("Unknown block encoding {} in chunked summary file",
+                        static_cast<int>(encoding))
+        };
+    }
+
+    std::vector<std::uint8_t> planes(4 * n, 0);
+    for (std::size_t i = 0; i < planes.size(); ) {
+        const auto byte = in.getU8();
+        if (byte != 0) {
+            planes[i++] = byte;
+            continue;
+        }
+
+        auto run = std::uint64_t{0};
+        for (int shift = 0; ; shift += 7) {
+            const auto b = in.getU8();
+            run |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) {
+                break;
+            }
+        }
+
+        if (run > planes.size() - i) {
+            throw std::runtime_error("Corrupt block in chunked summary file");
+        }
+
+        i += run;
+    }
+
+    std::uint32_t prev = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint32_t delta = 0;
+        for (std::size_t k = 0; k < 4; ++k) {
+            delta |= static_cast<std::uint32_t>(planes[k*n + i]) << (8 * k);
+        }
+
+        prev += delta;
+        values[i] = bitsToFloat(prev);
+    }
+
+    return values;
+}
+
+// Offset of the last complete trailer in the first 'fileSize' bytes of
+// the file, scanning backwards from the end.  A trailer is complete if
+// it immediately follows the footer to which it refers, or the header if
+// it refers to no footer.  Nullopt if there is no such trailer.
+std::optional<std::uint64_t>
+findTrailer(std::ifstream& fileH,
+            const std::uint64_t headerEnd,
+            const std::uint64_t fileSize)
+{
+    constexpr std::uint64_t window = 64 * 1024;
+
+    auto isTrailer = [headerEnd](const std::uint64_t pos, const std::uint64_t footer)
+    {
+        return (footer == 0)
+            ? (pos == headerEnd)
+            : ((footer >= headerEnd) && (pos >= footerSize) && (footer == pos - footerSize));
+    };
+
+    std::vector<char> buffer;
+    auto end = fileSize;
+    while ((end >= headerEnd) && (end - headerEnd >= trailerSize)) {
+        const auto begin = std::max(headerEnd, (end > window) ? end - window : std::uint64_t{0});
+
+        buffer.resize(end - begin);
+        fileH.clear();
+        fileH.seekg(static_cast<std::streamoff>(begin));
+        fileH.read(buffer.data(), buffer.size());
+        if (!fileH) {
+            return std::nullopt;
+        }
+
+        for (auto t = buffer.size() - trailerSize + 1; t-- > 0; ) {
+            if (std::string_view { buffer.data() + t + 8, footerMagic.size() } != footerMagic) {
+                continue;
+            }
+
+            const auto footer = ByteReader { std::span<const char>{ buffer }.subspan(t, 8) }.getU64();
+            if (isTrailer(begin + t, footer)) {
+                return begin + t;
+            }
+        }
+
+        if (begin == headerEnd) {
+            break;
+        }
+
+        // Next window overlaps this one by all but one byte of a trailer.
+        end = begin + trailerSize - 1;
+    }
+
+    return std::nullopt;
+}
+
+Opm::time_point make_date(const std::vector<int>& datetime)
+{
+    auto day = datetime[0];
+    auto month = datetime[1];
+    auto year = datetime[2];
+    auto hour = 0;
+    auto minute = 0;
+    auto second = 0;
+
+    if (datetime.size() == 7) {
+        hour = datetime[3];
+        minute = datetime[4];
+        second = datetime[5] ;
+    }
+
+    const auto ts = Opm::TimeStampUTC{ Opm::TimeStampUTC::YMD{ year, month, day}}.hour(hour).minutes(minute).seconds(second);
+    return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+// ---------------------------------------------------------------------------
+// ChunkedSmryOutput
+// ---------------------------------------------------------------------------
+
+ChunkedSmryOutput::ChunkedSmryOutput(const std::string& filename,
+                                     const std::vector<std::string>& valueKeys,
+                                     const std::vector<std::string>& valueUnits,
+                                     const std::vector<int>& startDate,
+                                     const std::size_t chunkSize,
+                                     const bool compress)
+    : m_last_write      { std::chrono::system_clock::now() }
+    , m_outputFileName  { filename }
+    , m_chunkSize       { std::max(chunkSize, std::size_t{1}) }
+    , m_compress        { compress }
+    , m_smry_keys       { valueKeys }
+    , m_smryUnits       { valueUnits }
+    , m_start_date_vect { startDate }
+    , m_smrydata        ( valueKeys.size() )
+{
+    if (valueUnits.size() != valueKeys.size()) {
+        throw std::invalid_argument("number of summary units not same as number of summary keys");
+    }
+
+    if (m_start_date_vect.size() != 7) {
+        throw std::invalid_argument("start date must have 7 elements");
+    }
+
+    std::fstream fileH(m_outputFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!fileH) {
+        throw std::runtime_error("Can not open chunked summary file " + m_outputFileName);
+    }
+
+    // Keys, units and start date are written once, here.
+    ByteWriter header;
+    header.putU32(static_cast<std::uint32_t>(m_smry_keys.size()));
+    for (std::size_t n = 0; n < m_smry_keys.size(); ++n) {
+        header.putString(m_smry_keys[n]);
+        header.putString(m_smryUnits[n]);
+    }
+
+    for (const auto& d : m_start_date_vect) {
+        header.putI32(d);
+    }
+
+    ByteWriter head;
+    for (const auto& c : fileMagic) {
+        head.putU8(static_cast<std::uint8_t>(c));
+    }
+    head.putU32(formatVersion);
+    head.putU32(static_cast<std::uint32_t>(header.buffer().size()));
+
+    fileH.write(head.buffer().data(), head.buffer().size());
+    fileH.write(header.buffer().data(), header.buffer().size());
+    m_fileEnd = head.buffer().size() + header.buffer().size();
+
+    // File is readable, without any time steps, from the start.
+    this->writeTrailer(fileH);
+}
+
+void ChunkedSmryOutput::write(const std::vector<float>& ts_data, int report_step, bool is_final_summary)
+{
+    if (ts_data.size() != m_smry_keys.size())
+        throw std::invalid_argument("size of ts_data vector not same as number of smry vectors");
+
+    m_rstep.push_back(report_step);
+
+    for (std::size_t n = 0; n < m_smry_keys.size(); n++)
+        m_smrydata[n].push_back(ts_data[n]);
+
+    m_nTimeSteps++;
+
+    const std::chrono::duration<double> elapsed_seconds =
+        std::chrono::system_clock::now() - m_last_write;
+
+    if (is_final_summary ||
+        (m_rstep.size() >= m_chunkSize) ||
+        (elapsed_seconds.count() > m_min_write_interval))
+    {
+        this->flush();
+    }
+}
+
+void ChunkedSmryOutput::flush()
+{
+    if (m_rstep.empty()) {
+        return;
+    }
+
+    std::fstream fileH(m_outputFileName, std::ios::in | std::ios::out | std::ios::binary);
+    if (!fileH) {
+        throw std::runtime_error("Can not open chunked summary file " + m_outputFileName);
+    }
+
+    // New chunk is appended after the current trailer, which remains
+    // valid until the trailer of the new chunk has been written.
+    fileH.seekp(static_cast<std::streamoff>(m_fileEnd));
+
+    const auto numSteps = m_rstep.size();
+
+    ByteWriter index;
+    for (const auto& rstep : m_rstep) {
+        index.putI32(rstep);
+    }
+
+    auto pos = m_fileEnd;
+    for (auto& values : m_smrydata) {
+        auto block = encodeRaw(values);
+        auto encoding = BlockEncoding::Raw;
+
+        if (m_compress) {
+            auto packed = encodeDeltaShuffle(values);
+            if (packed.size() < block.size()) {
+                block.swap(packed);
+                encoding = BlockEncoding::DeltaShuffle;
+            }
+        }
+
+        fileH.write(block.data(), block.size());
+
+        index.putU64(pos);
+        index.putU32(static_cast<std::uint32_t>(block.size()));
+        index.putU8(static_cast<std::uint8_t>(encoding));
+
+        pos += block.size();
+        values.clear();
+    }
+
+    fileH.write(index.buffer().data(), index.buffer().size());
+
+    m_fileEnd = pos + index.buffer().size();
+    m_rstep.clear();
+
+    this->writeFooter(fileH, { pos, m_nTimeSteps - numSteps, static_cast<std::uint32_t>(numSteps) });
+    this->writeTrailer(fileH);
+
+    if (!fileH) {
+        throw std::runtime_error("Failed writing chunked summary file " + m_outputFileName);
+    }
+
+    m_last_write = std::chrono::system_clock::now();
+}
+
+void ChunkedSmryOutput::writeFooter(std::fstream& fileH, const ChunkEntry& chunk)
+{
+    ByteWriter footer;
+
+    footer.putU64(chunk.indexOffset);
+    footer.putU64(chunk.firstStep);
+    footer.putU32(chunk.numSteps);
+    footer.putU64(m_lastFooter);
+
+    fileH.seekp(static_cast<std::streamoff>(m_fileEnd));
+    fileH.write(footer.buffer().data(), footer.buffer().size());
+
+    m_lastFooter = m_fileEnd;
+    m_fileEnd += footer.buffer().size();
+}
+
+void ChunkedSmryOutput::writeTrailer(std::fstream& fileH)
+{
+    ByteWriter trailer;
+
+    trailer.putU64(m_lastFooter);
+    for (const auto& c : footerMagic) {
+        trailer.putU8(static_cast<std::uint8_t>(c));
+    }
+
+    fileH.seekp(static_cast<std::streamoff>(m_fileEnd));
+    fileH.write(trailer.buffer().data(), trailer.buffer().size());
+    fileH.flush();
+
+    m_fileEnd += trailer.buffer().size();
+}
+
+// ---------------------------------------------------------------------------
+// ChunkedESmry
+// ---------------------------------------------------------------------------
+
+ChunkedESmry::ChunkedESmry(const std::string& filename)
+    : m_inputFileName { filename }
+{
+    std::ifstream fileH { filename, std::ios::in | std::ios::binary };
+    if (!fileH) {
+        throw std::invalid_argument("Can not open chunked summary file " + filename);
+    }
+
+    auto readBytes = [this, &fileH](const std::uint64_t offset, const std::size_t size)
+    {
+        std::vector<char> buffer(size);
+        fileH.seekg(static_cast<std::streamoff>(offset));
+        fileH.read(buffer.data(), size);
+
+        if (!fileH) {
+            throw std::runtime_error("Unexpected end of chunked summary file " + m_inputFileName);
+        }
+
+        return buffer;
+    };
+
+    fileH.seekg(0, std::ios::end);
+    const auto fileSize = static_cast<std::uint64_t>(fileH.tellg());
+
+    if (fileSize < prefixSize + trailerSize) {
+        throw std::runtime_error(m_inputFileName + " is not a chunked summary file");
+    }
+
+    std::uint64_t headerEnd = 0;
+    {
+        const auto head = readBytes(0, prefixSize);
+
+        if (std::string_view { head.data(), fileMagic.size() } != fileMagic) {
+            throw std::runtime_error(m_inputFileName + " is not a chunked summary file");
+        }
+
+        ByteReader in { std::span<const char>{ head }.subspan(fileMagic.size()) };
+        if (const auto version = in.getU32(); version != formatVersion) {
+            throw std::runtime_error {
+                fmt::format("Unsupported chunked summary file version {} in {}",
+                            version, m_inputFileName)
+            };
+        }
+
+        const auto headerSize = in.getU32();
+        if (headerSize > fileSize - prefixSize - trailerSize) {
+            throw std::runtime_error("Corrupt header in chunked summary file " + m_inputFileName);
+        }
+
+        headerEnd = prefixSize + headerSize;
+    }
+
+    {
+        const auto header = readBytes(prefixSize, headerEnd - prefixSize);
+        ByteReader in { header };
+
+        const auto nVect = in.getU32();
+        m_keyword.reserve(nVect);
+        m_units.reserve(nVect);
+
+        for (std::uint32_t n = 0; n < nVect; ++n) {
+            m_keyword.push_back(in.getString());
+            m_units.push_back(in.getString());
+            m_keyword_index.emplace(m_keyword.back(), n);
+        }
+
+        m_start_vect.resize(7);
+        for (auto& d : m_start_vect) {
+            d = in.getI32();
+        }
+
+        m_startdat = make_date(m_start_vect);
+    }
+
+    // The file normally ends with a trailer.  If it was cut short during
+    // a flush, it ends with a partial chunk after the previous trailer.
+    const auto trailerOffset = findTrailer(fileH, headerEnd, fileSize);
+    if (! trailerOffset.has_value()) {
+        throw std::runtime_error("Missing footer in chunked summary file " + m_inputFileName);
+    }
+
+    fileH.clear();
+    const auto trailer = readBytes(*trailerOffset, trailerSize);
+
+    // Collect chunks from the last footer backwards.  Each footer
+    // precedes the one referring to it, which also rules out cycles.
+    // A chunk's index immediately precedes its footer.
+    const auto indexSize = blockEntrySize * std::uint64_t{m_keyword.size()};
+    auto footerOffset = ByteReader { trailer }.getU64();
+    auto footerLimit = *trailerOffset;
+    while (footerOffset != 0) {
+        if ((footerOffset < headerEnd) || (footerOffset > footerLimit) ||
+            (footerLimit - footerOffset < footerSize))
+        {
+            throw std::runtime_error("Corrupt footer in chunked summary file " + m_inputFileName);
+        }
+
+        const auto footer = readBytes(footerOffset, footerSize);
+        ByteReader in { footer };
+
+        auto& chunk = m_chunks.emplace_back();
+        chunk.indexOffset = in.getU64();
+        chunk.firstStep = in.getU64();
+        chunk.numSteps = in.getU32();
+
+        if ((chunk.indexOffset < headerEnd) || (chunk.indexOffset > footerOffset) ||
+            (footerOffset - chunk.indexOffset != 4 * std::uint64_t{chunk.numSteps} + indexSize))
+        {
+            throw std::runtime_error("Corrupt chunk index in chunked summary file " + m_inputFileName);
+        }
+
+        footerLimit = footerOffset;
+        footerOffset = in.getU64();
+    }
+
+    std::ranges::reverse(m_chunks);
+
+    // Report step numbers of all time steps.  These are small compared
+    // to the vector data and needed for report step based queries.
+    for (const auto& chunk : m_chunks) {
+        const auto rsteps = readBytes(chunk.indexOffset, 4 * std::size_t{chunk.numSteps});
+        ByteReader rin { rsteps };
+
+        for (std::uint32_t i = 0; i < chunk.numSteps; ++i) {
+            m_rstep.push_back(rin.getI32());
+        }
+    }
+
+    m_nTstep = m_rstep.size();
+
+    for (std::size_t m = 0; m < m_nTstep; ++m) {
+        if ((m + 1 == m_nTstep) || (m_rstep[m + 1] != m_rstep[m])) {
+            m_seqIndex.push_back(static_cast<int>(m));
+        }
+    }
+}
+
+bool ChunkedESmry::hasKey(const std::string& key) const
+{
+    return m_keyword_index.find(key) != m_keyword_index.end();
+}
+
+std::size_t ChunkedESmry::keywordIndex(const std::string& name) const
+{
+    auto it = m_keyword_index.find(name);
+    if (it == m_keyword_index.end()) {
+        throw std::invalid_argument("summary key '" + name + "' not found");
+    }
+
+    return it->second;
+}
+
+std::vector<float> ChunkedESmry::readBlock(std::ifstream& fileH,
+                                           const ChunkEntry& chunk,
+                                           const std::size_t vectIndex) const
+{
+    std::array<char, blockEntrySize> entry;
+
+    fileH.seekg(static_cast<std::streamoff>(chunk.indexOffset + 4 * std::uint64_t{chunk.numSteps}
+                                              + vectIndex * blockEntrySize));
+    fileH.read(entry.data(), entry.size());
+
+    if (!fileH) {
+        throw std::runtime_error("Unexpected end of chunked summary file " + m_inputFileName);
+    }
+
+    ByteReader in { entry };
+    const auto offset = in.getU64();
+    const auto size = in.getU32();
+    const auto encoding = static_cast<BlockEncoding>(in.getU8());
+
+    // Vector blocks precede their chunk's index.  Check before allocating.
+    if ((offset > chunk.indexOffset) || (size > chunk.indexOffset - offset)) {
+        throw std::runtime_error("Corrupt block in chunked summary file " + m_inputFileName);
+    }
+
+    std::vector<char> block(size);
+    fileH.seekg(static_cast<std::streamoff>(offset));
+    fileH.read(block.data(), size);
+
+    if (!fileH) {
+        throw std::runtime_error("Unexpected end of chunked summary file " + m_inputFileName);
+    }
+
+    return decodeBlock(block, encoding, chunk.numSteps);
+}
+
+std::vector<float> ChunkedESmry::get(const std::string& name) const
+{
+    return this->get(name, 0, m_nTstep);
+}
+
+std::vector<float> ChunkedESmry::get(const std::string& name,
+                                     std::size_t first_step,
+                                     std::size_t last_step) const
+{
+    const auto vectIndex = this->keywordIndex(name);
+
+    last_step = std::min(last_step, m_nTstep);
+    first_step = std::min(first_step, last_step);
+
+    std::vector<float> values;
+    values.reserve(last_step - first_step);
+
+    if (first_step == last_step) {
+        return values;
+    }
+
+    // Separate stream per call so concurrent reads do not share a file
+    // position.
+    std::ifstream fileH { m_inputFileName, std::ios::in | std::ios::binary };
+    if (!fileH) {
+        throw std::runtime_error("Can not open chunked summary file " + m_inputFileName);
+    }
+
+    // First chunk ending after first_step.
+    auto chunk = std::ranges::partition_point(m_chunks,
+                                              [first_step](const auto& c)
+                                              { return c.firstStep + c.numSteps <= first_step; });
+
+    for (; (chunk != m_chunks.end()) && (chunk->firstStep < last_step); ++chunk) {
+        const auto block = this->readBlock(fileH, *chunk, vectIndex);
+
+        const auto begin = std::max(first_step, chunk->firstStep) - chunk->firstStep;
+        const auto end = std::min<std::size_t>(last_step, chunk->firstStep + chunk->numSteps) - chunk->firstStep;
+
+        values.insert(values.end(), block.begin() + begin, block.begin() + end);
+    }
+
+    return values;
+}
+
+std::vector<float> ChunkedESmry::get_at_rstep(const std::string& name) const
+{
+    const auto full_vect = this->get(name);
+
+    std::vector<float> rs_vect;
+    rs_vect.reserve(m_seqIndex.size());
+
+    std::ranges::transform(m_seqIndex, std::back_inserter(rs_vect),
+                           [&full_vect](const auto& r)
+                           { return full_vect[r]; });
+
+    return rs_vect;
+}
+
+const std::string& ChunkedESmry::get_unit(const std::string& name) const
+{
+    return m_units[this->keywordIndex(name)];
+}
+
+std::vector<time_point> ChunkedESmry::dates() const
+{
+    double time_unit = 24 * 3600;
+    std::vector<Opm::time_point> d;
+
+    const auto time = this->get("TIME");
+    std::ranges::transform(time, std::back_inserter(d),
+                           [this, time_unit](const auto& t)
+                           {
+                               using Seconds = std::chrono::duration<double, std::chrono::seconds::period>;
+                               return this->m_startdat +
+                                      std::chrono::duration_cast<time_point::duration>(Seconds{t * time_unit});
+                           });
+
+    return d;
+}
+
+std::vector<std::string> ChunkedESmry::keywordList(const std::string& pattern) const
+{
+    std::vector<std::string> list;
+    std::ranges::copy_if(m_keyword, std::back_inserter(list),
+                         [&pattern](const auto& key)
+                         { return shmatch(pattern, key); });
+
+    return list;
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,226 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_CHUNKEDSMRY_HPP
+#define OPM_IO_CHUNKEDSMRY_HPP
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// \file
+///
+/// Column-chunked summary file (.CSMRY).
+///
+/// Summary data is stored as a sequence of time chunks, each holding a
+/// contiguous range of time steps.  Within a chunk every summary vector
+/// is stored as a separate, optionally compressed, block.  Each chunk is
+/// followed by a small footer which refers to the footer of the previous
+/// chunk, so new chunks are appended without rewriting existing data and
+/// the amount written per chunk does not grow with the number of chunks.
+/// Readers can fetch a time window of a single vector by reading only the
+/// blocks that overlap it.
+///
+/// File layout (all integers little endian):
+///
+///   "OPMCSMRY" u32 version, u32 header size,
+///   header: u32 nVect, (key, unit) * nVect, i32 start[7]
+///   trailer 0
+///   chunk 1: vector blocks..., chunk index, footer 1, trailer 1
+///   ...
+///   chunk n: vector blocks..., chunk index, footer n, trailer n
+///
+///   footer:  u64 index offset, u64 first step, u32 nStep,
+///            u64 previous footer offset (0 for the first chunk)
+///   trailer: u64 footer offset (0 if no chunks), "CSMRYEND"
+///
+/// Each flush appends a chunk, its footer and a trailer and never writes
+/// over existing bytes, so a file cut short during a flush still holds
+/// the previous, complete, trailer followed by a partial chunk.  Readers
+/// use the last complete trailer, scanning backwards from the end of the
+/// file if necessary, and recover the chunk list by following the
+/// footers' back-pointers.
+///
+/// A chunk index holds the i32 report step number of each time step in
+/// the chunk, followed by (u64 offset, u32 size, u8 encoding) for each
+/// vector block.  Strings are stored as u32 length followed by characters.
+
+namespace Opm { namespace EclIO {
+
+/// Incremental writer of column-chunked summary files.
+class ChunkedSmryOutput
+{
+public:
+    /// Constructor.
+    ///
+    /// Creates the output file, replacing any existing file.
+    ///
+    /// \param[in] filename Name of output file.  Conventionally has
+    ///   extension .CSMRY.
+    ///
+    /// \param[in] valueKeys Summary vector keys.
+    ///
+    /// \param[in] valueUnits Summary vector units.  Same size as
+    ///   valueKeys.
+    ///
+    /// \param[in] startDate Simulation start in ESMRY "START" format:
+    ///   day, month, year, hour, minute, second, microsecond.
+    ///
+    /// \param[in] chunkSize Maximum number of time steps in each chunk.
+    ///
+    /// \param[in] compress Whether or not to apply delta+shuffle
+    ///   compression to vector blocks.  Blocks are stored uncompressed
+    ///   if compression does not reduce their size.
+    ChunkedSmryOutput(const std::string& filename,
+                      const std::vector<std::string>& valueKeys,
+                      const std::vector<std::string>& valueUnits,
+                      const std::vector<int>& startDate,
+                      std::size_t chunkSize = 256,
+                      bool compress = true);
+
+    /// Add summary values for one time step.
+    ///
+    /// The pending time steps are appended to the file as a new chunk
+    /// when the chunk is full, when \p is_final_summary is set, or when
+    /// more than m_min_write_interval seconds have elapsed since the
+    /// previous write.
+    void write(const std::vector<float>& ts_data,
+               int report_step,
+               bool is_final_summary);
+
+    /// Append all pending time steps to the file as a new chunk,
+    /// followed by its footer.
+    void flush();
+
+    /// Number of time steps added so far.
+    std::size_t numberOfTimeSteps() const { return m_nTimeSteps; }
+
+private:
+    static constexpr int m_min_write_interval = 15;  // at least 15 seconds between each write
+    std::chrono::time_point<std::chrono::system_clock> m_last_write;
+
+    struct ChunkEntry
+    {
+        std::uint64_t indexOffset{};
+        std::uint64_t firstStep{};
+        std::uint32_t numSteps{};
+    };
+
+    std::string m_outputFileName;
+    std::size_t m_chunkSize;
+    bool m_compress;
+
+    std::vector<std::string> m_smry_keys;
+    std::vector<std::string> m_smryUnits;
+    std::vector<int> m_start_date_vect;
+
+    std::size_t m_nTimeSteps{0};
+
+    // Pending time steps, not yet written to file.
+    std::vector<int> m_rstep;
+    std::vector<std::vector<float>> m_smrydata;
+
+    // Offset of the most recent footer, zero if no chunks written.
+    std::uint64_t m_lastFooter{0};
+
+    // Current file size, i.e., where the next chunk starts.
+    std::uint64_t m_fileEnd{0};
+
+    void writeFooter(std::fstream& fileH, const ChunkEntry& chunk);
+    void writeTrailer(std::fstream& fileH);
+};
+
+
+/// Reader of column-chunked summary files.
+///
+/// Vector values are read from file on request.  Reading a time window
+/// only touches the chunks overlapping that window.  Each read opens its
+/// own file stream, so const member functions may be called concurrently.
+class ChunkedESmry
+{
+public:
+    explicit ChunkedESmry(const std::string& filename);
+
+    bool hasKey(const std::string& key) const;
+
+    /// All values of summary vector \p name.
+    std::vector<float> get(const std::string& name) const;
+
+    /// Values of summary vector \p name for time steps in the half-open
+    /// range [first_step, last_step).  The range is clamped to the
+    /// available time steps.
+    std::vector<float> get(const std::string& name,
+                           std::size_t first_step,
+                           std::size_t last_step) const;
+
+    /// Values of summary vector \p name at the end of each report step.
+    std::vector<float> get_at_rstep(const std::string& name) const;
+
+    const std::string& get_unit(const std::string& name) const;
+
+    std::vector<time_point> dates() const;
+    time_point startdate() const { return m_startdat; }
+    const std::vector<int>& start_v() const { return m_start_vect; }
+
+    std::size_t numberOfTimeSteps() const { return m_nTstep; }
+    std::size_t numberOfVectors() const { return m_keyword.size(); }
+
+    const std::vector<std::string>& keywordList() const { return m_keyword; }
+    std::vector<std::string> keywordList(const std::string& pattern) const;
+
+    /// Time step indices at the end of each report step.
+    const std::vector<int>& reportStepIndices() const { return m_seqIndex; }
+
+private:
+    struct ChunkEntry
+    {
+        std::uint64_t indexOffset{};
+        std::uint64_t firstStep{};
+        std::uint32_t numSteps{};
+    };
+
+    std::string m_inputFileName;
+
+    std::vector<std::string> m_keyword;
+    std::vector<std::string> m_units;
+    std::unordered_map<std::string, std::size_t> m_keyword_index;
+
+    std::vector<ChunkEntry> m_chunks;
+    std::vector<int> m_rstep;
+    std::vector<int> m_seqIndex;
+    std::size_t m_nTstep{0};
+
+    std::vector<int> m_start_vect;
+    time_point m_startdat;
+
+    std::size_t keywordIndex(const std::string& name) const;
+    std::vector<float> readBlock(std::ifstream& fileH,
+                                 const ChunkEntry& chunk,
+                                 std::size_t vectIndex) const;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_CHUNKEDSMRY_HPP
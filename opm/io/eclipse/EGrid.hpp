@@ -33,6 +33,7 @@ class EGrid : public EclFile
 {
 public:
     explicit EGrid(const std::string& filename, const std::string& grid_name = "global");
+    EGrid(const std::string& filename, MemoryMapped mmap, const std::string& grid_name = "global");
 
     int global_index(int i, int j, int k) const;
     int active_index(int i, int j, int k) const;
@@ -24,7 +24,10 @@
 
 namespace Opm::EclIO {
 
-EInit::EInit(const std::string &filename) : EclFile(filename)
+EInit::EInit(const std::string &filename) : EInit(filename, MemoryMapped{false})
+{}
+
+EInit::EInit(const std::string &filename, MemoryMapped mmap) : EclFile(filename, mmap)
 {
     std::string lgrname;
 
@@ -31,6 +31,7 @@ class EInit : public EclFile
 {
 public:
     explicit EInit(const std::string& filename);
+    EInit(const std::string& filename, MemoryMapped mmap);
 
     const std::vector<std::string>& list_of_lgrs() const { return lgr_names; }
 
@@ -30,7 +30,10 @@
 
 namespace Opm::EclIO {
 
-ERft::ERft(const std::string &filename) : EclFile(filename)
+ERft::ERft(const std::string &filename) : ERft(filename, MemoryMapped{false})
+{}
+
+ERft::ERft(const std::string &filename, MemoryMapped mmap) : EclFile(filename, mmap)
 {
     loadData();
     std::vector<int> first;
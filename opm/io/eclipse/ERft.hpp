@@ -35,6 +35,7 @@ class ERft : public EclFile
 {
 public:
     explicit ERft(const std::string &filename);
+    ERft(const std::string &filename, MemoryMapped mmap);
 
     using RftDate = std::tuple<int,int,int>;
     template <typename T>
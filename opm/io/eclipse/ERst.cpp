@@ -54,7 +54,12 @@ namespace {
 namespace Opm::EclIO {
 
 ERst::ERst(const std::string& filename)
-    : EclFile(filename)
+    : ERst(filename, MemoryMapped{false})
+{}
+
+
+ERst::ERst(const std::string& filename, MemoryMapped mmap)
+    : EclFile(filename, mmap)
 {
     if (this->hasKey("SEQNUM")) {
         this->initUnified();
@@ -38,6 +38,7 @@ class ERst : public EclFile
 {
 public:
     explicit ERst(const std::string& filename);
+    ERst(const std::string& filename, MemoryMapped mmap);
 
     bool hasReportStepNumber(int number) const;
     bool hasArray(const std::string& name, int number) const;
@@ -115,6 +115,18 @@ bool is_well_completion(const std::string& keyword)
     return std::regex_match(keyword, well_compl_kw);
 }
 
+// True if the file exists and begins with the magic of a column-chunked
+// summary file (ChunkedSmryOutput).
+bool is_chunked_summary(const std::filesystem::path& filename)
+{
+    constexpr std::string_view chunkedMagic = "OPMCSMRY";
+
+    std::ifstream fileH { filename, std::ios::in | std::ios::binary };
+    std::string head(chunkedMagic.size(), '\0');
+
+    return fileH.read(head.data(), head.size()) && (head == chunkedMagic);
+}
+
 }
 
 
@@ -139,6 +151,9 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
     if (inputFileName.extension()=="")
         inputFileName+=".SMSPEC";
 
+    if (is_chunked_summary(inputFileName))
+        throw std::invalid_argument(inputFileName.string() + " is a chunked summary file, use ChunkedESmry to read it");
+
     if ((inputFileName.extension()!=".SMSPEC") && (inputFileName.extension()!=".FSMSPEC"))
         throw std::invalid_argument("Input file should have extension .SMSPEC or .FSMSPEC");
 
@@ -746,13 +761,6 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
     auto specInd = std::get<0>(timeStepList[0]);
     auto dataFileIndex = std::get<1>(timeStepList[0]);
-    std::uint64_t blockSize_f;
-
-    {
-        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal;
-
-        blockSize_f= static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
-    }
 
     if (formattedFiles[specInd])
         fileH.open(dataFileList[dataFileIndex], std::ios::in);
@@ -773,57 +781,117 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
         const auto stepFilePos = std::get<2>(ministep);;
 
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
-            if (it == arrayPos[specInd].end()) {
-                // undefined vector in current summary file. Typically when loading
-                // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
-            }
-            else {
-                int paramPos = it->second;
+        for (auto ind : keywIndVect)
+            vectorData[ind].push_back(this->readParamValue(fileH, specInd, stepFilePos, ind));
+    }
 
-                if (formattedFiles[specInd]) {
-                    std::uint64_t elementPos = 0;
-                    int nBlocks = paramPos / MaxBlockSizeReal;
-                    int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
+    fileH.close();
 
-                    if (nBlocks > 0)
-                        elementPos = static_cast<std::uint64_t>(nBlocks * blockSize_f);
+    for (const auto& ind : keywIndVect)
+        vectorLoaded[ind] = true;
 
-                    int nLines = sizeOfLastBlock / numColumnsReal;
-                    elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+}
 
-                    fileH.seekg (elementPos, fileH.beg);
+float ESmry::readParamValue(std::fstream& fileH, const int specInd,
+                            const std::uint64_t stepFilePos, const int keywInd) const
+{
+    auto it = arrayPos[specInd].find(keywInd);
+    if (it == arrayPos[specInd].end()) {
+        // undefined vector in current summary file. Typically when loading
+        // base restart run and including base run data. Vectors can be added to restart runs
+        return std::nanf("");
+    }
 
-                    const std::size_t size = columnWidthReal;
-                    std::vector<char> buffer(size);
-                    fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
-                }
-                else {
-                    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
-                    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
-                    elementPos += static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
+    const int paramPos = it->second;
 
-                    fileH.seekg (elementPos, fileH.beg);
+    if (formattedFiles[specInd]) {
+        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal;
+        const auto blockSize_f = static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
 
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+        std::uint64_t elementPos = 0;
+        int nBlocks = paramPos / MaxBlockSizeReal;
+        int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
 
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
-                }
-            }
+        if (nBlocks > 0)
+            elementPos = static_cast<std::uint64_t>(nBlocks * blockSize_f);
+
+        int nLines = sizeOfLastBlock / numColumnsReal;
+        elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
+
+        fileH.seekg (elementPos, fileH.beg);
+
+        std::vector<char> buffer(columnWidthReal + 1, '\0');
+        fileH.read (buffer.data(), columnWidthReal);
+
+        return std::strtof(buffer.data(), nullptr);
+    }
+
+    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
+    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
+    elementPos += static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
+
+    fileH.seekg (elementPos, fileH.beg);
+
+    float value;
+    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+
+    return Opm::EclIO::flipEndianFloat(value);
+}
+
+std::vector<std::vector<float>>
+ESmry::readTimeSteps(const std::vector<int>& keywIndVect,
+                     const std::vector<std::size_t>& steps) const
+{
+    auto start = std::chrono::system_clock::now();
+
+    std::vector<std::vector<float>> result(keywIndVect.size());
+    for (auto& values : result)
+        values.reserve(steps.size());
+
+    // Vectors already in memory are copied, only the remaining vectors
+    // are read from disk and then only at the requested time steps.
+    std::vector<std::size_t> fromDisk;
+    for (std::size_t n = 0; n < keywIndVect.size(); ++n) {
+        const auto ind = keywIndVect[n];
+
+        if (vectorLoaded[ind]) {
+            std::ranges::transform(steps, std::back_inserter(result[n]),
+                                   [this, ind](const auto& step)
+                                   { return vectorData[ind][step]; });
+        } else {
+            fromDisk.push_back(n);
         }
     }
 
-    fileH.close();
+    if (fromDisk.empty() || steps.empty())
+        return result;
 
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
+    std::fstream fileH;
+    int dataFileIndex = -1;
+
+    for (const auto& step : steps) {
+        const auto& [specInd, fileIndex, stepFilePos] = timeStepList[step];
+
+        if (dataFileIndex != fileIndex) {
+            fileH.close();
+            dataFileIndex = fileIndex;
+
+            if (formattedFiles[specInd])
+                fileH.open(dataFileList[dataFileIndex], std::ios::in );
+            else
+                fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+        }
+
+        for (const auto& n : fromDisk)
+            result[n].push_back(this->readParamValue(fileH, specInd, stepFilePos, keywIndVect[n]));
+    }
 
     std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
     m_io_loading += elapsed_seconds.count();
+
+    return result;
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
@@ -1399,6 +1467,53 @@ std::vector<float> ESmry::get_at_rstep(const std::string& name) const
     return this->rstep_vector( this->get(name) );
 }
 
+std::vector<float> ESmry::get(const std::string& name,
+                              const std::size_t first_step,
+                              const std::size_t last_step,
+                              const std::size_t stride) const
+{
+    return this->get_multiple({ name }, first_step, last_step, stride).front();
+}
+
+std::vector<std::vector<float>>
+ESmry::get_multiple(const std::vector<std::string>& names,
+                    const std::size_t first_step,
+                    const std::size_t last_step,
+                    const std::size_t stride) const
+{
+    return this->readTimeSteps(this->keywordIndices(names),
+                               selectTimeSteps(first_step, last_step, stride, nTstep));
+}
+
+std::vector<float> ESmry::get_at_rstep(const std::string& name,
+                                       const std::size_t first_rstep,
+                                       const std::size_t last_rstep,
+                                       const std::size_t stride) const
+{
+    auto steps = selectTimeSteps(first_rstep, last_rstep, stride, seqIndex.size());
+    for (auto& step : steps)
+        step = seqIndex[step];
+
+    return this->readTimeSteps(this->keywordIndices({ name }), steps).front();
+}
+
+std::vector<int> ESmry::keywordIndices(const std::vector<std::string>& names) const
+{
+    std::vector<int> keywIndVect;
+    keywIndVect.reserve(names.size());
+
+    for (const auto& name : names) {
+        auto it = keyword_index.find(name);
+        if (it == keyword_index.end()) {
+            OPM_THROW(std::invalid_argument, "keyword " + name + " not found ");
+        }
+
+        keywIndVect.push_back(it->second);
+    }
+
+    return keywIndVect;
+}
+
 
 int ESmry::timestepIdxAtReportstepStart(const int reportStep) const
 {
@@ -58,6 +58,21 @@ public:
     std::vector<float> get_at_rstep(const SummaryNode& node) const;
     std::vector<time_point> dates_at_rstep() const;
 
+    // Values at time steps first_step, first_step + stride, ... in the
+    // half-open range [first_step, last_step).  The range is clamped to
+    // the available time steps.  Vectors not already loaded are read
+    // from disk at the selected time steps only.
+    std::vector<float> get(const std::string& name, std::size_t first_step,
+                           std::size_t last_step, std::size_t stride = 1) const;
+
+    std::vector<std::vector<float>> get_multiple(const std::vector<std::string>& names,
+                                                 std::size_t first_step, std::size_t last_step,
+                                                 std::size_t stride = 1) const;
+
+    // As above, with first_rstep and last_rstep indexing report steps.
+    std::vector<float> get_at_rstep(const std::string& name, std::size_t first_rstep,
+                                    std::size_t last_rstep, std::size_t stride = 1) const;
+
     void loadData(const std::vector<std::string>& vectList) const;
     void loadData() const;
 
@@ -153,6 +168,13 @@ private:
     getListOfArrays(const std::string& filename, bool formatted);
 
     std::vector<int> makeKeywPosVector(int speInd) const;
+    std::vector<int> keywordIndices(const std::vector<std::string>& names) const;
+
+    float readParamValue(std::fstream& fileH, int specInd,
+                         std::uint64_t stepFilePos, int keywInd) const;
+
+    std::vector<std::vector<float>> readTimeSteps(const std::vector<int>& keywIndVect,
+                                                  const std::vector<std::size_t>& steps) const;
     std::string read_string_from_disk(std::fstream& fileH, std::uint64_t size) const;
 
     void read_ministeps_from_disk();
@@ -19,15 +19,21 @@
 #include <opm/io/eclipse/EclFile.hpp>
 
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <cstring>
 #include <cstddef>
+#include <exception>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <numeric>
 #include <cmath>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 #include <fmt/format.h>
 
@@ -97,6 +103,52 @@ void EclFile::load(bool preload) {
 }
 
 
+void EclFile::loadMapped(bool preload)
+{
+    this->mapped_file = std::make_shared<const MappedFile>(this->inputFilename);
+
+    const auto fileSize = static_cast<std::uint64_t>(this->mapped_file->size());
+
+    std::uint64_t pos = 0;
+    int n = 0;
+    while (pos < fileSize) {
+        std::string arrName(8,' ');
+        eclArrType arrType;
+        std::int64_t num;
+        int sizeOfElement;
+
+        try {
+            pos += readBinaryHeader(this->mapped_file->data(pos), arrName, num, arrType, sizeOfElement);
+        } catch (const std::exception& e){
+            OPM_THROW(std::runtime_error,
+                fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", this->inputFilename, e.what()));
+        }
+
+        array_size.push_back(num);
+        array_type.push_back(arrType);
+        array_name.push_back(trimr(arrName));
+        array_element_size.push_back(sizeOfElement);
+
+        array_index[array_name[n]] = n;
+
+        ifStreamPos.push_back(pos);
+
+        arrayLoaded.push_back(false);
+
+        if (num > 0){
+            pos += sizeOnDiskBinary(num, arrType, sizeOfElement);
+        }
+
+        n++;
+    }
+
+    this->ifStreamPos.push_back(fileSize);
+
+    if (preload)
+        this->loadData();
+}
+
+
 EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool preload) :
     formatted(fmt.value),
     inputFilename(filename)
@@ -106,49 +158,161 @@ EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool prelo
 
 
 EclFile::EclFile(const std::string& filename, bool preload) :
+    EclFile(filename, MemoryMapped{false}, preload)
+{}
+
+
+EclFile::EclFile(const std::string& filename, MemoryMapped mmap, bool preload) :
     inputFilename(filename)
 {
     if (!fileExists(filename))
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
 
     formatted = isFormatted(filename);
-    this->load(preload);
+
+    if (mmap.value && !formatted) {
+        this->loadMapped(preload);
+    } else {
+        this->load(preload);
+    }
 }
 
 
-void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
+template <typename Source>
+EclFile::ArrayData EclFile::readBinaryArrayData(Source& src, std::size_t arrIndex) const
 {
-    fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
-
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryInteArray(src, array_size[arrIndex]);
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryRealArray(src, array_size[arrIndex]);
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryDoubArray(src, array_size[arrIndex]);
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryLogiArray(src, array_size[arrIndex]);
     case CHAR:
-        char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryCharArray(src, array_size[arrIndex]);
     case C0NN:
-        char_array[arrIndex] = readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
-        break;
+        return readBinaryC0nnArray(src, array_size[arrIndex], array_element_size[arrIndex]);
     case MESS:
-        break;
+        return std::monostate{};
     default:
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
-        break;
     }
+}
+
+EclFile::ArrayData EclFile::readArrayData(std::fstream& fileH, std::size_t arrIndex) const
+{
+    if (this->mapped_file != nullptr) {
+        auto buffer = this->mapped_file->data(ifStreamPos[arrIndex]);
+        return this->readBinaryArrayData(buffer, arrIndex);
+    }
+
+    fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
+    return this->readBinaryArrayData(fileH, arrIndex);
+}
+
+void EclFile::storeArrayData(std::size_t arrIndex, ArrayData&& data)
+{
+    std::visit([this, arrIndex](auto&& values)
+    {
+        using Values = std::decay_t<decltype(values)>;
+
+        if constexpr (std::is_same_v<Values, std::vector<int>>) {
+            inte_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<Values, std::vector<float>>) {
+            real_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<Values, std::vector<double>>) {
+            doub_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<Values, std::vector<bool>>) {
+            logi_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<Values, std::vector<std::string>>) {
+            char_array[arrIndex] = std::move(values);
+        }
+    }, std::move(data));
 
     arrayLoaded[arrIndex] = true;
 }
 
+void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
+{
+    fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
+    this->storeArrayData(arrIndex, this->readBinaryArrayData(fileH, arrIndex));
+}
+
+void EclFile::loadMappedArray(std::size_t arrIndex)
+{
+    auto buffer = this->mapped_file->data(ifStreamPos[arrIndex]);
+    this->storeArrayData(arrIndex, this->readBinaryArrayData(buffer, arrIndex));
+}
+
+void EclFile::loadBinaryArraysParallel(const std::vector<int>& arrIndex)
+{
+    // Arrays are read and decoded concurrently into a local buffer, each
+    // thread using its own file handle unless the file is memory mapped.
+    // Results are moved into the array maps afterwards, since the maps
+    // are not safe for concurrent insertion.
+
+    const auto numArrays = static_cast<int>(arrIndex.size());
+    std::vector<ArrayData> data(numArrays);
+
+    std::exception_ptr error{};
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(this->num_load_threads)
+#endif
+    {
+        std::fstream fileH;
+
+        if (this->mapped_file == nullptr) {
+            fileH.open(inputFilename, std::ios::in | std::ios::binary);
+        }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int i = 0; i < numArrays; ++i) {
+            try {
+                if ((this->mapped_file == nullptr) && !fileH) {
+                    OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
+                }
+
+                data[i] = this->readArrayData(fileH, arrIndex[i]);
+            }
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                if (error == nullptr) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+
+    for (int i = 0; i < numArrays; ++i) {
+        this->storeArrayData(arrIndex[i], std::move(data[i]));
+    }
+}
+
+void EclFile::setNumLoadThreads(const int numThreads)
+{
+    if (numThreads < 1) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Number of load threads must be positive, got {}", numThreads));
+    }
+
+    this->num_load_threads = numThreads;
+}
+
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
 {
 
@@ -192,6 +356,19 @@ void EclFile::loadData()
 
         this->loadData(arrIndices);
 
+    } else if (this->num_load_threads > 1) {
+
+        std::vector<int> arrIndices(array_name.size());
+        std::iota(arrIndices.begin(), arrIndices.end(), 0);
+
+        this->loadBinaryArraysParallel(arrIndices);
+
+    } else if (this->mapped_file != nullptr) {
+
+        for (std::size_t i = 0; i < array_name.size(); i++) {
+            loadMappedArray(i);
+        }
+
     } else {
 
         std::fstream fileH;
@@ -235,6 +412,14 @@ void EclFile::loadData(const std::string& name)
             }
         }
 
+    } else if (this->mapped_file != nullptr) {
+
+        for (std::size_t i = 0; i < array_name.size(); i++) {
+            if (array_name[i] == name) {
+                loadMappedArray(i);
+            }
+        }
+
     } else {
 
         std::fstream fileH;
@@ -277,6 +462,16 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
             loadFormattedArray(fileStr, ind, 0);
         }
 
+    } else if ((this->num_load_threads > 1) && (arrIndex.size() > 1)) {
+
+        this->loadBinaryArraysParallel(arrIndex);
+
+    } else if (this->mapped_file != nullptr) {
+
+        for (int ind : arrIndex) {
+            loadMappedArray(ind);
+        }
+
     } else {
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
@@ -313,6 +508,8 @@ void EclFile::loadData(int arrIndex)
             loadFormattedArray(fileStr, arrIndex, 0);
 
 
+    } else if (this->mapped_file != nullptr) {
+        loadMappedArray(arrIndex);
     } else {
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
@@ -383,6 +580,11 @@ std::vector<unsigned int> EclFile::get_bin_logi_raw_values(int arrIndex) const
     if (array_type[arrIndex] != Opm::EclIO::LOGI)
         OPM_THROW(std::runtime_error, "Error, selected array is not of type LOGI");
 
+    if (this->mapped_file != nullptr) {
+        return readBinaryRawLogiArray(this->mapped_file->data(ifStreamPos[arrIndex]),
+                                      array_size[arrIndex]);
+    }
+
     std::fstream fileH;
     fileH.open(inputFilename, std::ios::in |  std::ios::binary);
 
@@ -23,14 +23,18 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 #include <cstdint>
 
 namespace Opm { namespace EclIO {
 
+class MappedFile;
+
 class EclFile
 {
 public:
@@ -38,15 +42,32 @@ public:
         bool value;
     };
 
+    /// Access unformatted file contents through a read-only memory
+    /// mapping rather than through file streams.  Array headers are
+    /// indexed directly from the mapping and array data is decoded from
+    /// the mapped region on request.  Ignored for formatted files.
+    struct MemoryMapped {
+        bool value;
+    };
+
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
+    EclFile(const std::string& filename, MemoryMapped mmap, bool preload = false);
     bool formattedInput() const { return formatted; }
+    bool memoryMapped() const { return mapped_file != nullptr; }
 
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
     void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex
 
+    /// Number of threads used to read and decode unformatted arrays
+    /// concurrently in loadData().  Each thread uses its own file handle,
+    /// or the shared mapping in memory mapped mode.  Default value 1
+    /// (serial loading).  Only effective in builds with OpenMP support.
+    void setNumLoadThreads(int numThreads);
+    int numLoadThreads() const { return num_load_threads; }
+
     void clearData()
     {
       inte_array.clear();
@@ -106,9 +127,30 @@ protected:
 private:
     std::vector<bool> arrayLoaded;
 
+    /// File contents in memory mapped mode.  Null otherwise.  Shared
+    /// between copies since the mapping is read-only.
+    std::shared_ptr<const MappedFile> mapped_file{};
+
+    int num_load_threads{1};
+
+    using ArrayData = std::variant<std::monostate,
+                                   std::vector<int>,
+                                   std::vector<float>,
+                                   std::vector<double>,
+                                   std::vector<bool>,
+                                   std::vector<std::string>>;
+
+    template <typename Source>
+    ArrayData readBinaryArrayData(Source& src, std::size_t arrIndex) const;
+    ArrayData readArrayData(std::fstream& fileH, std::size_t arrIndex) const;
+    void storeArrayData(std::size_t arrIndex, ArrayData&& data);
+
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void loadMappedArray(std::size_t arrIndex);
+    void loadBinaryArraysParallel(const std::vector<int>& arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
     void load(bool preload);
+    void loadMapped(bool preload);
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
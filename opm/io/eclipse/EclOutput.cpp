@@ -135,6 +135,19 @@ void EclOutput::write<PaddedOutputString<8>>
     }
 }
 
+void EclOutput::writeSinglePrecision(const std::string&         name,
+                                     const std::vector<double>& data)
+{
+    if (this->isFormatted) {
+        writeFormattedHeader(name, data.size(), REAL, sizeOfReal);
+        writeFormattedArray(data, REAL);
+    }
+    else {
+        writeBinaryHeader(name, data.size(), REAL, sizeOfReal);
+        writeBinaryRealArray(data);
+    }
+}
+
 void EclOutput::message(const std::string& msg)
 {
     // Generate message, i.e., output vector of type eclArrType::MESS,
@@ -266,6 +279,13 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
     int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
+    // Byte swapped copy of a single record, reused for all records.
+    constexpr bool isNumeric = std::is_same_v<T, int>
+        || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    using RecordElement = std::conditional_t<isNumeric, T, int>;
+    std::vector<RecordElement> record(std::min(size, static_cast<std::int64_t>(maxNumberOfElements)));
+
     rest = size * static_cast<std::int64_t>(sizeOfElement);
 
     offset = 0;
@@ -283,54 +303,24 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
+        if constexpr (isNumeric) {
 
-        } else if (arrType == REAL) {
+            flipEndian(std::span<const T>{ data }.subspan(offset, num), std::span<T>{ record });
 
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
+            ofileH.write(reinterpret_cast<char*>(record.data()), num * sizeof(T));
 
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
-
-        } else if (arrType == DOUB) {
-
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
-
-            std::vector<int> logi_data;
-            logi_data.resize(num, 0);
+        } else if constexpr (std::is_same_v<T, bool>) {
 
             for (int m = 0; m < num; ++m) {
                 if (data[m + offset]) {
-                    logi_data[m] = logi_true_val;
+                    record[m] = logi_true_val;
                 }
                 else {
-                    logi_data[m] = false_value;
+                    record[m] = false_value;
                 }
             }
 
-            ofileH.write(reinterpret_cast<char*>(logi_data.data()), logi_data.size() * sizeof(int)) ;
+            ofileH.write(reinterpret_cast<char*>(record.data()), num * sizeof(int)) ;
 
         } else {
 
@@ -350,6 +340,42 @@ template void EclOutput::writeBinaryArray<double>(const std::vector<double>& dat
 template void EclOutput::writeBinaryArray<bool>(const std::vector<bool>& data);
 template void EclOutput::writeBinaryArray<char>(const std::vector<char>& data);
 
+void EclOutput::writeBinaryRealArray(const std::vector<double>& data)
+{
+    const auto sizeData = block_size_data_binary(REAL);
+
+    const int sizeOfElement       = std::get<0>(sizeData);
+    const int maxBlockSize        = std::get<1>(sizeData);
+    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+    if (!ofileH.is_open()) {
+        OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
+    }
+
+    // Single precision, byte swapped copy of a single record, reused for
+    // all records.
+    std::vector<float> record(std::min(data.size(), static_cast<std::size_t>(maxNumberOfElements)));
+
+    for (std::size_t offset = 0; offset < data.size();) {
+        const auto num = std::min(data.size() - offset, record.size());
+        const auto block = std::span<float>{ record }.first(num);
+
+        std::transform(data.begin() + offset, data.begin() + offset + num,
+                       block.begin(), [](const double x)
+                       { return static_cast<float>(x); });
+
+        flipEndian(block);
+
+        const int dhead = flipEndianInt(static_cast<int>(num) * sizeOfElement);
+
+        ofileH.write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+        ofileH.write(reinterpret_cast<const char*>(block.data()), num * sizeof(float));
+        ofileH.write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+
+        offset += num;
+    }
+}
+
 
 void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int element_size)
 {
@@ -619,9 +645,6 @@ std::string EclOutput::make_doub_string_ix(double value) const
 template <typename T>
 void EclOutput::writeFormattedArray(const std::vector<T>& data)
 {
-    int size = data.size();
-    int n = 0;
-
     eclArrType arrType = MESS;
     if constexpr (std::is_same_v<T, int>) {
         arrType = INTE;
@@ -633,6 +656,15 @@ void EclOutput::writeFormattedArray(const std::vector<T>& data)
         arrType = LOGI;
     }
 
+    writeFormattedArray(data, arrType);
+}
+
+template <typename T>
+void EclOutput::writeFormattedArray(const std::vector<T>& data, const eclArrType arrType)
+{
+    int size = data.size();
+    int n = 0;
+
     auto sizeData = block_size_data_formatted(arrType);
 
     int maxBlockSize = std::get<0>(sizeData);
@@ -648,10 +680,10 @@ void EclOutput::writeFormattedArray(const std::vector<T>& data)
             break;
         case REAL:
             if (ix_standard) {
-                ofileH << std::setw(columnWidth) << make_real_string_ix(data[i]);
+                ofileH << std::setw(columnWidth) << make_real_string_ix(static_cast<float>(data[i]));
             }
             else {
-                ofileH << std::setw(columnWidth) << make_real_string_ecl(data[i]);
+                ofileH << std::setw(columnWidth) << make_real_string_ecl(static_cast<float>(data[i]));
             }
             break;
         case DOUB:
@@ -98,6 +98,13 @@ public:
 
     void write(const std::string& name, const std::vector<std::string>& data, int element_size);
 
+    // Write double precision values as a single precision (REAL) array.
+    // Same file contents as write(name, std::vector<float>(data.begin(),
+    // data.end())), but values are converted one record at a time rather
+    // than through a whole-array copy.
+
+    void writeSinglePrecision(const std::string& name, const std::vector<double>& data);
+
     void message(const std::string& msg);
     void flushStream();
 
@@ -117,6 +124,8 @@ private:
     template <typename T>
     void writeBinaryArray(const std::vector<T>& data);
 
+    void writeBinaryRealArray(const std::vector<double>& data);
+
     void writeBinaryCharArray(const std::vector<std::string>& data, int element_size);
     void writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& data);
 
@@ -125,6 +134,9 @@ private:
     template <typename T>
     void writeFormattedArray(const std::vector<T>& data);
 
+    template <typename T>
+    void writeFormattedArray(const std::vector<T>& data, eclArrType arrType);
+
     void writeFormattedCharArray(const std::vector<std::string>& data, int element_size);
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
@@ -28,8 +28,10 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <fmt/format.h>
@@ -38,6 +40,10 @@
 #include <intrin.h>
 #endif
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 int Opm::EclIO::flipEndianInt(int num)
 {
 #ifdef _MSC_VER
@@ -81,6 +87,152 @@ double Opm::EclIO::flipEndianDouble(double num)
     return value;
 }
 
+namespace {
+
+    // Byte order reversal kernels operating on raw element storage.
+    // Source and destination may be the same array.  The scalar loops are
+    // written such that GCC and Clang vectorise them with byte shuffles at
+    // -O2/-O3.  Explicit AVX2 code is used when the build targets it.
+
+#if defined(__AVX2__)
+    const __m256i& shuffleMask32()
+    {
+        static const __m256i mask =
+            _mm256_setr_epi8( 3,  2,  1,  0,  7,  6,  5,  4,
+                             11, 10,  9,  8, 15, 14, 13, 12,
+                              3,  2,  1,  0,  7,  6,  5,  4,
+                             11, 10,  9,  8, 15, 14, 13, 12);
+        return mask;
+    }
+
+    const __m256i& shuffleMask64()
+    {
+        static const __m256i mask =
+            _mm256_setr_epi8( 7,  6,  5,  4,  3,  2,  1,  0,
+                             15, 14, 13, 12, 11, 10,  9,  8,
+                              7,  6,  5,  4,  3,  2,  1,  0,
+                             15, 14, 13, 12, 11, 10,  9,  8);
+        return mask;
+    }
+
+    std::size_t byteSwapAVX2(const char* src, char* dest,
+                             const std::size_t numBytes,
+                             const __m256i& mask)
+    {
+        constexpr auto vectorSize = sizeof(__m256i);
+
+        std::size_t i = 0;
+        for (; i + vectorSize <= numBytes; i += vectorSize) {
+            const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                                _mm256_shuffle_epi8(v, mask));
+        }
+
+        return i;
+    }
+#endif // __AVX2__
+
+    void byteSwap32(const char* src, char* dest, const std::size_t n)
+    {
+        std::size_t first = 0;
+
+#if defined(__AVX2__)
+        first = byteSwapAVX2(src, dest, n * sizeof(std::uint32_t), shuffleMask32()) / sizeof(std::uint32_t);
+#endif // __AVX2__
+
+        for (std::size_t i = first; i < n; ++i) {
+            std::uint32_t v;
+            std::memcpy(&v, src + i*sizeof(v), sizeof(v));
+#ifdef _MSC_VER
+            v = _byteswap_ulong(v);
+#else
+            v = __builtin_bswap32(v);
+#endif
+            std::memcpy(dest + i*sizeof(v), &v, sizeof(v));
+        }
+    }
+
+    void byteSwap64(const char* src, char* dest, const std::size_t n)
+    {
+        std::size_t first = 0;
+
+#if defined(__AVX2__)
+        first = byteSwapAVX2(src, dest, n * sizeof(std::uint64_t), shuffleMask64()) / sizeof(std::uint64_t);
+#endif // __AVX2__
+
+        for (std::size_t i = first; i < n; ++i) {
+            std::uint64_t v;
+            std::memcpy(&v, src + i*sizeof(v), sizeof(v));
+#ifdef _MSC_VER
+            v = _byteswap_uint64(v);
+#else
+            v = __builtin_bswap64(v);
+#endif
+            std::memcpy(dest + i*sizeof(v), &v, sizeof(v));
+        }
+    }
+
+    template <typename T>
+    void flipEndianImpl(const T* src, T* dest, const std::size_t n)
+    {
+        static_assert((sizeof(T) == 4) || (sizeof(T) == 8),
+                      "Byte swapping is only supported for 32 and 64 bit types");
+
+        if constexpr (sizeof(T) == 4) {
+            byteSwap32(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dest), n);
+        }
+        else {
+            byteSwap64(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dest), n);
+        }
+    }
+
+    template <typename T>
+    void flipEndianCopy(std::span<const T> src, std::span<T> dest)
+    {
+        if (dest.size() < src.size()) {
+            OPM_THROW(std::invalid_argument, "Destination of byte swapped copy is too small");
+        }
+
+        flipEndianImpl(src.data(), dest.data(), src.size());
+    }
+
+} // Anonymous namespace
+
+void Opm::EclIO::flipEndian(std::span<int> data)
+{
+    flipEndianImpl(data.data(), data.data(), data.size());
+}
+
+void Opm::EclIO::flipEndian(std::span<unsigned int> data)
+{
+    flipEndianImpl(data.data(), data.data(), data.size());
+}
+
+void Opm::EclIO::flipEndian(std::span<float> data)
+{
+    flipEndianImpl(data.data(), data.data(), data.size());
+}
+
+void Opm::EclIO::flipEndian(std::span<double> data)
+{
+    flipEndianImpl(data.data(), data.data(), data.size());
+}
+
+void Opm::EclIO::flipEndian(std::span<const int> src, std::span<int> dest)
+{
+    flipEndianCopy(src, dest);
+}
+
+void Opm::EclIO::flipEndian(std::span<const float> src, std::span<float> dest)
+{
+    flipEndianCopy(src, dest);
+}
+
+void Opm::EclIO::flipEndian(std::span<const double> src, std::span<double> dest)
+{
+    flipEndianCopy(src, dest);
+}
+
 bool Opm::EclIO::fileExists(const std::string& filename){
 
     std::ifstream fileH(filename.c_str());
@@ -138,6 +290,27 @@ std::tuple<int, int> Opm::EclIO::splitSummaryNumber(const int n)
     return { n1, n2 };
 }
 
+std::vector<std::size_t>
+Opm::EclIO::selectTimeSteps(const std::size_t first_step,
+                            std::size_t last_step,
+                            const std::size_t stride,
+                            const std::size_t num_steps)
+{
+    if (stride == 0)
+        throw std::invalid_argument("Time step stride must be positive");
+
+    last_step = std::min(last_step, num_steps);
+
+    std::vector<std::size_t> steps;
+    if (first_step < last_step)
+        steps.reserve((last_step - first_step + stride - 1) / stride);
+
+    for (auto step = first_step; step < last_step; step += stride)
+        steps.push_back(step);
+
+    return steps;
+}
+
 std::tuple<int, int> Opm::EclIO::block_size_data_binary(eclArrType arrType)
 {
     using BlockSizeTuple = std::tuple<int, int>;
@@ -335,57 +508,124 @@ void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& tmpStrName,
     }
 }
 
-void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& arrName,
-                      std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize)
-{
-    std::string tmpStrName(8,' ');
-    std::string tmpStrType(4,' ');
-    int tmpSize;
+namespace {
+
+    void readBinaryBytes(std::span<const char> buffer, std::size_t& pos,
+                         char* dest, const std::size_t numBytes)
+    {
+        if (numBytes > buffer.size() - pos) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file");
+        }
 
-    readBinaryHeader(fileH, tmpStrName, tmpSize, tmpStrType);
+        std::memcpy(dest, buffer.data() + pos, numBytes);
+        pos += numBytes;
+    }
+
+    int readBinaryInt(std::span<const char> buffer, std::size_t& pos)
+    {
+        int value;
+        readBinaryBytes(buffer, pos, reinterpret_cast<char*>(&value), sizeof(value));
+        return Opm::EclIO::flipEndianInt(value);
+    }
 
-    if (tmpStrType == "X231"){
-        std::string x231ArrayName = tmpStrName;
-        int x231exp = tmpSize * (-1);
+    void readBinaryHeaderRecord(std::span<const char> buffer, std::size_t& pos,
+                                std::string& tmpStrName, int& tmpSize, std::string& tmpStrType)
+    {
+        int bhead = readBinaryInt(buffer, pos);
 
-        readBinaryHeader(fileH, tmpStrName, tmpSize, tmpStrType);
+        if (bhead != 16) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Error reading binary header. Expected 16 bytes of header data,"
+                                  " found {}", bhead));
+        }
 
-        if (x231ArrayName != tmpStrName)
-            OPM_THROW(std::runtime_error, "Invalid X231 header, name should be same in both headers'");
+        readBinaryBytes(buffer, pos, &tmpStrName[0], 8);
+        tmpSize = readBinaryInt(buffer, pos);
+        readBinaryBytes(buffer, pos, &tmpStrType[0], 4);
 
-        if (x231exp < 0)
-            OPM_THROW(std::runtime_error, "Invalid X231 header, size of array should be negative'");
+        bhead = readBinaryInt(buffer, pos);
 
-        size = static_cast<std::int64_t>(tmpSize) + static_cast<std::int64_t>(x231exp) * pow(2,31);
-    } else {
-        size = static_cast<std::int64_t>(tmpSize);
+        if (bhead != 16) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Error reading binary header. Expected 16 bytes of header data,"
+                                  " found {}", bhead));
+        }
     }
 
-    elementSize = 4;
+    template <typename ReadHeaderRecord>
+    void readBinaryHeaderImpl(ReadHeaderRecord&& readHeaderRecord, std::string& arrName,
+                              std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize)
+    {
+        std::string tmpStrName(8,' ');
+        std::string tmpStrType(4,' ');
+        int tmpSize;
 
-    arrName = tmpStrName;
-    if (tmpStrType == "INTE")
-        arrType = Opm::EclIO::INTE;
-    else if (tmpStrType == "REAL")
-        arrType = Opm::EclIO::REAL;
-    else if (tmpStrType == "DOUB"){
-        arrType = Opm::EclIO::DOUB;
-        elementSize = 8;
-    }
-    else if (tmpStrType == "CHAR"){
-        arrType = Opm::EclIO::CHAR;
-        elementSize = 8;
-    }
-    else if (tmpStrType.substr(0,1)=="C"){
-        arrType = Opm::EclIO::C0NN;
-        elementSize = std::stoi(tmpStrType.substr(1,3));
+        readHeaderRecord(tmpStrName, tmpSize, tmpStrType);
+
+        if (tmpStrType == "X231"){
+            std::string x231ArrayName = tmpStrName;
+            int x231exp = tmpSize * (-1);
+
+            readHeaderRecord(tmpStrName, tmpSize, tmpStrType);
+
+            if (x231ArrayName != tmpStrName)
+                OPM_THROW(std::runtime_error, "Invalid X231 header, name should be same in both headers'");
+
+            if (x231exp < 0)
+                OPM_THROW(std::runtime_error, "Invalid X231 header, size of array should be negative'");
+
+            size = static_cast<std::int64_t>(tmpSize) + static_cast<std::int64_t>(x231exp) * pow(2,31);
+        } else {
+            size = static_cast<std::int64_t>(tmpSize);
+        }
+
+        elementSize = 4;
+
+        arrName = tmpStrName;
+        if (tmpStrType == "INTE")
+            arrType = Opm::EclIO::INTE;
+        else if (tmpStrType == "REAL")
+            arrType = Opm::EclIO::REAL;
+        else if (tmpStrType == "DOUB"){
+            arrType = Opm::EclIO::DOUB;
+            elementSize = 8;
+        }
+        else if (tmpStrType == "CHAR"){
+            arrType = Opm::EclIO::CHAR;
+            elementSize = 8;
+        }
+        else if (tmpStrType.substr(0,1)=="C"){
+            arrType = Opm::EclIO::C0NN;
+            elementSize = std::stoi(tmpStrType.substr(1,3));
+        }
+        else if (tmpStrType =="LOGI")
+            arrType = Opm::EclIO::LOGI;
+        else if (tmpStrType == "MESS")
+            arrType = Opm::EclIO::MESS;
+        else
+            OPM_THROW(std::runtime_error, "Error, unknown array type '" + tmpStrType +"'");
     }
-    else if (tmpStrType =="LOGI")
-        arrType = Opm::EclIO::LOGI;
-    else if (tmpStrType == "MESS")
-        arrType = Opm::EclIO::MESS;
-    else
-        OPM_THROW(std::runtime_error, "Error, unknown array type '" + tmpStrType +"'");
+
+} // Anonymous namespace
+
+void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& arrName,
+                      std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize)
+{
+    readBinaryHeaderImpl([&fileH](std::string& tmpStrName, int& tmpSize, std::string& tmpStrType)
+                         { readBinaryHeader(fileH, tmpStrName, tmpSize, tmpStrType); },
+                         arrName, size, arrType, elementSize);
+}
+
+std::size_t Opm::EclIO::readBinaryHeader(std::span<const char> buffer, std::string& arrName,
+                                         std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize)
+{
+    std::size_t pos = 0;
+
+    readBinaryHeaderImpl([buffer, &pos](std::string& tmpStrName, int& tmpSize, std::string& tmpStrType)
+                         { readBinaryHeaderRecord(buffer, pos, tmpStrName, tmpSize, tmpStrType); },
+                         arrName, size, arrType, elementSize);
+
+    return pos;
 }
 
 
@@ -440,142 +680,275 @@ void Opm::EclIO::readFormattedHeader(std::fstream& fileH, std::string& arrName,
     }
 }
 
-template<typename T, typename T2>
-std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64_t size, Opm::EclIO::eclArrType type,
-                               std::function<T(T2)>& flip, int elementSize)
-{
-    std::vector<T> arr;
+namespace {
 
-    auto sizeData = block_size_data_binary(type);
+    struct BulkByteSwap {};
 
-    if (type == Opm::EclIO::C0NN){
-        std::get<1>(sizeData)= std::get<1>(sizeData) / std::get<0>(sizeData) * elementSize;
-        std::get<0>(sizeData) = elementSize;
-    }
+    class StreamSource
+    {
+    public:
+        explicit StreamSource(std::fstream& fileH) : fileH_(fileH) {}
 
-    const int sizeOfElement = std::get<0>(sizeData);
-    const int maxBlockSize = std::get<1>(sizeData);
-    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
+        void read(char* dest, const std::size_t numBytes)
+        {
+            this->fileH_.read(dest, numBytes);
+        }
 
-    arr.reserve(size);
+        int readInt()
+        {
+            int value;
+            this->fileH_.read(reinterpret_cast<char*>(&value), sizeof(value));
+            return Opm::EclIO::flipEndianInt(value);
+        }
 
-    std::int64_t rest = size;
+    private:
+        std::fstream& fileH_;
+    };
 
-    while (rest > 0) {
-        int dhead;
-        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-        dhead = Opm::EclIO::flipEndianInt(dhead);
-        const int num = dhead / sizeOfElement;
+    class BufferSource
+    {
+    public:
+        explicit BufferSource(std::span<const char> buffer) : buffer_(buffer) {}
 
-        if ((num > maxNumberOfElements) || (num < 0)) {
-            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+        void read(char* dest, const std::size_t numBytes)
+        {
+            readBinaryBytes(this->buffer_, this->pos_, dest, numBytes);
         }
 
-        if constexpr (std::is_same_v<T2, std::string>) {
-            for (int i = 0; i < num; i++) {
-                T2 value;
-                value.resize(sizeOfElement) ;
-                fileH.read(&value[0], sizeOfElement);
-                arr.push_back(flip(value));
-            }
-        } else {
-            std::vector<T2> buf(num);
-            fileH.read(reinterpret_cast<char*>(buf.data()), buf.size()*sizeof(T2));
+        int readInt()
+        {
+            return readBinaryInt(this->buffer_, this->pos_);
+        }
 
-            for (const auto& value : buf)
-                arr.push_back(flip(value));
+    private:
+        std::span<const char> buffer_;
+        std::size_t pos_{0};
+    };
+
+    // Common record loop for all binary array readers.  Numeric arrays
+    // (Flip = BulkByteSwap) are read directly into the result vector one
+    // record at a time and byte swapped in bulk.  All other types are
+    // converted element by element through 'flip'.
+    template<typename T, typename T2, typename Source, typename Flip>
+    std::vector<T> readBinaryArrayImpl(Source& src, const std::int64_t size,
+                                       Opm::EclIO::eclArrType type, Flip&& flip,
+                                       int elementSize)
+    {
+        std::vector<T> arr;
+
+        auto sizeData = Opm::EclIO::block_size_data_binary(type);
+
+        if (type == Opm::EclIO::C0NN){
+            std::get<1>(sizeData)= std::get<1>(sizeData) / std::get<0>(sizeData) * elementSize;
+            std::get<0>(sizeData) = elementSize;
         }
 
-        rest -= num;
+        const int sizeOfElement = std::get<0>(sizeData);
+        const int maxBlockSize = std::get<1>(sizeData);
+        const int maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+        arr.reserve(size);
+
+        std::int64_t rest = size;
+
+        while (rest > 0) {
+            const int dhead = src.readInt();
+            const int num = dhead / sizeOfElement;
+
+            if ((num > maxNumberOfElements) || (num < 0)) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+            }
+
+            if constexpr (std::is_same_v<std::decay_t<Flip>, BulkByteSwap>) {
+                static_assert(std::is_same_v<T, T2>, "Bulk byte swapping requires identical element types");
+
+                const auto first = arr.size();
+                arr.resize(first + num);
+
+                auto record = std::span<T> { arr }.subspan(first);
+                src.read(reinterpret_cast<char*>(record.data()), record.size_bytes());
+
+                Opm::EclIO::flipEndian(record);
+            }
+            else if constexpr (std::is_same_v<T2, std::string>) {
+                for (int i = 0; i < num; i++) {
+                    T2 value(sizeOfElement, ' ');
+                    src.read(&value[0], sizeOfElement);
+                    arr.push_back(flip(value));
+                }
+            }
+            else {
+                std::vector<T2> buf(num);
+                src.read(reinterpret_cast<char*>(buf.data()), buf.size()*sizeof(T2));
+
+                for (const auto& value : buf)
+                    arr.push_back(flip(value));
+            }
+
+            rest -= num;
+
+            if (( num < maxNumberOfElements && rest != 0) ||
+                (num == maxNumberOfElements && rest < 0)) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, incorrect number of elements");
+            }
+
+            const int dtail = src.readInt();
 
-        if (( num < maxNumberOfElements && rest != 0) ||
-            (num == maxNumberOfElements && rest < 0)) {
-            OPM_THROW(std::runtime_error, "Error reading binary data, incorrect number of elements");
+            if (dhead != dtail) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+            }
         }
 
-        int dtail;
-        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
-        dtail = Opm::EclIO::flipEndianInt(dtail);
+        return arr;
+    }
 
-        if (dhead != dtail) {
-            OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+    bool logiValue(unsigned int intVal)
+    {
+        bool value = false;
+        if (intVal == Opm::EclIO::true_value_ecl) {
+            value = true;
+        } else if (intVal == Opm::EclIO::false_value) {
+            value = false;
+        } else if (intVal == Opm::EclIO::true_value_ix) {
+            value = true;
+        } else {
+            OPM_THROW(std::runtime_error, "Error reading logi value");
         }
+
+        return value;
     }
 
-    return arr;
+    unsigned int rawLogiValue(unsigned int intVal)
+    {
+        return intVal;
+    }
+
+    std::string trimmedString(const std::string& val)
+    {
+        return Opm::EclIO::trimr(val);
+    }
+
+    template <typename Source>
+    std::vector<std::string> readCharArray(Source& src, const std::int64_t size)
+    {
+        using Char8 = std::array<char, 8>;
+        auto f = [](const Char8& val)
+        {
+            std::string res(val.begin(), val.end());
+            return Opm::EclIO::trimr(res);
+        };
+
+        return readBinaryArrayImpl<std::string,Char8>(src, size, Opm::EclIO::CHAR, f, Opm::EclIO::sizeOfChar);
+    }
+
+} // Anonymous namespace
+
+template<typename T, typename T2>
+std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64_t size, Opm::EclIO::eclArrType type,
+                               std::function<T(T2)>& flip, int elementSize)
+{
+    StreamSource src { fileH };
+    return readBinaryArrayImpl<T,T2>(src, size, type, flip, elementSize);
 }
 
+template std::vector<int>
+Opm::EclIO::readBinaryArray<int,int>(std::fstream&, const std::int64_t, Opm::EclIO::eclArrType,
+                                     std::function<int(int)>&, int);
+
 
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    StreamSource src { fileH };
+    return readBinaryArrayImpl<int,int>(src, size, Opm::EclIO::INTE, BulkByteSwap{}, sizeOfInte);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    StreamSource src { fileH };
+    return readBinaryArrayImpl<float,float>(src, size, Opm::EclIO::REAL, BulkByteSwap{}, sizeOfReal);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    StreamSource src { fileH };
+    return readBinaryArrayImpl<double,double>(src, size, Opm::EclIO::DOUB, BulkByteSwap{}, sizeOfDoub);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<bool(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              bool value = false;
-                                              if (intVal == Opm::EclIO::true_value_ecl) {
-                                                  value = true;
-                                              } else if (intVal == Opm::EclIO::false_value) {
-                                                  value = false;
-                                              } else if (intVal == Opm::EclIO::true_value_ix) {
-                                                  value = true;
-                                              } else {
-                                                  OPM_THROW(std::runtime_error, "Error reading logi value");
-                                              }
-
-                                              return value;
-                                          };
-    return readBinaryArray<bool,unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    StreamSource src { fileH };
+    return readBinaryArrayImpl<bool,unsigned int>(src, size, Opm::EclIO::LOGI, logiValue, sizeOfLogi);
 }
 
 std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<unsigned int(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              return intVal;
-                                          };
-    return readBinaryArray<unsigned int, unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    StreamSource src { fileH };
+    return readBinaryArrayImpl<unsigned int, unsigned int>(src, size, Opm::EclIO::LOGI, rawLogiValue, sizeOfLogi);
 }
 
 
 std::vector<std::string> Opm::EclIO::readBinaryCharArray(std::fstream& fileH, const std::int64_t size)
 {
-    using Char8 = std::array<char, 8>;
-    std::function<std::string(Char8)> f = [](const Char8& val)
-                                          {
-                                              std::string res(val.begin(), val.end());
-                                              return Opm::EclIO::trimr(res);
-                                          };
-    return readBinaryArray<std::string,Char8>(fileH, size, Opm::EclIO::CHAR, f, sizeOfChar);
+    StreamSource src { fileH };
+    return readCharArray(src, size);
 }
 
 
 std::vector<std::string> Opm::EclIO::readBinaryC0nnArray(std::fstream& fileH, const std::int64_t size, int elementSize)
 {
-    std::function<std::string(std::string)> f = [](const std::string& val)
-                                          {
-                                              return Opm::EclIO::trimr(val);
-                                          };
+    StreamSource src { fileH };
+    return readBinaryArrayImpl<std::string,std::string>(src, size, Opm::EclIO::C0NN, trimmedString, elementSize);
+}
+
+
+std::vector<int> Opm::EclIO::readBinaryInteArray(std::span<const char> buffer, const std::int64_t size)
+{
+    BufferSource src { buffer };
+    return readBinaryArrayImpl<int,int>(src, size, Opm::EclIO::INTE, BulkByteSwap{}, sizeOfInte);
+}
+
+
+std::vector<float> Opm::EclIO::readBinaryRealArray(std::span<const char> buffer, const std::int64_t size)
+{
+    BufferSource src { buffer };
+    return readBinaryArrayImpl<float,float>(src, size, Opm::EclIO::REAL, BulkByteSwap{}, sizeOfReal);
+}
+
 
-    return readBinaryArray<std::string,std::string>(fileH, size, Opm::EclIO::C0NN, f, elementSize);
+std::vector<double> Opm::EclIO::readBinaryDoubArray(std::span<const char> buffer, const std::int64_t size)
+{
+    BufferSource src { buffer };
+    return readBinaryArrayImpl<double,double>(src, size, Opm::EclIO::DOUB, BulkByteSwap{}, sizeOfDoub);
+}
+
+
+std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::span<const char> buffer, const std::int64_t size)
+{
+    BufferSource src { buffer };
+    return readBinaryArrayImpl<bool,unsigned int>(src, size, Opm::EclIO::LOGI, logiValue, sizeOfLogi);
+}
+
+
+std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::span<const char> buffer, const std::int64_t size)
+{
+    BufferSource src { buffer };
+    return readBinaryArrayImpl<unsigned int, unsigned int>(src, size, Opm::EclIO::LOGI, rawLogiValue, sizeOfLogi);
+}
+
+
+std::vector<std::string> Opm::EclIO::readBinaryCharArray(std::span<const char> buffer, const std::int64_t size)
+{
+    BufferSource src { buffer };
+    return readCharArray(src, size);
+}
+
+
+std::vector<std::string> Opm::EclIO::readBinaryC0nnArray(std::span<const char> buffer, const std::int64_t size, int elementSize)
+{
+    BufferSource src { buffer };
+    return readBinaryArrayImpl<std::string,std::string>(src, size, Opm::EclIO::C0NN, trimmedString, elementSize);
 }
 
 
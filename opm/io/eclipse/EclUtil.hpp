@@ -22,8 +22,10 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -34,6 +36,20 @@ namespace Opm { namespace EclIO {
     std::int64_t flipEndianLongInt(std::int64_t num);
     float flipEndianFloat(float num);
     double flipEndianDouble(double num);
+
+    /// Reverse byte order of all elements of \p data in place.
+    void flipEndian(std::span<int> data);
+    void flipEndian(std::span<unsigned int> data);
+    void flipEndian(std::span<float> data);
+    void flipEndian(std::span<double> data);
+
+    /// Copy elements of \p src into the leading elements of \p dest,
+    /// reversing the byte order of each element.  Throws an exception of
+    /// type std::invalid_argument if \p dest is smaller than \p src.
+    void flipEndian(std::span<const int> src, std::span<int> dest);
+    void flipEndian(std::span<const float> src, std::span<float> dest);
+    void flipEndian(std::span<const double> src, std::span<double> dest);
+
     bool isEOF(std::fstream* fileH);
     bool fileExists(const std::string& filename);
     bool isFormatted(const std::string& filename);
@@ -50,6 +66,14 @@ namespace Opm { namespace EclIO {
     /// two constituent IDs.
     std::tuple<int,int> splitSummaryNumber(const int n);
 
+    /// Time step indices first_step, first_step + stride, ... below
+    /// min(last_step, num_steps).  Throws an exception of type
+    /// std::invalid_argument if \p stride is zero.
+    std::vector<std::size_t> selectTimeSteps(std::size_t first_step,
+                                             std::size_t last_step,
+                                             std::size_t stride,
+                                             std::size_t num_steps);
+
     std::tuple<int, int> block_size_data_binary(eclArrType arrType);
     std::tuple<int, int, int> block_size_data_formatted(eclArrType arrType);
 
@@ -64,6 +88,15 @@ namespace Opm { namespace EclIO {
     void readBinaryHeader(std::fstream& fileH, std::string& arrName,
                       std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
+    /// Decode binary array header from memory buffer.
+    ///
+    /// \param[in] buffer Bytes starting at the array header.
+    ///
+    /// \return Number of bytes occupied by header, including any X231
+    ///   extension header.
+    std::size_t readBinaryHeader(std::span<const char> buffer, std::string& arrName,
+                                 std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize);
+
     void readFormattedHeader(std::fstream& fileH, std::string& arrName,
                       std::int64_t &num, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
@@ -79,6 +112,17 @@ namespace Opm { namespace EclIO {
     std::vector<std::string> readBinaryCharArray(std::fstream& fileH, const std::int64_t size);
     std::vector<std::string> readBinaryC0nnArray(std::fstream& fileH, const std::int64_t size, int elementSize);
 
+    // Decode binary array data from memory buffer starting at the first
+    // record marker of the array.  Numeric records are copied in bulk and
+    // byte swapped in place.
+    std::vector<int> readBinaryInteArray(std::span<const char> buffer, const std::int64_t size);
+    std::vector<float> readBinaryRealArray(std::span<const char> buffer, const std::int64_t size);
+    std::vector<double> readBinaryDoubArray(std::span<const char> buffer, const std::int64_t size);
+    std::vector<bool> readBinaryLogiArray(std::span<const char> buffer, const std::int64_t size);
+    std::vector<unsigned int> readBinaryRawLogiArray(std::span<const char> buffer, const std::int64_t size);
+    std::vector<std::string> readBinaryCharArray(std::span<const char> buffer, const std::int64_t size);
+    std::vector<std::string> readBinaryC0nnArray(std::span<const char> buffer, const std::int64_t size, int elementSize);
+
     template<typename T>
     std::vector<T> readFormattedArray(const std::string& file_str, const int size, std::int64_t fromPos,
                                        std::function<T(const std::string&)>& process);
@@ -57,6 +57,58 @@ Opm::time_point make_date(const std::vector<int>& datetime) {
     return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
 }
 
+// Byte offset of element 'elm' of a binary REAL array, relative to the
+// start of the array's first data record.
+std::uint64_t realElementOffset(const std::size_t elm)
+{
+    using namespace Opm::EclIO;
+
+    const auto maxNum = static_cast<std::size_t>(MaxBlockSizeReal / sizeOfReal);
+    const auto nFullBlocks = static_cast<std::uint64_t>(elm / maxNum);
+
+    return nFullBlocks * (MaxBlockSizeReal + 2 * sizeOfInte) + sizeOfInte
+        + static_cast<std::uint64_t>(elm % maxNum) * sizeOfReal;
+}
+
+// Read selected elements, in increasing order, of a binary REAL array.
+// Elements close together on disk are fetched in a single read.
+bool readRealElements(std::fstream& fileH,
+                      const std::uint64_t dataPos,
+                      const std::vector<std::size_t>& elements,
+                      std::vector<float>& values)
+{
+    constexpr std::uint64_t maxGap = 4096;
+
+    std::vector<char> buffer;
+
+    for (std::size_t i = 0; i < elements.size(); ) {
+        const auto begin = realElementOffset(elements[i]);
+
+        auto j = i + 1;
+        while ((j < elements.size()) &&
+               (realElementOffset(elements[j]) - realElementOffset(elements[j - 1]) <= maxGap))
+        {
+            ++j;
+        }
+
+        const auto end = realElementOffset(elements[j - 1]) + Opm::EclIO::sizeOfReal;
+
+        buffer.resize(end - begin);
+        fileH.seekg(static_cast<std::streamoff>(dataPos + begin), std::ios_base::beg);
+        fileH.read(buffer.data(), buffer.size());
+
+        if (!fileH)
+            return false;
+
+        for (; i < j; ++i) {
+            float value;
+            std::memcpy(&value, buffer.data() + (realElementOffset(elements[i]) - begin), sizeof value);
+            values.push_back(Opm::EclIO::flipEndianFloat(value));
+        }
+    }
+
+    return true;
+}
 
 }
 
@@ -556,6 +608,170 @@ void ExtESmry::loadData(const std::vector<std::string>& stringVect)
     m_io_loading += elapsed_seconds.count();
 }
 
+bool ExtESmry::read_esmry_steps(const std::vector<int>& keyIndexVect,
+                                const std::vector<std::size_t>& steps,
+                                int ind, std::vector<std::vector<float>>& smry_data)
+{
+    std::fstream fileH;
+
+    fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        return false;
+
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    std::int64_t num_tstep;
+    int sizeOfElement;
+
+    // Number of time steps may have increased since the file was opened.
+    fileH.seekg (m_rstep_offset[ind], fileH.beg);
+
+    try {
+        Opm::EclIO::readBinaryHeader(fileH, arrName, num_tstep, arrType, sizeOfElement);
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
+
+    auto smry_arr_size = sizeOnDiskBinary(num_tstep, Opm::EclIO::REAL, sizeOfReal);
+
+    for (std::size_t n = 0 ; n < keyIndexVect.size(); n++) {
+
+        const auto& key = m_keyword[keyIndexVect[n]];
+
+        if ( m_keyword_index[ind].find(key) == m_keyword_index[ind].end() ) {
+
+            smry_data[n].insert(smry_data[n].end(), steps.size(), 0.0f);
+
+        } else {
+
+            int key_ind = m_keyword_index[ind].at(key);
+
+            std::uint64_t pos = m_rstep_offset[ind] + smry_arr_size*static_cast<std::uint64_t>(key_ind);
+            pos = pos + 2 * sizeOnDiskBinary(num_tstep, Opm::EclIO::INTE, sizeOfInte);
+            pos = pos + static_cast<std::uint64_t>(2 * 24);
+            pos = pos + static_cast<std::uint64_t>(key_ind * 24);
+
+            fileH.seekg (pos, fileH.beg);
+
+            std::int64_t size;
+
+            try {
+                readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
+            } catch (const std::runtime_error& error)
+            {
+                return false;
+            }
+
+            if (Opm::EclIO::trimr(arrName) != "V" + std::to_string(key_ind))
+                return false;
+
+            if (!steps.empty() && (steps.back() >= static_cast<std::size_t>(size)))
+                return false;
+
+            const auto dataPos = pos + static_cast<std::uint64_t>(24);
+
+            if (!readRealElements(fileH, dataPos, steps, smry_data[n]))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+std::vector<std::vector<float>>
+ExtESmry::readTimeSteps(const std::vector<int>& keyIndexVect,
+                        const std::vector<std::size_t>& steps)
+{
+    auto start = std::chrono::system_clock::now();
+
+    std::vector<std::vector<float>> result(keyIndexVect.size());
+    for (auto& values : result)
+        values.reserve(steps.size());
+
+    std::vector<int> diskKeys;
+    std::vector<std::size_t> diskPos;
+
+    for (std::size_t n = 0; n < keyIndexVect.size(); ++n) {
+        const auto kind = keyIndexVect[n];
+
+        if (m_vectorLoaded[kind]) {
+            std::ranges::transform(steps, std::back_inserter(result[n]),
+                                   [this, kind](const auto& step)
+                                   { return m_vectorData[kind][step]; });
+        } else {
+            diskKeys.push_back(kind);
+            diskPos.push_back(n);
+        }
+    }
+
+    if (diskKeys.empty() || steps.empty())
+        return result;
+
+    std::vector<std::vector<float>> smry_data(diskKeys.size());
+
+    // Time steps of the base runs come first, see loadData().
+    std::size_t first_global = 0;
+    auto step = steps.begin();
+
+    for (int ind = static_cast<int>(m_tstep_range.size()) - 1; ind > -1; --ind) {
+        const auto num_local = static_cast<std::size_t>(std::get<1>(m_tstep_range[ind])) + 1;
+
+        std::vector<std::size_t> local_steps;
+        for (; (step != steps.end()) && (*step < first_global + num_local); ++step)
+            local_steps.push_back(*step - first_global);
+
+        first_global += num_local;
+
+        if (local_steps.empty())
+            continue;
+
+        const auto num_before = smry_data.front().size();
+
+        bool res = read_esmry_steps(diskKeys, local_steps, ind, smry_data);
+        int n_attempts = 1;
+
+        while ((!res) && (n_attempts < 10)){
+            for (auto& values : smry_data)
+                values.resize(num_before);
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            res = read_esmry_steps(diskKeys, local_steps, ind, smry_data);
+            n_attempts ++;
+        }
+
+        if (!res){
+            OPM_THROW(std::runtime_error,
+                      "when loading data from ESMRY file" + m_esmry_files[ind].string());
+        }
+    }
+
+    for (std::size_t n = 0; n < diskKeys.size(); ++n)
+        result[diskPos[n]] = std::move(smry_data[n]);
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return result;
+}
+
+std::vector<int> ExtESmry::keywordIndices(const std::vector<std::string>& names) const
+{
+    std::vector<int> keyIndexVect;
+    keyIndexVect.reserve(names.size());
+
+    for (const auto& name : names) {
+        const auto it = m_keyword_index[0].find(name);
+        if (it == m_keyword_index[0].end())
+            throw std::invalid_argument("summary key '" + name + "' not found");
+
+        keyIndexVect.push_back(it->second);
+    }
+
+    return keyIndexVect;
+}
+
 void ExtESmry::loadData()
 {
     this->loadData(m_keyword);
@@ -575,6 +791,36 @@ const std::vector<float>& ExtESmry::get(const std::string& name)
     return m_vectorData[index];
 }
 
+std::vector<float> ExtESmry::get(const std::string& name,
+                                 const std::size_t first_step,
+                                 const std::size_t last_step,
+                                 const std::size_t stride)
+{
+    return this->get_multiple({ name }, first_step, last_step, stride).front();
+}
+
+std::vector<std::vector<float>>
+ExtESmry::get_multiple(const std::vector<std::string>& names,
+                       const std::size_t first_step,
+                       const std::size_t last_step,
+                       const std::size_t stride)
+{
+    return this->readTimeSteps(this->keywordIndices(names),
+                               selectTimeSteps(first_step, last_step, stride, m_nTstep));
+}
+
+std::vector<float> ExtESmry::get_at_rstep(const std::string& name,
+                                          const std::size_t first_rstep,
+                                          const std::size_t last_rstep,
+                                          const std::size_t stride)
+{
+    auto steps = selectTimeSteps(first_rstep, last_rstep, stride, m_seqIndex.size());
+    for (auto& step : steps)
+        step = m_seqIndex[step];
+
+    return this->readTimeSteps(this->keywordIndices({ name }), steps).front();
+}
+
 std::vector<Opm::time_point> ExtESmry::dates()
 {
     double time_unit = 24 * 3600;
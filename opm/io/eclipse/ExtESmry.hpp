@@ -50,6 +50,21 @@ public:
 
     const std::vector<float>& get(const std::string& name);
     std::vector<float> get_at_rstep(const std::string& name);
+
+    // Values at time steps first_step, first_step + stride, ... in the
+    // half-open range [first_step, last_step).  The range is clamped to
+    // the available time steps.  Vectors not already loaded are read
+    // from disk at the selected time steps only.
+    std::vector<float> get(const std::string& name, std::size_t first_step,
+                           std::size_t last_step, std::size_t stride = 1);
+
+    std::vector<std::vector<float>> get_multiple(const std::vector<std::string>& names,
+                                                 std::size_t first_step, std::size_t last_step,
+                                                 std::size_t stride = 1);
+
+    // As above, with first_rstep and last_rstep indexing report steps.
+    std::vector<float> get_at_rstep(const std::string& name, std::size_t first_rstep,
+                                    std::size_t last_rstep, std::size_t stride = 1);
     std::string& get_unit(const std::string& name);
 
     void loadData();
@@ -107,6 +122,14 @@ private:
     bool load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind );
 
+    bool read_esmry_steps(const std::vector<int>& keyIndexVect, const std::vector<std::size_t>& steps,
+                          int ind, std::vector<std::vector<float>>& smry_data);
+
+    std::vector<std::vector<float>> readTimeSteps(const std::vector<int>& keyIndexVect,
+                                                  const std::vector<std::size_t>& steps);
+
+    std::vector<int> keywordIndices(const std::vector<std::string>& names) const;
+
     void updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN);
 };
 
@@ -0,0 +1,123 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#if defined(_WIN32)
+#include <iterator>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Opm { namespace EclIO {
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    std::ifstream fileH(filename, std::ios::in | std::ios::binary);
+
+    if (!fileH) {
+        throw std::runtime_error(fmt::format("Can not open file: {}", filename));
+    }
+
+    this->buffer_.assign(std::istreambuf_iterator<char>(fileH),
+                         std::istreambuf_iterator<char>());
+
+    this->begin_ = this->buffer_.data();
+    this->size_ = this->buffer_.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+#else
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error {
+            fmt::format("Can not open file: {} ({})", filename, std::strerror(errno))
+        };
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        const auto err = errno;
+        ::close(fd);
+
+        throw std::runtime_error {
+            fmt::format("Can not determine size of file: {} ({})", filename, std::strerror(err))
+        };
+    }
+
+    this->size_ = static_cast<std::size_t>(st.st_size);
+
+    if (this->size_ > 0) {
+        void* addr = ::mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (addr == MAP_FAILED) {
+            const auto err = errno;
+            ::close(fd);
+
+            throw std::runtime_error {
+                fmt::format("Can not memory map file: {} ({})", filename, std::strerror(err))
+            };
+        }
+
+        this->begin_ = static_cast<const char*>(addr);
+    }
+
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (this->begin_ != nullptr) {
+        ::munmap(const_cast<char*>(this->begin_), this->size_);
+    }
+}
+
+#endif
+
+std::span<const char> MappedFile::data(const std::uint64_t offset) const
+{
+    if (offset > this->size_) {
+        throw std::out_of_range {
+            fmt::format("Offset {} is beyond end of mapped file of size {}",
+                        offset, this->size_)
+        };
+    }
+
+    return this->data().subspan(static_cast<std::size_t>(offset));
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,84 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_MAPPEDFILE_HPP
+#define OPM_IO_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Read-only view of the full contents of a file.
+///
+/// On POSIX systems the file is memory mapped, so accessing a part of
+/// the file only costs the page faults needed to bring that part into
+/// memory.  On other platforms the file contents is read into an
+/// internal buffer on construction.
+class MappedFile
+{
+public:
+    /// Constructor.
+    ///
+    /// Throws an exception of type std::runtime_error if the file
+    /// cannot be opened or mapped.
+    ///
+    /// \param[in] filename Name of file to map.
+    explicit MappedFile(const std::string& filename);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /// Full file contents.
+    std::span<const char> data() const
+    {
+        return { this->begin_, this->size_ };
+    }
+
+    /// File contents from byte position \p offset to end of file.
+    ///
+    /// Throws an exception of type std::out_of_range if \p offset is
+    /// beyond the end of the file.
+    std::span<const char> data(std::uint64_t offset) const;
+
+    /// Size of file in bytes.
+    std::size_t size() const { return this->size_; }
+
+private:
+    /// Start of mapped region.  Null if file is empty.
+    const char* begin_{nullptr};
+
+    /// Number of bytes in mapped region.
+    std::size_t size_{0};
+
+    /// File contents on platforms without memory mapping support.
+    std::vector<char> buffer_{};
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_MAPPEDFILE_HPP
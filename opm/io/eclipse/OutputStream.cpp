@@ -32,6 +32,7 @@
 #include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <ios>
 #include <map>
@@ -303,11 +304,74 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
 // =====================================================================
 
+struct Opm::EclIO::OutputStream::Restart::DeferredOutput
+{
+    ResultSet rset;
+    int seqnum;
+    Formatted fmt;
+    Unified unif;
+
+    /// Recorded output operations, in order.
+    std::vector<std::function<void(EclOutput&)>> records{};
+};
+
 Opm::EclIO::OutputStream::Restart::
 Restart(const ResultSet& rset,
         const int        seqnum,
         const Formatted& fmt,
         const Unified&   unif)
+{
+    this->open(rset, seqnum, fmt, unif);
+}
+
+Opm::EclIO::OutputStream::Restart::
+Restart(const ResultSet& rset,
+        const int        seqnum,
+        const Formatted& fmt,
+        const Unified&   unif,
+        Deferred)
+    : deferred_{ std::make_unique<DeferredOutput>(DeferredOutput{ rset, seqnum, fmt, unif }) }
+{}
+
+Opm::EclIO::OutputStream::Restart::~Restart()
+{}
+
+Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
+    : stream_  { std::move(rhs.stream_) }
+    , deferred_{ std::move(rhs.deferred_) }
+{}
+
+Opm::EclIO::OutputStream::Restart&
+Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
+{
+    this->stream_ = std::move(rhs.stream_);
+    this->deferred_ = std::move(rhs.deferred_);
+
+    return *this;
+}
+
+void Opm::EclIO::OutputStream::Restart::commit()
+{
+    if (this->deferred_ == nullptr) {
+        return;
+    }
+
+    const auto deferred = std::move(this->deferred_);
+
+    this->open(deferred->rset, deferred->seqnum,
+               deferred->fmt, deferred->unif);
+
+    for (const auto& record : deferred->records) {
+        record(this->stream());
+    }
+}
+
+void
+Opm::EclIO::OutputStream::Restart::
+open(const ResultSet& rset,
+     const int        seqnum,
+     const Formatted& fmt,
+     const Unified&   unif)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
@@ -328,23 +392,15 @@ Restart(const ResultSet& rset,
     }
 }
 
-Opm::EclIO::OutputStream::Restart::~Restart()
-{}
-
-Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
-    : stream_{ std::move(rhs.stream_) }
-{}
-
-Opm::EclIO::OutputStream::Restart&
-Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
+void Opm::EclIO::OutputStream::Restart::message(const std::string& msg)
 {
-    this->stream_ = std::move(rhs.stream_);
+    if (this->deferred_ != nullptr) {
+        this->deferred_->records.emplace_back
+            ([msg](EclOutput& stream) { stream.message(msg); });
 
-    return *this;
-}
+        return;
+    }
 
-void Opm::EclIO::OutputStream::Restart::message(const std::string& msg)
-{
     this->stream().message(msg);
 }
 
@@ -376,6 +432,21 @@ write(const std::string& kw, const std::vector<double>& data)
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Restart::
+writeSinglePrecision(const std::string& kw, const std::vector<double>& data)
+{
+    if (this->deferred_ != nullptr) {
+        // Record single precision values only.  Same file contents as
+        // EclOutput::writeSinglePrecision() at half the memory.
+        this->writeImpl(kw, std::vector<float>(data.begin(), data.end()));
+
+        return;
+    }
+
+    this->stream().writeSinglePrecision(kw, data);
+}
+
 void
 Opm::EclIO::OutputStream::Restart::
 write(const std::string& kw, const std::vector<std::string>& data)
@@ -482,6 +553,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
     void Restart::writeImpl(const std::string&    kw,
                             const std::vector<T>& data)
     {
+        if (this->deferred_ != nullptr) {
+            this->deferred_->records.emplace_back
+                ([kw, data](EclOutput& stream) { stream.write(kw, data); });
+
+            return;
+        }
+
         this->stream().write(kw, data);
     }
 
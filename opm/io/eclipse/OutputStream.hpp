@@ -173,6 +173,29 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                          const Formatted& fmt,
                          const Unified&   unif);
 
+        /// Tag type for requesting deferred output.
+        struct Deferred {};
+
+        /// Constructor for deferred output.
+        ///
+        /// Does not open any file.  Output is instead recorded in memory,
+        /// in order, until a subsequent call to commit().  Commit() may be
+        /// called on a different thread than the one which records output.
+        ///
+        /// \param[in] rset Output directory and base name of output stream.
+        ///
+        /// \param[in] seqnum Sequence number of new report.  One-based
+        ///    report step ID.
+        ///
+        /// \param[in] fmt Whether or not to create formatted output files.
+        ///
+        /// \param[in] unif Whether or not to create unified output files.
+        explicit Restart(const ResultSet& rset,
+                         const int        seqnum,
+                         const Formatted& fmt,
+                         const Unified&   unif,
+                         Deferred);
+
         ~Restart();
 
         Restart(const Restart& rhs) = delete;
@@ -221,6 +244,18 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&         kw,
                    const std::vector<double>& data);
 
+        /// Write double precision floating point data to underlying
+        /// output stream as single precision values.
+        ///
+        /// Converts values one output record at a time, so does not form
+        /// a single precision copy of the full array.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void writeSinglePrecision(const std::string&         kw,
+                                  const std::vector<double>& data);
+
         /// Write unpadded string data to underlying output stream.
         ///
         /// \param[in] kw Name of output vector (keyword).
@@ -238,10 +273,33 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&                        kw,
                    const std::vector<PaddedOutputString<8>>& data);
 
+        /// Write recorded output of deferred stream to file.
+        ///
+        /// Opens file stream as if by the non-deferred constructor and
+        /// outputs all recorded data.  No-op unless stream was created
+        /// with the constructor for deferred output.
+        void commit();
+
     private:
+        /// Output recorded by a deferred stream.
+        struct DeferredOutput;
+
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Recorded output.  Null unless stream is deferred.
+        std::unique_ptr<DeferredOutput> deferred_;
+
+        /// Open file stream pertaining to restart of particular report
+        /// step.
+        ///
+        /// Writes to \c stream_.  Implementation of the non-deferred
+        /// constructor.
+        void open(const ResultSet& rset,
+                  const int        seqnum,
+                  const Formatted& fmt,
+                  const Unified&   unif);
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
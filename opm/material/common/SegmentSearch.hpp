@@ -0,0 +1,127 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Branch-free search for the sampling interval of tabulated functions.
+ */
+#ifndef OPM_SEGMENT_SEARCH_HPP
+#define OPM_SEGMENT_SEARCH_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+namespace Opm {
+
+/*!
+ * \brief Return the sampling interval of a position.
+ *
+ * The result is the same as that of the bisection in
+ * Tabulated1DFunction::findSegmentIndex(), i.e., the interval \f$k\f$ for
+ * which \f$s_k \le x < s_{k+1}\f$, except that positions up to and
+ * including \f$s_1\f$ use the first interval and positions from
+ * \f$s_{n-2}\f$ use the last one.  The number of steps only depends on the
+ * number of sampling points, and the steps do not branch on the position.
+ *
+ * \param numSamples Number of sampling points. At least two.
+ * \param sample Accessor for sampling point \f$s_k\f$, strictly increasing in \f$k\f$.
+ * \param x Position.
+ */
+template <class SampleAccessor, class Scalar>
+unsigned segmentIndex(const std::size_t numSamples,
+                      const SampleAccessor& sample,
+                      const Scalar x)
+{
+    assert(numSamples >= 2);
+
+    if (numSamples < 3) {
+        return 0;
+    }
+
+    // Number of interior sampling points s_2, ..., s_{n-2} not greater
+    // than x.
+    std::size_t pos = 2;
+    for (std::size_t len = numSamples - 3; len > 1; len -= len / 2) {
+        pos += (sample(pos + len / 2) <= x) ? len / 2 : 0;
+    }
+
+    const std::size_t count = (numSamples > 3)
+        ? (pos - 2) + (sample(pos) <= x)
+        : 0;
+
+    return (sample(1) < x) + count;
+}
+
+/*!
+ * \brief Return the sampling intervals of a batch of positions.
+ *
+ * Same result as segmentIndex() for each position.  All positions take
+ * the same bisection steps in lock-step, so the search vectorises over the
+ * batch.
+ *
+ * \param samples Sampling points, strictly increasing. At least two.
+ * \param x Positions.
+ * \param segIdx Sampling interval of each position. Same size as \p x.
+ */
+template <class Scalar, class Evaluation>
+void segmentIndices(std::span<const Scalar> samples,
+                    std::span<const Evaluation> x,
+                    std::span<unsigned> segIdx)
+{
+    assert(samples.size() >= 2);
+    assert(segIdx.size() == x.size());
+
+    const std::size_t numSamples = samples.size();
+    const std::size_t n = x.size();
+
+    for (std::size_t k = 0; k < n; ++k) {
+        segIdx[k] = 0;
+    }
+
+    if (numSamples < 3) {
+        return;
+    }
+
+    // Bisection over the interior sampling points s_2, ..., s_{n-2}.
+    const Scalar* interior = samples.data() + 2;
+    for (std::size_t len = numSamples - 3; len > 1; len -= len / 2) {
+        const unsigned half = len / 2;
+        for (std::size_t k = 0; k < n; ++k) {
+            segIdx[k] += (interior[segIdx[k] + half] <= scalarValue(x[k])) ? half : 0;
+        }
+    }
+
+    const Scalar s1 = samples[1];
+    const bool hasInterior = numSamples > 3;
+    for (std::size_t k = 0; k < n; ++k) {
+        const auto xk = scalarValue(x[k]);
+        segIdx[k] = (s1 < xk) + (hasInterior ? segIdx[k] + (interior[segIdx[k]] <= xk) : 0);
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_SEGMENT_SEARCH_HPP
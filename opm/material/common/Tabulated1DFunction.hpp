@@ -28,12 +28,15 @@
 #define OPM_TABULATED_1D_FUNCTION_HPP
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/material/common/SegmentSearch.hpp>
 #include <opm/material/densead/Math.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <iosfwd>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -282,6 +285,41 @@ public:
         return y0 + (y1 - y0)*(x - x0)/(x1 - x0);
     }
 
+    /*!
+     * \brief Number of positions whose sampling intervals are searched for
+     *        at once by the batched eval().
+     */
+    static constexpr std::size_t maxBatchSize = 64;
+
+    /*!
+     * \brief Evaluate the function at any number of positions.
+     *
+     * Equals eval(x[k], extrapolate) for each position to within rounding,
+     * but the sampling intervals are searched for maxBatchSize positions at
+     * once.
+     *
+     * \param x Positions on the abscissa.
+     * \param result Function values. Same size as \p x.
+     * \param extrapolate Whether or not to extend the function beyond its range.
+     */
+    template <class Evaluation>
+    void eval(std::span<const Evaluation> x,
+              std::span<Evaluation> result,
+              bool extrapolate = false) const
+    {
+        assert(result.size() == x.size());
+
+        std::array<unsigned, maxBatchSize> segIdx;
+        for (std::size_t start = 0; start < x.size(); start += maxBatchSize) {
+            const std::size_t n = std::min(maxBatchSize, x.size() - start);
+            findSegmentIndices(x.subspan(start, n), std::span<unsigned>{segIdx.data(), n}, extrapolate);
+
+            for (std::size_t k = 0; k < n; ++k) {
+                result[start + k] = eval(x[start + k], SegmentIndex{segIdx[k]});
+            }
+        }
+    }
+
     /*!
      * \brief Evaluate the spline's derivative at a given position.
      *
@@ -504,6 +542,42 @@ public:
         }
     }
 
+    /*!
+     * \brief Return the sampling intervals of a batch of positions.
+     *
+     * Same result as findSegmentIndex() for each position.
+     *
+     * \param x Positions on the abscissa.
+     * \param segIdx Sampling interval of each position. Same size as \p x.
+     * \param extrapolate Whether or not positions outside the range are allowed.
+     */
+    template <class Evaluation>
+    void findSegmentIndices(std::span<const Evaluation> x,
+                            std::span<unsigned> segIdx,
+                            bool extrapolate = false) const
+    {
+        for (const auto& xk : x) {
+            if (!isfinite(xk)) {
+                throw std::runtime_error("We can not search for extrapolation/interpolation "
+                                         "segment in an 1D table for non-finite value " +
+                                         std::to_string(getValue(xk)) + " .");
+            }
+
+            if (!extrapolate && !applies(xk))
+                throw std::logic_error("Trying to evaluate a tabulated function outside of its range");
+        }
+
+        if (numSamples() < 2) {
+            throw std::logic_error("We need at least two sampling points to "
+                                   "do interpolation/extrapolation, "
+                                   "and the table only contains " +
+                                   std::to_string(numSamples()) +
+                                   " sampling points");
+        }
+
+        segmentIndices(std::span<const Scalar>{xValues_}, x, segIdx);
+    }
+
 private:
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, std::size_t segIdx) const
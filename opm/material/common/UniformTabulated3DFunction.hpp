@@ -0,0 +1,402 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::UniformTabulated3DFunction
+ */
+#ifndef OPM_UNIFORM_TABULATED_3D_FUNCTION_HPP
+#define OPM_UNIFORM_TABULATED_3D_FUNCTION_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/common/utility/gpuDecorators.hpp>
+#include <opm/common/utility/VectorWithDefaultAllocator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace Opm {
+
+/*!
+ * \brief Implements a scalar function that depends on three variables and which is
+ *        sampled on an uniform X-Y-Z grid.
+ *
+ * Values are tri-linearly interpolated, so evaluating the function with
+ * Evaluation arguments yields the exact derivatives of the interpolant.
+ * A single sampling point along an axis is allowed, in which case the
+ * function does not depend on that coordinate.
+ *
+ * The sampling points can either be set individually, or be determined
+ * by sampleAdaptively() from a function which is expensive to evaluate.
+ */
+template <class Scalar, template<class> class Storage = Opm::VectorWithDefaultAllocator>
+class UniformTabulated3DFunction
+{
+    using ContainerT = Storage<Scalar>;
+public:
+    OPM_HOST_DEVICE UniformTabulated3DFunction()
+    { }
+
+    /*!
+     * \brief Constructor where the tabulation parameters are already
+     *        provided.
+     */
+    UniformTabulated3DFunction(Scalar minX, Scalar maxX, unsigned numX,
+                               Scalar minY, Scalar maxY, unsigned numY,
+                               Scalar minZ, Scalar maxZ, unsigned numZ)
+    {
+        resize(minX, maxX, numX, minY, maxY, numY, minZ, maxZ, numZ);
+    }
+
+    /*!
+     * \brief Resize the tabulation to a new range.
+     */
+    void resize(Scalar minX, Scalar maxX, unsigned numX,
+                Scalar minY, Scalar maxY, unsigned numY,
+                Scalar minZ, Scalar maxZ, unsigned numZ)
+    {
+        samples_.resize(std::size_t{numX}*numY*numZ);
+
+        min_ = { minX, minY, minZ };
+        max_ = { maxX, maxY, maxZ };
+        num_ = { numX, numY, numZ };
+    }
+
+    /*!
+     * \brief Returns whether or not the function has any sampling points.
+     */
+    OPM_HOST_DEVICE bool empty() const
+    { return samples_.empty(); }
+
+    OPM_HOST_DEVICE Scalar xMin() const
+    { return min_[0]; }
+
+    OPM_HOST_DEVICE Scalar xMax() const
+    { return max_[0]; }
+
+    OPM_HOST_DEVICE Scalar yMin() const
+    { return min_[1]; }
+
+    OPM_HOST_DEVICE Scalar yMax() const
+    { return max_[1]; }
+
+    OPM_HOST_DEVICE Scalar zMin() const
+    { return min_[2]; }
+
+    OPM_HOST_DEVICE Scalar zMax() const
+    { return max_[2]; }
+
+    OPM_HOST_DEVICE unsigned numX() const
+    { return num_[0]; }
+
+    OPM_HOST_DEVICE unsigned numY() const
+    { return num_[1]; }
+
+    OPM_HOST_DEVICE unsigned numZ() const
+    { return num_[2]; }
+
+    /*!
+     * \brief Returns the sampling points.
+     */
+    OPM_HOST_DEVICE const ContainerT& samples() const
+    { return samples_; }
+
+    /*!
+     * \brief Return the position of the i-th sampling point on the x-axis.
+     */
+    OPM_HOST_DEVICE Scalar iToX(unsigned i) const
+    { return position_(0, i); }
+
+    /*!
+     * \brief Return the position of the j-th sampling point on the y-axis.
+     */
+    OPM_HOST_DEVICE Scalar jToY(unsigned j) const
+    { return position_(1, j); }
+
+    /*!
+     * \brief Return the position of the k-th sampling point on the z-axis.
+     */
+    OPM_HOST_DEVICE Scalar kToZ(unsigned k) const
+    { return position_(2, k); }
+
+    /*!
+     * \brief Returns true iff a coordinate lies in the tabulated range
+     */
+    template <class Evaluation>
+    OPM_HOST_DEVICE bool applies(const Evaluation& x, const Evaluation& y, const Evaluation& z) const
+    {
+        return
+            xMin() <= x && x <= xMax() &&
+            yMin() <= y && y <= yMax() &&
+            zMin() <= z && z <= zMax();
+    }
+
+    /*!
+     * \brief Evaluate the function at a given (x,y,z) position.
+     *
+     * Positions outside the tabulated range are linearly extrapolated
+     * from the outermost sampling intervals.
+     */
+    template <class Evaluation>
+    OPM_HOST_DEVICE Evaluation eval(const Evaluation& x,
+                                    const Evaluation& y,
+                                    const Evaluation& z) const
+    {
+        unsigned i, j, k;
+        const Evaluation alpha = localPosition_(0, x, i);
+        const Evaluation beta = localPosition_(1, y, j);
+        const Evaluation gamma = localPosition_(2, z, k);
+
+        const unsigned di = (numX() > 1) ? 1 : 0;
+        const unsigned dj = (numY() > 1) ? 1 : 0;
+        const unsigned dk = (numZ() > 1) ? 1 : 0;
+
+        // tri-linear interpolation
+        auto bilinear = [&](unsigned kk)
+        {
+            const Evaluation& s1 = getSamplePoint(i, j, kk)*(1.0 - alpha) + getSamplePoint(i + di, j, kk)*alpha;
+            const Evaluation& s2 = getSamplePoint(i, j + dj, kk)*(1.0 - alpha) + getSamplePoint(i + di, j + dj, kk)*alpha;
+            return Evaluation(s1*(1.0 - beta) + s2*beta);
+        };
+
+        if (dk == 0) {
+            return bilinear(k);
+        }
+
+        return bilinear(k)*(1.0 - gamma) + bilinear(k + 1)*gamma;
+    }
+
+    /*!
+     * \brief Get the value of the sample point (i, j, k).
+     */
+    OPM_HOST_DEVICE Scalar getSamplePoint(unsigned i, unsigned j, unsigned k) const
+    {
+        assert(i < numX());
+        assert(j < numY());
+        assert(k < numZ());
+
+        return samples_[(std::size_t{k}*numY() + j)*numX() + i];
+    }
+
+    /*!
+     * \brief Set the value of the sample point (i, j, k).
+     */
+    void setSamplePoint(unsigned i, unsigned j, unsigned k, Scalar value)
+    {
+        assert(i < numX());
+        assert(j < numY());
+        assert(k < numZ());
+
+        samples_[(std::size_t{k}*numY() + j)*numX() + i] = value;
+    }
+
+    /*!
+     * \brief Tabulate a function with error-controlled resolution.
+     *
+     * Starts from a coarse uniform grid and repeatedly halves the
+     * sampling interval along the axes with the largest interpolation
+     * errors, measured half way between neighbouring sampling points.
+     * Inside a grid cell, the errors along the axes add up, so the
+     * estimated error of the table is their sum.  Axes with an empty
+     * range get a single sampling point.
+     *
+     * \param f Function to tabulate, called as f(x, y, z) with Scalar arguments.
+     * \param tolerance Maximum absolute interpolation error.
+     * \param maxSamples Upper limit on the total number of sampling points.
+     *
+     * \return Estimated maximum interpolation error of the resulting
+     *         table.  Exceeds \p tolerance if the limit on the number of
+     *         sampling points was reached first, and is infinite if \p f
+     *         is not finite at some sampling point or at some point half
+     *         way between neighbouring sampling points.  The table must
+     *         not be used in the latter case.
+     */
+    template <class Function>
+    Scalar sampleAdaptively(const Function& f,
+                            Scalar minX, Scalar maxX,
+                            Scalar minY, Scalar maxY,
+                            Scalar minZ, Scalar maxZ,
+                            Scalar tolerance,
+                            std::size_t maxSamples = std::size_t{1} << 20)
+    {
+        const std::array<Scalar, 3> lo { minX, minY, minZ };
+        const std::array<Scalar, 3> hi { maxX, maxY, maxZ };
+
+        std::array<unsigned, 3> num{};
+        int numAxes = 0;
+        for (int d = 0; d < 3; ++d) {
+            num[d] = (hi[d] > lo[d]) ? 5 : 1;
+            numAxes += (num[d] > 1) ? 1 : 0;
+        }
+
+        while (true) {
+            resize(minX, maxX, num[0], minY, maxY, num[1], minZ, maxZ, num[2]);
+            for (unsigned k = 0; k < numZ(); ++k) {
+                for (unsigned j = 0; j < numY(); ++j) {
+                    for (unsigned i = 0; i < numX(); ++i) {
+                        const Scalar value = f(iToX(i), jToY(j), kToZ(k));
+                        if (!std::isfinite(value)) {
+                            return std::numeric_limits<Scalar>::infinity();
+                        }
+
+                        setSamplePoint(i, j, k, value);
+                    }
+                }
+            }
+
+            const auto error = axisErrors_(f);
+            const Scalar totalError = error[0] + error[1] + error[2];
+            if (!std::isfinite(totalError)) {
+                return std::numeric_limits<Scalar>::infinity();
+            }
+
+            if (totalError <= tolerance) {
+                return totalError;
+            }
+
+            // Refine the axes whose share of the error is too large,
+            // largest error first, as far as the sample limit permits.
+            std::array<int, 3> order { 0, 1, 2 };
+            std::sort(order.begin(), order.end(),
+                      [&error](int a, int b) { return error[a] > error[b]; });
+
+            auto refined = num;
+            for (const int d : order) {
+                if (error[d] <= tolerance/numAxes) {
+                    break;
+                }
+
+                auto candidate = refined;
+                candidate[d] = 2*num[d] - 1;
+                if (std::size_t{candidate[0]}*candidate[1]*candidate[2] <= maxSamples) {
+                    refined = candidate;
+                }
+            }
+
+            if (refined == num) {
+                return totalError;
+            }
+
+            num = refined;
+        }
+    }
+
+    OPM_HOST_DEVICE bool operator==(const UniformTabulated3DFunction& data) const
+    {
+        return samples_ == data.samples_ &&
+               num_ == data.num_ &&
+               min_ == data.min_ &&
+               max_ == data.max_;
+    }
+
+private:
+    OPM_HOST_DEVICE Scalar position_(int axis, unsigned idx) const
+    {
+        assert(idx < num_[axis]);
+
+        if (num_[axis] < 2) {
+            return min_[axis];
+        }
+
+        return min_[axis] + idx*(max_[axis] - min_[axis])/(num_[axis] - 1);
+    }
+
+    // Sampling interval of a position along an axis, and the position
+    // relative to that interval.
+    template <class Evaluation>
+    OPM_HOST_DEVICE Evaluation localPosition_(int axis, const Evaluation& x, unsigned& idx) const
+    {
+        if (num_[axis] < 2) {
+            idx = 0;
+            return Evaluation(0.0);
+        }
+
+        Evaluation alpha = (x - min_[axis])/(max_[axis] - min_[axis])*(num_[axis] - 1);
+        idx = static_cast<unsigned>(
+            std::max(0, std::min(static_cast<int>(num_[axis]) - 2,
+                                 static_cast<int>(scalarValue(alpha)))));
+
+        return alpha - idx;
+    }
+
+    // Maximum interpolation error half way between neighbouring
+    // sampling points along each axis.  Infinite if f is not finite at
+    // some of those points.
+    template <class Function>
+    std::array<Scalar, 3> axisErrors_(const Function& f) const
+    {
+        std::array<Scalar, 3> error{};
+
+        // std::max() would drop a NaN difference.
+        auto update = [](Scalar& maxError, const Scalar diff)
+        {
+            maxError = std::isnan(diff)
+                ? std::numeric_limits<Scalar>::infinity()
+                : std::max(maxError, std::abs(diff));
+        };
+
+        for (unsigned k = 0; k < numZ(); ++k) {
+            for (unsigned j = 0; j < numY(); ++j) {
+                for (unsigned i = 0; i < numX(); ++i) {
+                    const Scalar x = iToX(i);
+                    const Scalar y = jToY(j);
+                    const Scalar z = kToZ(k);
+
+                    if (i + 1 < numX()) {
+                        const Scalar xm = (x + iToX(i + 1))/2;
+                        update(error[0], f(xm, y, z) - eval(xm, y, z));
+                    }
+                    if (j + 1 < numY()) {
+                        const Scalar ym = (y + jToY(j + 1))/2;
+                        update(error[1], f(x, ym, z) - eval(x, ym, z));
+                    }
+                    if (k + 1 < numZ()) {
+                        const Scalar zm = (z + kToZ(k + 1))/2;
+                        update(error[2], f(x, y, zm) - eval(x, y, zm));
+                    }
+                }
+            }
+        }
+
+        return error;
+    }
+
+    // the values of the sample points f(x_i, y_j, z_k).  don't use this
+    // directly, use getSamplePoint(i,j,k) instead!
+    ContainerT samples_{};
+
+    // the number of sample points in each direction
+    std::array<unsigned, 3> num_{};
+
+    // the range of the tabulation in each direction
+    std::array<Scalar, 3> min_{};
+    std::array<Scalar, 3> max_{};
+};
+
+} // namespace Opm
+
+#endif
@@ -32,16 +32,25 @@
 
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/SegmentSearch.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <iosfwd>
 #include <limits>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <vector>
 
+namespace Opm::DenseAd {
+template <class ValueT, int numDerivs, int width>
+class EvaluationBatch;
+}
+
 namespace Opm {
 /*!
  * \brief Implements a scalar function that depends on two variables and which is sampled
@@ -325,6 +334,118 @@ public:
         return eval(i, j1, j2, alpha, beta1, beta2);
     }
 
+    /*!
+     * \brief Evaluate the function at a batch of (x,y) positions at once.
+     *
+     * Same result as the generic eval() in each lane.  The sampling
+     * intervals on the x-axis are searched for in lock-step, those on the
+     * y-axis per lane without branching on the position, and the
+     * interpolation weights and values are computed for all lanes at once.
+     */
+    template <class ValueT, int numDerivs, int width>
+    DenseAd::EvaluationBatch<ValueT, numDerivs, width>
+    eval(const DenseAd::EvaluationBatch<ValueT, numDerivs, width>& x,
+         const DenseAd::EvaluationBatch<ValueT, numDerivs, width>& y,
+         bool extrapolate = false) const
+    {
+        using Batch = DenseAd::EvaluationBatch<ValueT, numDerivs, width>;
+        using Lanes = typename Batch::Lanes;
+
+#ifndef NDEBUG
+        if (!extrapolate) {
+            for (int k = 0; k < width; ++k) {
+                if (!applies(x.value(k), y.value(k))) {
+                    throw NumericalProblem("Attempt to get undefined table value (" +
+                                           std::to_string(x.value(k)) + ", " +
+                                           std::to_string(y.value(k)) + ")");
+                }
+            }
+        }
+#else
+        static_cast<void>(extrapolate);
+#endif
+
+        // Same steps as the scalar findPoints() and eval(), with one
+        // sampling interval per lane.
+        const Lanes xk = x.values();
+        std::array<unsigned, width> i;
+        segmentIndices(std::span<const Scalar>{xPos_}, std::span<const ValueT>{xk}, std::span<unsigned>{i});
+
+        Lanes x1, x2;
+        for (int k = 0; k < width; ++k) {
+            x1[k] = xPos_[i[k]];
+            x2[k] = xPos_[i[k] + 1];
+        }
+
+        Lanes dx;
+        for (int k = 0; k < width; ++k) {
+            dx[k] = x2[k] - x1[k];
+        }
+        const Batch alpha = (x - x1)/dx;
+
+        Batch shift = 0.0;
+        if (interpolationGuide_ != InterpolationPolicy::Vertical) {
+            Lanes shift0;
+            for (int k = 0; k < width; ++k) {
+                shift0[k] = yPos_[i[k] + 1] - yPos_[i[k]];
+            }
+            shift = Batch::createConstant(shift0);
+
+            if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
+                Lanes yPos1, yPos2;
+                for (int k = 0; k < width; ++k) {
+                    yPos1[k] = yPos_[i[k]];
+                    yPos2[k] = yPos_[i[k] + 1];
+                }
+
+                const Batch yEnd = yPos1*(1.0 - alpha) + yPos2*alpha;
+                shift = shift * y / yEnd;
+                for (int k = 0; k < width; ++k) {
+                    if (!(yEnd.value(k) > 0.)) {
+                        shift.setLane(k, typename Batch::LaneEvaluation(0.));
+                    }
+                }
+            }
+        }
+
+        const Batch yLower = y - alpha*shift;
+        const Batch yUpper = y + (1 - alpha)*shift;
+
+        Lanes y11, y12, y21, y22, v11, v12, v21, v22;
+        for (int k = 0; k < width; ++k) {
+            const auto& col1 = samples_[i[k]];
+            const auto& col2 = samples_[i[k] + 1];
+            const unsigned j1 = segmentIndex(col1.size(),
+                                             [&col1](std::size_t j) { return std::get<1>(col1[j]); },
+                                             yLower.value(k));
+            const unsigned j2 = segmentIndex(col2.size(),
+                                             [&col2](std::size_t j) { return std::get<1>(col2[j]); },
+                                             yUpper.value(k));
+
+            y11[k] = std::get<1>(col1[j1]);
+            y12[k] = std::get<1>(col1[j1 + 1]);
+            y21[k] = std::get<1>(col2[j2]);
+            y22[k] = std::get<1>(col2[j2 + 1]);
+            v11[k] = std::get<2>(col1[j1]);
+            v12[k] = std::get<2>(col1[j1 + 1]);
+            v21[k] = std::get<2>(col2[j2]);
+            v22[k] = std::get<2>(col2[j2 + 1]);
+        }
+
+        Lanes dy1, dy2;
+        for (int k = 0; k < width; ++k) {
+            dy1[k] = y12[k] - y11[k];
+            dy2[k] = y22[k] - y21[k];
+        }
+        const Batch beta1 = (yLower - y11)/dy1;
+        const Batch beta2 = (yUpper - y21)/dy2;
+
+        const Batch s1 = v11*(1.0 - beta1) + v12*beta1;
+        const Batch s2 = v21*(1.0 - beta2) + v22*beta2;
+
+        return s1*(1.0 - alpha) + s2*alpha;
+    }
+
     template <class Evaluation>
     void findPoints(unsigned& i,
                     unsigned& j1,
@@ -393,6 +514,151 @@ public:
         beta2 = yToBeta(yUpper, i + 1, j2);
     }
 
+    /*!
+     * \brief Maximum number of positions in one batch of interpolation points.
+     *
+     * Small enough for the points of a batch to stay in cache between
+     * findPoints() and eval().
+     */
+    static constexpr std::size_t maxBatchSize = 64;
+
+    /*!
+     * \brief Interpolation points of a batch of (x,y) positions.
+     *
+     * One entry per position in each array, with the same meaning as the
+     * corresponding argument of the scalar findPoints().
+     */
+    template <class Evaluation>
+    struct BatchPoints
+    {
+        std::size_t size{0};
+        std::array<unsigned, maxBatchSize> i;
+        std::array<unsigned, maxBatchSize> j1;
+        std::array<unsigned, maxBatchSize> j2;
+        std::array<Evaluation, maxBatchSize> alpha;
+        std::array<Evaluation, maxBatchSize> beta1;
+        std::array<Evaluation, maxBatchSize> beta2;
+    };
+
+    /*!
+     * \brief Find the interpolation points of a batch of (x,y) positions.
+     *
+     * Same sampling intervals as the scalar findPoints() for each position.
+     * The weights may differ in the last bits, since the compiler is free
+     * to contract the arithmetic of the batched loop into fused
+     * multiply-adds differently.  The x-axis sampling intervals of all
+     * positions are searched for at once, and the y-axis intervals without
+     * branching on the position.  The points may be used to evaluate any
+     * function which has the same sampling points and interpolation policy
+     * as this one.
+     *
+     * \param x Positions on the first axis. At most maxBatchSize.
+     * \param y Positions on the second axis. Same size as \p x.
+     */
+    template <class Evaluation>
+    void findPoints(BatchPoints<Evaluation>& points,
+                    std::span<const Evaluation> x,
+                    std::span<const Evaluation> y,
+                    bool extrapolate) const
+    {
+        assert(x.size() == y.size());
+        assert(x.size() <= maxBatchSize);
+        assert(xPos_.size() >= 2);
+
+        const std::size_t n = x.size();
+        points.size = n;
+
+#ifndef NDEBUG
+        if (!extrapolate) {
+            for (std::size_t k = 0; k < n; ++k) {
+                if (!applies(x[k], y[k])) {
+                    throw NumericalProblem("Attempt to get undefined table value (" +
+                                           std::to_string(scalarValue(x[k])) + ", " +
+                                           std::to_string(scalarValue(y[k])) + ")");
+                }
+            }
+        }
+#else
+        static_cast<void>(extrapolate);
+#endif
+
+        segmentIndices(std::span<const Scalar>{xPos_}, x, std::span<unsigned>{points.i.data(), n});
+
+        for (std::size_t k = 0; k < n; ++k) {
+            const unsigned i = points.i[k];
+            points.alpha[k] = xToAlpha(x[k], i);
+
+            // Same shift as in the scalar findPoints().
+            Evaluation shift = 0.0;
+            if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
+                shift = yPos_[i+1] - yPos_[i];
+            }
+            else if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
+                shift = yPos_[i+1] - yPos_[i];
+                auto yEnd = yPos_[i]*(1.0 - points.alpha[k]) + yPos_[i+1]*points.alpha[k];
+                if (yEnd > 0.) {
+                    shift = shift * y[k] / yEnd;
+                } else {
+                    shift = 0.;
+                }
+            }
+
+            const Evaluation yLower = y[k] - points.alpha[k]*shift;
+            const Evaluation yUpper = y[k] + (1 - points.alpha[k])*shift;
+
+            const auto& col1 = samples_[i];
+            const auto& col2 = samples_[i + 1];
+            points.j1[k] = segmentIndex(col1.size(),
+                                        [&col1](std::size_t j) { return std::get<1>(col1[j]); },
+                                        scalarValue(yLower));
+            points.j2[k] = segmentIndex(col2.size(),
+                                        [&col2](std::size_t j) { return std::get<1>(col2[j]); },
+                                        scalarValue(yUpper));
+            points.beta1[k] = yToBeta(yLower, i, points.j1[k]);
+            points.beta2[k] = yToBeta(yUpper, i + 1, points.j2[k]);
+        }
+    }
+
+    /*!
+     * \brief Evaluate the function at a batch of interpolation points.
+     *
+     * \param points Result of findPoints() on this function, or on a
+     *   function with the same sampling points and interpolation policy.
+     * \param result Function values. Same size as \p points.
+     */
+    template <class Evaluation>
+    void eval(const BatchPoints<Evaluation>& points, std::span<Evaluation> result) const
+    {
+        assert(result.size() == points.size);
+
+        for (std::size_t k = 0; k < points.size; ++k) {
+            result[k] = eval(points.i[k], points.j1[k], points.j2[k],
+                             points.alpha[k], points.beta1[k], points.beta2[k]);
+        }
+    }
+
+    /*!
+     * \brief Evaluate the function at any number of (x,y) positions.
+     *
+     * Equals eval(x[k], y[k], extrapolate) for each position up to
+     * rounding.
+     */
+    template <class Evaluation>
+    void eval(std::span<const Evaluation> x,
+              std::span<const Evaluation> y,
+              std::span<Evaluation> result,
+              bool extrapolate = false) const
+    {
+        assert(result.size() == x.size());
+
+        BatchPoints<Evaluation> points;
+        for (std::size_t start = 0; start < x.size(); start += maxBatchSize) {
+            const std::size_t n = std::min(maxBatchSize, x.size() - start);
+            findPoints(points, x.subspan(start, n), y.subspan(start, n), extrapolate);
+            eval(points, result.subspan(start, n));
+        }
+    }
+
     template <class Evaluation>
     Evaluation eval(const unsigned& i, const unsigned& j1, const unsigned& j2, const Evaluation& alpha,const Evaluation& beta1,const Evaluation& beta2) const
     {
@@ -0,0 +1,856 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Evaluations of a function and its derivatives for a fixed number of
+ *        cells at once, stored as a structure of arrays.
+ */
+#ifndef OPM_DENSEAD_EVALUATION_BATCH_HPP
+#define OPM_DENSEAD_EVALUATION_BATCH_HPP
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <array>
+#include <cassert>
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief Evaluations of a function and its derivatives w.r.t. a fixed set of
+ *        variables for \c width cells ("lanes") at once.
+ *
+ * The values of all lanes are stored contiguously, followed by the first
+ * derivative of all lanes and so on.  Every operation therefore is a loop
+ * over the lanes of each row, which the compiler turns into vector
+ * instructions.  Each lane does the same operations, in the same order, as
+ * the corresponding Evaluation<ValueT, numDerivs> would.
+ *
+ * There are deliberately no comparison operators: branching on the value
+ * of a batch has no meaning when the lanes disagree.  Code which does that
+ * must look at the individual lanes, or is not instantiable on batches.
+ */
+template <class ValueT, int numDerivs, int width>
+class EvaluationBatch
+{
+    static_assert(numDerivs >= 0, "Evaluation batches need a static number of derivatives");
+    static_assert(width > 0, "Evaluation batches need at least one lane");
+
+public:
+    //! number of derivatives
+    static constexpr int numVars = numDerivs;
+
+    //! number of cells in a batch
+    static constexpr int numLanes = width;
+
+    //! field type
+    using ValueType = ValueT;
+
+    //! evaluation of a single lane
+    using LaneEvaluation = Evaluation<ValueT, numDerivs>;
+
+    //! one field value per lane
+    using Lanes = std::array<ValueT, width>;
+
+    //! number of derivatives
+    constexpr int size() const
+    { return numDerivs; }
+
+protected:
+    //! number of rows, i.e., value and derivatives
+    static constexpr int numRows_ = numDerivs + 1;
+
+    //! length of internal data vector
+    static constexpr int length_ = numRows_*width;
+
+    //! start index of the given row
+    static constexpr int rowStart_(int row)
+    { return row*width; }
+
+public:
+    //! default constructor
+    EvaluationBatch() : data_()
+    {}
+
+    //! copy other batch of function evaluations
+    EvaluationBatch(const EvaluationBatch& other) = default;
+
+    // create a batch which represents the same constant function in all lanes
+    EvaluationBatch(const ValueT& c) : data_()
+    {
+        for (int k = 0; k < width; ++k)
+            data_[k] = c;
+    }
+
+    // create a batch representing the variable at varPos with the same value in
+    // all lanes
+    EvaluationBatch(const ValueT& c, int varPos) : EvaluationBatch(c)
+    {
+        assert(0 <= varPos && varPos < size());
+
+        for (int k = 0; k < width; ++k)
+            data_[rowStart_(varPos + 1) + k] = 1.0;
+    }
+
+    // create a batch with the same value and derivatives in all lanes
+    explicit EvaluationBatch(const LaneEvaluation& eval)
+    {
+        for (int k = 0; k < width; ++k)
+            setLane(k, eval);
+    }
+
+    // set all derivatives to zero
+    void clearDerivatives()
+    {
+        for (int i = rowStart_(1); i < length_; ++i)
+            data_[i] = 0.0;
+    }
+
+    // create an uninitialized batch compatible with the argument
+    static EvaluationBatch createBlank(const EvaluationBatch&)
+    { return EvaluationBatch(); }
+
+    // create a batch with values and all the derivatives to be zero
+    static EvaluationBatch createConstantZero(const EvaluationBatch&)
+    { return EvaluationBatch(0.); }
+
+    // create a batch with values to be one and all the derivatives to be zero
+    static EvaluationBatch createConstantOne(const EvaluationBatch&)
+    { return EvaluationBatch(1.); }
+
+    // create a batch of constant functions with the same value in all lanes
+    static EvaluationBatch createConstant(const ValueT& value)
+    { return EvaluationBatch(value); }
+
+    // create a batch of constant functions with one value per lane
+    static EvaluationBatch createConstant(const Lanes& values)
+    {
+        EvaluationBatch result;
+        result.setValues(values);
+        return result;
+    }
+
+    static EvaluationBatch createConstant(const EvaluationBatch&, const ValueT& value)
+    { return EvaluationBatch(value); }
+
+    // create a batch of "naked" variables (i.e., f(x) = x) with the same value in
+    // all lanes
+    static EvaluationBatch createVariable(const ValueT& value, int varPos)
+    { return EvaluationBatch(value, varPos); }
+
+    // create a batch of "naked" variables with one value per lane
+    static EvaluationBatch createVariable(const Lanes& values, int varPos)
+    {
+        assert(0 <= varPos && varPos < numDerivs);
+
+        EvaluationBatch result = createConstant(values);
+        for (int k = 0; k < width; ++k)
+            result.data_[rowStart_(varPos + 1) + k] = 1.0;
+
+        return result;
+    }
+
+    static EvaluationBatch createVariable(const EvaluationBatch&, const ValueT& value, int varPos)
+    { return EvaluationBatch(value, varPos); }
+
+    // return the value of a lane
+    const ValueT& value(int lane) const
+    { return data_[lane]; }
+
+    // set the value of a lane
+    void setValue(int lane, const ValueT& val)
+    { data_[lane] = val; }
+
+    // return the values of all lanes
+    Lanes values() const
+    {
+        Lanes result;
+        for (int k = 0; k < width; ++k)
+            result[k] = data_[k];
+        return result;
+    }
+
+    // set the values of all lanes
+    void setValues(const Lanes& val)
+    {
+        for (int k = 0; k < width; ++k)
+            data_[k] = val[k];
+    }
+
+    // return the derivative of a lane w.r.t. the given variable
+    const ValueT& derivative(int lane, int varIdx) const
+    {
+        assert(0 <= varIdx && varIdx < size());
+        return data_[rowStart_(varIdx + 1) + lane];
+    }
+
+    // set the derivative of a lane w.r.t. the given variable
+    void setDerivative(int lane, int varIdx, const ValueT& derVal)
+    {
+        assert(0 <= varIdx && varIdx < size());
+        data_[rowStart_(varIdx + 1) + lane] = derVal;
+    }
+
+    // return the value and derivatives of a lane
+    LaneEvaluation lane(int k) const
+    {
+        LaneEvaluation result;
+        result.setValue(data_[k]);
+        for (int varIdx = 0; varIdx < numDerivs; ++varIdx)
+            result.setDerivative(varIdx, data_[rowStart_(varIdx + 1) + k]);
+        return result;
+    }
+
+    // set the value and derivatives of a lane
+    void setLane(int k, const LaneEvaluation& eval)
+    {
+        data_[k] = eval.value();
+        for (int varIdx = 0; varIdx < numDerivs; ++varIdx)
+            data_[rowStart_(varIdx + 1) + k] = eval.derivative(varIdx);
+    }
+
+    // add value and derivatives from other to this values and derivatives
+    EvaluationBatch& operator+=(const EvaluationBatch& other)
+    {
+        for (int i = 0; i < length_; ++i)
+            data_[i] += other.data_[i];
+        return *this;
+    }
+
+    // add the same constant to all lanes
+    EvaluationBatch& operator+=(const ValueT& other)
+    {
+        for (int k = 0; k < width; ++k)
+            data_[k] += other;
+        return *this;
+    }
+
+    // add one constant per lane
+    EvaluationBatch& operator+=(const Lanes& other)
+    {
+        for (int k = 0; k < width; ++k)
+            data_[k] += other[k];
+        return *this;
+    }
+
+    // subtract other's value and derivatives from this values
+    EvaluationBatch& operator-=(const EvaluationBatch& other)
+    {
+        for (int i = 0; i < length_; ++i)
+            data_[i] -= other.data_[i];
+        return *this;
+    }
+
+    // subtract the same constant from all lanes
+    EvaluationBatch& operator-=(const ValueT& other)
+    {
+        for (int k = 0; k < width; ++k)
+            data_[k] -= other;
+        return *this;
+    }
+
+    // subtract one constant per lane
+    EvaluationBatch& operator-=(const Lanes& other)
+    {
+        for (int k = 0; k < width; ++k)
+            data_[k] -= other[k];
+        return *this;
+    }
+
+    // multiply values and apply chain rule to derivatives: (u*v)' = (v'u + u'v)
+    EvaluationBatch& operator*=(const EvaluationBatch& other)
+    {
+        const Lanes u = values();
+        const Lanes v = other.values();
+
+        // value
+        for (int k = 0; k < width; ++k)
+            data_[k] *= v[k];
+
+        // derivatives
+        for (int i = rowStart_(1); i < length_; i += width)
+            for (int k = 0; k < width; ++k)
+                data_[i + k] = data_[i + k]*v[k] + other.data_[i + k]*u[k];
+
+        return *this;
+    }
+
+    // m(c*u)' = c*u'
+    EvaluationBatch& operator*=(const ValueT& other)
+    {
+        for (int i = 0; i < length_; ++i)
+            data_[i] *= other;
+        return *this;
+    }
+
+    EvaluationBatch& operator*=(const Lanes& other)
+    {
+        for (int i = 0; i < length_; i += width)
+            for (int k = 0; k < width; ++k)
+                data_[i + k] *= other[k];
+        return *this;
+    }
+
+    // m(u*v)' = (vu' - uv')/v^2
+    EvaluationBatch& operator/=(const EvaluationBatch& other)
+    {
+        const Lanes u = values();
+        const Lanes v = other.values();
+
+        // derivatives
+        for (int i = rowStart_(1); i < length_; i += width)
+            for (int k = 0; k < width; ++k)
+                data_[i + k] = (v[k]*data_[i + k] - u[k]*other.data_[i + k])/(v[k]*v[k]);
+
+        // value
+        for (int k = 0; k < width; ++k)
+            data_[k] /= v[k];
+
+        return *this;
+    }
+
+    // divide value and derivatives by the same constant in all lanes
+    EvaluationBatch& operator/=(const ValueT& other)
+    {
+        const ValueT tmp = 1.0/other;
+        return *this *= tmp;
+    }
+
+    // divide value and derivatives by one constant per lane
+    EvaluationBatch& operator/=(const Lanes& other)
+    {
+        Lanes tmp;
+        for (int k = 0; k < width; ++k)
+            tmp[k] = 1.0/other[k];
+        return *this *= tmp;
+    }
+
+    EvaluationBatch operator+(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result += other;
+        return result;
+    }
+
+    EvaluationBatch operator+(const ValueT& other) const
+    {
+        EvaluationBatch result(*this);
+        result += other;
+        return result;
+    }
+
+    EvaluationBatch operator+(const Lanes& other) const
+    {
+        EvaluationBatch result(*this);
+        result += other;
+        return result;
+    }
+
+    EvaluationBatch operator-(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result -= other;
+        return result;
+    }
+
+    EvaluationBatch operator-(const ValueT& other) const
+    {
+        EvaluationBatch result(*this);
+        result -= other;
+        return result;
+    }
+
+    EvaluationBatch operator-(const Lanes& other) const
+    {
+        EvaluationBatch result(*this);
+        result -= other;
+        return result;
+    }
+
+    // negation (unary minus) operator
+    EvaluationBatch operator-() const
+    {
+        EvaluationBatch result;
+        for (int i = 0; i < length_; ++i)
+            result.data_[i] = - data_[i];
+        return result;
+    }
+
+    EvaluationBatch operator*(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result *= other;
+        return result;
+    }
+
+    EvaluationBatch operator*(const ValueT& other) const
+    {
+        EvaluationBatch result(*this);
+        result *= other;
+        return result;
+    }
+
+    EvaluationBatch operator*(const Lanes& other) const
+    {
+        EvaluationBatch result(*this);
+        result *= other;
+        return result;
+    }
+
+    EvaluationBatch operator/(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result /= other;
+        return result;
+    }
+
+    EvaluationBatch operator/(const ValueT& other) const
+    {
+        EvaluationBatch result(*this);
+        result /= other;
+        return result;
+    }
+
+    EvaluationBatch operator/(const Lanes& other) const
+    {
+        EvaluationBatch result(*this);
+        result /= other;
+        return result;
+    }
+
+    EvaluationBatch& operator=(const EvaluationBatch& other) = default;
+
+private:
+    std::array<ValueT, length_> data_;
+};
+
+// arithmetic with a constant on the left hand side, with the same results as
+// the corresponding operators of Evaluation
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator+(const std::type_identity_t<ValueType>& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{
+    EvaluationBatch<ValueType, numVars, width> result(b);
+    result += a;
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator+(const typename EvaluationBatch<ValueType, numVars, width>::Lanes& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{
+    EvaluationBatch<ValueType, numVars, width> result(b);
+    result += a;
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator-(const std::type_identity_t<ValueType>& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{ return -(b - a); }
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator-(const typename EvaluationBatch<ValueType, numVars, width>::Lanes& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{ return -(b - a); }
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator*(const std::type_identity_t<ValueType>& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{
+    EvaluationBatch<ValueType, numVars, width> result(b);
+    result *= a;
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator*(const typename EvaluationBatch<ValueType, numVars, width>::Lanes& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{
+    EvaluationBatch<ValueType, numVars, width> result(b);
+    result *= a;
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator/(const std::type_identity_t<ValueType>& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{
+    EvaluationBatch<ValueType, numVars, width> tmp(a);
+    tmp /= b;
+    return tmp;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width>
+operator/(const typename EvaluationBatch<ValueType, numVars, width>::Lanes& a, const EvaluationBatch<ValueType, numVars, width>& b)
+{
+    auto tmp = EvaluationBatch<ValueType, numVars, width>::createConstant(a);
+    tmp /= b;
+    return tmp;
+}
+
+// provide some algebraic functions, with the same results in each lane as the
+// functions of Math.hpp for Evaluation
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> abs(const EvaluationBatch<ValueType, numVars, width>& x)
+{
+    EvaluationBatch<ValueType, numVars, width> result(x);
+    for (int k = 0; k < width; ++k) {
+        const bool negate = !(x.value(k) > 0.0);
+        result.setValue(k, negate ? -x.value(k) : x.value(k));
+        for (int varIdx = 0; varIdx < numVars; ++varIdx)
+            result.setDerivative(k, varIdx, negate ? -x.derivative(k, varIdx) : x.derivative(k, varIdx));
+    }
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> min(const EvaluationBatch<ValueType, numVars, width>& x1,
+                                               const EvaluationBatch<ValueType, numVars, width>& x2)
+{
+    EvaluationBatch<ValueType, numVars, width> result(x2);
+    for (int k = 0; k < width; ++k) {
+        const bool first = x1.value(k) < x2.value(k);
+        result.setValue(k, first ? x1.value(k) : x2.value(k));
+        for (int varIdx = 0; varIdx < numVars; ++varIdx)
+            result.setDerivative(k, varIdx, first ? x1.derivative(k, varIdx) : x2.derivative(k, varIdx));
+    }
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> min(const std::type_identity_t<ValueType>& x1,
+                                               const EvaluationBatch<ValueType, numVars, width>& x2)
+{
+    EvaluationBatch<ValueType, numVars, width> result(x2);
+    for (int k = 0; k < width; ++k) {
+        const bool first = x1 < x2.value(k);
+        result.setValue(k, first ? x1 : x2.value(k));
+        for (int varIdx = 0; varIdx < numVars; ++varIdx)
+            result.setDerivative(k, varIdx, first ? 0.0 : x2.derivative(k, varIdx));
+    }
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> min(const EvaluationBatch<ValueType, numVars, width>& x1,
+                                               const std::type_identity_t<ValueType>& x2)
+{ return min(x2, x1); }
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> max(const EvaluationBatch<ValueType, numVars, width>& x1,
+                                               const EvaluationBatch<ValueType, numVars, width>& x2)
+{
+    EvaluationBatch<ValueType, numVars, width> result(x2);
+    for (int k = 0; k < width; ++k) {
+        const bool first = x1.value(k) > x2.value(k);
+        result.setValue(k, first ? x1.value(k) : x2.value(k));
+        for (int varIdx = 0; varIdx < numVars; ++varIdx)
+            result.setDerivative(k, varIdx, first ? x1.derivative(k, varIdx) : x2.derivative(k, varIdx));
+    }
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> max(const std::type_identity_t<ValueType>& x1,
+                                               const EvaluationBatch<ValueType, numVars, width>& x2)
+{
+    EvaluationBatch<ValueType, numVars, width> result(x2);
+    for (int k = 0; k < width; ++k) {
+        const bool first = x1 > x2.value(k);
+        result.setValue(k, first ? x1 : x2.value(k));
+        for (int varIdx = 0; varIdx < numVars; ++varIdx)
+            result.setDerivative(k, varIdx, first ? 0.0 : x2.derivative(k, varIdx));
+    }
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> max(const EvaluationBatch<ValueType, numVars, width>& x1,
+                                               const std::type_identity_t<ValueType>& x2)
+{ return max(x2, x1); }
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> sqrt(const EvaluationBatch<ValueType, numVars, width>& x)
+{
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+
+    EvaluationBatch<ValueType, numVars, width> result(x);
+
+    std::array<ValueType, width> df_dx;
+    for (int k = 0; k < width; ++k) {
+        const ValueType sqrt_x = ValueTypeToolbox::sqrt(x.value(k));
+        result.setValue(k, sqrt_x);
+        df_dx[k] = 0.5/sqrt_x;
+    }
+
+    // derivatives use the chain rule
+    for (int varIdx = 0; varIdx < numVars; ++varIdx)
+        for (int k = 0; k < width; ++k)
+            result.setDerivative(k, varIdx, df_dx[k]*x.derivative(k, varIdx));
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> exp(const EvaluationBatch<ValueType, numVars, width>& x)
+{
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+
+    EvaluationBatch<ValueType, numVars, width> result(x);
+
+    std::array<ValueType, width> df_dx;
+    for (int k = 0; k < width; ++k) {
+        df_dx[k] = ValueTypeToolbox::exp(x.value(k));
+        result.setValue(k, df_dx[k]);
+    }
+
+    // derivatives use the chain rule
+    for (int varIdx = 0; varIdx < numVars; ++varIdx)
+        for (int k = 0; k < width; ++k)
+            result.setDerivative(k, varIdx, df_dx[k]*x.derivative(k, varIdx));
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> log(const EvaluationBatch<ValueType, numVars, width>& x)
+{
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+
+    EvaluationBatch<ValueType, numVars, width> result(x);
+
+    std::array<ValueType, width> df_dx;
+    for (int k = 0; k < width; ++k) {
+        result.setValue(k, ValueTypeToolbox::log(x.value(k)));
+        df_dx[k] = 1/x.value(k);
+    }
+
+    // derivatives use the chain rule
+    for (int varIdx = 0; varIdx < numVars; ++varIdx)
+        for (int k = 0; k < width; ++k)
+            result.setDerivative(k, varIdx, df_dx[k]*x.derivative(k, varIdx));
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> pow(const EvaluationBatch<ValueType, numVars, width>& base,
+                                               const std::type_identity_t<ValueType>& exp)
+{
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+
+    EvaluationBatch<ValueType, numVars, width> result(base);
+
+    std::array<ValueType, width> df_dx;
+    for (int k = 0; k < width; ++k) {
+        const ValueType pow_x = ValueTypeToolbox::pow(base.value(k), exp);
+
+        // we special case the base 0 case because 0.0 is in the valid range of the
+        // base but the generic code leads to NaNs.
+        const bool zero = base.value(k) == 0.0;
+        result.setValue(k, zero ? 0.0 : pow_x);
+        df_dx[k] = zero ? 0.0 : pow_x/base.value(k)*exp;
+    }
+
+    // derivatives use the chain rule
+    for (int varIdx = 0; varIdx < numVars; ++varIdx)
+        for (int k = 0; k < width; ++k)
+            result.setDerivative(k, varIdx, base.value(k) == 0.0 ? 0.0 : df_dx[k]*base.derivative(k, varIdx));
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> pow(const std::type_identity_t<ValueType>& base,
+                                               const EvaluationBatch<ValueType, numVars, width>& exp)
+{
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+
+    if (base == 0.0) {
+        // we special case the base 0 case because 0.0 is in the valid range of the
+        // base but the generic code leads to NaNs.
+        return EvaluationBatch<ValueType, numVars, width>(0.0);
+    }
+
+    EvaluationBatch<ValueType, numVars, width> result(exp);
+
+    const ValueType lnBase = ValueTypeToolbox::log(base);
+    for (int k = 0; k < width; ++k)
+        result.setValue(k, ValueTypeToolbox::exp(lnBase*exp.value(k)));
+
+    // derivatives use the chain rule
+    for (int varIdx = 0; varIdx < numVars; ++varIdx)
+        for (int k = 0; k < width; ++k)
+            result.setDerivative(k, varIdx, lnBase*result.value(k)*exp.derivative(k, varIdx));
+
+    return result;
+}
+
+template <class ValueType, int numVars, int width>
+EvaluationBatch<ValueType, numVars, width> pow(const EvaluationBatch<ValueType, numVars, width>& base,
+                                               const EvaluationBatch<ValueType, numVars, width>& exp)
+{
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+
+    EvaluationBatch<ValueType, numVars, width> result(base);
+
+    std::array<ValueType, width> valuePow;
+    std::array<ValueType, width> logF;
+    for (int k = 0; k < width; ++k) {
+        valuePow[k] = ValueTypeToolbox::pow(base.value(k), exp.value(k));
+        logF[k] = ValueTypeToolbox::log(base.value(k));
+        result.setValue(k, base.value(k) == 0.0 ? 0.0 : valuePow[k]);
+    }
+
+    // use the chain rule for the derivatives. since both, the base and the exponent can
+    // potentially depend on the variable set, calculating these is quite elaborate...
+    for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+        for (int k = 0; k < width; ++k) {
+            const ValueType& f = base.value(k);
+            const ValueType& g = exp.value(k);
+            const ValueType& fPrime = base.derivative(k, varIdx);
+            const ValueType& gPrime = exp.derivative(k, varIdx);
+            result.setDerivative(k, varIdx, f == 0.0 ? 0.0 : (g*fPrime/f + logF[k]*gPrime) * valuePow[k]);
+        }
+    }
+
+    return result;
+}
+
+} // namespace DenseAd
+
+// a kind of traits class for batches of evaluations. Functions which need the
+// value of a single evaluation, like value() and scalarValue(), are left out on
+// purpose.
+template <class ValueT, int numVars, int width>
+struct MathToolbox<DenseAd::EvaluationBatch<ValueT, numVars, width> >
+{
+public:
+    typedef ValueT ValueType;
+    typedef MathToolbox<ValueType> InnerToolbox;
+    typedef typename InnerToolbox::Scalar Scalar;
+    typedef DenseAd::EvaluationBatch<ValueType, numVars, width> Evaluation;
+
+    static Evaluation createBlank(const Evaluation& x)
+    { return Evaluation::createBlank(x); }
+
+    static Evaluation createConstantZero(const Evaluation& x)
+    { return Evaluation::createConstantZero(x); }
+
+    static Evaluation createConstantOne(const Evaluation& x)
+    { return Evaluation::createConstantOne(x); }
+
+    static Evaluation createConstant(ValueType value)
+    { return Evaluation::createConstant(value); }
+
+    static Evaluation createConstant(const Evaluation& x, const ValueType value)
+    { return Evaluation::createConstant(x, value); }
+
+    static Evaluation createVariable(ValueType value, int varIdx)
+    { return Evaluation::createVariable(value, varIdx); }
+
+    template <class LhsEval>
+    static typename std::enable_if<std::is_same<Evaluation, LhsEval>::value,
+                                   LhsEval>::type
+    decay(const Evaluation& eval)
+    { return eval; }
+
+    // comparison
+    static bool isSame(const Evaluation& a, const Evaluation& b, Scalar tolerance)
+    {
+        for (int k = 0; k < width; ++k) {
+            if (!MathToolbox<typename Evaluation::LaneEvaluation>::isSame(a.lane(k), b.lane(k), tolerance))
+                return false;
+        }
+
+        return true;
+    }
+
+    // arithmetic functions
+    template <class Arg1Eval, class Arg2Eval>
+    static Evaluation max(const Arg1Eval& arg1, const Arg2Eval& arg2)
+    { return DenseAd::max(arg1, arg2); }
+
+    template <class Arg1Eval, class Arg2Eval>
+    static Evaluation min(const Arg1Eval& arg1, const Arg2Eval& arg2)
+    { return DenseAd::min(arg1, arg2); }
+
+    static Evaluation abs(const Evaluation& arg)
+    { return DenseAd::abs(arg); }
+
+    static Evaluation sqrt(const Evaluation& arg)
+    { return DenseAd::sqrt(arg); }
+
+    static Evaluation exp(const Evaluation& arg)
+    { return DenseAd::exp(arg); }
+
+    static Evaluation log(const Evaluation& arg)
+    { return DenseAd::log(arg); }
+
+    template <class RhsValueType>
+    static Evaluation pow(const Evaluation& arg1, const RhsValueType& arg2)
+    { return DenseAd::pow(arg1, arg2); }
+
+    template <class RhsValueType>
+    static Evaluation pow(const RhsValueType& arg1, const Evaluation& arg2)
+    { return DenseAd::pow(arg1, arg2); }
+
+    static Evaluation pow(const Evaluation& arg1, const Evaluation& arg2)
+    { return DenseAd::pow(arg1, arg2); }
+
+    static bool isfinite(const Evaluation& arg)
+    {
+        for (int k = 0; k < width; ++k) {
+            if (!MathToolbox<typename Evaluation::LaneEvaluation>::isfinite(arg.lane(k)))
+                return false;
+        }
+
+        return true;
+    }
+
+    static bool isnan(const Evaluation& arg)
+    {
+        for (int k = 0; k < width; ++k) {
+            if (MathToolbox<typename Evaluation::LaneEvaluation>::isnan(arg.lane(k)))
+                return true;
+        }
+
+        return false;
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_DENSEAD_EVALUATION_BATCH_HPP
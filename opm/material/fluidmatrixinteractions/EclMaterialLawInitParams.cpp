@@ -30,6 +30,7 @@
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawReadEffectiveParams.hpp>
 #include <opm/material/fluidmatrixinteractions/EclMultiplexerMaterialParams.hpp>
 
+#include <algorithm>
 #include <cassert>
 
 namespace {
@@ -79,17 +80,25 @@ run(const IntLookupFunction& fieldPropIntOnLeafAssigner,
     initSatnumRegionArray_(fieldPropIntOnLeafAssigner);
     copySatnumArrays_(fieldPropIntOnLeafAssigner);
     initOilWaterScaledEpsInfo_();
-    initMaterialLawParamVectors_();
+    const bool compact = initCompactStorage_(lookupIdxOnLevelZeroAssigner);
+    initMaterialLawParamVectors_(compact);
     std::vector<const std::vector<int>*> satnumArray;
     std::vector<const std::vector<int>*> imbnumArray;
     std::vector<std::vector<MaterialLawParams>*> mlpArray;
     initArrays_(satnumArray, imbnumArray, mlpArray);
     const auto num_arrays = mlpArray.size();
     for (unsigned i = 0; i < num_arrays; i++) {
+        const bool compactArray = compact && (i == 0);
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
         for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
+            if (compactArray && params_.hasSharedParams(elemIdx)) {
+                // End-points not scaled and already stored in
+                // oilWaterScaledEpsInfoDrainage by initCompactStorage_().
+                // Region's shared object is set up by initSharedParams_().
+                continue;
+            }
             unsigned satRegionIdx = satRegion_(*satnumArray[i], elemIdx);
             //unsigned satNumCell = this->parent_.satnumRegionArray_[elemIdx];
             HystParams<Traits> hystParams{
@@ -111,9 +120,15 @@ run(const IntLookupFunction& fieldPropIntOnLeafAssigner,
                 hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
             }
             hystParams.finalize();
-            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+            auto& materialParams = compactArray
+                ? params_.compactMaterialLawParams[params_.compactMaterialLawParamsIdx[elemIdx]]
+                : (*mlpArray[i])[elemIdx];
+            initThreePhaseParams_(hystParams, materialParams, satRegionIdx, elemIdx);
         }
     }
+    if (compact) {
+        initSharedParams_(lookupIdxOnLevelZeroAssigner);
+    }
 }
 
 /* private methods alphabetically sorted*/
@@ -185,12 +200,59 @@ initArrays_(std::vector<const std::vector<int>*>& satnumArray,
     }
 }
 
+template <class Traits>
+bool
+InitParams<Traits>::
+initCompactStorage_(const LookupFunction& lookupIdxOnLevelZeroAssigner)
+{
+    // Parameter objects with hysteresis carry per-cell dynamic state and
+    // cannot be shared.
+    if (!this->parent_.compactStorage() || this->parent_.enableHysteresis()) {
+        return false;
+    }
+
+    // The scaled end-points of all cells are needed to decide which cells
+    // may share parameters.  EclEpsScalingPointsInfo holds the end-points
+    // of all two-phase systems, so comparing it covers gas-oil and
+    // gas-water scaling too.  Cells which share parameters are skipped in
+    // run(), so this is also where their end-points are stored.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
+        params_.oilWaterScaledEpsInfoDrainage[elemIdx] =
+            readScaledEpsInfoDrainage_(elemIdx, lookupIdxOnLevelZeroAssigner);
+    }
+
+    // One shared object per saturation region, followed by one object for
+    // each cell whose end-points are scaled.
+    const int numSatRegions = this->eclState_.runspec().tabdims().getNumSatTables();
+    params_.numSharedMaterialLawParams = numSatRegions;
+    params_.compactMaterialLawParamsIdx.resize(this->numCompressedElems_);
+
+    int numParams = numSatRegions;
+    for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
+        const unsigned satRegionIdx = satRegion_(params_.satnumRegionArray, elemIdx);
+        params_.compactMaterialLawParamsIdx[elemIdx] =
+            (params_.oilWaterScaledEpsInfoDrainage[elemIdx] ==
+             this->parent_.unscaledEpsInfo(satRegionIdx))
+            ? static_cast<int>(satRegionIdx)
+            : numParams++;
+    }
+
+    params_.compactMaterialLawParams.resize(numParams);
+    return true;
+}
+
 template <class Traits>
 void
 InitParams<Traits>::
-initMaterialLawParamVectors_()
+initMaterialLawParamVectors_(const bool compact)
 {
-    params_.materialLawParams.resize(this->numCompressedElems_);
+    // Compact storage holds all objects of the cells' own parameters.
+    if (!compact) {
+        params_.materialLawParams.resize(this->numCompressedElems_);
+    }
     if (this->params_.hasDirectionalImbnum() || this->params_.hasDirectionalRelperms()) {
         params_.dirMaterialLawParams
             = std::make_unique<DirectionalMaterialLawParams<MaterialLawParams>>(this->numCompressedElems_);
@@ -223,6 +285,49 @@ initSatnumRegionArray_(const IntLookupFunction& fieldPropIntOnLeafAssigner)
     }
 }
 
+template <class Traits>
+void
+InitParams<Traits>::
+initSharedParams_(const LookupFunction& lookupIdxOnLevelZeroAssigner)
+{
+    // Build each region's shared object from the first cell which uses it.
+    // All such cells have identical, unscaled, end-points.
+    std::vector<int> firstElem(params_.numSharedMaterialLawParams, -1);
+    for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
+        if (!params_.hasSharedParams(elemIdx)) {
+            continue;
+        }
+
+        const int satRegionIdx = params_.compactMaterialLawParamsIdx[elemIdx];
+        if (firstElem[satRegionIdx] < 0) {
+            firstElem[satRegionIdx] = elemIdx;
+        }
+    }
+
+    for (unsigned satRegionIdx = 0; satRegionIdx < firstElem.size(); ++satRegionIdx) {
+        if (firstElem[satRegionIdx] < 0) {
+            continue;
+        }
+
+        const unsigned elemIdx = firstElem[satRegionIdx];
+        HystParams<Traits> hystParams{
+            params_,
+            epsGridProperties_,
+            epsImbGridProperties_.get(),
+            this->eclState_,
+            this->parent_
+        };
+
+        hystParams.setConfig(satRegionIdx);
+        hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+        hystParams.setDrainageParamsOilWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+        hystParams.setDrainageParamsGasWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+        hystParams.finalize();
+        initThreePhaseParams_(hystParams, params_.compactMaterialLawParams[satRegionIdx],
+                              satRegionIdx, elemIdx);
+    }
+}
+
 template <class Traits>
 void
 InitParams<Traits>::
@@ -303,6 +408,21 @@ readEffectiveParameters_()
     effectiveReader.read();
 }
 
+template <class Traits>
+EclEpsScalingPointsInfo<typename Traits::Scalar>
+InitParams<Traits>::
+readScaledEpsInfoDrainage_(unsigned elemIdx,
+                           const LookupFunction& lookupIdxOnLevelZeroAssigner) const
+{
+    // Same as the end-points HystParams<>::setDrainageParamsOilWater()
+    // stores for the cell.
+    const auto lookupIdx = lookupIdxOnLevelZeroAssigner(elemIdx);
+    const unsigned satRegionIdx = this->epsGridProperties_.satRegion(lookupIdx);
+    EclEpsScalingPointsInfo<Scalar> info(this->parent_.unscaledEpsInfo(satRegionIdx));
+    info.extractScaled(this->eclState_, this->epsGridProperties_, lookupIdx);
+    return info;
+}
+
 template <class Traits>
 void
 InitParams<Traits>::
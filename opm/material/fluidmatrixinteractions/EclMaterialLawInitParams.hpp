@@ -88,7 +88,9 @@ private:
                      std::vector<const std::vector<int>*>& imbnumArray,
                      std::vector<std::vector<MaterialLawParams>*>& mlpArray);
 
-    void initMaterialLawParamVectors_();
+    bool initCompactStorage_(const LookupFunction& lookupIdxOnLevelZeroAssigner);
+
+    void initMaterialLawParamVectors_(const bool compact);
 
     void initOilWaterScaledEpsInfo_();
 
@@ -96,6 +98,8 @@ private:
     // field properties of cells on the leaf grid view for CpGrid with local grid refinement.
     void initSatnumRegionArray_(const IntLookupFunction& fieldPropIntOnLeafAssigner);
 
+    void initSharedParams_(const LookupFunction& lookupIdxOnLevelZeroAssigner);
+
     void initThreePhaseParams_(HystParams<Traits>& hystParams,
                                MaterialLawParams& materialParams,
                                unsigned satRegionIdx,
@@ -103,6 +107,10 @@ private:
 
     void readEffectiveParameters_();
 
+    EclEpsScalingPointsInfo<Scalar>
+    readScaledEpsInfoDrainage_(unsigned elemIdx,
+                               const LookupFunction& lookupIdxOnLevelZeroAssigner) const;
+
     void readUnscaledEpsPointsVectors_();
 
     template <class Container>
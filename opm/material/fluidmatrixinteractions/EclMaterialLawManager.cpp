@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 
 namespace Opm::EclMaterialLaw {
 
@@ -166,7 +167,7 @@ applySwatinit(unsigned elemIdx,
     fs.setSaturation(TraitsT::gasPhaseIdx, 0);
     fs.setSaturation(TraitsT::nonWettingPhaseIdx, 0);
     std::array<Scalar, numPhases> pc = { 0 };
-    MaterialLaw::capillaryPressures(pc, materialLawParams(elemIdx), fs);
+    MaterialLaw::capillaryPressures(pc, params_.cellParams(elemIdx), fs);
     Scalar pcowAtSw = pc[oilPhaseIdx] - pc[waterPhaseIdx];
     constexpr const Scalar pcowAtSwThreshold = 1.0e-6; //Pascal
 
@@ -245,7 +246,7 @@ const typename Manager<TraitsT>::MaterialLawParams&
 Manager<TraitsT>::
 connectionMaterialLawParams(unsigned satRegionIdx, unsigned elemIdx) const
 {
-    MaterialLawParams& mlp = const_cast<MaterialLawParams&>(params_.materialLawParams[elemIdx]);
+    MaterialLawParams& mlp = const_cast<Manager&>(*this).mutableMaterialLawParams(elemIdx);
 
     if (enableHysteresis())
         OpmLog::warning("Warning: Using non-default satnum regions for connection is not tested in combination with hysteresis");
@@ -434,7 +435,7 @@ EclEpsScalingPoints<typename TraitsT::Scalar>&
 Manager<TraitsT>::
 oilWaterScaledEpsPointsDrainage(unsigned elemIdx)
 {
-    auto& materialParams = params_.materialLawParams[elemIdx];
+    auto& materialParams = mutableMaterialLawParams(elemIdx);
     switch (materialParams.approach()) {
     case EclMultiplexerApproach::Stone1: {
         auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone1>();
@@ -482,10 +483,88 @@ materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const
         }
     }
     else {
-        return params_.materialLawParams[elemIdx];
+        return params_.cellParams(elemIdx);
     }
 }
 
+namespace
+{
+template <class ParamsT>
+std::shared_ptr<ParamsT> copyTwoPhaseParams(const ParamsT& params)
+{
+    return std::make_shared<ParamsT>(params);
+}
+} // anon namespace
+
+template<class TraitsT>
+typename Manager<TraitsT>::MaterialLawParams&
+Manager<TraitsT>::
+mutableMaterialLawParams(unsigned elemIdx)
+{
+    assert(elemIdx <  params_.satnumRegionArray.size());
+    if (!params_.hasSharedParams(elemIdx)) {
+        return const_cast<MaterialLawParams&>(params_.cellParams(elemIdx));
+    }
+
+    // The shared object only holds pointers to its two-phase parameters,
+    // so copy those explicitly to make the cell's end-points independent.
+    auto& dest = params_.compactMaterialLawParams.emplace_back();
+    const auto& src = params_.cellParams(elemIdx);
+    dest.setApproach(src.approach());
+    switch (src.approach()) {
+    case EclMultiplexerApproach::Stone1: {
+        const auto& srcParams = src.template getRealParams<EclMultiplexerApproach::Stone1>();
+        auto& realParams = dest.template getRealParams<EclMultiplexerApproach::Stone1>();
+        realParams.setGasOilParams(copyTwoPhaseParams(srcParams.gasOilParams()));
+        realParams.setOilWaterParams(copyTwoPhaseParams(srcParams.oilWaterParams()));
+        realParams.setSwl(srcParams.Swl());
+        realParams.setEta(srcParams.eta());
+        realParams.finalize();
+        break;
+    }
+
+    case EclMultiplexerApproach::Stone2: {
+        const auto& srcParams = src.template getRealParams<EclMultiplexerApproach::Stone2>();
+        auto& realParams = dest.template getRealParams<EclMultiplexerApproach::Stone2>();
+        realParams.setGasOilParams(copyTwoPhaseParams(srcParams.gasOilParams()));
+        realParams.setOilWaterParams(copyTwoPhaseParams(srcParams.oilWaterParams()));
+        realParams.setSwl(srcParams.Swl());
+        realParams.finalize();
+        break;
+    }
+
+    case EclMultiplexerApproach::Default: {
+        const auto& srcParams = src.template getRealParams<EclMultiplexerApproach::Default>();
+        auto& realParams = dest.template getRealParams<EclMultiplexerApproach::Default>();
+        realParams.setGasOilParams(copyTwoPhaseParams(srcParams.gasOilParams()));
+        realParams.setOilWaterParams(copyTwoPhaseParams(srcParams.oilWaterParams()));
+        realParams.setSwl(srcParams.Swl());
+        realParams.finalize();
+        break;
+    }
+
+    case EclMultiplexerApproach::TwoPhase: {
+        const auto& srcParams = src.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+        auto& realParams = dest.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+        realParams.setGasOilParams(copyTwoPhaseParams(srcParams.gasOilParams()));
+        realParams.setOilWaterParams(copyTwoPhaseParams(srcParams.oilWaterParams()));
+        realParams.setGasWaterParams(copyTwoPhaseParams(srcParams.gasWaterParams()));
+        realParams.setApproach(srcParams.approach());
+        realParams.finalize();
+        break;
+    }
+
+    case EclMultiplexerApproach::OnePhase:
+        // Nothing to do, no parameters.
+        break;
+    }
+
+    params_.compactMaterialLawParamsIdx[elemIdx] =
+        static_cast<int>(params_.compactMaterialLawParams.size()) - 1;
+
+    return dest;
+}
+
 template<class TraitsT>
 void
 Manager<TraitsT>::
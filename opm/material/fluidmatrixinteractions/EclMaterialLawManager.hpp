@@ -42,6 +42,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -121,9 +122,34 @@ public:
         std::vector<int> satnumRegionArray{};
         std::vector<int> imbnumRegionArray{};
         std::vector<MaterialLawParams> materialLawParams{};
+        // Compact storage, used instead of materialLawParams: one object
+        // per saturation region, shared by all cells of that region whose
+        // end-points are not scaled, followed by the objects of cells with
+        // parameters of their own.  A deque, since references must remain
+        // valid when cells get objects of their own.  Each cell's index
+        // into that container.
+        std::deque<MaterialLawParams> compactMaterialLawParams{};
+        std::vector<int> compactMaterialLawParamsIdx{};
+        int numSharedMaterialLawParams{0};
         DirectionalMaterialLawParamsPtr dirMaterialLawParams{};
         bool onlyPiecewiseLinear = true;
 
+        bool hasCompactStorage() const
+        { return !compactMaterialLawParamsIdx.empty(); }
+
+        bool hasSharedParams(unsigned elemIdx) const
+        {
+            return hasCompactStorage() &&
+                   (compactMaterialLawParamsIdx[elemIdx] < numSharedMaterialLawParams);
+        }
+
+        const MaterialLawParams& cellParams(unsigned elemIdx) const
+        {
+            return hasCompactStorage()
+                ? compactMaterialLawParams[compactMaterialLawParamsIdx[elemIdx]]
+                : materialLawParams[elemIdx];
+        }
+
         bool hasDirectionalRelperms() const
         {
             return !krnumXArray.empty() ||
@@ -141,6 +167,27 @@ public:
 
     void initFromState(const EclipseState& eclState);
 
+    /// Enable or disable compact storage of per-cell parameters.
+    ///
+    /// In compact mode, all cells of a saturation region whose
+    /// end-points are not scaled share a single material law parameter
+    /// object, and no per-cell object is allocated for them.  A cell gets
+    /// an object of its own only if its end-points are subsequently
+    /// modified, e.g., by applySwatinit() or through the non-const
+    /// parameter accessors.  Compact storage is not used in runs with
+    /// hysteresis, since those have dynamic per-cell state.  Cells with
+    /// objects of their own store their scaling points inside their
+    /// two-phase parameter objects as before.
+    ///
+    /// Must be called before initParamsForElements().
+    ///
+    /// \param[in] enable Whether or not to use compact storage.
+    void setCompactStorage(const bool enable)
+    { compactStorage_ = enable; }
+
+    bool compactStorage() const
+    { return compactStorage_; }
+
     // \brief Function argument 'fieldPropIntOnLeadAssigner' needed to lookup
     //        field properties of cells on the leaf grid view for CpGrid with local grid refinement.
     //        Function argument 'lookupIdxOnLevelZeroAssigner' is added to lookup, for each
@@ -219,23 +266,36 @@ public:
     const EclEpsConfig& oilWaterConfig() const
     { return oilWaterConfig_; }
 
+    // Note: In compact storage mode, the non-const overloads give the cell
+    // its own copy of a shared parameter object, like
+    // mutableMaterialLawParams().  Use the const overloads for read-only
+    // access to keep the objects shared.
     MaterialLawParams& materialLawParams(unsigned elemIdx)
-    {
-        assert(elemIdx <  params_.materialLawParams.size());
-        return params_.materialLawParams[elemIdx];
-    }
+    { return mutableMaterialLawParams(elemIdx); }
 
     const MaterialLawParams& materialLawParams(unsigned elemIdx) const
     {
-        assert(elemIdx <  params_.materialLawParams.size());
-        return params_.materialLawParams[elemIdx];
+        assert(elemIdx <  params_.satnumRegionArray.size());
+        return params_.cellParams(elemIdx);
     }
 
     const MaterialLawParams& materialLawParams(unsigned elemIdx, FaceDir::DirEnum facedir) const
     { return materialLawParamsFunc_(elemIdx, facedir); }
 
     MaterialLawParams& materialLawParams(unsigned elemIdx, FaceDir::DirEnum facedir)
-    { return const_cast<MaterialLawParams&>(materialLawParamsFunc_(elemIdx, facedir)); }
+    {
+        // Directional parameter objects are never shared.
+        return params_.dirMaterialLawParams
+            ? const_cast<MaterialLawParams&>(materialLawParamsFunc_(elemIdx, facedir))
+            : mutableMaterialLawParams(elemIdx);
+    }
+
+    /// Parameter object of a single cell, for modification.
+    ///
+    /// In compact storage mode, gives the cell its own copy of the
+    /// parameter object first if the cell shares one with other cells of
+    /// its saturation region.  Otherwise same as materialLawParams().
+    MaterialLawParams& mutableMaterialLawParams(unsigned elemIdx);
 
     /*!
      * \brief Returns a material parameter object for a given element and saturation region.
@@ -322,6 +382,11 @@ public:
         // Only dynamic state in the parameters need to be stored.
         // For that reason we do not serialize the vector
         // as that would recreate the objects inside.
+        // Compact storage is only used without hysteresis, in which
+        // case the parameters hold no dynamic state.
+        if (params_.hasCompactStorage()) {
+            return;
+        }
         for (auto& mat : params_.materialLawParams) {
             serializer(mat);
         }
@@ -342,6 +407,7 @@ private:
     void readGlobalThreePhaseOptions_(const Runspec& runspec);
 
     bool enableEndPointScaling_{false};
+    bool compactStorage_{false};
     EclHysteresisConfig hysteresisConfig_;
     std::vector<std::shared_ptr<WagHysteresisConfig::WagHysteresisConfigRecord>> wagHystersisConfig_;
 
@@ -34,10 +34,18 @@
 
 #include <opm/common/utility/gpuDecorators.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstddef>
 #include <stdexcept>
 #include <type_traits>
 
+namespace Opm::DenseAd {
+template <class ValueT, int numDerivs, int width>
+class EvaluationBatch;
+}
+
 namespace Opm {
 /*!
  * \ingroup FluidMatrixInteractions
@@ -266,6 +274,61 @@ private:
         return evalDescending_(xValues, yValues, x);
     }
 
+    /*!
+     * \brief Evaluate the curve for a batch of saturations at once.
+     *
+     * Same result as the generic eval_() in each lane, for finite
+     * arguments.  All lanes search for their sampling interval in lock-step,
+     * without branching on the argument, and are then interpolated at once.
+     * Lanes outside the sampling range use a zero slope from the value at
+     * that end of the curve.
+     */
+    template <class ValueT, int numDerivs, int width>
+    static DenseAd::EvaluationBatch<ValueT, numDerivs, width>
+    eval_(const ValueVector& xValues,
+          const ValueVector& yValues,
+          const DenseAd::EvaluationBatch<ValueT, numDerivs, width>& x)
+    {
+        OPM_TIMEFUNCTION_LOCAL(Subsystem::SatProps);
+        using Batch = DenseAd::EvaluationBatch<ValueT, numDerivs, width>;
+
+        assert(xValues.size() > 1); // we need at least two sampling points!
+        const std::size_t n = xValues.size() - 1;
+        const bool ascending = xValues.front() < xValues.back();
+        const typename Batch::Lanes xk = x.values();
+
+        // Same interval as the bisection of findSegmentIndex_() and
+        // findSegmentIndexDescending_() for the lanes inside the sampling
+        // range, i.e., the last sampling point which is less than (greater
+        // than or equal to, if descending) the argument.
+        std::array<std::size_t, width> segIdx{};
+        for (std::size_t len = n + 1; len > 1; len -= len/2) {
+            const std::size_t half = len/2;
+            if (ascending) {
+                for (int k = 0; k < width; ++k)
+                    segIdx[k] += (xValues[segIdx[k] + half] < xk[k]) ? half : 0;
+            }
+            else {
+                for (int k = 0; k < width; ++k)
+                    segIdx[k] += (xValues[segIdx[k] + half] >= xk[k]) ? half : 0;
+            }
+        }
+
+        typename Batch::Lanes x0, y0, m;
+        for (int k = 0; k < width; ++k) {
+            const bool atFront = ascending ? (xk[k] <= xValues.front()) : (xk[k] >= xValues.front());
+            const bool atBack = ascending ? (xk[k] >= xValues.back()) : (xk[k] <= xValues.back());
+            const std::size_t i = std::min(segIdx[k], n - 1);
+
+            const Scalar slope = (yValues[i + 1] - yValues[i])/(xValues[i + 1] - xValues[i]);
+            x0[k] = (atFront || atBack) ? xk[k] : xValues[i];
+            y0[k] = atFront ? yValues.front() : (atBack ? yValues.back() : yValues[i]);
+            m[k] = (atFront || atBack) ? 0.0 : slope;
+        }
+
+        return y0 + (x - x0)*m;
+    }
+
     template <class Evaluation>
     OPM_HOST_DEVICE static Evaluation evalAscending_(const ValueVector& xValues,
                                      const ValueVector& yValues,
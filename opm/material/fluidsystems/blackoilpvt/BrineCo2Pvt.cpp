@@ -31,6 +31,9 @@
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 #include <fmt/format.h>
 
 namespace Opm {
@@ -225,6 +228,72 @@ setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa)
                              static_cast<Scalar>(viscaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, template<class> class Storage>
+Scalar BrineCo2Pvt<Scalar, Storage>::
+tabulateSolubility(Scalar temperatureMin, Scalar temperatureMax,
+                   Scalar pressureMin, Scalar pressureMax,
+                   Scalar tolerance, std::size_t maxSamples)
+{
+    xlCO2Table_ = {};
+    if (!enableDissolution_ || salinity_.empty()) {
+        return 0.0;
+    }
+
+    const auto [salinityMin, salinityMax] = std::minmax_element(salinity_.begin(), salinity_.end());
+    Scalar saltMin = *salinityMin;
+    Scalar saltMax = *salinityMax;
+    if (enableSaltConcentration_) {
+        // The mass fraction of NaCl is limited by halite saturation at
+        // about 0.27.
+        saltMin = 0.0;
+        saltMax = std::max(saltMax, Scalar{0.3});
+    }
+
+    auto moleFraction = [this](Scalar T, Scalar p, Scalar salinity)
+    {
+        Scalar xgH2O;
+        Scalar xlCO2;
+        BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_, T, p, salinity,
+                                                    /*knownPhaseIdx=*/-1,
+                                                    xlCO2, xgH2O,
+                                                    activityModel_, extrapolate);
+        return xlCO2;
+    };
+
+    auto table = UniformTabulated3DFunction<Scalar, Storage>{};
+    const Scalar error = table.sampleAdaptively(moleFraction,
+                                                temperatureMin, temperatureMax,
+                                                pressureMin, pressureMax,
+                                                saltMin, saltMax,
+                                                tolerance, maxSamples);
+
+    if (!std::isfinite(error)) {
+        OpmLog::warning(fmt::format("The CO2 solubility in brine is undefined at some "
+                                    "temperatures and pressures in [{}, {}] K x [{}, {}] Pa. "
+                                    "It is computed from the correlation instead of a table.",
+                                    temperatureMin, temperatureMax, pressureMin, pressureMax));
+        return error;
+    }
+
+    if (error > tolerance) {
+        OpmLog::warning(fmt::format("The CO2 solubility in brine could not be tabulated "
+                                    "with a mole fraction error below {:.3e} on at most "
+                                    "{} points, the estimated error is {:.3e}. "
+                                    "It is computed from the correlation instead of a table.",
+                                    tolerance, maxSamples, error));
+        return error;
+    }
+
+    OpmLog::info(fmt::format("Tabulated CO2 solubility in brine on {}x{}x{} "
+                             "temperature/pressure/salinity points with an "
+                             "estimated maximum mole fraction error of {:.3e}.",
+                             table.numX(), table.numY(), table.numZ(), error));
+
+    xlCO2Table_ = std::move(table);
+
+    return error;
+}
+
 template class BrineCo2Pvt<double>;
 template class BrineCo2Pvt<float>;
 
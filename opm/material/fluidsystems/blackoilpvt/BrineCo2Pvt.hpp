@@ -40,6 +40,7 @@
 #include <opm/material/components/SimpleHuDuanH2O.hpp>
 #include <opm/material/components/CO2.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
+#include <opm/material/common/UniformTabulated3DFunction.hpp>
 #include <opm/material/components/TabulatedComponent.hpp>
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
@@ -189,6 +190,35 @@ public:
 
     void setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa);
 
+    /*!
+     * \brief Tabulate the solubility of CO2 in brine.
+     *
+     * Samples the equilibrium mole fraction of CO2 in brine over the given
+     * temperature and pressure range, and over the salinities of all
+     * regions or, if the salt concentration is variable, over all
+     * salinities up to halite saturation.  The sampling interval is
+     * refined until the error of the interpolation is below \p tolerance.
+     *
+     * Subsequently, the dissolution factor interpolates the table within
+     * the tabulated range and only evaluates the solubility model of
+     * BinaryCoeffBrineCO2 outside of it.  Must be called after the
+     * salinity, salt concentration and activity model settings are
+     * final.
+     *
+     * \param tolerance Maximum absolute error of the CO2 mole fraction.
+     * \param maxSamples Upper limit on the number of sampling points.
+     *
+     * \return Estimated maximum error of the tabulated mole fraction.
+     *         Infinite if the solubility model is undefined somewhere in
+     *         the range.  No table is used if the error is infinite or if
+     *         \p tolerance is not reached within \p maxSamples sampling
+     *         points.
+     */
+    Scalar tabulateSolubility(Scalar temperatureMin, Scalar temperatureMax,
+                              Scalar pressureMin, Scalar pressureMax,
+                              Scalar tolerance = 1.0e-6,
+                              std::size_t maxSamples = std::size_t{1} << 20);
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -572,17 +602,22 @@ public:
 
         // calulate the equilibrium composition for the given
         // temperature and pressure.
-        Evaluation xgH2O;
         Evaluation xlCO2;
-        BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_,
-                                                    temperature,
-                                                    pressure,
-                                                    salinity,
-                                                    /*knownPhaseIdx=*/-1,
-                                                    xlCO2,
-                                                    xgH2O,
-                                                    activityModel_,
-                                                    extrapolate);
+        if (!xlCO2Table_.empty() && xlCO2Table_.applies(temperature, pressure, salinity)) {
+            xlCO2 = xlCO2Table_.eval(temperature, pressure, salinity);
+        }
+        else {
+            Evaluation xgH2O;
+            BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_,
+                                                        temperature,
+                                                        pressure,
+                                                        salinity,
+                                                        /*knownPhaseIdx=*/-1,
+                                                        xlCO2,
+                                                        xgH2O,
+                                                        activityModel_,
+                                                        extrapolate);
+        }
 
         // normalize the phase compositions
         xlCO2 = max(0.0, min(1.0, xlCO2));
@@ -852,6 +887,11 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+
+    // Equilibrium mole fraction of CO2 in brine as a function of
+    // temperature, pressure and salinity.  Empty unless
+    // tabulateSolubility() has been called.
+    UniformTabulated3DFunction<Scalar, Storage> xlCO2Table_{};
 };
 
 } // namespace Opm
@@ -30,6 +30,9 @@
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 #include <fmt/format.h>
 
 namespace Opm {
@@ -132,6 +135,66 @@ setReferenceDensities(unsigned regionIdx,
     h2ReferenceDensity_[regionIdx] = rhoRefH2;
 }
 
+template<class Scalar>
+Scalar BrineH2Pvt<Scalar>::
+tabulateSolubility(Scalar temperatureMin, Scalar temperatureMax,
+                   Scalar pressureMin, Scalar pressureMax,
+                   Scalar tolerance, std::size_t maxSamples)
+{
+    xlH2Table_ = {};
+    if (!enableDissolution_ || salinity_.empty()) {
+        return 0.0;
+    }
+
+    const auto [salinityMin, salinityMax] = std::minmax_element(salinity_.begin(), salinity_.end());
+    Scalar saltMin = *salinityMin;
+    Scalar saltMax = *salinityMax;
+    if (enableSaltConcentration_) {
+        // The mass fraction of NaCl is limited by halite saturation at
+        // about 0.27.
+        saltMin = 0.0;
+        saltMax = std::max(saltMax, Scalar{0.3});
+    }
+
+    auto moleFraction = [](Scalar T, Scalar p, Scalar salinity)
+    {
+        return BinaryCoeffBrineH2::calculateMoleFractions(T, p, salinity, extrapolate);
+    };
+
+    auto table = UniformTabulated3DFunction<Scalar>{};
+    const Scalar error = table.sampleAdaptively(moleFraction,
+                                                temperatureMin, temperatureMax,
+                                                pressureMin, pressureMax,
+                                                saltMin, saltMax,
+                                                tolerance, maxSamples);
+
+    if (!std::isfinite(error)) {
+        OpmLog::warning(fmt::format("The H2 solubility in brine is undefined at some "
+                                    "temperatures and pressures in [{}, {}] K x [{}, {}] Pa. "
+                                    "It is computed from the correlation instead of a table.",
+                                    temperatureMin, temperatureMax, pressureMin, pressureMax));
+        return error;
+    }
+
+    if (error > tolerance) {
+        OpmLog::warning(fmt::format("The H2 solubility in brine could not be tabulated "
+                                    "with a mole fraction error below {:.3e} on at most "
+                                    "{} points, the estimated error is {:.3e}. "
+                                    "It is computed from the correlation instead of a table.",
+                                    tolerance, maxSamples, error));
+        return error;
+    }
+
+    OpmLog::info(fmt::format("Tabulated H2 solubility in brine on {}x{}x{} "
+                             "temperature/pressure/salinity points with an "
+                             "estimated maximum mole fraction error of {:.3e}.",
+                             table.numX(), table.numY(), table.numZ(), error));
+
+    xlH2Table_ = std::move(table);
+
+    return error;
+}
+
 template class BrineH2Pvt<double>;
 template class BrineH2Pvt<float>;
 
@@ -34,6 +34,7 @@ copyright holders.
 #include <opm/material/components/BrineDynamic.hpp>
 #include <opm/material/components/H2.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
+#include <opm/material/common/UniformTabulated3DFunction.hpp>
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/fluidsystems/BlackOilFunctions.hpp>
 
@@ -111,6 +112,30 @@ public:
     void setEnableSaltConcentration(bool yesno)
     { enableSaltConcentration_ = yesno; }
 
+    /*!
+    * \brief Tabulate the solubility of H2 in brine.
+    *
+    * Samples the equilibrium mole fraction of H2 in brine over the given
+    * temperature and pressure range, and over the salinities of all regions
+    * or, if the salt concentration is variable, over all salinities up to
+    * halite saturation.  The sampling interval is refined until the error
+    * of the interpolation is below \p tolerance.  Outside of the tabulated
+    * range the solubility model of BinaryCoeffBrineH2 is still used.
+    *
+    * \param tolerance Maximum absolute error of the H2 mole fraction.
+    * \param maxSamples Upper limit on the number of sampling points.
+    *
+    * \return Estimated maximum error of the tabulated mole fraction.
+    *         Infinite if the solubility model is undefined somewhere in
+    *         the range, e.g. below the vapour pressure of water.  No
+    *         table is used if the error is infinite or if \p tolerance is
+    *         not reached within \p maxSamples sampling points.
+    */
+    Scalar tabulateSolubility(Scalar temperatureMin, Scalar temperatureMax,
+                              Scalar pressureMin, Scalar pressureMax,
+                              Scalar tolerance = 1.0e-7,
+                              std::size_t maxSamples = std::size_t{1} << 20);
+
     /*!
     * \brief Return the number of PVT regions which are considered by this PVT-object.
     */
@@ -602,8 +627,14 @@ private:
             return 0.0;
 
         // calulate the equilibrium composition for the given temperature and pressure
-        LhsEval xlH2 = BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure,
-                                                                  salinity, extrapolate);
+        LhsEval xlH2;
+        if (!xlH2Table_.empty() && xlH2Table_.applies(temperature, pressure, salinity)) {
+            xlH2 = xlH2Table_.eval(temperature, pressure, salinity);
+        }
+        else {
+            xlH2 = BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure,
+                                                              salinity, extrapolate);
+        }
 
         // normalize the phase compositions
         xlH2 = max(0.0, min(1.0, xlH2));
@@ -701,6 +732,11 @@ private:
     std::vector<Scalar> salinity_{};
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
+
+    // Equilibrium mole fraction of H2 in brine as a function of
+    // temperature, pressure and salinity.  Empty unless
+    // tabulateSolubility() has been called.
+    UniformTabulated3DFunction<Scalar> xlH2Table_{};
 };  // end class BrineH2Pvt
 
 }  // end namespace Opm
@@ -30,6 +30,7 @@
 #include <opm/material/common/MathToolbox.hpp>
 
 #include <cstddef>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -204,6 +205,51 @@ public:
         return (1.0 + X * (1.0 + X / 2.0)) / BwRef;
     }
 
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase for a batch
+     *        of cells in the same PVT region.
+     *
+     * Matches the scalar viscosity() for each cell up to rounding.
+     */
+    template <class Evaluation>
+    void viscosity(unsigned regionIdx,
+                   std::span<const Evaluation> /*temperature*/,
+                   std::span<const Evaluation> pressure,
+                   std::span<const Evaluation> /*Rsw*/,
+                   std::span<const Evaluation> /*saltconcentration*/,
+                   std::span<Evaluation> mu) const
+    {
+        Evaluation bw;
+        for (std::size_t k = 0; k < pressure.size(); ++k) {
+            inverseBAndMu(bw, mu[k], regionIdx, pressure[k]);
+        }
+    }
+
+    /*!
+     * \brief Returns the formation volume factor [-] of the fluid phase for a
+     *        batch of cells in the same PVT region.
+     *
+     * Matches the scalar inverseFormationVolumeFactor() for each cell up to
+     * rounding.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(unsigned regionIdx,
+                                      std::span<const Evaluation> /*temperature*/,
+                                      std::span<const Evaluation> pressure,
+                                      std::span<const Evaluation> /*Rsw*/,
+                                      std::span<const Evaluation> /*saltconcentration*/,
+                                      std::span<Evaluation> invB) const
+    {
+        const Scalar pRef = waterReferencePressure_[regionIdx];
+        const Scalar compressibility = waterCompressibility_[regionIdx];
+        const Scalar BwRef = waterReferenceFormationVolumeFactor_[regionIdx];
+
+        for (std::size_t k = 0; k < pressure.size(); ++k) {
+            const Evaluation X = compressibility*(pressure[k] - pRef);
+            invB[k] = (1.0 + X * (1.0 + X / 2.0)) / BwRef;
+        }
+    }
+
     /*!
      * \brief Returns the formation volume factor [-] and viscosity [Pa s] of the fluid phase.
      */
@@ -31,7 +31,10 @@
 
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <span>
 #include <vector>
 
 namespace Opm {
@@ -167,6 +170,55 @@ public:
                                             const Evaluation& /*Rvw*/) const
     { return saturatedInverseFormationVolumeFactor(regionIdx, temperature, pressure); }
 
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase for a batch
+     *        of cells in the same PVT region.
+     *
+     * Matches the scalar viscosity() for each cell up to rounding, with a
+     * single table search for both underlying tables.
+     */
+    template <class Evaluation>
+    void viscosity(unsigned regionIdx,
+                   std::span<const Evaluation> /*temperature*/,
+                   std::span<const Evaluation> pressure,
+                   std::span<const Evaluation> /*Rv*/,
+                   std::span<const Evaluation> /*Rvw*/,
+                   std::span<Evaluation> mu) const
+    {
+        constexpr std::size_t maxBatchSize = TabulatedOneDFunction::maxBatchSize;
+
+        std::array<unsigned, maxBatchSize> segIdx;
+        for (std::size_t start = 0; start < mu.size(); start += maxBatchSize) {
+            const std::size_t n = std::min(maxBatchSize, mu.size() - start);
+            inverseGasB_[regionIdx].findSegmentIndices(pressure.subspan(start, n),
+                                                       std::span<unsigned>{segIdx.data(), n},
+                                                       /*extrapolate=*/true);
+
+            for (std::size_t k = 0; k < n; ++k) {
+                const auto& p = pressure[start + k];
+                const auto& invBg = inverseGasB_[regionIdx].eval(p, SegmentIndex{segIdx[k]});
+                const auto& invMugBg = inverseGasBMu_[regionIdx].eval(p, SegmentIndex{segIdx[k]});
+                mu[start + k] = invBg / invMugBg;
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns the formation volume factor [-] of the fluid phase for a
+     *        batch of cells in the same PVT region.
+     *
+     * Matches the scalar inverseFormationVolumeFactor() for each cell up to
+     * rounding.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(unsigned regionIdx,
+                                      std::span<const Evaluation> /*temperature*/,
+                                      std::span<const Evaluation> pressure,
+                                      std::span<const Evaluation> /*Rv*/,
+                                      std::span<const Evaluation> /*Rvw*/,
+                                      std::span<Evaluation> invB) const
+    { inverseGasB_[regionIdx].eval(pressure, invB, /*extrapolate=*/true); }
+
     /*!
      * \brief Returns the formation volume factor [-] and viscosity [Pa s] of the fluid phase.
      */
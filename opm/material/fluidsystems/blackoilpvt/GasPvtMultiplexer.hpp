@@ -35,7 +35,10 @@
 #include <opm/material/fluidsystems/blackoilpvt/WetGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WetHumidGasPvt.hpp>
 
+#include <cstddef>
 #include <functional>
+#include <span>
+
 namespace Opm {
 
 class EclipseState;
@@ -202,6 +205,32 @@ public:
                                             const Evaluation& Rvw) const
     { OPM_GAS_PVT_MULTIPLEXER_CALL(return pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rv, Rvw)); }
 
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase for a batch
+     *        of cells in the same PVT region.
+     */
+    template <class Evaluation>
+    void viscosity(unsigned regionIdx,
+                   std::span<const Evaluation> temperature,
+                   std::span<const Evaluation> pressure,
+                   std::span<const Evaluation> Rv,
+                   std::span<const Evaluation> Rvw,
+                   std::span<Evaluation> mu) const
+    { OPM_GAS_PVT_MULTIPLEXER_CALL(batchViscosity_(pvtImpl, regionIdx, temperature, pressure, Rv, Rvw, mu), break); }
+
+    /*!
+     * \brief Returns the formation volume factor [-] of the fluid phase for a
+     *        batch of cells in the same PVT region.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(unsigned regionIdx,
+                                      std::span<const Evaluation> temperature,
+                                      std::span<const Evaluation> pressure,
+                                      std::span<const Evaluation> Rv,
+                                      std::span<const Evaluation> Rvw,
+                                      std::span<Evaluation> invB) const
+    { OPM_GAS_PVT_MULTIPLEXER_CALL(batchInverseFormationVolumeFactor_(pvtImpl, regionIdx, temperature, pressure, Rv, Rvw, invB), break); }
+
     /*!
      * \brief Returns the formation volume factor [-] and viscosity [Pa s] of the fluid phase.
      */
@@ -399,6 +428,46 @@ public:
     operator=(const GasPvtMultiplexer<Scalar,enableThermal>& data);
 
 private:
+    // Use the implementation's batched evaluation if it has one, and
+    // evaluate cell by cell otherwise.
+    template <class PvtImpl, class Evaluation>
+    static void batchViscosity_(const PvtImpl& pvtImpl,
+                                unsigned regionIdx,
+                                std::span<const Evaluation> temperature,
+                                std::span<const Evaluation> pressure,
+                                std::span<const Evaluation> Rv,
+                                std::span<const Evaluation> Rvw,
+                                std::span<Evaluation> mu)
+    {
+        if constexpr (requires { pvtImpl.viscosity(regionIdx, temperature, pressure, Rv, Rvw, mu); }) {
+            pvtImpl.viscosity(regionIdx, temperature, pressure, Rv, Rvw, mu);
+        }
+        else {
+            for (std::size_t k = 0; k < mu.size(); ++k) {
+                mu[k] = pvtImpl.viscosity(regionIdx, temperature[k], pressure[k], Rv[k], Rvw[k]);
+            }
+        }
+    }
+
+    template <class PvtImpl, class Evaluation>
+    static void batchInverseFormationVolumeFactor_(const PvtImpl& pvtImpl,
+                                                   unsigned regionIdx,
+                                                   std::span<const Evaluation> temperature,
+                                                   std::span<const Evaluation> pressure,
+                                                   std::span<const Evaluation> Rv,
+                                                   std::span<const Evaluation> Rvw,
+                                                   std::span<Evaluation> invB)
+    {
+        if constexpr (requires { pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rv, Rvw, invB); }) {
+            pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rv, Rvw, invB);
+        }
+        else {
+            for (std::size_t k = 0; k < invB.size(); ++k) {
+                invB[k] = pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature[k], pressure[k], Rv[k], Rvw[k]);
+            }
+        }
+    }
+
     using UniqueVoidPtrWithDeleter = std::unique_ptr<void, std::function<void(void*)>>;
 
     template <class ConcreteGasPvt> UniqueVoidPtrWithDeleter makeGasPvt();
@@ -35,6 +35,9 @@
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtThermal.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantRsDeadOilPvt.hpp>
 
+#include <cstddef>
+#include <span>
+
 namespace Opm {
 
 class EclipseState;
@@ -199,6 +202,30 @@ public:
                                             const Evaluation& Rs) const
     { OPM_OIL_PVT_MULTIPLEXER_CALL(return pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rs)); }
 
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase for a batch
+     *        of cells in the same PVT region.
+     */
+    template <class Evaluation>
+    void viscosity(unsigned regionIdx,
+                   std::span<const Evaluation> temperature,
+                   std::span<const Evaluation> pressure,
+                   std::span<const Evaluation> Rs,
+                   std::span<Evaluation> mu) const
+    { OPM_OIL_PVT_MULTIPLEXER_CALL(batchViscosity_(pvtImpl, regionIdx, temperature, pressure, Rs, mu), break); }
+
+    /*!
+     * \brief Returns the formation volume factor [-] of the fluid phase for a
+     *        batch of cells in the same PVT region.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(unsigned regionIdx,
+                                      std::span<const Evaluation> temperature,
+                                      std::span<const Evaluation> pressure,
+                                      std::span<const Evaluation> Rs,
+                                      std::span<Evaluation> invB) const
+    { OPM_OIL_PVT_MULTIPLEXER_CALL(batchInverseFormationVolumeFactor_(pvtImpl, regionIdx, temperature, pressure, Rs, invB), break); }
+
     /*!
      * \brief Returns the formation volume factor [-] and viscosity [Pa s] of the fluid phase.
      */
@@ -375,6 +402,44 @@ public:
     operator=(const OilPvtMultiplexer<Scalar,enableThermal>& data);
 
 private:
+    // Use the implementation's batched evaluation if it has one, and
+    // evaluate cell by cell otherwise.
+    template <class PvtImpl, class Evaluation>
+    static void batchViscosity_(const PvtImpl& pvtImpl,
+                                unsigned regionIdx,
+                                std::span<const Evaluation> temperature,
+                                std::span<const Evaluation> pressure,
+                                std::span<const Evaluation> Rs,
+                                std::span<Evaluation> mu)
+    {
+        if constexpr (requires { pvtImpl.viscosity(regionIdx, temperature, pressure, Rs, mu); }) {
+            pvtImpl.viscosity(regionIdx, temperature, pressure, Rs, mu);
+        }
+        else {
+            for (std::size_t k = 0; k < mu.size(); ++k) {
+                mu[k] = pvtImpl.viscosity(regionIdx, temperature[k], pressure[k], Rs[k]);
+            }
+        }
+    }
+
+    template <class PvtImpl, class Evaluation>
+    static void batchInverseFormationVolumeFactor_(const PvtImpl& pvtImpl,
+                                                   unsigned regionIdx,
+                                                   std::span<const Evaluation> temperature,
+                                                   std::span<const Evaluation> pressure,
+                                                   std::span<const Evaluation> Rs,
+                                                   std::span<Evaluation> invB)
+    {
+        if constexpr (requires { pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rs, invB); }) {
+            pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rs, invB);
+        }
+        else {
+            for (std::size_t k = 0; k < invB.size(); ++k) {
+                invB[k] = pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature[k], pressure[k], Rs[k]);
+            }
+        }
+    }
+
     OilPvtApproach approach_{OilPvtApproach::NoOil};
     void* realOilPvt_{nullptr};
 };
@@ -33,6 +33,9 @@
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp>
 
+#include <cstddef>
+#include <span>
+
 #define OPM_WATER_PVT_MULTIPLEXER_CALL(codeToCall, ...)                                \
     switch (approach_) {                                                               \
     case WaterPvtApproach::ConstantCompressibilityWater: {                             \
@@ -187,6 +190,32 @@ public:
         OPM_WATER_PVT_MULTIPLEXER_CALL(return pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rsw, saltconcentration));
     }
 
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase for a batch
+     *        of cells in the same PVT region.
+     */
+    template <class Evaluation>
+    void viscosity(unsigned regionIdx,
+                   std::span<const Evaluation> temperature,
+                   std::span<const Evaluation> pressure,
+                   std::span<const Evaluation> Rsw,
+                   std::span<const Evaluation> saltconcentration,
+                   std::span<Evaluation> mu) const
+    { OPM_WATER_PVT_MULTIPLEXER_CALL(batchViscosity_(pvtImpl, regionIdx, temperature, pressure, Rsw, saltconcentration, mu), break); }
+
+    /*!
+     * \brief Returns the formation volume factor [-] of the fluid phase for a
+     *        batch of cells in the same PVT region.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(unsigned regionIdx,
+                                      std::span<const Evaluation> temperature,
+                                      std::span<const Evaluation> pressure,
+                                      std::span<const Evaluation> Rsw,
+                                      std::span<const Evaluation> saltconcentration,
+                                      std::span<Evaluation> invB) const
+    { OPM_WATER_PVT_MULTIPLEXER_CALL(batchInverseFormationVolumeFactor_(pvtImpl, regionIdx, temperature, pressure, Rsw, saltconcentration, invB), break); }
+
     /*!
      * \brief Returns the formation volume factor [-] and viscosity [Pa s] of the fluid phase.
      */
@@ -332,6 +361,46 @@ public:
     operator=(const WaterPvtMultiplexer<Scalar,enableThermal,enableBrine>& data);
 
 private:
+    // Use the implementation's batched evaluation if it has one, and
+    // evaluate cell by cell otherwise.
+    template <class PvtImpl, class Evaluation>
+    static void batchViscosity_(const PvtImpl& pvtImpl,
+                                unsigned regionIdx,
+                                std::span<const Evaluation> temperature,
+                                std::span<const Evaluation> pressure,
+                                std::span<const Evaluation> Rsw,
+                                std::span<const Evaluation> saltconcentration,
+                                std::span<Evaluation> mu)
+    {
+        if constexpr (requires { pvtImpl.viscosity(regionIdx, temperature, pressure, Rsw, saltconcentration, mu); }) {
+            pvtImpl.viscosity(regionIdx, temperature, pressure, Rsw, saltconcentration, mu);
+        }
+        else {
+            for (std::size_t k = 0; k < mu.size(); ++k) {
+                mu[k] = pvtImpl.viscosity(regionIdx, temperature[k], pressure[k], Rsw[k], saltconcentration[k]);
+            }
+        }
+    }
+
+    template <class PvtImpl, class Evaluation>
+    static void batchInverseFormationVolumeFactor_(const PvtImpl& pvtImpl,
+                                                   unsigned regionIdx,
+                                                   std::span<const Evaluation> temperature,
+                                                   std::span<const Evaluation> pressure,
+                                                   std::span<const Evaluation> Rsw,
+                                                   std::span<const Evaluation> saltconcentration,
+                                                   std::span<Evaluation> invB)
+    {
+        if constexpr (requires { pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rsw, saltconcentration, invB); }) {
+            pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rsw, saltconcentration, invB);
+        }
+        else {
+            for (std::size_t k = 0; k < invB.size(); ++k) {
+                invB[k] = pvtImpl.inverseFormationVolumeFactor(regionIdx, temperature[k], pressure[k], Rsw[k], saltconcentration[k]);
+            }
+        }
+    }
+
     WaterPvtApproach approach_{WaterPvtApproach::NoWater};
     void* realWaterPvt_{nullptr};
 };
@@ -34,7 +34,10 @@
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <span>
 
 namespace Opm {
 
@@ -212,6 +215,57 @@ public:
                                             const Evaluation& /*Rvw*/) const
     { return inverseGasB_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true); }
 
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase for a batch
+     *        of cells in the same PVT region.
+     *
+     * Matches the scalar viscosity() for each cell up to rounding, with a
+     * single table search for both underlying tables.
+     */
+    template <class Evaluation>
+    void viscosity(unsigned regionIdx,
+                   std::span<const Evaluation> /*temperature*/,
+                   std::span<const Evaluation> pressure,
+                   std::span<const Evaluation> Rv,
+                   std::span<const Evaluation> /*Rvw*/,
+                   std::span<Evaluation> mu) const
+    {
+        constexpr std::size_t maxBatchSize = TabulatedTwoDFunction::maxBatchSize;
+
+        typename TabulatedTwoDFunction::template BatchPoints<Evaluation> points;
+        std::array<Evaluation, maxBatchSize> invMugBg;
+        for (std::size_t start = 0; start < mu.size(); start += maxBatchSize) {
+            const std::size_t n = std::min(maxBatchSize, mu.size() - start);
+            const auto muBatch = mu.subspan(start, n);
+
+            inverseGasB_[regionIdx].findPoints(points, pressure.subspan(start, n),
+                                               Rv.subspan(start, n),
+                                               /*extrapolate=*/true);
+            inverseGasB_[regionIdx].eval(points, muBatch);
+            inverseGasBMu_[regionIdx].eval(points, std::span<Evaluation>{invMugBg.data(), n});
+
+            for (std::size_t k = 0; k < n; ++k) {
+                muBatch[k] /= invMugBg[k];
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns the formation volume factor [-] of the fluid phase for a
+     *        batch of cells in the same PVT region.
+     *
+     * Matches the scalar inverseFormationVolumeFactor() for each cell up to
+     * rounding.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(unsigned regionIdx,
+                                      std::span<const Evaluation> /*temperature*/,
+                                      std::span<const Evaluation> pressure,
+                                      std::span<const Evaluation> Rv,
+                                      std::span<const Evaluation> /*Rvw*/,
+                                      std::span<Evaluation> invB) const
+    { inverseGasB_[regionIdx].eval(pressure, Rv, invB, /*extrapolate=*/true); }
+
     /*!
      * \brief Returns the formation volume factor [-] and viscosity [Pa s] of the fluid phase.
      */
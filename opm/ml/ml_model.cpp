@@ -34,6 +34,7 @@
 #include <cstddef>
 #include <fstream>
 #include <numeric>
+#include <type_traits>
 
 #include <fmt/format.h>
 
@@ -51,6 +52,55 @@ namespace {
         file.read(reinterpret_cast<char*>(data), sizeof(T) * n);
         return !file.fail();
     }
+
+    // out += in * weights for row-major matrices in (m x k), weights (k x n)
+    // and out (m x n).  Blocks of rows share each row of weights, and blocks
+    // of columns keep the touched part of out in cache.
+    template <typename Scalar>
+    void multiplyAdd(const Scalar* in, const Scalar* weights, Scalar* out,
+                     const std::size_t m, const std::size_t k, const std::size_t n)
+    {
+        constexpr std::size_t rowBlock = 4;
+        constexpr std::size_t colBlock = 256;
+
+        for (std::size_t j0 = 0; j0 < n; j0 += colBlock) {
+            const std::size_t j1 = std::min(n, j0 + colBlock);
+
+            std::size_t r = 0;
+            for (; r + rowBlock <= m; r += rowBlock) {
+                Scalar* o0 = out + (r + 0)*n;
+                Scalar* o1 = out + (r + 1)*n;
+                Scalar* o2 = out + (r + 2)*n;
+                Scalar* o3 = out + (r + 3)*n;
+
+                for (std::size_t i = 0; i < k; ++i) {
+                    const Scalar a0 = in[(r + 0)*k + i];
+                    const Scalar a1 = in[(r + 1)*k + i];
+                    const Scalar a2 = in[(r + 2)*k + i];
+                    const Scalar a3 = in[(r + 3)*k + i];
+                    const Scalar* w = weights + i*n;
+
+                    for (std::size_t j = j0; j < j1; ++j) {
+                        o0[j] += a0*w[j];
+                        o1[j] += a1*w[j];
+                        o2[j] += a2*w[j];
+                        o3[j] += a3*w[j];
+                    }
+                }
+            }
+
+            for (; r < m; ++r) {
+                Scalar* o = out + r*n;
+                for (std::size_t i = 0; i < k; ++i) {
+                    const Scalar a = in[r*k + i];
+                    const Scalar* w = weights + i*n;
+                    for (std::size_t j = j0; j < j1; ++j) {
+                        o[j] += a*w[j];
+                    }
+                }
+            }
+        }
+    }
 }
 
 namespace Opm::ML
@@ -510,9 +560,23 @@ namespace Opm::ML
 
         OPM_ERROR_IF(!activation_.loadLayer(file), "Failed to load activation");
 
+        convertWeights_();
+
         return true;
     }
 
+    template <class Evaluation>
+    void NNLayerDense<Evaluation>::convertWeights_()
+    {
+        using Scalar = typename MathToolbox<Evaluation>::Scalar;
+        static_assert(std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>,
+                      "Batched dense layers support float and double based evaluations");
+
+        if constexpr (std::is_same_v<Scalar, double>) {
+            doubleWeights_.assign(weights_.data_.begin(), weights_.data_.end());
+        }
+    }
+
     template <class Evaluation>
     bool NNLayerDense<Evaluation>::apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
     {
@@ -533,6 +597,78 @@ namespace Opm::ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNLayerDense<Evaluation>::applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    {
+        using Scalar = typename MathToolbox<Evaluation>::Scalar;
+
+        const std::size_t numIn = weights_.dims_[0];
+        const std::size_t numOut = weights_.dims_[1];
+        OPM_ERROR_IF(in.dims_.size() != 2 || in.dims_[1] != weights_.dims_[0],
+                     fmt::format("\n Invalid batch shape for dense layer with "
+                                 "{} inputs", numIn));
+
+        const std::size_t numRows = in.dims_[0];
+        out.resizeI(std::vector{in.dims_[0], weights_.dims_[1]});
+
+        const Scalar* weights = nullptr;
+        if constexpr (std::is_same_v<Scalar, float>) {
+            weights = weights_.data_.data();
+        }
+        else {
+            weights = doubleWeights_.data();
+        }
+
+        if constexpr (std::is_floating_point_v<Evaluation>) {
+            for (std::size_t r = 0; r < numRows; ++r) {
+                std::copy(biases_.data_.begin(), biases_.data_.end(),
+                          out.data_.begin() + r*numOut);
+            }
+
+            multiplyAdd(in.data_.data(), weights, out.data_.data(),
+                        numRows, numIn, numOut);
+        }
+        else {
+            // Row r*numCols of the scalar matrices holds the values of row r
+            // of the batch, and the following rows hold its derivatives.
+            constexpr std::size_t numCols = Evaluation::numVars + 1;
+
+            std::vector<Scalar> packedIn(numRows*numCols*numIn);
+            std::vector<Scalar> packedOut(numRows*numCols*numOut, 0.0);
+            for (std::size_t r = 0; r < numRows; ++r) {
+                const Evaluation* x = in.data_.data() + r*numIn;
+                Scalar* value = packedIn.data() + r*numCols*numIn;
+                for (std::size_t i = 0; i < numIn; ++i) {
+                    value[i] = x[i].value();
+                    for (std::size_t d = 1; d < numCols; ++d) {
+                        value[d*numIn + i] = x[i].derivative(d - 1);
+                    }
+                }
+
+                std::copy(biases_.data_.begin(), biases_.data_.end(),
+                          packedOut.begin() + r*numCols*numOut);
+            }
+
+            multiplyAdd(packedIn.data(), weights, packedOut.data(),
+                        numRows*numCols, numIn, numOut);
+
+            for (std::size_t r = 0; r < numRows; ++r) {
+                Evaluation* y = out.data_.data() + r*numOut;
+                const Scalar* value = packedOut.data() + r*numCols*numOut;
+                for (std::size_t j = 0; j < numOut; ++j) {
+                    y[j].setValue(value[j]);
+                    for (std::size_t d = 1; d < numCols; ++d) {
+                        y[j].setDerivative(d - 1, value[d*numOut + j]);
+                    }
+                }
+            }
+        }
+
+        OPM_ERROR_IF(!activation_.apply(out, out), "Failed to apply activation");
+
+        return true;
+    }
+
     template <class Evaluation>
     bool NNModel<Evaluation>::loadModel(const std::string& filename)
     {
@@ -602,6 +738,55 @@ namespace Opm::ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNModel<Evaluation>::applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    {
+        OPM_ERROR_IF(in.dims_.size() != 2, "Batched input must be a 2D tensor");
+
+        if (layers_.empty()) {
+            out = in;
+            return true;
+        }
+
+        const int numRows = in.dims_[0];
+        const int numIn = in.dims_[1];
+
+        // Pass the batch through all layers in blocks of rows, so that the
+        // intermediate results stay in cache.  Empty batches still take one
+        // pass to get the output shape.
+        constexpr int blockRows = 64;
+
+        Tensor<Evaluation> block_in;
+        Tensor<Evaluation> block_out;
+        for (int row = 0; row == 0 || row < numRows; row += blockRows) {
+            const int rows = std::min(blockRows, numRows - row);
+
+            block_in.resizeI(std::vector{rows, numIn});
+            std::copy_n(in.data_.begin() + static_cast<std::size_t>(row) * numIn,
+                        block_in.data_.size(), block_in.data_.begin());
+
+            for (std::size_t i = 0; i < layers_.size(); i++) {
+                if (i > 0) {
+                    block_in.swap(block_out);
+                }
+
+                OPM_ERROR_IF(!(layers_[i]->applyBatch(block_in, block_out)),
+                             fmt::format(fmt::runtime("\n Failed to apply layer "
+                                         "{}"),
+                                         i));
+            }
+
+            if (row == 0) {
+                out.resizeI(std::vector{numRows, block_out.dims_[1]});
+            }
+
+            std::ranges::copy(block_out.data_,
+                              out.data_.begin() + static_cast<std::size_t>(row) * out.dims_[1]);
+        }
+
+        return true;
+    }
+
     void NNTimer::start()
     {
         start_ = std::chrono::high_resolution_clock::now();
@@ -615,26 +800,37 @@ namespace Opm::ML
 
     template class Tensor<float>;
     template class NNModel<float>;
+    template class NNLayerDense<float>;
     template class NNModel<Opm::DenseAd::Evaluation<float, 3>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<float, 3>>;
     template class Tensor<Opm::DenseAd::Evaluation<float, 3>>;
     template class NNModel<Opm::DenseAd::Evaluation<float, 2>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<float, 2>>;
     template class Tensor<Opm::DenseAd::Evaluation<float, 2>>;
     template class NNModel<Opm::DenseAd::Evaluation<float, 1>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<float, 1>>;
     template class Tensor<Opm::DenseAd::Evaluation<float, 1>>;
 
     template class Tensor<double>;
     template class NNModel<double>;
+    template class NNLayerDense<double>;
     template class NNModel<Opm::DenseAd::Evaluation<double, 6>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<double, 6>>;
     template class Tensor<Opm::DenseAd::Evaluation<double, 6>>;
     template class NNModel<Opm::DenseAd::Evaluation<double, 5>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<double, 5>>;
     template class Tensor<Opm::DenseAd::Evaluation<double, 5>>;
     template class NNModel<Opm::DenseAd::Evaluation<double, 4>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<double, 4>>;
     template class Tensor<Opm::DenseAd::Evaluation<double, 4>>;
     template class NNModel<Opm::DenseAd::Evaluation<double, 3>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<double, 3>>;
     template class Tensor<Opm::DenseAd::Evaluation<double, 3>>;
     template class NNModel<Opm::DenseAd::Evaluation<double, 2>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<double, 2>>;
     template class Tensor<Opm::DenseAd::Evaluation<double, 2>>;
     template class NNModel<Opm::DenseAd::Evaluation<double, 1>>;
+    template class NNLayerDense<Opm::DenseAd::Evaluation<double, 1>>;
     template class Tensor<Opm::DenseAd::Evaluation<double, 1>>;
 
 } // namespace Opm::ML
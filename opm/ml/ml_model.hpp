@@ -29,6 +29,7 @@
 
 #include <chrono>
 #include <iosfwd>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -111,6 +112,12 @@ namespace Opm::ML
         virtual bool loadLayer(std::ifstream& file) = 0;
         // Apply the NN layers
         virtual bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) = 0;
+        // Apply the NN layer to a batch of inputs, stored as the rows of a
+        // 2D tensor.  Element-wise layers treat a batch like any other tensor.
+        virtual bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+        {
+            return this->apply(in, out);
+        }
     };
 
     //! Activation types
@@ -210,7 +217,9 @@ namespace Opm::ML
             : weights_(weights)
             , biases_(biases)
             , activation_(activation_type)
-        {}
+        {
+            convertWeights_();
+        }
 
         bool loadLayer(std::ifstream& file) override;
 
@@ -250,10 +259,32 @@ namespace Opm::ML
          */
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        /**
+         * @brief Applies the forward pass to a batch of inputs.
+         *
+         * - `in` has shape `(batch_size, input_dim)`, one input per row.
+         * - `out` gets shape `(batch_size, output_dim)`.
+         *
+         * Computes the matrix product of the whole batch with the weights in
+         * a blocked kernel without per-element bounds checks.  For AD types,
+         * the value and each derivative of an input become separate rows of
+         * a scalar matrix product, since the layer is linear before the
+         * activation.
+         */
+        bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
+
     private:
+        // Copies the weights to doubleWeights_ if applyBatch() computes in
+        // double precision.
+        void convertWeights_();
+
         Tensor<float> weights_;
         Tensor<float> biases_;
 
+        // Weights used by applyBatch() for double based evaluations.
+        // Empty if these are float based, since weights_ is used directly.
+        std::vector<double> doubleWeights_;
+
         NNLayerActivation<Evaluation> activation_;
     };
 
@@ -273,6 +304,12 @@ namespace Opm::ML
 
         virtual bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out);
 
+        // Applies the model to a batch of inputs, e.g., one per cell.  `in`
+        // has shape (batch_size, input_dim) and `out` gets shape
+        // (batch_size, output_dim).  Matches apply() on each row up to
+        // rounding.
+        virtual bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out);
+
     private:
         std::vector<std::unique_ptr<NNLayer<Evaluation>>> layers_;
     };
@@ -0,0 +1,407 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/data/DenseWells.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <opm/output/data/Wells.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    /// Message buffer appending to a contiguous byte array.  Implements
+    /// the write() part of the MessageBufferType protocol.
+    class ByteWriter
+    {
+    public:
+        explicit ByteWriter(std::vector<char>& buffer)
+            : buffer_ { buffer }
+        {}
+
+        template <typename T>
+        void write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "Only trivially copyable types may be "
+                          "written to a byte buffer");
+
+            const auto* p = reinterpret_cast<const char*>(&value);
+            this->buffer_.insert(this->buffer_.end(), p, p + sizeof(T));
+        }
+
+        void write(const std::string& value)
+        {
+            this->write(value.size());
+            this->buffer_.insert(this->buffer_.end(), value.begin(), value.end());
+        }
+
+    private:
+        std::vector<char>& buffer_;
+    };
+
+    /// Message buffer counting the number of bytes which a sequence of
+    /// write() calls would append to a ByteWriter.
+    class ByteCounter
+    {
+    public:
+        template <typename T>
+        void write(const T&)
+        {
+            this->size_ += sizeof(T);
+        }
+
+        void write(const std::string& value)
+        {
+            this->write(value.size());
+            this->size_ += value.size();
+        }
+
+        std::size_t size() const
+        {
+            return this->size_;
+        }
+
+    private:
+        std::size_t size_{0};
+    };
+
+    /// Message buffer reading from a contiguous byte array.  Implements
+    /// the read() part of the MessageBufferType protocol.
+    class ByteReader
+    {
+    public:
+        explicit ByteReader(std::span<const char> buffer)
+            : buffer_ { buffer }
+        {}
+
+        template <typename T>
+        void read(T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "Only trivially copyable types may be "
+                          "read from a byte buffer");
+
+            std::memcpy(&value, this->take(sizeof(T)), sizeof(T));
+        }
+
+        void read(std::string& value)
+        {
+            auto size = value.size();
+            this->read(size);
+
+            const auto* p = this->take(size);
+            value.assign(p, p + size);
+        }
+
+        bool done() const
+        {
+            return this->pos_ == this->buffer_.size();
+        }
+
+    private:
+        std::span<const char> buffer_;
+        std::size_t pos_{0};
+
+        const char* take(const std::size_t size)
+        {
+            if (size > this->buffer_.size() - this->pos_) {
+                throw std::invalid_argument {
+                    "Truncated well result buffer"
+                };
+            }
+
+            const auto* p = this->buffer_.data() + this->pos_;
+            this->pos_ += size;
+
+            return p;
+        }
+    };
+
+    std::vector<Opm::data::Segment> extractSegments(Opm::data::Well& well)
+    {
+        auto segments = std::vector<Opm::data::Segment>{};
+        segments.reserve(well.segments.size());
+
+        for (auto& segment : well.segments) {
+            segments.push_back(std::move(segment.second));
+        }
+
+        well.segments.clear();
+
+        return segments;
+    }
+
+} // Anonymous namespace
+
+Opm::data::DenseWells::DenseWells(std::vector<std::string> wellNames)
+    : names_      { std::move(wellNames) }
+    , hasResults_ ( names_.size(), false )
+    , wells_      ( names_.size() )
+    , segStart_   ( names_.size(), 0 )
+    , segCount_   ( names_.size(), 0 )
+{
+    for (auto wellIx = 0*this->size(); wellIx < this->size(); ++wellIx) {
+        if (! this->index_.emplace(this->names_[wellIx], wellIx).second) {
+            throw std::invalid_argument {
+                fmt::format("Well {} listed more than once in dense well results",
+                            this->names_[wellIx])
+            };
+        }
+    }
+}
+
+Opm::data::DenseWells::DenseWells(std::vector<std::string> wellNames,
+                                  const Wells&             wells)
+    : DenseWells { std::move(wellNames) }
+{
+    for (const auto& [name, well] : wells) {
+        this->insert(name, well);
+    }
+}
+
+std::size_t Opm::data::DenseWells::insert(const std::string& name, Well well)
+{
+    const auto wellIx = this->index(name);
+    if (! wellIx.has_value()) {
+        throw std::invalid_argument {
+            fmt::format("Well {} is not known to dense well results", name)
+        };
+    }
+
+    auto segments = extractSegments(well);
+    this->insert(*wellIx, std::move(well), std::move(segments));
+
+    return *wellIx;
+}
+
+const Opm::data::Segment*
+Opm::data::DenseWells::findSegment(const std::size_t wellIx,
+                                   const std::size_t segNumber) const
+{
+    const auto segments = this->segments(wellIx);
+
+    const auto pos = std::ranges::lower_bound(segments, segNumber, std::less<>{},
+                                              &Segment::segNumber);
+
+    return ((pos == segments.end()) || (pos->segNumber != segNumber))
+        ? nullptr : &*pos;
+}
+
+std::optional<std::size_t>
+Opm::data::DenseWells::index(const std::string& name) const
+{
+    const auto pos = this->index_.find(name);
+    if (pos == this->index_.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
+const Opm::data::Well*
+Opm::data::DenseWells::find(const std::string& name) const
+{
+    const auto wellIx = this->index(name);
+
+    return (wellIx.has_value() && this->hasResults_[*wellIx])
+        ? &this->wells_[*wellIx] : nullptr;
+}
+
+double Opm::data::DenseWells::get(const std::string& name, Rates::opt m) const
+{
+    const auto* well = this->find(name);
+
+    return (well != nullptr) ? well->rates.get(m, 0.0) : 0.0;
+}
+
+Opm::data::Wells Opm::data::DenseWells::toWells() const
+{
+    auto wells = Wells{};
+
+    for (auto wellIx = 0*this->size(); wellIx < this->size(); ++wellIx) {
+        if (! this->hasResults_[wellIx]) {
+            continue;
+        }
+
+        auto well = this->wells_[wellIx];
+
+        for (const auto& segment : this->segments(wellIx)) {
+            well.segments.emplace(segment.segNumber, segment);
+        }
+
+        wells.emplace(this->names_[wellIx], std::move(well));
+    }
+
+    return wells;
+}
+
+std::vector<char> Opm::data::DenseWells::pack() const
+{
+    // Well results hold strings, maps and vectors, so each well is written
+    // member by member.  Count the bytes first to allocate the buffer
+    // only once.
+    auto counter = ByteCounter{};
+    this->pack(counter);
+
+    auto buffer = std::vector<char>{};
+    buffer.reserve(counter.size());
+
+    auto writer = ByteWriter { buffer };
+    this->pack(writer);
+
+    return buffer;
+}
+
+void Opm::data::DenseWells::unpack(std::span<const char> buffer)
+{
+    auto reader = ByteReader { buffer };
+
+    auto name = std::string{};
+    while (! reader.done()) {
+        auto numWells = std::size_t{0};
+        reader.read(numWells);
+
+        for (auto i = 0*numWells; i < numWells; ++i) {
+            auto wellIx = std::size_t{0};
+            reader.read(wellIx);
+            reader.read(name);
+
+            if ((wellIx >= this->size()) || (this->names_[wellIx] != name)) {
+                throw std::invalid_argument {
+                    fmt::format("Well {} with sequence index {} does not "
+                                "match dense well results", name, wellIx)
+                };
+            }
+
+            auto well = Well{};
+            well.read(reader);
+
+            auto numSegments = std::size_t{0};
+            reader.read(numSegments);
+
+            auto segments = std::vector<Segment>(numSegments);
+            for (auto& segment : segments) {
+                segment.read(reader);
+            }
+
+            if (! this->hasResults_[wellIx]) {
+                this->insert(wellIx, std::move(well), std::move(segments));
+                continue;
+            }
+
+            std::ranges::sort(segments, {}, &Segment::segNumber);
+
+            const auto existing = this->segments(wellIx);
+            if ((well != this->wells_[wellIx]) ||
+                ! std::ranges::equal(segments, existing))
+            {
+                OPM_THROW(std::runtime_error, "Received different output data for well " + name + " from more than one process, the output of this simulation will be wrong!");
+            }
+
+            OpmLog::warning("Received consistently duplicated output data for well " + name + " from more than one process - this might be problematic!");
+        }
+    }
+}
+
+bool Opm::data::DenseWells::operator==(const DenseWells& that) const
+{
+    if ((this->names_ != that.names_) ||
+        (this->hasResults_ != that.hasResults_) ||
+        (this->wells_ != that.wells_))
+    {
+        return false;
+    }
+
+    // Segment storage order depends on insertion order, so compare the
+    // segments of each well.
+    for (auto wellIx = 0*this->size(); wellIx < this->size(); ++wellIx) {
+        if (! std::ranges::equal(this->segments(wellIx), that.segments(wellIx))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+template <class MessageBufferType>
+void Opm::data::DenseWells::pack(MessageBufferType& buffer) const
+{
+    buffer.write(static_cast<std::size_t>(std::ranges::count(this->hasResults_, true)));
+
+    for (auto wellIx = 0*this->size(); wellIx < this->size(); ++wellIx) {
+        if (! this->hasResults_[wellIx]) {
+            continue;
+        }
+
+        buffer.write(wellIx);
+        buffer.write(this->names_[wellIx]);
+        this->wells_[wellIx].write(buffer);
+
+        const auto segments = this->segments(wellIx);
+        buffer.write(segments.size());
+
+        for (const auto& segment : segments) {
+            segment.write(buffer);
+        }
+    }
+}
+
+void Opm::data::DenseWells::insert(const std::size_t      wellIx,
+                                   Well&&                 well,
+                                   std::vector<Segment>&& segments)
+{
+    if (this->hasResults_[wellIx]) {
+        throw std::invalid_argument {
+            fmt::format("Well {} already exists in dense well results",
+                        this->names_[wellIx])
+        };
+    }
+
+    std::ranges::sort(segments, {}, &Segment::segNumber);
+
+    this->hasResults_[wellIx] = true;
+    this->wells_[wellIx] = std::move(well);
+
+    this->segStart_[wellIx] = this->segments_.size();
+    this->segCount_[wellIx] = segments.size();
+
+    this->segments_.insert(this->segments_.end(),
+                           std::make_move_iterator(segments.begin()),
+                           std::make_move_iterator(segments.end()));
+}
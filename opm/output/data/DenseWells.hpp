@@ -0,0 +1,260 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_OUTPUT_DATA_DENSEWELLS_HPP
+#define OPM_OUTPUT_DATA_DENSEWELLS_HPP
+
+#include <opm/output/data/Wells.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// \file
+///
+/// Well level dynamic results stored in flat arrays addressed by well
+/// sequence index and segment index.
+
+namespace Opm { namespace data {
+
+    /// Dense, index-addressed collection of dynamic well results.
+    ///
+    /// The collection has one slot for each well of the run, addressed by
+    /// the well's sequence index, i.e., Well::seqIndex(), in the run's
+    /// Schedule.  The slots are defined by the list of well names passed
+    /// to the constructor--typically Schedule::wellNames(), which orders
+    /// the wells by sequence index--and a slot holds results only if those
+    /// have been inserted or unpacked.  The segment results of all wells
+    /// are stored in a single array, contiguously and in increasing
+    /// segment number order for each well, and addressed by a zero-based
+    /// per-well segment index.  The Well objects of the collection
+    /// therefore never hold any segments of their own.
+    ///
+    /// Name based look-up, as provided by data::Wells, is available as a
+    /// view on top of the dense storage through find() and get(), and
+    /// through conversion to and from data::Wells.
+    ///
+    /// The collection serialises to and from a single contiguous byte
+    /// buffer, meaning gathering well results from several processes
+    /// reduces to concatenating buffers.  Each well's results are stored
+    /// in the slot of its sequence index regardless of the order in which
+    /// they are unpacked.
+    class DenseWells
+    {
+    public:
+        /// Default constructor.
+        ///
+        /// Creates an empty collection without any slots.
+        DenseWells() = default;
+
+        /// Constructor.
+        ///
+        /// Creates a collection with one empty slot for each well.
+        ///
+        /// \param[in] wellNames Names of all wells, ordered by sequence
+        ///   index.  Typically Schedule::wellNames().
+        explicit DenseWells(std::vector<std::string> wellNames);
+
+        /// Constructor.
+        ///
+        /// Converts from name-based representation.
+        ///
+        /// \param[in] wellNames Names of all wells, ordered by sequence
+        ///   index.  Typically Schedule::wellNames().
+        ///
+        /// \param[in] wells Name-based collection of well results.  All
+        ///   wells must be in \p wellNames.
+        DenseWells(std::vector<std::string> wellNames, const Wells& wells);
+
+        /// Add well results to collection.
+        ///
+        /// Moves any segment results into the collection's segment array.
+        ///
+        /// \param[in] name Well name.  Must be one of the collection's
+        ///   wells and must not already have results.
+        ///
+        /// \param[in] well Dynamic results for well \p name.
+        ///
+        /// \return Sequence index of well.
+        std::size_t insert(const std::string& name, Well well);
+
+        /// Number of slots, i.e., wells of the run, in collection.
+        std::size_t size() const { return this->names_.size(); }
+
+        /// Whether or not collection has any slots.
+        bool empty() const { return this->names_.empty(); }
+
+        /// Whether or not well at particular sequence index has results.
+        ///
+        /// \param[in] wellIx Sequence index.  Must be less than size().
+        bool hasResults(const std::size_t wellIx) const
+        {
+            return this->hasResults_[wellIx];
+        }
+
+        /// Name of well at particular sequence index.
+        ///
+        /// \param[in] wellIx Sequence index.  Must be less than size().
+        const std::string& name(const std::size_t wellIx) const
+        {
+            return this->names_[wellIx];
+        }
+
+        /// Well results at particular sequence index.
+        ///
+        /// \param[in] wellIx Sequence index.  Must be less than size().
+        ///
+        /// \return Well results.  Default constructed if the well has
+        ///   no results.
+        const Well& operator[](const std::size_t wellIx) const
+        {
+            return this->wells_[wellIx];
+        }
+
+        /// Well results at particular sequence index.
+        ///
+        /// \param[in] wellIx Sequence index.  Must be less than size().
+        Well& operator[](const std::size_t wellIx)
+        {
+            return this->wells_[wellIx];
+        }
+
+        /// Segment results of well at particular sequence index.
+        ///
+        /// \param[in] wellIx Sequence index.  Must be less than size().
+        ///
+        /// \return Segment results, in increasing segment number order.
+        std::span<const Segment> segments(const std::size_t wellIx) const
+        {
+            return std::span<const Segment> { this->segments_ }
+                .subspan(this->segStart_[wellIx], this->segCount_[wellIx]);
+        }
+
+        /// Look up results for individual segment by segment number.
+        ///
+        /// \param[in] wellIx Sequence index.  Must be less than size().
+        ///
+        /// \param[in] segNumber One-based segment number.
+        ///
+        /// \return Segment results.  Nullptr if no such segment exists.
+        const Segment* findSegment(const std::size_t wellIx,
+                                   const std::size_t segNumber) const;
+
+        /// Translate well name to sequence index.
+        ///
+        /// \param[in] name Well name.
+        ///
+        /// \return Sequence index.  Nullopt if no such well exists.
+        std::optional<std::size_t> index(const std::string& name) const;
+
+        /// Look up well results by well name.
+        ///
+        /// \param[in] name Well name.
+        ///
+        /// \return Well results.  Nullptr if no such well exists or if
+        ///   the well has no results.
+        const Well* find(const std::string& name) const;
+
+        /// Retrieve individual well level rate.
+        ///
+        /// Same as data::Wells::get().
+        ///
+        /// \param[in] name Well name.
+        ///
+        /// \param[in] m Rate type.
+        ///
+        /// \return Well level rate.  Zero if no such well or rate exists.
+        double get(const std::string& name, Rates::opt m) const;
+
+        /// Convert to name-based representation.
+        ///
+        /// Includes only those wells which have results.
+        Wells toWells() const;
+
+        /// Serialise wells with results to contiguous byte buffer.
+        ///
+        /// \return Serialised representation.  Each well is tagged with
+        ///   its sequence index.
+        std::vector<char> pack() const;
+
+        /// Add wells from serialised representation.
+        ///
+        /// Each well's results are stored in the slot of its sequence
+        /// index.  Wells already having results must have identical
+        /// results, mirroring data::Wells::read().
+        ///
+        /// \param[in] buffer Result of one or more calls to pack(),
+        ///   concatenated, on collections with the same wells.  Typically
+        ///   the result of gathering pack() buffers from several
+        ///   processes.
+        void unpack(std::span<const char> buffer);
+
+        /// Equality predicate.
+        bool operator==(const DenseWells& that) const;
+
+    private:
+        /// Well names, in sequence index order.
+        std::vector<std::string> names_{};
+
+        /// Whether or not each well has results.
+        std::vector<bool> hasResults_{};
+
+        /// Well results, in sequence index order.  No segments.
+        std::vector<Well> wells_{};
+
+        /// Start of each well's segments in segments_.
+        std::vector<std::size_t> segStart_{};
+
+        /// Number of segments of each well.
+        std::vector<std::size_t> segCount_{};
+
+        /// Segment results of all wells, in insertion order of the wells.
+        std::vector<Segment> segments_{};
+
+        /// Translation table from well names to sequence indices.
+        std::unordered_map<std::string, std::size_t> index_{};
+
+        /// Serialise wells with results.
+        ///
+        /// \tparam MessageBufferType Implements the write() part of the
+        ///   MessageBufferType protocol.
+        ///
+        /// \param[in,out] buffer Serialisation target.
+        template <class MessageBufferType>
+        void pack(MessageBufferType& buffer) const;
+
+        /// Store well results in slot, replacing segments.
+        ///
+        /// \param[in] wellIx Sequence index.  Must be less than size()
+        ///   and must not already have results.
+        ///
+        /// \param[in] well Dynamic results for well.  No segments.
+        ///
+        /// \param[in] segments Segment results, in any order.
+        void insert(std::size_t            wellIx,
+                    Well&&                 well,
+                    std::vector<Segment>&& segments);
+    };
+
+}} // namespace Opm::data
+
+#endif // OPM_OUTPUT_DATA_DENSEWELLS_HPP
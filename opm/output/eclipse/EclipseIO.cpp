@@ -59,17 +59,23 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
+#include <exception>
 #include <filesystem>
 #include <functional>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
+#include <queue>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <utility>    // move
 #include <vector>
 
@@ -126,6 +132,137 @@ std::vector<Opm::time_point> reportStepStartTimes(const Opm::Schedule& sched)
     return rptStepStart;
 }
 
+/// Serialised execution of output tasks on a background thread.
+///
+/// Tasks run in submission order.  At most 'capacity' tasks, including
+/// the one currently running, are in flight at any time, and submitting
+/// another task waits for the oldest one to complete.  An exception thrown
+/// by a task does not stop the thread, but is reported by the next call to
+/// submit() or fence().
+class BackgroundWriter
+{
+public:
+    explicit BackgroundWriter(const std::size_t capacity)
+        : capacity_ { std::max(capacity, std::size_t{1}) }
+        , thread_   { [this]() { this->run(); } }
+    {}
+
+    BackgroundWriter(const BackgroundWriter&) = delete;
+    BackgroundWriter& operator=(const BackgroundWriter&) = delete;
+
+    /// Complete all pending tasks and stop background thread.
+    ~BackgroundWriter()
+    {
+        {
+            std::lock_guard lock { this->mutex_ };
+            this->stop_ = true;
+        }
+
+        this->taskQueued_.notify_one();
+        this->thread_.join();
+
+        if (this->error_) {
+            try {
+                std::rethrow_exception(this->error_);
+            }
+            catch (const std::exception& e) {
+                Opm::OpmLog::error(std::string{"Asynchronous output failed: "} + e.what());
+            }
+            catch (...) {
+                Opm::OpmLog::error("Asynchronous output failed");
+            }
+        }
+    }
+
+    /// Queue task for execution on background thread.
+    void submit(std::function<void()> task)
+    {
+        {
+            std::unique_lock lock { this->mutex_ };
+            this->taskDone_.wait(lock, [this]()
+            { return this->inFlight_ < this->capacity_; });
+
+            this->rethrowIfFailed();
+
+            this->tasks_.push(std::move(task));
+            ++this->inFlight_;
+        }
+
+        this->taskQueued_.notify_one();
+    }
+
+    /// Wait for all queued tasks to complete.
+    void fence()
+    {
+        std::unique_lock lock { this->mutex_ };
+        this->taskDone_.wait(lock, [this]() { return this->inFlight_ == 0; });
+
+        this->rethrowIfFailed();
+    }
+
+private:
+    std::size_t capacity_{1};
+    std::size_t inFlight_{0};
+    bool stop_{false};
+
+    std::queue<std::function<void()>> tasks_{};
+    std::exception_ptr error_{};
+
+    std::mutex mutex_{};
+    std::condition_variable taskQueued_{};
+    std::condition_variable taskDone_{};
+
+    // Must be last, since the thread uses all other members.
+    std::thread thread_;
+
+    void run()
+    {
+        while (true) {
+            auto task = std::function<void()>{};
+
+            {
+                std::unique_lock lock { this->mutex_ };
+                this->taskQueued_.wait(lock, [this]()
+                { return this->stop_ || !this->tasks_.empty(); });
+
+                if (this->tasks_.empty()) {
+                    return;
+                }
+
+                task = std::move(this->tasks_.front());
+                this->tasks_.pop();
+            }
+
+            auto error = std::exception_ptr{};
+            try {
+                task();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard lock { this->mutex_ };
+                if (! this->error_) {
+                    this->error_ = std::move(error);
+                }
+
+                error = nullptr;
+                --this->inFlight_;
+            }
+
+            this->taskDone_.notify_all();
+        }
+    }
+
+    void rethrowIfFailed()
+    {
+        if (this->error_) {
+            std::rethrow_exception(std::exchange(this->error_, nullptr));
+        }
+    }
+};
+
 } // Anonymous namespace
 
 /// Internal implementation class for EclipseIO public interface.
@@ -516,6 +653,15 @@ public:
     /// Record full processing of a complete time step.
     void countTimeStep() { ++this->miniStepId_; }
 
+    /// Write restart files on a background thread.
+    ///
+    /// \param[in] maxPending Maximum number of restart files in
+    /// flight, including the one being written.
+    void enableAsyncOutput(const std::size_t maxPending);
+
+    /// Wait for all pending restart file output to complete.
+    void flushOutput();
+
 private:
     /// Run's static properties.
     std::reference_wrapper<const EclipseState> es_;
@@ -575,6 +721,12 @@ private:
     /// Stored as \c float to mimic the summary file's TIME vector.
     float last_summary_output_{std::numeric_limits<float>::lowest()};
 
+    /// Background thread for restart file output.
+    ///
+    /// Null unless asynchronous output is enabled.  Declared last so that
+    /// pending output completes before any other member is destroyed.
+    std::unique_ptr<BackgroundWriter> restartWriter_{};
+
     /// Output static properties to INIT file.
     ///
     /// \param[in] simProps Initial per-cell properties such as
@@ -683,6 +835,39 @@ private:
     /// is strictly between the previous summary file output time
     /// (last_summary_output_) and the next report step time.
     bool elapsedTimeAccepted(const int report_step, const double secs_elapsed) const;
+
+    /// Create restart file output.
+    ///
+    /// If asynchronous output is enabled, file contents are formed on the
+    /// calling thread, since they depend on the run's Schedule,
+    /// EclipseState and grid, and only written on the background thread.
+    ///
+    /// \param[in] value Restart values of type RestartValue, or one
+    /// RestartValue for each grid in runs with local grids.
+    template <typename Value>
+    void writeRestart(const Action::State& action_state,
+                      const WellTestState& wtest_state,
+                      const SummaryState&  st,
+                      const UDQState&      udq_state,
+                      const int            report_step,
+                      std::optional<int>   time_step,
+                      const double         secs_elapsed,
+                      const bool           write_double,
+                      Value&&              value);
+
+    /// Output restart file contents to restart stream.
+    ///
+    /// \param[in,out] rstFile Restart output stream, possibly deferred.
+    template <typename Value>
+    void saveRestart(EclIO::OutputStream::Restart& rstFile,
+                     const Action::State&          action_state,
+                     const WellTestState&          wtest_state,
+                     const SummaryState&           st,
+                     const UDQState&               udq_state,
+                     const int                     report_step,
+                     const double                  secs_elapsed,
+                     const bool                    write_double,
+                     Value&&                       value);
 };
 
 Opm::EclipseIO::Impl::Impl(const EclipseState&  eclipseState,
@@ -896,18 +1081,9 @@ void Opm::EclipseIO::Impl::writeRestartFile(const Action::State& action_state,
                                             const bool           write_double,
                                             RestartValue&&       value)
 {
-    EclIO::OutputStream::Restart rstFile {
-        EclIO::OutputStream::ResultSet { this->outputDir_, this->baseName_ },
-        this->reportIndex(report_step, time_step),
-        EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() },
-        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() }
-    };
-
-    RestartIO::save(rstFile, report_step, secs_elapsed,
-                    std::move(value),
-                    this->es_, this->grid_, this->schedule_,
-                    action_state, wtest_state, st,
-                    udq_state, this->aquiferData_, write_double);
+    this->writeRestart(action_state, wtest_state, st, udq_state,
+                       report_step, time_step, secs_elapsed,
+                       write_double, std::move(value));
 }
 
 void Opm::EclipseIO::Impl::writeRestartFile(const Action::State&        action_state,
@@ -920,13 +1096,59 @@ void Opm::EclipseIO::Impl::writeRestartFile(const Action::State&        action_s
                                             const bool                  write_double,
                                             std::vector<RestartValue>&& value)
 {
-    EclIO::OutputStream::Restart rstFile {
-        EclIO::OutputStream::ResultSet { this->outputDir_, this->baseName_ },
-        this->reportIndex(report_step, time_step),
-        EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() },
-        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() }
-    };
+    this->writeRestart(action_state, wtest_state, st, udq_state,
+                       report_step, time_step, secs_elapsed,
+                       write_double, std::move(value));
+}
+
+template <typename Value>
+void Opm::EclipseIO::Impl::writeRestart(const Action::State& action_state,
+                                        const WellTestState& wtest_state,
+                                        const SummaryState&  st,
+                                        const UDQState&      udq_state,
+                                        const int            report_step,
+                                        std::optional<int>   time_step,
+                                        const double         secs_elapsed,
+                                        const bool           write_double,
+                                        Value&&              value)
+{
+    const auto rset = EclIO::OutputStream::ResultSet { this->outputDir_, this->baseName_ };
+    const auto report_index = this->reportIndex(report_step, time_step);
+    const auto fmt  = EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() };
+    const auto unif = EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() };
+
+    if (this->restartWriter_ == nullptr) {
+        EclIO::OutputStream::Restart rstFile { rset, report_index, fmt, unif };
 
+        this->saveRestart(rstFile, action_state, wtest_state, st, udq_state,
+                          report_step, secs_elapsed, write_double,
+                          std::move(value));
+        return;
+    }
+
+    // Shared, rather than unique, ownership since std::function<> requires
+    // copyable targets.
+    auto rstFile = std::make_shared<EclIO::OutputStream::Restart>
+        (rset, report_index, fmt, unif, EclIO::OutputStream::Restart::Deferred{});
+
+    this->saveRestart(*rstFile, action_state, wtest_state, st, udq_state,
+                      report_step, secs_elapsed, write_double,
+                      std::move(value));
+
+    this->restartWriter_->submit([rstFile]() { rstFile->commit(); });
+}
+
+template <typename Value>
+void Opm::EclipseIO::Impl::saveRestart(EclIO::OutputStream::Restart& rstFile,
+                                       const Action::State&          action_state,
+                                       const WellTestState&          wtest_state,
+                                       const SummaryState&           st,
+                                       const UDQState&               udq_state,
+                                       const int                     report_step,
+                                       const double                  secs_elapsed,
+                                       const bool                    write_double,
+                                       Value&&                       value)
+{
     RestartIO::save(rstFile, report_step, secs_elapsed,
                     std::move(value),
                     this->es_, this->grid_, this->schedule_,
@@ -934,6 +1156,22 @@ void Opm::EclipseIO::Impl::writeRestartFile(const Action::State&        action_s
                     udq_state, this->aquiferData_, write_double);
 }
 
+void Opm::EclipseIO::Impl::enableAsyncOutput(const std::size_t maxPending)
+{
+    if (this->restartWriter_ != nullptr) {
+        this->restartWriter_->fence();
+    }
+
+    this->restartWriter_ = std::make_unique<BackgroundWriter>(maxPending);
+}
+
+void Opm::EclipseIO::Impl::flushOutput()
+{
+    if (this->restartWriter_ != nullptr) {
+        this->restartWriter_->fence();
+    }
+}
+
 void Opm::EclipseIO::Impl::writeRunSummary() const
 {
     const auto formatted = this->es_.get().cfg().io().getFMTOUT();
@@ -1228,6 +1466,10 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         this->impl->writeRunSummary();
     }
 
+    if (this->impl->isFinalWrite(report_step, isSubstep, forceFinalWrite)) {
+        this->impl->flushOutput();
+    }
+
     this->impl->countTimeStep();
 }
 
@@ -1270,6 +1512,10 @@ void Opm::EclipseIO::writeTimeStep(const Action::State&      action_state,
         this->impl->writeRunSummary();
     }
 
+    if (this->impl->isFinalWrite(report_step, isSubstep, forceFinalWrite)) {
+        this->impl->flushOutput();
+    }
+
     this->impl->countTimeStep();
 }
 
@@ -1279,6 +1525,20 @@ recordNewDynamicWellConns(const out::Summary::DynamicConns& newConns)
     this->impl->recordNewDynamicWellConns(newConns);
 }
 
+void Opm::EclipseIO::enableAsyncOutput(const std::size_t maxPending)
+{
+    if (! this->impl->outputEnabled()) {
+        return;
+    }
+
+    this->impl->enableAsyncOutput(maxPending);
+}
+
+void Opm::EclipseIO::flushOutput()
+{
+    this->impl->flushOutput();
+}
+
 Opm::RestartValue
 Opm::EclipseIO::loadRestart(Action::State&                 action_state,
                             SummaryState&                  summary_state,
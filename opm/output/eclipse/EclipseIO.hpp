@@ -357,6 +357,33 @@ public:
     ///   ignored.
     void recordNewDynamicWellConns(const out::Summary::DynamicConns& newConns);
 
+    /// Write restart files on a background thread.
+    ///
+    /// Subsequent calls to writeTimeStep() which create restart file
+    /// output form the complete file contents in memory, including
+    /// aggregation of well, connection, and segment data and unit
+    /// conversion, and return once those contents are queued.  Only the
+    /// file output happens on a background thread.  The background thread
+    /// does not access the run's Schedule, EclipseState or grid, so these
+    /// may be modified, e.g., when applying the effects of an ACTIONX
+    /// block, while output is pending.  Summary and RFT file output
+    /// remains synchronous.  The final call to writeTimeStep() waits for
+    /// all pending output.
+    ///
+    /// \param[in] maxPending Maximum number of restart files in flight,
+    /// including the one being written.  Calls to writeTimeStep() which
+    /// would exceed this limit wait for the oldest file to be written.
+    /// The default value, two, lets the simulator prepare the next
+    /// restart file while the previous one is being written.
+    void enableAsyncOutput(std::size_t maxPending = 2);
+
+    /// Wait for all pending restart file output to complete.
+    ///
+    /// Use for instance before checkpointing the run's output files.
+    /// Rethrows the first exception raised while writing pending output,
+    /// if any.  No-op unless asynchronous output is enabled.
+    void flushOutput();
+
     /// Load per-cell solution data and wellstate from restart file.
     ///
     /// Name of restart file and report step from which to restart inferred
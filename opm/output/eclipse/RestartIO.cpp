@@ -765,9 +765,7 @@ namespace {
                 rstFile.write(arrayName, fipArray);
             }
             else {
-                rstFile.write(arrayName, std::vector<float> {
-                    fipArray.begin(), fipArray.end()
-                });
+                rstFile.writeSinglePrecision(arrayName, fipArray);
             }
         };
 
@@ -838,7 +836,7 @@ namespace {
                 if (write_double) {
                     rstFile.write(tracer_rst_name, data);
                 } else {
-                    rstFile.write(tracer_rst_name, std::vector<float> {data.begin(), data.end()});
+                    rstFile.writeSinglePrecision(tracer_rst_name, data);
                 }
                 continue;
             }
@@ -863,9 +861,7 @@ namespace {
                 rstFile.write(tracer_rst_name, data);
             }
             else {
-                rstFile.write(tracer_rst_name, std::vector<float> {
-                        data.begin(), data.end()
-                    });
+                rstFile.writeSinglePrecision(tracer_rst_name, data);
             }
         }
     }
@@ -917,9 +913,7 @@ namespace {
                 rstFile.write(key, data);
             }
             else {
-                rstFile.write(key, std::vector<float> {
-                    data.begin(), data.end()
-                });
+                rstFile.writeSinglePrecision(key, data);
             }
         };
 
@@ -74,6 +74,11 @@ namespace Opm { namespace Action {
 
    will read from and write to the file "CASE.X0010" - completely ignoring
    the report step argument '99'.
+
+   The save() functions take ownership of the restart values and convert
+   the solution arrays from SI to output units in place.  Pass the values
+   with std::move() to avoid copying the cell arrays.  Single precision
+   output arrays are converted one Fortran record at a time.
 */
 namespace Opm::RestartIO {
 
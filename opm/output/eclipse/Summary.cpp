@@ -63,6 +63,7 @@
 #include <opm/io/eclipse/ExtSmryOutput.hpp>
 
 #include <opm/output/data/Aquifer.hpp>
+#include <opm/output/data/DenseWells.hpp>
 #include <opm/output/data/Groups.hpp>
 #include <opm/output/data/GuideRateValue.hpp>
 #include <opm/output/data/Wells.hpp>
@@ -76,6 +77,7 @@
 #include <cctype>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <exception>
 #include <filesystem>
@@ -660,6 +662,95 @@ struct quantity {
 };
 
 
+/*
+ * Dynamic well results from the simulator.  Either name-based, in which
+ * case every look-up searches the data::Wells map, or in a DenseWells
+ * collection, in which case the results of a Schedule well are found
+ * directly from the well's sequence index.
+ */
+class WellResults
+{
+public:
+    WellResults() = default;
+
+    explicit WellResults(const Opm::data::Wells& wells)
+        : wells_ { &wells }
+    {}
+
+    explicit WellResults(const Opm::data::DenseWells& wells)
+        : dense_ { &wells }
+    {}
+
+    /// Results of Schedule well.  Nullptr if the well has no results.
+    const Opm::data::Well* find(const Opm::Well& well) const
+    {
+        if (this->dense_ == nullptr) {
+            return this->find(well.name());
+        }
+
+        const auto wellIx = well.seqIndex();
+        if ((wellIx >= this->dense_->size()) || !this->dense_->hasResults(wellIx)) {
+            return nullptr;
+        }
+
+        assert (this->dense_->name(wellIx) == well.name());
+
+        return &(*this->dense_)[wellIx];
+    }
+
+    /// Results of named well.  Nullptr if the well has no results.
+    const Opm::data::Well* find(const std::string& name) const
+    {
+        if (this->dense_ != nullptr) {
+            return this->dense_->find(name);
+        }
+
+        if (this->wells_ == nullptr) {
+            return nullptr;
+        }
+
+        const auto pos = this->wells_->find(name);
+        return (pos == this->wells_->end()) ? nullptr : &pos->second;
+    }
+
+    /// Results of single segment.  Nullptr if no such segment exists.
+    ///
+    /// \param[in] well Schedule well.
+    /// \param[in] xw Results of \p well, from find().
+    /// \param[in] segNumber One-based segment number.
+    const Opm::data::Segment*
+    findSegment(const Opm::Well&        well,
+                const Opm::data::Well&  xw,
+                const std::size_t       segNumber) const
+    {
+        if (this->dense_ != nullptr) {
+            return this->dense_->findSegment(well.seqIndex(), segNumber);
+        }
+
+        const auto pos = xw.segments.find(segNumber);
+        return (pos == xw.segments.end()) ? nullptr : &pos->second;
+    }
+
+    /// Connection level rate.  Same as data::Wells::get().
+    double get(const std::string&                      name,
+               const Opm::data::Connection::global_index connection_grid_index,
+               const Opm::data::Rates::opt             m) const
+    {
+        const auto* xw = this->find(name);
+        if (xw == nullptr) {
+            return 0.0;
+        }
+
+        const auto* connection = xw->find_connection(connection_grid_index);
+        return (connection == nullptr) ? 0.0 : connection->rates.get(m, 0.0);
+    }
+
+private:
+    const Opm::data::Wells* wells_{nullptr};
+    const Opm::data::DenseWells* dense_{nullptr};
+};
+
+
 /*
  * All functions must have the same parameters, so they're gathered in a struct
  * and functions use whatever information they care about.
@@ -670,20 +761,20 @@ struct quantity {
 struct fn_args
 {
     const std::vector<const Opm::Well*>& schedule_wells;
-    const std::string group_name;
-    const std::string keyword_name;
+    const std::string& group_name;
+    const std::string& keyword_name;
     double duration;
     const int sim_step;
     int  num;
     const std::optional<std::variant<std::string, int>> extra_data;
     const Opm::SummaryState& st;
-    const Opm::data::Wells& wells;
+    const WellResults& wells;
     const Opm::data::WellBlockAveragePressures& wbp;
     const Opm::data::GroupAndNetworkValues& grp_nwrk;
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector<std::pair<std::string, double>> eff_factors{};
+    const std::vector<std::pair<std::string, double>>& eff_factors;
     const Opm::Inplace* initial_inplace{nullptr};
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -1059,9 +1150,9 @@ inline quantity artificial_lift_quantity( const fn_args& args ) {
         return zero;
     }
 
-    auto xwPos = args.wells.find(well->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return zero;
     }
@@ -1075,7 +1166,7 @@ inline quantity artificial_lift_quantity( const fn_args& args ) {
         return zero;
 
     const double eff_fac = efac(args.eff_factors, well->name());
-    auto alq_rate = eff_fac * xwPos->second.rates.get(rt::alq, production.alq_value);
+    auto alq_rate = eff_fac * xw->rates.get(rt::alq, production.alq_value);
     return { alq_rate, dimension };
 }
 
@@ -1089,9 +1180,9 @@ inline quantity glir( const fn_args& args ) {
             continue;
         }
 
-        auto xwPos = args.wells.find(well->name());
-        if ((xwPos == args.wells.end()) ||
-            (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+        const auto* xw = args.wells.find(*well);
+        if ((xw == nullptr) ||
+            (xw->dynamicStatus == Opm::Well::Status::SHUT))
         {
             continue;
         }
@@ -1099,21 +1190,21 @@ inline quantity glir( const fn_args& args ) {
         const auto& production = well->productionControls(args.st);
         if (! has_vfp_table(sched_state, production.vfp_table_number)) {
             const double eff_fac = efac(args.eff_factors, well->name());
-            alq_rate += args.unit_system.to_si( measure::gas_surface_rate, eff_fac * xwPos->second.rates.get(rt::alq, production.alq_value ));
+            alq_rate += args.unit_system.to_si( measure::gas_surface_rate, eff_fac * xw->rates.get(rt::alq, production.alq_value ));
             continue;
         }
 
         const auto thisAlqType = alq_type(sched_state, production.vfp_table_number);
         if (thisAlqType == Opm::VFPProdTable::ALQ_TYPE::ALQ_GRAT) {
             const double eff_fac = efac(args.eff_factors, well->name());
-            alq_rate += eff_fac * xwPos->second.rates.get(rt::alq, production.alq_value);
+            alq_rate += eff_fac * xw->rates.get(rt::alq, production.alq_value);
         }
 
         if (thisAlqType == Opm::VFPProdTable::ALQ_TYPE::ALQ_IGLR) {
             const double eff_fac = efac(args.eff_factors, well->name());
             auto glr = production.alq_value;
-            auto wpr = xwPos->second.rates.get(rt::wat);
-            auto opr = xwPos->second.rates.get(rt::oil);
+            auto wpr = xw->rates.get(rt::wat);
+            auto opr = xw->rates.get(rt::oil);
             alq_rate -= eff_fac * glr * (wpr + opr);
         }
     }
@@ -1130,15 +1221,15 @@ inline quantity rate(const fn_args& args)
     for (const auto* sched_well : args.schedule_wells) {
         const auto& name = sched_well->name();
 
-        auto xwPos = args.wells.find(name);
-        if ((xwPos == args.wells.end()) ||
-            (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+        const auto* xw = args.wells.find(*sched_well);
+        if ((xw == nullptr) ||
+            (xw->dynamicStatus == Opm::Well::Status::SHUT))
         {
             continue;
         }
 
         const double eff_fac = efac(args.eff_factors, name);
-        const auto v = xwPos->second.rates.get(phase, 0.0) * eff_fac;
+        const auto v = xw->rates.get(phase, 0.0) * eff_fac;
 
         if ((v > 0.0) == injection) {
             sum += v;
@@ -1168,15 +1259,15 @@ const Opm::data::Connection* findConnectionResults(const fn_args& args)
         return nullptr;
     }
 
-    const auto xwPos = args.wells.find(args.schedule_wells.front()->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (xwPos->second.current_control.isProducer == injection))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (xw->current_control.isProducer == injection))
     {
         return nullptr;
     }
 
-    return xwPos->second.find_connection(args.num - 1);
+    return xw->find_connection(args.num - 1);
 }
 
 template <double Opm::data::ConnectionFracture::* q, measure unit, bool injection = true>
@@ -1209,16 +1300,16 @@ inline quantity sum_filtrate_connection_quantities(const fn_args& args)
         return zero;
     }
 
-    const auto xwPos = args.wells.find(args.schedule_wells.front()->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (xwPos->second.current_control.isProducer == injection))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (xw->current_control.isProducer == injection))
     {
         return zero;
     }
 
-    const auto sum = std::accumulate(xwPos->second.connections.begin(),
-                                     xwPos->second.connections.end(), 0.0,
+    const auto sum = std::accumulate(xw->connections.begin(),
+                                     xw->connections.end(), 0.0,
                                      [](const double s, const auto& conn)
                                      { return s + conn.filtrate.*q; });
 
@@ -1235,15 +1326,15 @@ inline quantity filtrate_well_quantities(const fn_args& args)
         return zero;
     }
 
-    auto xwPos = args.wells.find(args.schedule_wells.front()->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (xwPos->second.current_control.isProducer == injection))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (xw->current_control.isProducer == injection))
     {
         return zero;
     }
 
-    return { xwPos->second.filtrate.*q, unit };
+    return { xw->filtrate.*q, unit };
 }
 
 template< rt tracer, rt phase, bool injection = true >
@@ -1257,15 +1348,15 @@ inline quantity ratetracer( const fn_args& args ) {
     for (const auto* sched_well : args.schedule_wells) {
         const auto& name = sched_well->name();
 
-        auto xwPos = args.wells.find(name);
-        if ((xwPos == args.wells.end()) ||
-            (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+        const auto* xw = args.wells.find(*sched_well);
+        if ((xw == nullptr) ||
+            (xw->dynamicStatus == Opm::Well::Status::SHUT))
         {
             continue;
         }
 
         const double eff_fac = efac(args.eff_factors, name);
-        const auto v = xwPos->second.rates.get(tracer, 0.0, tracer_name) * eff_fac;
+        const auto v = xw->rates.get(tracer, 0.0, tracer_name) * eff_fac;
 
         if ((v > 0.0) == injection) {
             sum += v;
@@ -1292,16 +1383,16 @@ inline quantity ratel( const fn_args& args ) {
     const auto* well = args.schedule_wells.front();
     const auto& name = well->name();
 
-    auto xwPos = args.wells.find(name);
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (xwPos->second.current_control.isProducer == injection))
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (xw->current_control.isProducer == injection))
     {
         return zero;
     }
 
     const double eff_fac = efac(args.eff_factors, name);
-    const auto& well_data = xwPos->second;
+    const auto& well_data = *xw;
 
     double sum = 0;
     const auto& connections = well->getConnections( args.num );
@@ -1334,13 +1425,12 @@ inline quantity cpr( const fn_args& args ) {
     if (args.schedule_wells.empty())
         return zero;
 
-    const auto& name = args.schedule_wells.front()->name();
-    auto xwPos = args.wells.find(name);
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
         return zero;
 
-    const auto& well_data = xwPos->second;
+    const auto& well_data = *xw;
     const auto& connection =
         std::ranges::find_if(well_data.connections,
                              [global_index](const Opm::data::Connection& c)
@@ -1365,10 +1455,10 @@ inline quantity cratel( const fn_args& args ) {
     const auto* well = args.schedule_wells.front();
     const auto& name = well->name();
 
-    auto xwPos = args.wells.find(name);
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (xwPos->second.current_control.isProducer == injection))
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (xw->current_control.isProducer == injection))
     {
         return zero;
     }
@@ -1378,7 +1468,7 @@ inline quantity cratel( const fn_args& args ) {
         // Connection might not yet have come online.
         return zero;
 
-    const auto& well_data = xwPos->second;
+    const auto& well_data = *xw;
     const double eff_fac = efac(args.eff_factors, name);
 
     double lsum = 0.0;
@@ -1413,17 +1503,16 @@ quantity connFracStatistics(const fn_args& args)
         return zero;
     }
 
-    const auto& name = args.schedule_wells.front()->name();
-    auto xwPos = args.wells.find(name);
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return zero;
     }
 
     const auto global_index = static_cast<std::size_t>(args.num - 1);
 
-    const auto& well_data = xwPos->second;
+    const auto& well_data = *xw;
     const auto connPos =
         std::ranges::find_if(well_data.connections,
                              [global_index](const Opm::data::Connection& c)
@@ -1443,11 +1532,11 @@ inline quantity flowing( const fn_args& args ) {
     const auto& wells = args.wells;
     auto pred = [&wells]( const Opm::Well* w ) -> bool
     {
-        auto xwPos = wells.find(w->name());
-        return (xwPos != wells.end())
+        const auto* xw = wells.find(*w);
+        return (xw != nullptr)
             && (w->isInjector( ) == injection)
-            && (xwPos->second.dynamicStatus == Opm::Well::Status::OPEN)
-            && xwPos->second.flowing();
+            && (xw->dynamicStatus == Opm::Well::Status::OPEN)
+            && xw->flowing();
     };
 
     return {
@@ -1474,15 +1563,15 @@ inline quantity crate( const fn_args& args ) {
         return zero;
 
     const auto& name = args.schedule_wells.front()->name();
-    auto xwPos = args.wells.find(name);
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (xwPos->second.current_control.isProducer == injection))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (xw->current_control.isProducer == injection))
     {
         return zero;
     }
 
-    const auto& well_data = xwPos->second;
+    const auto& well_data = *xw;
     // The two LC* filters are engaged together or not at all; the lambda
     // below dereferences lgr_cell_filter whenever lgr_grid_filter is set.
     assert(args.lgr_grid_filter.has_value() == args.lgr_cell_filter.has_value());
@@ -1518,10 +1607,10 @@ quantity crate_resv( const fn_args& args ) {
         return zero;
 
     const auto& name = args.schedule_wells.front()->name();
-    auto xwPos = args.wells.find(name);
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (xwPos->second.current_control.isProducer == injection))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (xw->current_control.isProducer == injection))
     {
         return zero;
     }
@@ -1532,7 +1621,7 @@ quantity crate_resv( const fn_args& args ) {
     // up a connection with offset 0.
     const auto global_index = static_cast<std::size_t>(args.num - 1);
 
-    const auto& well_data = xwPos->second;
+    const auto& well_data = *xw;
     const auto completion =
         std::ranges::find_if(well_data.connections,
                              [global_index](const Opm::data::Connection& c)
@@ -1559,23 +1648,21 @@ quantity segment_quantity(const fn_args& args,
         return zero;
     }
 
-    const auto& name = args.schedule_wells.front()->name();
-    auto xwPos = args.wells.find(name);
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto& well = *args.schedule_wells.front();
+    const auto* xw = args.wells.find(well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return zero;
     }
 
-    const auto& well_data = xwPos->second;
-
     const auto segNumber = static_cast<std::size_t>(args.num);
-    auto segPos = well_data.segments.find(segNumber);
-    if (segPos == well_data.segments.end()) {
+    const auto* segment = args.wells.findSegment(well, *xw, segNumber);
+    if (segment == nullptr) {
         return zero;
     }
 
-    return { getValue(segPos->second), m };
+    return { getValue(*segment), m };
 }
 
 template <Opm::data::SegmentPressures::Value ix>
@@ -1674,14 +1761,14 @@ inline quantity trans_factors ( const fn_args& args ) {
         // No wells.  Before simulation starts?
         return zero;
 
-    auto xwPos = args.wells.find(args.schedule_wells.front()->name());
-    if (xwPos == args.wells.end())
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if (xw == nullptr)
         // No dynamic results for this well.  Not open?
         return zero;
 
     // Like connection rate we need to look up a connection with offset 0.
     const std::size_t global_index = args.num - 1;
-    const auto& connections = xwPos->second.connections;
+    const auto& connections = xw->connections;
     const auto connPos =
             std::ranges::find_if(connections,
                                  [global_index](const Opm::data::Connection& c)
@@ -1702,14 +1789,14 @@ inline quantity d_factors ( const fn_args& args ) {
         // No wells.  Before simulation starts?
         return zero;
 
-    auto xwPos = args.wells.find(args.schedule_wells.front()->name());
-    if (xwPos == args.wells.end())
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if (xw == nullptr)
         // No dynamic results for this well.  Not open?
         return zero;
 
     // Like connection rate we need to look up a connection with offset 0.
     const std::size_t global_index = args.num - 1;
-    const auto& connections = xwPos->second.connections;
+    const auto& connections = xw->connections;
     auto connPos = std::find_if(connections.begin(), connections.end(),
         [global_index](const Opm::data::Connection& c)
     {
@@ -1729,12 +1816,12 @@ inline quantity wstat( const fn_args& args ) {
     if (args.schedule_wells.empty())
         return zero;
     const auto& sched_well = args.schedule_wells.front();
-    const auto& arg_well = args.wells.find(sched_well->name());
+    const auto* arg_well = args.wells.find(*sched_well);
 
-    if (arg_well == args.wells.end() || arg_well->second.dynamicStatus == Opm::Well::Status::SHUT)
+    if (arg_well == nullptr || arg_well->dynamicStatus == Opm::Well::Status::SHUT)
         return {Opm::WStat::numeric::SHUT, measure::identity};
 
-    if (arg_well->second.dynamicStatus == Opm::Well::Status::STOP)
+    if (arg_well->dynamicStatus == Opm::Well::Status::STOP)
         return {Opm::WStat::numeric::STOP, measure::identity};
 
     if (sched_well->isInjector())
@@ -1748,14 +1835,14 @@ inline quantity bhp( const fn_args& args ) {
     if (args.schedule_wells.empty())
         return zero;
 
-    const auto p = args.wells.find(args.schedule_wells.front()->name());
-    if ((p == args.wells.end()) ||
-        (p->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* p = args.wells.find(*args.schedule_wells.front());
+    if ((p == nullptr) ||
+        (p->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return zero;
     }
 
-    return { p->second.bhp, measure::pressure };
+    return { p->bhp, measure::pressure };
 }
 
 /*
@@ -1842,15 +1929,15 @@ quantity temperature(const fn_args& args)
         return zero;
     }
 
-    const auto p = args.wells.find(args.schedule_wells.front()->name());
-    if ((p == args.wells.end()) ||
-        (p->second.dynamicStatus == Opm::Well::Status::SHUT) ||
-        (p->second.current_control.isProducer == injection))
+    const auto* p = args.wells.find(*args.schedule_wells.front());
+    if ((p == nullptr) ||
+        (p->dynamicStatus == Opm::Well::Status::SHUT) ||
+        (p->current_control.isProducer == injection))
     {
         return zero;
     }
 
-    return { p->second.temperature, measure::temperature };
+    return { p->temperature, measure::temperature };
 }
 
 inline quantity thp( const fn_args& args ) {
@@ -1858,14 +1945,14 @@ inline quantity thp( const fn_args& args ) {
     if (args.schedule_wells.empty())
         return zero;
 
-    const auto p = args.wells.find(args.schedule_wells.front()->name());
-    if ((p == args.wells.end()) ||
-        (p->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* p = args.wells.find(*args.schedule_wells.front());
+    if ((p == nullptr) ||
+        (p->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return zero;
     }
 
-    return { p->second.thp, measure::pressure };
+    return { p->thp, measure::pressure };
 }
 
     inline quantity bhp_history( const fn_args& args ) {
@@ -1874,9 +1961,9 @@ inline quantity thp( const fn_args& args ) {
     const auto* sched_well = args.schedule_wells.front();
 
     // Check if well is shut - if so, return 0
-    const auto p = args.wells.find(sched_well->name());
-    if ((p != args.wells.end()) &&
-        (p->second.dynamicStatus == Opm::Well::Status::SHUT)) {
+    const auto* p = args.wells.find(*sched_well);
+    if ((p != nullptr) &&
+        (p->dynamicStatus == Opm::Well::Status::SHUT)) {
         return { 0.0, measure::pressure };
         }
 
@@ -1893,9 +1980,9 @@ inline quantity thp( const fn_args& args ) {
     const auto* sched_well = args.schedule_wells.front();
 
     // Check if well is shut - if so, return 0
-    const auto p = args.wells.find(sched_well->name());
-    if ((p != args.wells.end()) &&
-        (p->second.dynamicStatus == Opm::Well::Status::SHUT)) {
+    const auto* p = args.wells.find(*sched_well);
+    if ((p != nullptr) &&
+        (p->dynamicStatus == Opm::Well::Status::SHUT)) {
         return { 0.0, measure::pressure };
         }
 
@@ -2040,9 +2127,9 @@ inline quantity production_history(const fn_args& args)
     for (const auto* sched_well : args.schedule_wells) {
         const auto& name = sched_well->name();
 
-        auto xwPos = args.wells.find(name);
-        if ((xwPos == args.wells.end()) ||
-            (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+        const auto* xw = args.wells.find(*sched_well);
+        if ((xw == nullptr) ||
+            (xw->dynamicStatus == Opm::Well::Status::SHUT))
         {
             continue;
         }
@@ -2066,13 +2153,13 @@ inline quantity production_history(const fn_args& args)
             double v = 0.0;
             switch (phase) {
             case Opm::Phase::WATER:
-                v = xwPos->second.rates.get(rt::wat, 0.0) * eff_fac;
+                v = xw->rates.get(rt::wat, 0.0) * eff_fac;
                 break;
             case Opm::Phase::OIL:
-                v = xwPos->second.rates.get(rt::oil, 0.0) * eff_fac;
+                v = xw->rates.get(rt::oil, 0.0) * eff_fac;
                 break;
             case Opm::Phase::GAS:
-                v = xwPos->second.rates.get(rt::gas, 0.0) * eff_fac;
+                v = xw->rates.get(rt::gas, 0.0) * eff_fac;
                 break;
             default:
                 v = -sched_well->production_rate(args.st, phase) * eff_fac;
@@ -2097,9 +2184,9 @@ inline quantity injection_history(const fn_args& args)
     for (const auto* sched_well : args.schedule_wells) {
         const auto& name = sched_well->name();
 
-        auto xwPos = args.wells.find(name);
-        if ((xwPos == args.wells.end()) ||
-            (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+        const auto* xw = args.wells.find(*sched_well);
+        if ((xw == nullptr) ||
+            (xw->dynamicStatus == Opm::Well::Status::SHUT))
         {
             // Well's not flowing.  Ignore contribution regardless of what's
             // in WCONINJH.
@@ -2132,13 +2219,13 @@ inline quantity injection_history(const fn_args& args)
                 switch (phase)
                 {
                 case Opm::Phase::WATER:
-                    rate = xwPos->second.rates.get(Opm::data::Rates::opt::wat, 0.0);
+                    rate = xw->rates.get(Opm::data::Rates::opt::wat, 0.0);
                     break;
                 case Opm::Phase::OIL:
-                    rate = xwPos->second.rates.get(Opm::data::Rates::opt::oil, 0.0);
+                    rate = xw->rates.get(Opm::data::Rates::opt::oil, 0.0);
                     break;
                 case Opm::Phase::GAS:
-                    rate = xwPos->second.rates.get(Opm::data::Rates::opt::gas, 0.0);
+                    rate = xw->rates.get(Opm::data::Rates::opt::gas, 0.0);
                     break;
                 default:
                     rate = sched_well->injection_rate(args.st, phase);
@@ -2163,14 +2250,13 @@ inline quantity abandoned_well( const fn_args& args ) {
         if (!injection && !sched_well->hasProduced())
             continue;
 
-        const auto& well_name = sched_well->name();
-        auto well_iter = args.wells.find( well_name );
-        if (well_iter == args.wells.end()) {
+        const auto* well_iter = args.wells.find(*sched_well);
+        if (well_iter == nullptr) {
             count += 1;
             continue;
         }
 
-        count += !well_iter->second.flowing();
+        count += !well_iter->flowing();
     }
 
     return { 1.0 * count, measure::identity };
@@ -2279,15 +2365,13 @@ quantity well_control_limit(const fn_args& args)
         return zero;
     }
 
-    const auto& name = args.schedule_wells.front()->name();
-
-    auto xwPos = args.wells.find(name);
-    if (xwPos == args.wells.end()) {
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if (xw == nullptr) {
         return zero;
     }
 
-    return xwPos->second.limits.has(i)
-        ? quantity { xwPos->second.limits.get(i), m }
+    return xw->limits.has(i)
+        ? quantity { xw->limits.get(i), m }
         : zero;
 }
 
@@ -2354,19 +2438,19 @@ inline quantity potential_rate( const fn_args& args )
     for (const auto* sched_well : args.schedule_wells) {
         const auto& name = sched_well->name();
 
-        auto xwPos = args.wells.find(name);
-        if ((xwPos == args.wells.end()) ||
-            (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+        const auto* xw = args.wells.find(*sched_well);
+        if ((xw == nullptr) ||
+            (xw->dynamicStatus == Opm::Well::Status::SHUT))
         {
             continue;
         }
 
         if (sched_well->isInjector() && outputInjector) {
-            const auto v = xwPos->second.rates.get(phase, 0.0);
+            const auto v = xw->rates.get(phase, 0.0);
             sum += v * efac(args.eff_factors, name);
         }
         else if (sched_well->isProducer() && outputProducer) {
-            const auto v = xwPos->second.rates.get(phase, 0.0);
+            const auto v = xw->rates.get(phase, 0.0);
             sum += v * efac(args.eff_factors, name);
         }
     }
@@ -2388,9 +2472,9 @@ quantity well_block_average_prod_index(const fn_args& args)
 
     const auto* well = args.schedule_wells.front();
 
-    auto xwPos = args.wells.find(well->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return zero;
     }
@@ -2414,10 +2498,10 @@ quantity well_block_average_prod_index(const fn_args& args)
         }
     }();
 
-    const auto q = xwPos->second.rates.get(rate_quant, 0.0)
+    const auto q = xw->rates.get(rate_quant, 0.0)
         * efac(args.eff_factors, well->name());
 
-    const auto dp = p->second[wbp_quantity] - xwPos->second.bhp;
+    const auto dp = p->second[wbp_quantity] - xw->bhp;
 
     return { - q / dp, unit };
 }
@@ -2473,9 +2557,9 @@ inline quantity connection_productivity_index(const fn_args& args)
     if (args.schedule_wells.empty())
         return zero;
 
-    auto xwPos = args.wells.find(args.schedule_wells.front()->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*args.schedule_wells.front());
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return zero;
     }
@@ -2486,7 +2570,7 @@ inline quantity connection_productivity_index(const fn_args& args)
     // up a connection with offset 0.
     const auto global_index = static_cast<std::size_t>(args.num) - 1;
 
-    const auto& xcon = xwPos->second.connections;
+    const auto& xcon = xw->connections;
     const auto completion =
         std::ranges::find_if(xcon,
                              [global_index](const Opm::data::Connection& c)
@@ -2581,15 +2665,15 @@ inline quantity well_control_mode( const fn_args& args )
     }
 
     const auto* well = args.schedule_wells.front();
-    auto xwPos = args.wells.find(well->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT ||
-         xwPos->second.dynamicStatus == Opm::Well::Status::STOP )) {
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT ||
+         xw->dynamicStatus == Opm::Well::Status::STOP )) {
         // No dynamic results for 'well'.  Treat as shut/stopped.
         return { 0.0, unit };
     }
 
-    if (! well_control_mode_defined(xwPos->second)) {
+    if (! well_control_mode_defined(*xw)) {
         // No dynamic control mode defined.  Use input control.
         const auto wmctl = Opm::Well::eclipseControlMode(*well, args.st);
 
@@ -2598,7 +2682,7 @@ inline quantity well_control_mode( const fn_args& args )
 
     // Well has simulator-provided active control mode.  Pick the
     // appropriate value depending on well type (producer/injector).
-    const auto& curr = xwPos->second.current_control;
+    const auto& curr = xw->current_control;
     const auto wmctl = curr.isProducer
         ? Opm::Well::eclipseControlMode(curr.prod)
         : Opm::Well::eclipseControlMode(curr.inj, well->injectorType());
@@ -2637,14 +2721,14 @@ quantity well_guiderate(const fn_args& args)
         return { 0.0, rate_unit<i>() };
     }
 
-    auto xwPos = args.wells.find(well->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         return { 0.0, rate_unit<i>() };
     }
 
-    return guiderate_value<i>(xwPos->second.guide_rates);
+    return guiderate_value<i>(xw->guide_rates);
 }
 
 quantity well_efficiency_factor(const fn_args& args)
@@ -2657,16 +2741,16 @@ quantity well_efficiency_factor(const fn_args& args)
 
     const auto* well = args.schedule_wells.front();
 
-    auto xwPos = args.wells.find(well->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         // Non-flowing wells have a zero efficiency factor
         return zero;
     }
 
     return { well->getEfficiencyFactor() *
-             xwPos->second.efficiency_scaling_factor, measure::identity };
+             xw->efficiency_scaling_factor, measure::identity };
 }
 
 quantity well_efficiency_factor_grouptree(const fn_args& args)
@@ -2679,15 +2763,15 @@ quantity well_efficiency_factor_grouptree(const fn_args& args)
 
     const auto* well = args.schedule_wells.front();
 
-    auto xwPos = args.wells.find(well->name());
-    if ((xwPos == args.wells.end()) ||
-        (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+    const auto* xw = args.wells.find(*well);
+    if ((xw == nullptr) ||
+        (xw->dynamicStatus == Opm::Well::Status::SHUT))
     {
         // Non-flowing wells have a zero efficiency factor
         return zero;
     }
 
-    auto factor = well->getEfficiencyFactor() * xwPos->second.efficiency_scaling_factor;
+    auto factor = well->getEfficiencyFactor() * xw->efficiency_scaling_factor;
     auto parent = well->groupName();
     while (parent != "FIELD") {
         const auto& grp = args.schedule[args.sim_step].groups(parent);
@@ -4279,6 +4363,27 @@ void updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::S
     }
 }
 
+/// Location of a well, group, or network node level summary vector in the
+/// summary state.  Assigns IDs to the vector's variable and entity if
+/// needed.  Nullopt for all other summary vectors.
+std::optional<Opm::SummaryState::VarHandle>
+varHandle(const Opm::EclIO::SummaryNode& node, Opm::SummaryState& st)
+{
+    using Cat = Opm::EclIO::SummaryNode::Category;
+
+    switch (node.category) {
+    case Cat::Well:
+        return st.well_var_handle(node.wgname, node.keyword);
+
+    case Cat::Group:
+    case Cat::Node:
+        return st.group_var_handle(node.wgname, node.keyword, node.type);
+
+    default:
+        return std::nullopt;
+    }
+}
+
 /*
  * The well efficiency factor will not impact the well rate itself, but is
  * rather applied for accumulated values.The WEFAC can be considered to shut
@@ -4302,20 +4407,35 @@ struct EfficiencyFactor
 
     FacColl factors{};
 
+    /// Well efficiency factors times those of all applicable up-tree
+    /// groups, i.e., excluding the dynamic efficiency scaling factors of
+    /// the simulator.  One entry for each element of 'factors'.
+    std::vector<double> static_factors{};
+
+    /// Insertion index (Well::seqIndex()) of each well in 'factors'.
+    std::vector<std::size_t> well_index{};
+
     void setFactors(const Opm::EclIO::SummaryNode&       node,
                     const Opm::Schedule&                 schedule,
                     const std::vector<const Opm::Well*>& schedule_wells,
-                    const int                            sim_step,
-                    const Opm::data::Wells&              sim_res);
+                    const int                            sim_step);
+
+    /// Apply dynamic efficiency scaling factors from simulator results.
+    void applyScaling(const WellResults& sim_res);
+
+    /// Apply dynamic efficiency scaling factors, indexed by insertion
+    /// index, from precomputed table.
+    void applyScaling(const std::vector<double>& scaling);
 };
 
 void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
                                   const Opm::Schedule&                 schedule,
                                   const std::vector<const Opm::Well*>& schedule_wells,
-                                  const int                            sim_step,
-                                  const Opm::data::Wells&              sim_res)
+                                  const int                            sim_step)
 {
     this->factors.clear();
+    this->static_factors.clear();
+    this->well_index.clear();
 
     const bool is_field  { node.category == Opm::EclIO::SummaryNode::Category::Field  } ;
     const bool is_group  { node.category == Opm::EclIO::SummaryNode::Category::Group  } ;
@@ -4329,13 +4449,7 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
         if (!well->hasBeenDefined(sim_step))
             continue;
 
-        const auto res_it = sim_res.find(well->name());
-        double efficiency_scaling_factor = 1.0;
-        if (res_it != sim_res.end()) {
-            efficiency_scaling_factor = res_it->second.efficiency_scaling_factor;
-        }
-
-        double eff_factor = well->getEfficiencyFactor() * efficiency_scaling_factor;
+        double eff_factor = well->getEfficiencyFactor();
         const auto* group_ptr = std::addressof(schedule.getGroup(well->groupName(), sim_step));
 
         while (group_ptr) {
@@ -4353,6 +4467,27 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
         }
 
         this->factors.emplace_back(well->name(), eff_factor);
+        this->static_factors.push_back(eff_factor);
+        this->well_index.push_back(well->seqIndex());
+    }
+}
+
+void EfficiencyFactor::applyScaling(const WellResults& sim_res)
+{
+    for (auto i = 0*this->factors.size(); i < this->factors.size(); ++i) {
+        auto& [well, eff_factor] = this->factors[i];
+
+        const auto* xw = sim_res.find(well);
+        eff_factor = (xw != nullptr)
+            ? this->static_factors[i] * xw->efficiency_scaling_factor
+            : this->static_factors[i];
+    }
+}
+
+void EfficiencyFactor::applyScaling(const std::vector<double>& scaling)
+{
+    for (auto i = 0*this->factors.size(); i < this->factors.size(); ++i) {
+        this->factors[i].second = this->static_factors[i] * scaling[this->well_index[i]];
     }
 }
 
@@ -4368,7 +4503,7 @@ namespace Evaluator {
 
     struct SimulatorResults
     {
-        const Opm::data::Wells& wellSol;
+        const WellResults& wellSol;
         const Opm::data::WellBlockAveragePressures& wbp;
         const Opm::data::GroupAndNetworkValues& grpNwrkSol;
         const std::map<std::string, double>& single;
@@ -4404,6 +4539,14 @@ namespace Evaluator {
                   (cat == Cat::Miscellaneous));
     }
 
+    /// Wells contributing to a single summary vector, and their efficiency
+    /// factors, at a particular report step.
+    struct NodeWells
+    {
+        std::vector<const Opm::Well*> wells{};
+        EfficiencyFactor eFac{};
+    };
+
     class FunctionRelation : public Base
     {
     public:
@@ -4413,6 +4556,8 @@ namespace Evaluator {
             : node_      (std::move(node))
             , fcn_       (std::move(fcn))
             , use_number_(useNumber(node_.category))
+            , need_wells_(need_wells(node_))
+            , group_name_(groupName(node_))
             , state_     (use_number_ && (node_.number <= 0)
                           ? State::Deferred : State::Complete)
         {}
@@ -4427,31 +4572,84 @@ namespace Evaluator {
                 return;
             }
 
-            const auto wells = need_wells(this->node_)
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
+            auto nodeWells = this->findWells(sim_step, input);
+            nodeWells.eFac.applyScaling(simRes.wellSol);
 
-            EfficiencyFactor eFac{};
-            eFac.setFactors(this->node_, input.sched, wells, sim_step, simRes.wellSol);
+            this->store(this->value(sim_step, stepSize, input, simRes, st, nodeWells), st);
+        }
+
+        /// Wells and static efficiency factors of this summary vector.
+        ///
+        /// Depends on the well and group structure at \p sim_step only, so
+        /// may be reused for all ministeps with the same structure.
+        NodeWells findWells(const std::size_t sim_step,
+                            const InputData&  input) const
+        {
+            auto nodeWells = NodeWells{};
+
+            if (this->need_wells_) {
+                nodeWells.wells = find_wells(input.sched, this->node_,
+                                             static_cast<int>(sim_step), input.reg);
+            }
+
+            nodeWells.eFac.setFactors(this->node_, input.sched, nodeWells.wells,
+                                      static_cast<int>(sim_step));
+
+            return nodeWells;
+        }
 
+        /// Compute value of summary vector in output units.
+        ///
+        /// Reads, but does not modify, the summary state.  Dynamic
+        /// efficiency scaling factors must already be applied to \p
+        /// nodeWells.
+        double value(const std::size_t        sim_step,
+                     const double             stepSize,
+                     const InputData&         input,
+                     const SimulatorResults&  simRes,
+                     const Opm::SummaryState& st,
+                     const NodeWells&         nodeWells) const
+        {
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                nodeWells.wells, this->group_name_, this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
                 this->number(), this->node_.fip_region,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(eFac.factors),
+                nodeWells.eFac.factors,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits(),
                 simRes.rc_rates
             };
 
-            const auto& usys = input.es.getUnits();
-            const auto  prm  = this->fcn_(args);
+            const auto prm = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            return input.es.getUnits().from_si(prm.unit, prm.value);
+        }
+
+        /// Assign value, in output units, to summary vector.
+        void store(const double value, Opm::SummaryState& st) const
+        {
+            updateValue(this->node_, value, st);
+        }
+
+        /// Location of this summary vector in the summary state, if it
+        /// may be stored through a handle.
+        std::optional<Opm::SummaryState::VarHandle>
+        handle(Opm::SummaryState& st) const
+        {
+            return varHandle(this->node_, st);
+        }
+
+        /// Whether or not this summary vector's value depends on other
+        /// summary vectors computed in the same evaluation pass.
+        bool readsSummaryState() const
+        {
+            using Fn = quantity(*)(const fn_args&);
+
+            const auto* fn = this->fcn_.target<Fn>();
+            return (fn != nullptr) && (*fn == &roew);
         }
 
         void setNumber(const int numValue)
@@ -4474,30 +4672,31 @@ namespace Evaluator {
             return this->node_.unique_key();
         }
 
+        bool isComplete() const
+        {
+            return this->state_ == State::Complete;
+        }
+
     private:
         Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
         bool                    use_number_;
+        bool                    need_wells_;
+        std::string             group_name_;
         State                   state_;
 
-        std::string group_name() const
+        static std::string groupName(const Opm::EclIO::SummaryNode& node)
         {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
 
-            if (this->node_.category == Cat::Field) return std::string{"FIELD"};
+            if (node.category == Cat::Field) return std::string{"FIELD"};
 
             const auto need_grp_name =
-                (this->node_.category == Cat::Group) ||
-                (this->node_.category == Cat::Node);
+                (node.category == Cat::Group) ||
+                (node.category == Cat::Node);
 
-            const auto def_gr_name = this->node_.category == Cat::Field ? std::string{"FIELD"} : std::string{""};
             return need_grp_name
-                ? this->node_.wgname : def_gr_name;
-        }
-
-        bool isComplete() const
-        {
-            return this->state_ == State::Complete;
+                ? node.wgname : std::string{""};
         }
 
         int number() const
@@ -4577,8 +4776,8 @@ namespace Evaluator {
                 static_cast<std::size_t>(this->node_.number - 1);
 
             EfficiencyFactor eFac{};
-            eFac.setFactors(this->node_, input.sched, wells, sim_step,
-                            simRes.wellSol);
+            eFac.setFactors(this->node_, input.sched, wells, sim_step);
+            eFac.applyScaling(simRes.wellSol);
 
             const fn_args args {
                 wells, "", this->node_.keyword,
@@ -4587,7 +4786,7 @@ namespace Evaluator {
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(eFac.factors),
+                eFac.factors,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits(),
                 simRes.rc_rates,
@@ -5122,6 +5321,224 @@ namespace Evaluator {
         std::string saveKey_;
     };
 
+    /// Evaluation plan for a collection of summary vectors.
+    ///
+    /// Resolves the wells and static efficiency factors of each function
+    /// relation once, and reuses them until the report step or the well and
+    /// group structure of the schedule changes.  Function relations which
+    /// do not read other summary vectors of the same evaluation pass are
+    /// then computed concurrently.  Storing values into the summary state,
+    /// and evaluating all other summary vectors, happens serially in the
+    /// original order.  Well, group and node level values are stored
+    /// through summary state handles resolved once per ID assignment.
+    class Plan
+    {
+    public:
+        /// Discard resolved nodes, e.g., because the set of evaluators or
+        /// their summary vectors changed.
+        void invalidate()
+        {
+            this->sim_step_.reset();
+            this->handle_stamp_.reset();
+            this->structure_.clear();
+            this->nodes_.clear();
+        }
+
+        /// Whether or not the plan applies to the well and group structure
+        /// of a particular report step.
+        bool isCurrent(const std::size_t sim_step, const Opm::Schedule& sched) const
+        {
+            if (this->sim_step_ != sim_step) {
+                return false;
+            }
+
+            if (sim_step >= sched.size()) {
+                return this->structure_.empty();
+            }
+
+            const auto& state = sched[sim_step];
+            if (this->structure_.size() != state.wells.size() + state.groups.size()) {
+                return false;
+            }
+
+            auto elm = this->structure_.begin();
+            const auto same = [&elm](const auto& entry)
+            { return *elm++ == entry.second; };
+
+            return std::all_of(state.wells.begin(), state.wells.end(), same)
+                && std::all_of(state.groups.begin(), state.groups.end(), same);
+        }
+
+        /// Resolve wells and efficiency factors of summary vectors.
+        ///
+        /// \param[in] evaluators Summary vector evaluators in order of
+        ///   evaluation.
+        void rebuild(const std::size_t               sim_step,
+                     const InputData&                input,
+                     const std::vector<const Base*>& evaluators)
+        {
+            this->invalidate();
+
+            // Keep the current well and group objects alive so that new
+            // objects cannot reuse their addresses while the plan exists.
+            if (sim_step < input.sched.size()) {
+                const auto& state = input.sched[sim_step];
+                for (const auto& entry : state.wells) {
+                    this->structure_.push_back(entry.second);
+                }
+                for (const auto& entry : state.groups) {
+                    this->structure_.push_back(entry.second);
+                }
+            }
+
+            this->scaled_wells_.clear();
+            this->nodes_.reserve(evaluators.size());
+
+            for (const auto* evaluator : evaluators) {
+                auto& node = this->nodes_.emplace_back();
+                node.evaluator = evaluator;
+
+                const auto* fn = dynamic_cast<const FunctionRelation*>(evaluator);
+                if ((fn == nullptr) || !fn->isComplete() || fn->readsSummaryState()) {
+                    continue;
+                }
+
+                node.function = fn;
+                node.wells = fn->findWells(sim_step, input);
+
+                const auto& eFac = node.wells.eFac;
+                for (auto i = 0*eFac.factors.size(); i < eFac.factors.size(); ++i) {
+                    const auto ix = eFac.well_index[i];
+                    if (ix >= this->scaled_wells_.size()) {
+                        this->scaled_wells_.resize(ix + 1, nullptr);
+                    }
+
+                    this->scaled_wells_[ix] = &eFac.factors[i].first;
+                }
+            }
+
+            this->sim_step_ = sim_step;
+        }
+
+        /// Compute all summary vectors and store their values.
+        void eval(const std::size_t       sim_step,
+                  const double            stepSize,
+                  const InputData&        input,
+                  const SimulatorResults& simRes,
+                  Opm::SummaryState&      st)
+        {
+            this->updateScaling(simRes.wellSol);
+
+            const auto num_nodes = static_cast<int>(this->nodes_.size());
+            this->values_.assign(this->nodes_.size(), std::nullopt);
+
+            const auto& cst = st;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, chunk_size) if(num_nodes > chunk_size)
+#endif
+            for (int n = 0; n < num_nodes; ++n) {
+                auto& node = this->nodes_[n];
+                if (node.function == nullptr) {
+                    continue;
+                }
+
+                try {
+                    node.wells.eFac.applyScaling(this->scaling_);
+                    this->values_[n] = node.function->value(sim_step, stepSize, input,
+                                                            simRes, cst, node.wells);
+                }
+                catch (...) {
+                    // Leave failure handling to the serial update below.
+                }
+            }
+
+            if (this->handle_stamp_ != st.handle_stamp()) {
+                this->resolveHandles(st);
+            }
+
+            for (auto n = 0*this->nodes_.size(); n < this->nodes_.size(); ++n) {
+                const auto& node = this->nodes_[n];
+
+                if (! this->values_[n].has_value()) {
+                    node.evaluator->update(sim_step, stepSize, input, simRes, st);
+                }
+                else if (node.handle.has_value()) {
+                    st.update(*node.handle, *this->values_[n]);
+                }
+                else {
+                    node.function->store(*this->values_[n], st);
+                }
+            }
+        }
+
+    private:
+        struct Node
+        {
+            /// Summary vector evaluator.
+            const Base* evaluator{nullptr};
+
+            /// Function relation which may be computed concurrently.  Null
+            /// for evaluators which must run serially.
+            const FunctionRelation* function{nullptr};
+
+            /// Resolved wells and efficiency factors of 'function'.
+            NodeWells wells{};
+
+            /// Location of the value of 'function' in the summary state.
+            /// Nullopt if the value must be stored by name.
+            std::optional<Opm::SummaryState::VarHandle> handle{};
+        };
+
+        /// Number of summary vectors handed to each thread at a time.
+        static constexpr int chunk_size = 64;
+
+        std::optional<std::size_t> sim_step_{};
+
+        /// Summary state ID assignment for which the node handles are
+        /// resolved.
+        std::optional<std::uint64_t> handle_stamp_{};
+
+        std::vector<std::shared_ptr<const void>> structure_{};
+        std::vector<Node> nodes_{};
+
+        /// Names of wells with efficiency factors, indexed by insertion
+        /// index.  Null for wells not referenced by any summary vector.
+        std::vector<const std::string*> scaled_wells_{};
+
+        /// Dynamic efficiency scaling factors, indexed by insertion index.
+        std::vector<double> scaling_{};
+
+        std::vector<std::optional<double>> values_{};
+
+        void resolveHandles(Opm::SummaryState& st)
+        {
+            for (auto& node : this->nodes_) {
+                if (node.function != nullptr) {
+                    node.handle = node.function->handle(st);
+                }
+            }
+
+            this->handle_stamp_ = st.handle_stamp();
+        }
+
+        void updateScaling(const WellResults& sim_res)
+        {
+            this->scaling_.assign(this->scaled_wells_.size(), 1.0);
+
+            for (auto ix = 0*this->scaled_wells_.size(); ix < this->scaled_wells_.size(); ++ix) {
+                if (this->scaled_wells_[ix] == nullptr) {
+                    continue;
+                }
+
+                const auto* xw = sim_res.find(*this->scaled_wells_[ix]);
+                if (xw != nullptr) {
+                    this->scaling_[ix] = xw->efficiency_scaling_factor;
+                }
+            }
+        }
+    };
+
     class Factory
     {
     public:
@@ -6093,6 +6510,12 @@ private:
     /// of those vectors will need to be activated for the new connections.
     std::unordered_map<std::string, std::unordered_set<std::string>> extraConnVectors_{};
 
+    /// Resolved wells and efficiency factors of all summary vectors.
+    /// Rebuilt when the report step or the well/group structure changes.
+    mutable Evaluator::Plan plan_{};
+
+    std::vector<const Evaluator::Base*> evaluationOrder() const;
+
     void configureTimeVector(const EclipseState& es, const std::string& kw);
     void configureTimeVectors(const EclipseState& es, const SummaryConfig& sumcfg);
 
@@ -6239,6 +6662,9 @@ recordNewDynamicWellConns(const DynamicConns& newConns)
                     const auto& [valueKey, ix] = *param;
 
                     this->valueKeys_[ix] = valueKey;
+
+                    // Evaluator 'ix' is complete now, so must join the plan.
+                    this->plan_.invalidate();
                 }
                 else {
                     OpmLog::warning(
@@ -6254,6 +6680,22 @@ recordNewDynamicWellConns(const DynamicConns& newConns)
     }
 }
 
+std::vector<const Evaluator::Base*>
+Opm::out::Summary::SummaryImplementation::evaluationOrder() const
+{
+    auto evaluators = std::vector<const Evaluator::Base*>{};
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators()) {
+        evaluators.push_back(evalPtr.get());
+    }
+
+    for (const auto& paramPair : this->extra_parameters) {
+        evaluators.push_back(paramPair.second.get());
+    }
+
+    return evaluators;
+}
+
 void
 Opm::out::Summary::SummaryImplementation::
 eval(const int                    sim_step,
@@ -6279,8 +6721,11 @@ eval(const int                    sim_step,
         values.inplace.initial
     };
 
-    const auto& well_solution = (values.well_solution != nullptr)
-        ? *values.well_solution : data::Wells{};
+    const auto no_wells = data::Wells{};
+    const auto well_solution = (values.dense_well_solution != nullptr)
+        ? WellResults { *values.dense_well_solution }
+        : WellResults { (values.well_solution != nullptr)
+                        ? *values.well_solution : no_wells };
 
     const auto& wbp = (values.wbp != nullptr)
         ? *values.wbp : data::WellBlockAveragePressures{};
@@ -6320,13 +6765,11 @@ eval(const int                    sim_step,
         values.rc_group_rates
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    if (! this->plan_.isCurrent(sim_step, this->sched_)) {
+        this->plan_.rebuild(sim_step, input, this->evaluationOrder());
     }
 
-    for (const auto& paramPair : this->extra_parameters) {
-        paramPair.second->update(sim_step, duration, input, simRes, st);
-    }
+    this->plan_.eval(sim_step, duration, input, simRes, st);
 
     st.update_elapsed(duration);
 }
@@ -43,6 +43,7 @@ namespace Opm {
 } // namespace Opm
 
 namespace Opm::data {
+    class DenseWells;
     class GroupAndNetworkValues;
     class InterRegFlowMap;
     struct WellBlockAveragePressures;
@@ -113,6 +114,16 @@ public:
         /// Nullptr if unavailable.
         const data::Wells* well_solution {nullptr};
 
+        /// Dynamic state variables at the well, connection, and segment
+        /// levels, addressed by the wells' sequence indices.
+        ///
+        /// Alternative to well_solution which lets summary evaluation find
+        /// each well's results without name look-up.  Must have one slot
+        /// for each well of the run's Schedule, as created from
+        /// Schedule::wellNames().  Used in place of well_solution if
+        /// non-null.
+        const data::DenseWells* dense_well_solution {nullptr};
+
         /// Well-block averaged pressures.
         ///
         /// Goes into the WBP* and WPI* summary quantities.
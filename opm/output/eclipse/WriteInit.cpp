@@ -446,6 +446,8 @@ namespace {
     {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
+        const auto dims   = grid.activeCellDims();
+        const auto depths = grid.activeCellDepth();
 
         auto dx    = std::vector<float>{};  dx   .reserve(nAct);
         auto dy    = std::vector<float>{};  dy   .reserve(nAct);
@@ -453,13 +455,10 @@ namespace {
         auto depth = std::vector<float>{};  depth.reserve(nAct);
 
         for (auto cell = 0*nAct; cell < nAct; ++cell) {
-            const auto  globCell = grid.getGlobalIndex(cell);
-            const auto& dims     = grid.getCellDims(globCell);
-
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+            dx   .push_back(units.from_si(length, dims[0][cell]));
+            dy   .push_back(units.from_si(length, dims[1][cell]));
+            dz   .push_back(units.from_si(length, dims[2][cell]));
+            depth.push_back(units.from_si(length, depths[cell]));
         }
 
         initFile.write("DEPTH", depth);
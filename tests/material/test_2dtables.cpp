@@ -25,7 +25,8 @@
  *
  * \brief This is the unit test for the 2D tabulation classes.
  *
- * I.e., for the UniformTabulated2DFunction and UniformXTabulated2DFunction classes.
+ * I.e., for the UniformTabulated2DFunction and UniformXTabulated2DFunction classes,
+ * as well as for their three-dimensional counterpart UniformTabulated3DFunction.
  */
 #include "config.h"
 
@@ -37,10 +38,17 @@
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/IntervalTabulated2DFunction.hpp>
+#include <opm/material/common/UniformTabulated3DFunction.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <cmath>
 #include <iostream>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 template <class ScalarT>
 struct Test
@@ -108,7 +116,9 @@ struct Test
 
     template <class Fn>
     Opm::UniformXTabulated2DFunction<Scalar>
-    createUniformXTabulatedFunction2(Fn& f)
+    createUniformXTabulatedFunction2(Fn& f,
+                                     typename Opm::UniformXTabulated2DFunction<Scalar>::InterpolationPolicy policy =
+                                     Opm::UniformXTabulated2DFunction<Scalar>::InterpolationPolicy::Vertical)
     {
         Scalar xMin = -2.0;
         Scalar xMax = 3.0;
@@ -117,7 +127,7 @@ struct Test
         Scalar yMin = - 4.0;
         Scalar yMax = 5.0;
 
-        Opm::UniformXTabulated2DFunction<Scalar> tab(Opm::UniformXTabulated2DFunction<Scalar>::InterpolationPolicy::Vertical);
+        Opm::UniformXTabulated2DFunction<Scalar> tab(policy);
 
         for (unsigned i = 0; i < m; ++i) {
             Scalar x = xMin + Scalar(i)/(m - 1) * (xMax - xMin);
@@ -163,6 +173,86 @@ struct Test
         return Opm::IntervalTabulated2DFunction<Scalar>(xSamples, ySamples, data, true, true);
     }
 
+    // The batched evaluation may round differently from the scalar one.
+    static void checkClose(const Scalar a, const Scalar b)
+    {
+        const Scalar tolerance = std::is_same_v<Scalar, float> ? 1e-6 : 1e-13;
+        const Scalar scale = std::max({ Scalar{1}, std::abs(a), std::abs(b) });
+        BOOST_CHECK_MESSAGE(std::abs(a - b) <= tolerance*scale,
+                            "difference between " << a << " and " << b << " too large");
+    }
+
+    template <int numVars>
+    static void checkClose(const Opm::DenseAd::Evaluation<Scalar, numVars>& a,
+                           const Opm::DenseAd::Evaluation<Scalar, numVars>& b)
+    {
+        checkClose(a.value(), b.value());
+        for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+            checkClose(a.derivative(varIdx), b.derivative(varIdx));
+        }
+    }
+
+    template <class Evaluation>
+    static Evaluation variable(const Scalar value, const int varIdx)
+    {
+        if constexpr (std::is_same_v<Evaluation, Scalar>) {
+            static_cast<void>(varIdx);
+            return value;
+        }
+        else {
+            return Evaluation::createVariable(value, varIdx);
+        }
+    }
+
+    // Compare the batched evaluation of a table with the scalar one.
+    template <class Evaluation>
+    void checkBatchEval(const Opm::UniformXTabulated2DFunction<Scalar>& table)
+    {
+        using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+
+        // Positions on both sides of, and on, the sampling points, including
+        // positions outside the tabulated range.  Some full batches and a
+        // partial last one.
+        const unsigned n = 3*Table::maxBatchSize + 17;
+        std::vector<Evaluation> x(n), y(n), result(n);
+        for (unsigned k = 0; k < n; ++k) {
+            x[k] = variable<Evaluation>(-2.5 + Scalar(k % 97)/96 * 6.0, 0);
+            y[k] = variable<Evaluation>(-4.5 + Scalar(k % 89)/88 * 10.0, 1);
+        }
+
+        table.eval(std::span<const Evaluation>{x}, std::span<const Evaluation>{y},
+                   std::span<Evaluation>{result}, /*extrapolate=*/true);
+
+        for (unsigned k = 0; k < n; ++k) {
+            checkClose(result[k], table.eval(x[k], y[k], /*extrapolate=*/true));
+        }
+
+        // Interpolation points are the same as those of the scalar path.
+        typename Table::template BatchPoints<Evaluation> points;
+        const auto batch = std::span<const Evaluation>{x}.first(Table::maxBatchSize);
+        table.findPoints(points, batch,
+                         std::span<const Evaluation>{y}.first(Table::maxBatchSize),
+                         /*extrapolate=*/true);
+
+        BOOST_CHECK_EQUAL(points.size, batch.size());
+        for (unsigned k = 0; k < points.size; ++k) {
+            unsigned i, j1, j2;
+            Evaluation alpha, beta1, beta2;
+            table.findPoints(i, j1, j2, alpha, beta1, beta2, x[k], y[k], /*extrapolate=*/true);
+
+            BOOST_CHECK_EQUAL(points.i[k], i);
+            BOOST_CHECK_EQUAL(points.j1[k], j1);
+            BOOST_CHECK_EQUAL(points.j2[k], j2);
+            checkClose(points.alpha[k], alpha);
+            checkClose(points.beta1[k], beta1);
+            checkClose(points.beta2[k], beta2);
+        }
+
+        // An empty batch is a no-op.
+        table.eval(std::span<const Evaluation>{}, std::span<const Evaluation>{},
+                   std::span<Evaluation>{}, /*extrapolate=*/true);
+    }
+
     template <class Fn, class Table>
     bool compareTableWithAnalyticFn(const Table& table,
                                     Scalar xMin,
@@ -335,6 +425,22 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunction2, Scalar, Types)
                                     1e-2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionBatch, Scalar, Types)
+{
+    using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+    using Policy = typename Table::InterpolationPolicy;
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 2>;
+
+    Test<Scalar> test;
+    for (const auto policy : { Policy::Vertical, Policy::LeftExtreme, Policy::RightExtreme }) {
+        BOOST_TEST_MESSAGE("Interpolation policy " << static_cast<int>(policy));
+
+        const auto uniformXTab = test.createUniformXTabulatedFunction2(test.testFn3, policy);
+        test.template checkBatchEval<Scalar>(uniformXTab);
+        test.template checkBatchEval<Eval>(uniformXTab);
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction1, Scalar, Types)
 {
     Test<Scalar> test;
@@ -406,3 +512,101 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction3, Scalar, Types)
     test.compareTableWithAnalyticFn2(xytab, xMin, xMax, m,
                                      yMin, yMax, n, test.testFn3, tolerance);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformTabulated3DFunctionTrilinear, Scalar, Types)
+{
+    // Tri-linear interpolation reproduces a tri-linear function, including
+    // its derivatives.
+    auto f = [](auto x, auto y, auto z)
+    { return 1.0 + 2.0*x - y + 0.5*z + x*y*z; };
+
+    Opm::UniformTabulated3DFunction<Scalar> tab(-1.0, 2.0, 7,
+                                                0.0, 1.0, 5,
+                                                10.0, 20.0, 3);
+    for (unsigned k = 0; k < tab.numZ(); ++k) {
+        for (unsigned j = 0; j < tab.numY(); ++j) {
+            for (unsigned i = 0; i < tab.numX(); ++i) {
+                tab.setSamplePoint(i, j, k, f(tab.iToX(i), tab.jToY(j), tab.kToZ(k)));
+            }
+        }
+    }
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 3>;
+    const Scalar tolerance = std::is_same_v<Scalar, float> ? 1e-3 : 1e-10;
+    for (const Scalar x : { -1.0, -0.3, 0.9, 2.0 }) {
+        for (const Scalar y : { 0.0, 0.55, 1.0 }) {
+            for (const Scalar z : { 10.0, 13.7, 20.0 }) {
+                BOOST_CHECK(tab.applies(x, y, z));
+
+                const auto value = tab.eval(Eval::createVariable(x, 0),
+                                            Eval::createVariable(y, 1),
+                                            Eval::createVariable(z, 2));
+
+                BOOST_CHECK_CLOSE(value.value(), f(x, y, z), tolerance);
+                BOOST_CHECK_CLOSE(value.derivative(0), 2.0 + y*z, tolerance);
+                BOOST_CHECK_CLOSE(value.derivative(1), -1.0 + x*z, tolerance);
+                BOOST_CHECK_CLOSE(value.derivative(2), 0.5 + x*y, tolerance);
+            }
+        }
+    }
+
+    BOOST_CHECK(!tab.applies(Scalar{2.5}, Scalar{0.5}, Scalar{15.0}));
+}
+
+BOOST_AUTO_TEST_CASE(UniformTabulated3DFunctionAdaptive)
+{
+    auto f = [](double x, double y, double z)
+    { return std::exp(-x)*std::sin(2*y) + z; };
+
+    const double tolerance = 1e-4;
+
+    // The function is linear in z, so that axis is never refined.  An
+    // empty z-range gets a single sampling point.
+    Opm::UniformTabulated3DFunction<double> tab;
+    const double error = tab.sampleAdaptively(f, 0.0, 2.0, 0.0, 3.0, -1.0, 1.0, tolerance);
+    BOOST_CHECK_LE(error, tolerance);
+    BOOST_CHECK_EQUAL(tab.numZ(), 5u);
+    BOOST_CHECK_GT(tab.numX(), 5u);
+    BOOST_CHECK_GT(tab.numY(), tab.numX());
+
+    Opm::UniformTabulated3DFunction<double> flat;
+    flat.sampleAdaptively(f, 0.0, 2.0, 0.0, 3.0, 0.5, 0.5, tolerance);
+    BOOST_CHECK_EQUAL(flat.numZ(), 1u);
+    BOOST_CHECK_CLOSE(flat.eval(1.0, 1.0, 0.5), f(1.0, 1.0, 0.5), 1e-2);
+
+    // Interpolation error at the cell centres, where the errors along
+    // the axes add up, is within the estimate.
+    for (unsigned k = 0; k + 1 < tab.numZ(); ++k) {
+        for (unsigned j = 0; j + 1 < tab.numY(); ++j) {
+            for (unsigned i = 0; i + 1 < tab.numX(); ++i) {
+                const double x = 0.5*(tab.iToX(i) + tab.iToX(i + 1));
+                const double y = 0.5*(tab.jToY(j) + tab.jToY(j + 1));
+                const double z = 0.5*(tab.kToZ(k) + tab.kToZ(k + 1));
+                BOOST_CHECK_SMALL(tab.eval(x, y, z) - f(x, y, z), error);
+            }
+        }
+    }
+
+    // Sample limit is respected.
+    Opm::UniformTabulated3DFunction<double> coarse;
+    const double coarseError = coarse.sampleAdaptively(f, 0.0, 2.0, 0.0, 3.0, -1.0, 1.0,
+                                                       1e-12, /*maxSamples=*/1000);
+    BOOST_CHECK_GT(coarseError, 1e-12);
+    BOOST_CHECK_LE(coarse.samples().size(), 1000u);
+
+    // A function which is undefined somewhere cannot be tabulated.
+    auto g = [&f](double x, double y, double z)
+    { return (x > 1.5) ? std::log(1.5 - x) : f(x, y, z); };
+
+    Opm::UniformTabulated3DFunction<double> undefined;
+    BOOST_CHECK(std::isinf(undefined.sampleAdaptively(g, 0.0, 2.0, 0.0, 3.0, -1.0, 1.0,
+                                                      tolerance)));
+
+    // Also if it is undefined only between the initial sampling points.
+    auto h = [&f](double x, double y, double z)
+    { return (std::abs(x - 0.25) < 0.01) ? std::nan("") : f(x, y, z); };
+
+    Opm::UniformTabulated3DFunction<double> undefinedMidpoint;
+    BOOST_CHECK(std::isinf(undefinedMidpoint.sampleAdaptively(h, 0.0, 2.0, 0.0, 3.0, -1.0, 1.0,
+                                                              tolerance)));
+}
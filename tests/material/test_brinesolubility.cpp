@@ -0,0 +1,157 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Unit tests for the tabulated gas solubility of the brine PVT models.
+ *
+ * Within the tabulated range, the saturated gas dissolution factor must
+ * match the solubility correlation within the error estimate returned by
+ * tabulateSolubility().  Outside of it, the correlation must be used.
+ */
+#include "config.h"
+
+#include <boost/mpl/list.hpp>
+
+#define BOOST_TEST_MODULE BrineSolubility
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// Mole fraction of the dissolved gas corresponding to a dissolution factor.
+template <class Pvt, class Scalar>
+Scalar moleFraction(const Pvt& pvt, const Scalar rs, const Scalar gasMolarMass)
+{
+    const Scalar rhoG = rs*pvt.gasReferenceDensity(0);
+    const Scalar massFraction = rhoG/(pvt.oilReferenceDensity(0) + rhoG);
+    const Scalar brineMolarMass = Pvt::Brine::molarMass(pvt.salinity(0));
+
+    return massFraction*brineMolarMass
+        / (gasMolarMass*(1 - massFraction) + massFraction*brineMolarMass);
+}
+
+template <class Pvt, class Scalar>
+void checkSolubilityTable(const Scalar gasMolarMass)
+{
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 2>;
+
+    const auto salinity = std::vector<Scalar>{ 0.05 };
+    const Pvt correlation(salinity);
+    Pvt tabulated(salinity);
+
+    const Scalar tMin = 300.0, tMax = 380.0;
+    const Scalar pMin = 1.0e6, pMax = 3.0e7;
+    const Scalar error = tabulated.tabulateSolubility(tMin, tMax, pMin, pMax);
+    BOOST_REQUIRE(std::isfinite(error));
+    BOOST_CHECK_GT(error, 0.0);
+
+    // Inside the tabulated range, including its edges and corners.
+    constexpr auto fractions = std::array { 0.0, 0.13, 0.37, 0.5, 0.71, 0.94, 1.0 };
+    for (const auto ft : fractions) {
+        for (const auto fp : fractions) {
+            const Scalar T = tMin + ft*(tMax - tMin);
+            const Scalar p = pMin + fp*(pMax - pMin);
+
+            const Scalar rsRef = correlation.saturatedGasDissolutionFactor(0, T, p);
+            const Scalar rsTab = tabulated.saturatedGasDissolutionFactor(0, T, p);
+            BOOST_CHECK_SMALL(moleFraction(tabulated, rsTab, gasMolarMass) -
+                              moleFraction(correlation, rsRef, gasMolarMass), error);
+
+            const Eval rsTabEval = tabulated.saturatedGasDissolutionFactor(0,
+                                                                           Eval::createVariable(T, 0),
+                                                                           Eval::createVariable(p, 1));
+            BOOST_CHECK_CLOSE(rsTabEval.value(), rsTab, 1e-4);
+        }
+    }
+
+    // Outside of it, the dissolution factor is that of the correlation.
+    const Scalar tMid = (tMin + tMax)/2;
+    const Scalar pMid = (pMin + pMax)/2;
+    for (const auto& [T, p] : { std::array { tMin - 10, pMid }, std::array { tMax + 10, pMid },
+                                std::array { tMid, pMin/2 }, std::array { tMid, 2*pMax } })
+    {
+        BOOST_CHECK_EQUAL(tabulated.saturatedGasDissolutionFactor(0, T, p),
+                          correlation.saturatedGasDissolutionFactor(0, T, p));
+
+        const auto rsTab = tabulated.saturatedGasDissolutionFactor(0,
+                                                                   Eval::createVariable(T, 0),
+                                                                   Eval::createVariable(p, 1));
+        const auto rsRef = correlation.saturatedGasDissolutionFactor(0,
+                                                                     Eval::createVariable(T, 0),
+                                                                     Eval::createVariable(p, 1));
+        BOOST_CHECK_EQUAL(rsTab.value(), rsRef.value());
+        BOOST_CHECK_EQUAL(rsTab.derivative(0), rsRef.derivative(0));
+        BOOST_CHECK_EQUAL(rsTab.derivative(1), rsRef.derivative(1));
+    }
+
+    // If the tolerance is not reached within the sample limit, no table
+    // is used.
+    Pvt limited(salinity);
+    BOOST_CHECK_GT(limited.tabulateSolubility(tMin, tMax, pMin, pMax, 1.0e-12, 100), 1.0e-12);
+    BOOST_CHECK_EQUAL(limited.saturatedGasDissolutionFactor(0, tMid + 1, pMid),
+                      correlation.saturatedGasDissolutionFactor(0, tMid + 1, pMid));
+}
+
+} // Anonymous namespace
+
+using Types = boost::mpl::list<float,double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BrineCo2, Scalar, Types)
+{
+    using Pvt = Opm::BrineCo2Pvt<Scalar>;
+    checkSolubilityTable<Pvt>(Pvt::CO2::molarMass());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BrineH2, Scalar, Types)
+{
+    using Pvt = Opm::BrineH2Pvt<Scalar>;
+    checkSolubilityTable<Pvt>(Pvt::H2::molarMass());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BrineH2Undefined, Scalar, Types)
+{
+    // At one bar, water boils below the upper temperature, where the
+    // solubility correlation is undefined.  No table is used then.
+    const auto salinity = std::vector<Scalar>{ 0.05 };
+    const Opm::BrineH2Pvt<Scalar> correlation(salinity);
+    Opm::BrineH2Pvt<Scalar> tabulated(salinity);
+
+    BOOST_CHECK(std::isinf(tabulated.tabulateSolubility(300.0, 400.0, 1.0e5, 3.0e7)));
+
+    for (const Scalar T : { 300.0, 350.0 }) {
+        for (const Scalar p : { 1.0e5, 1.0e6, 3.0e7 }) {
+            BOOST_CHECK_EQUAL(tabulated.saturatedGasDissolutionFactor(0, T, p),
+                              correlation.saturatedGasDissolutionFactor(0, T, p));
+        }
+    }
+}
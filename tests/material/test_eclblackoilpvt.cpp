@@ -55,7 +55,14 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -407,3 +414,264 @@ BOOST_AUTO_TEST_CASE(RSCONST_ThrowsBelowBubblePoint)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// Batched evaluation of PVT objects set up without a deck.
+namespace {
+
+constexpr double bar = 1.0e5;
+
+template <class Scalar>
+void checkClose(const Scalar a, const Scalar b)
+{
+    const Scalar tolerance = std::is_same_v<Scalar, float> ? 1e-6 : 1e-13;
+    const Scalar scale = std::max({ Scalar{1}, std::abs(a), std::abs(b) });
+    BOOST_CHECK_MESSAGE(std::abs(a - b) <= tolerance*scale,
+                        "difference between " << a << " and " << b << " too large");
+}
+
+template <class Scalar, int numVars>
+void checkClose(const Opm::DenseAd::Evaluation<Scalar, numVars>& a,
+                const Opm::DenseAd::Evaluation<Scalar, numVars>& b)
+{
+    checkClose(a.value(), b.value());
+    for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+        checkClose(a.derivative(varIdx), b.derivative(varIdx));
+    }
+}
+
+// Batched viscosity and inverse formation volume factor must match the
+// per-cell ones.  Enough cells for several batches and a partial one.
+template <class Pvt, class Evaluation, class... Inputs>
+void checkPvtBatch(const Pvt& pvt,
+                   const std::vector<Evaluation>& temperature,
+                   const Inputs&... inputs)
+{
+    const std::size_t n = temperature.size();
+
+    std::vector<Evaluation> mu(n), invB(n);
+    pvt.viscosity(/*regionIdx=*/0, std::span<const Evaluation>{temperature},
+                  std::span<const Evaluation>{inputs}..., std::span<Evaluation>{mu});
+    pvt.inverseFormationVolumeFactor(/*regionIdx=*/0, std::span<const Evaluation>{temperature},
+                                     std::span<const Evaluation>{inputs}..., std::span<Evaluation>{invB});
+
+    for (std::size_t k = 0; k < n; ++k) {
+        checkClose(mu[k], pvt.viscosity(0, temperature[k], inputs[k]...));
+        checkClose(invB[k], pvt.inverseFormationVolumeFactor(0, temperature[k], inputs[k]...));
+    }
+
+    // Empty batches are no-ops.
+    pvt.viscosity(/*regionIdx=*/0, std::span<const Evaluation>{},
+                  std::span<const Evaluation>{inputs}.first(0)..., std::span<Evaluation>{});
+}
+
+template <class Evaluation, class Scalar>
+Evaluation variable(const Scalar value, const int varIdx)
+{
+    if constexpr (std::is_same_v<Evaluation, Scalar>) {
+        return value;
+    }
+    else {
+        return Evaluation::createVariable(value, varIdx);
+    }
+}
+
+// Cells with pressures and dissolved phase ratios in, and outside, the
+// tabulated ranges.
+template <class Evaluation>
+struct BatchCells
+{
+    using Scalar = typename Opm::MathToolbox<Evaluation>::Scalar;
+
+    explicit BatchCells(const Scalar ratioMax)
+    {
+        constexpr std::size_t n = 3*64 + 5;
+        for (std::size_t k = 0; k < n; ++k) {
+            temperature.push_back(Evaluation{350.0});
+            pressure.push_back(variable<Evaluation>(Scalar((5.0 + (k % 61)*10.0)*bar), 0));
+            ratio.push_back(variable<Evaluation>(Scalar((k % 43)/40.0*ratioMax), 1));
+            zero.push_back(Evaluation{0.0});
+        }
+    }
+
+    std::vector<Evaluation> temperature, pressure, ratio, zero;
+};
+
+// 10 saturated states, each with 6 undersaturated pressure nodes.
+template <class Scalar>
+Opm::LiveOilPvt<Scalar> makeLiveOilPvt()
+{
+    using Pvt = Opm::LiveOilPvt<Scalar>;
+
+    Pvt pvt;
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 0.9, 1000.0);
+
+    std::vector<std::pair<Scalar, Scalar>> rsSat, muSat;
+    for (std::size_t i = 0; i < 10; ++i) {
+        const Scalar pSat = (10.0 + 40.0*i) * bar;
+        rsSat.emplace_back(pSat, 5.0 + 15.0*i);
+        muSat.emplace_back(pSat, 2.0e-3 / (1.0 + 0.05*i));
+    }
+
+    pvt.setSaturatedOilGasDissolutionFactor(0, rsSat);
+    pvt.setSaturatedOilViscosity(0, muSat);
+
+    using Table = typename Pvt::TabulatedTwoDFunction;
+    Table invB { Table::InterpolationPolicy::LeftExtreme };
+    Table mu { Table::InterpolationPolicy::LeftExtreme };
+    for (std::size_t i = 0; i < rsSat.size(); ++i) {
+        const auto [pSat, rs] = rsSat[i];
+        invB.appendXPos(rs);
+        mu.appendXPos(rs);
+        for (std::size_t j = 0; j < 6; ++j) {
+            const Scalar p = pSat + 50.0*j*bar;
+            invB.appendSamplePoint(i, p, (1.0 + 1.0e-3*rs) * (1.0 + 1.5e-9*(p - pSat)));
+            mu.appendSamplePoint(i, p, muSat[i].second * (1.0 + 4.0e-9*(p - pSat)));
+        }
+    }
+
+    pvt.setInverseOilFormationVolumeFactor(0, invB);
+    pvt.setOilViscosity(0, mu);
+    pvt.initEnd();
+
+    return pvt;
+}
+
+template <class Scalar>
+void makeDeadOilPvt(Opm::DeadOilPvt<Scalar>& pvt)
+{
+    std::vector<Scalar> p, invB, mu;
+    for (std::size_t i = 0; i < 8; ++i) {
+        p.push_back((10.0 + 50.0*i) * bar);
+        invB.push_back(1.0 / (1.2 - 0.01*i));
+        mu.push_back(1.5e-3 + 0.1e-3*i);
+    }
+
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 0.9, 1000.0);
+    pvt.setInverseOilFormationVolumeFactor(0, Opm::Tabulated1DFunction<Scalar>{ p, invB });
+    pvt.setOilViscosity(0, Opm::Tabulated1DFunction<Scalar>{ p, mu });
+    pvt.initEnd();
+}
+
+// Each pressure node has its own number of vaporised oil ratio nodes.
+template <class Scalar>
+void makeWetGasPvt(Opm::WetGasPvt<Scalar>& pvt)
+{
+    using Pvt = Opm::WetGasPvt<Scalar>;
+    using Table = typename Pvt::TabulatedTwoDFunction;
+
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 0.9, 1000.0);
+
+    std::vector<std::pair<Scalar, Scalar>> rvSat;
+    Table invB { Table::InterpolationPolicy::RightExtreme };
+    Table mu { Table::InterpolationPolicy::RightExtreme };
+    for (std::size_t i = 0; i < 12; ++i) {
+        const Scalar p = (20.0 + 40.0*i) * bar;
+        const Scalar rvMax = 1.0e-5 * (1 + i);
+        rvSat.emplace_back(p, rvMax);
+
+        invB.appendXPos(p);
+        mu.appendXPos(p);
+        const std::size_t numRv = 2 + i % 4;
+        for (std::size_t j = 0; j < numRv; ++j) {
+            const Scalar rv = rvMax * j / (numRv - 1);
+            invB.appendSamplePoint(i, rv, p / (1.0e5 * (1.0 + 500.0*rv)));
+            mu.appendSamplePoint(i, rv, 1.0e-5 * (1.0 + 1.0e-8*p) * (1.0 + 1000.0*rv));
+        }
+    }
+
+    pvt.setSaturatedGasOilVaporizationFactor(0, rvSat);
+    pvt.setInverseGasFormationVolumeFactor(0, invB);
+    pvt.setGasViscosity(0, mu);
+    pvt.initEnd();
+}
+
+template <class Scalar>
+void makeDryGasPvt(Opm::DryGasPvt<Scalar>& pvt)
+{
+    std::vector<std::pair<Scalar, Scalar>> Bg;
+    std::vector<Scalar> p, mu;
+    for (std::size_t i = 0; i < 15; ++i) {
+        p.push_back((20.0 + 30.0*i) * bar);
+        Bg.emplace_back(p.back(), 1.0e5 / p.back());
+        mu.push_back(1.0e-5 * (1.0 + 0.05*i));
+    }
+
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 0.9, 1000.0);
+    pvt.setGasFormationVolumeFactor(0, Bg);
+    pvt.setGasViscosity(0, Opm::Tabulated1DFunction<Scalar>{ p, mu });
+    pvt.initEnd();
+}
+
+template <class Scalar>
+void makeWaterPvt(Opm::ConstantCompressibilityWaterPvt<Scalar>& pvt)
+{
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 0.9, 1000.0);
+    pvt.setReferencePressure(0, 100.0*bar);
+    pvt.setReferenceFormationVolumeFactor(0, 1.02);
+    pvt.setCompressibility(0, 4.0e-10);
+    pvt.setViscosity(0, 0.5e-3, 2.0e-10);
+    pvt.initEnd();
+}
+
+template <class Evaluation>
+void checkPvtBatches()
+{
+    using Scalar = typename Opm::MathToolbox<Evaluation>::Scalar;
+
+    const BatchCells<Evaluation> oilCells(150.0);
+    const BatchCells<Evaluation> gasCells(1.5e-4);
+
+    // Tabulated in two dimensions and batched natively.
+    const auto liveOil = makeLiveOilPvt<Scalar>();
+    checkPvtBatch(liveOil, oilCells.temperature, oilCells.pressure, oilCells.ratio);
+
+    Opm::OilPvtMultiplexer<Scalar> oilPvt;
+    oilPvt.setApproach(Opm::OilPvtApproach::LiveOil);
+    oilPvt.template getRealPvt<Opm::OilPvtApproach::LiveOil>() = liveOil;
+    checkPvtBatch(oilPvt, oilCells.temperature, oilCells.pressure, oilCells.ratio);
+
+    Opm::GasPvtMultiplexer<Scalar> gasPvt;
+    gasPvt.setApproach(Opm::GasPvtApproach::WetGas);
+    makeWetGasPvt(gasPvt.template getRealPvt<Opm::GasPvtApproach::WetGas>());
+    checkPvtBatch(gasPvt.template getRealPvt<Opm::GasPvtApproach::WetGas>(),
+                  gasCells.temperature, gasCells.pressure, gasCells.ratio, gasCells.zero);
+    checkPvtBatch(gasPvt, gasCells.temperature, gasCells.pressure, gasCells.ratio, gasCells.zero);
+
+    // Tabulated in one dimension.
+    Opm::GasPvtMultiplexer<Scalar> dryGasPvt;
+    dryGasPvt.setApproach(Opm::GasPvtApproach::DryGas);
+    makeDryGasPvt(dryGasPvt.template getRealPvt<Opm::GasPvtApproach::DryGas>());
+    checkPvtBatch(dryGasPvt.template getRealPvt<Opm::GasPvtApproach::DryGas>(),
+                  gasCells.temperature, gasCells.pressure, gasCells.zero, gasCells.zero);
+    checkPvtBatch(dryGasPvt, gasCells.temperature, gasCells.pressure, gasCells.zero, gasCells.zero);
+
+    // Analytic.
+    Opm::WaterPvtMultiplexer<Scalar> waterPvt;
+    waterPvt.setApproach(Opm::WaterPvtApproach::ConstantCompressibilityWater);
+    makeWaterPvt(waterPvt.template getRealPvt<Opm::WaterPvtApproach::ConstantCompressibilityWater>());
+    checkPvtBatch(waterPvt.template getRealPvt<Opm::WaterPvtApproach::ConstantCompressibilityWater>(),
+                  oilCells.temperature, oilCells.pressure, oilCells.zero, oilCells.zero);
+    checkPvtBatch(waterPvt, oilCells.temperature, oilCells.pressure, oilCells.zero, oilCells.zero);
+
+    // Dead oil has no batched evaluation, so the multiplexer evaluates it
+    // cell by cell.
+    Opm::OilPvtMultiplexer<Scalar> deadOilPvt;
+    deadOilPvt.setApproach(Opm::OilPvtApproach::DeadOil);
+    makeDeadOilPvt(deadOilPvt.template getRealPvt<Opm::OilPvtApproach::DeadOil>());
+    checkPvtBatch(deadOilPvt, oilCells.temperature, oilCells.pressure, oilCells.zero);
+}
+
+} // Anonymous namespace
+
+using BatchTypes = boost::mpl::list<float,double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEvaluation, Scalar, BatchTypes)
+{
+    checkPvtBatches<Scalar>();
+    checkPvtBatches<Opm::DenseAd::Evaluation<Scalar, 2>>();
+}
@@ -44,7 +44,10 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
+#include <array>
 #include <cstddef>
+#include <string>
+#include <vector>
 
 // values of strings taken from the SPE1 test case1 of opm-data
 static constexpr const char* fam1DeckString =
@@ -965,3 +968,169 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(CompactStorage, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(fam1DeckString);
+    const Opm::EclipseState eclState(deck);
+
+    const std::size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    MaterialLawManager compactMaterialLawManager;
+    compactMaterialLawManager.setCompactStorage(true);
+    compactMaterialLawManager.initFromState(eclState);
+    compactMaterialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    BOOST_CHECK(compactMaterialLawManager.compactStorage());
+
+    const auto& compact = compactMaterialLawManager;
+
+    // No end-point scaling, and a single saturation region.  All cells
+    // share the same parameter object, and have the region's end-points.
+    for (unsigned elemIdx = 1; elemIdx < n; ++elemIdx) {
+        BOOST_CHECK(&compact.materialLawParams(elemIdx) ==
+                    &compact.materialLawParams(0));
+    }
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        BOOST_CHECK(compact.oilWaterScaledEpsInfoDrainage(elemIdx) ==
+                    materialLawManager.oilWaterScaledEpsInfoDrainage(elemIdx));
+    }
+    BOOST_CHECK_CLOSE(compact.oilWaterScaledEpsInfoDrainage(n - 1).Swl, Scalar(0.12), 1.0e-5);
+
+    // Scaling a cell's capillary pressure gives it an object of its own.
+    materialLawManager.applyRestartSwatInit(0, 1.0e5);
+    compactMaterialLawManager.applyRestartSwatInit(0, 1.0e5);
+
+    BOOST_CHECK(&compact.materialLawParams(0) != &compact.materialLawParams(1));
+    BOOST_CHECK(&compact.materialLawParams(1) == &compact.materialLawParams(2));
+
+    // So does mutable access, leaving the other cells of the region
+    // alone.  References to other cells' objects remain valid.
+    const auto* params0 = &compact.materialLawParams(0);
+    const auto* params1 = &compactMaterialLawManager.mutableMaterialLawParams(1);
+    BOOST_CHECK(params1 == &compact.materialLawParams(1));
+    BOOST_CHECK(params1 != &compact.materialLawParams(2));
+    BOOST_CHECK(&compact.materialLawParams(2) == &compact.materialLawParams(3));
+    BOOST_CHECK(&compactMaterialLawManager.mutableMaterialLawParams(1) == params1);
+    BOOST_CHECK(&compactMaterialLawManager.materialLawParams(1) == params1);
+
+    const auto* params2 = &compactMaterialLawManager.materialLawParams(2);
+    BOOST_CHECK(params2 == &compact.materialLawParams(2));
+    BOOST_CHECK(params2 != &compact.materialLawParams(3));
+    BOOST_CHECK(params2 != params1);
+
+    const auto* params3 = &compactMaterialLawManager.materialLawParams(3, Opm::FaceDir::XPlus);
+    BOOST_CHECK(params3 == &compact.materialLawParams(3));
+    BOOST_CHECK(params3 != &compact.materialLawParams(4));
+    BOOST_CHECK(params0 == &compact.materialLawParams(0));
+
+    auto elems = std::vector<unsigned> { 1, 2, 3 };
+    for (unsigned elemIdx = 0; elemIdx < n; elemIdx += n / 10) {
+        elems.push_back(elemIdx);
+    }
+
+    for (const auto elemIdx : elems) {
+        for (int i = 0; i <= 100; i += 5) {
+            const Scalar Sw = Scalar(i) / 100;
+            for (int j = 0; j <= 100 - i; j += 5) {
+                const Scalar So = Scalar(j) / 100;
+                typename Fixture<Scalar>::FluidState fs;
+                fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+                fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, So);
+                fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, 1 - Sw - So);
+
+                std::array<Scalar,numPhases> pc{};
+                std::array<Scalar,numPhases> pcCompact{};
+                MaterialLaw::capillaryPressures(pc, materialLawManager.materialLawParams(elemIdx), fs);
+                MaterialLaw::capillaryPressures(pcCompact, compact.materialLawParams(elemIdx), fs);
+
+                std::array<Scalar,numPhases> kr{};
+                std::array<Scalar,numPhases> krCompact{};
+                MaterialLaw::relativePermeabilities(kr, materialLawManager.materialLawParams(elemIdx), fs);
+                MaterialLaw::relativePermeabilities(krCompact, compact.materialLawParams(elemIdx), fs);
+
+                for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                    BOOST_CHECK_EQUAL(pc[phaseIdx], pcCompact[phaseIdx]);
+                    BOOST_CHECK_EQUAL(kr[phaseIdx], krCompact[phaseIdx]);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(CompactStorageScaledEndPoints, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    // Gas-oil end-point scaling only, in the top layer.
+    auto deckString = std::string { fam1DeckString };
+    deckString.replace(deckString.find("DISGAS\n"), 7, "DISGAS\n\nENDSCALE\n/\n");
+    deckString += "\nBOX\n 1 10 1 10 1 1 /\nSGCR\n 100*0.1 /\nENDBOX\n";
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+
+    const std::size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    MaterialLawManager compactMaterialLawManager;
+    compactMaterialLawManager.setCompactStorage(true);
+    compactMaterialLawManager.initFromState(eclState);
+    compactMaterialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    const auto& compact = compactMaterialLawManager;
+
+    // Cells of the top layer have parameters of their own, the others
+    // share those of the saturation region.
+    for (unsigned elemIdx = 0; elemIdx < 100; ++elemIdx) {
+        BOOST_CHECK(&compact.materialLawParams(elemIdx) !=
+                    &compact.materialLawParams(100));
+    }
+    BOOST_CHECK(&compact.materialLawParams(0) != &compact.materialLawParams(1));
+    for (unsigned elemIdx = 101; elemIdx < n; ++elemIdx) {
+        BOOST_CHECK(&compact.materialLawParams(elemIdx) ==
+                    &compact.materialLawParams(100));
+    }
+
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        BOOST_CHECK(compact.oilWaterScaledEpsInfoDrainage(elemIdx) ==
+                    materialLawManager.oilWaterScaledEpsInfoDrainage(elemIdx));
+    }
+
+    for (const unsigned elemIdx : { 0u, 50u, 99u, 100u, 150u, 299u }) {
+        for (int i = 0; i <= 100; i += 5) {
+            const Scalar Sw = Scalar(i) / 100;
+            for (int j = 0; j <= 100 - i; j += 5) {
+                const Scalar So = Scalar(j) / 100;
+                typename Fixture<Scalar>::FluidState fs;
+                fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+                fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, So);
+                fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, 1 - Sw - So);
+
+                std::array<Scalar,numPhases> kr{};
+                std::array<Scalar,numPhases> krCompact{};
+                MaterialLaw::relativePermeabilities(kr, materialLawManager.materialLawParams(elemIdx), fs);
+                MaterialLaw::relativePermeabilities(krCompact, compact.materialLawParams(elemIdx), fs);
+
+                for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                    BOOST_CHECK_EQUAL(kr[phaseIdx], krCompact[phaseIdx]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,188 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Unit tests for the batched evaluation of Tabulated1DFunction.
+ *
+ * The batched sampling interval search must give the same intervals as
+ * the scalar one, and the batched evaluation the same values up to
+ * rounding.
+ */
+#include "config.h"
+
+#include <boost/mpl/list.hpp>
+
+#define BOOST_TEST_MODULE Tabulated1DFunction
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template <class Scalar>
+void checkClose(const Scalar a, const Scalar b)
+{
+    const Scalar tolerance = std::is_same_v<Scalar, float> ? 1e-6 : 1e-13;
+    const Scalar scale = std::max({ Scalar{1}, std::abs(a), std::abs(b) });
+    BOOST_CHECK_MESSAGE(std::abs(a - b) <= tolerance*scale,
+                        "difference between " << a << " and " << b << " too large");
+}
+
+template <class Scalar, int numVars>
+void checkClose(const Opm::DenseAd::Evaluation<Scalar, numVars>& a,
+                const Opm::DenseAd::Evaluation<Scalar, numVars>& b)
+{
+    checkClose(a.value(), b.value());
+    for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+        checkClose(a.derivative(varIdx), b.derivative(varIdx));
+    }
+}
+
+template <class Evaluation, class Scalar>
+Evaluation variable(const Scalar value)
+{
+    if constexpr (std::is_same_v<Evaluation, Scalar>) {
+        return value;
+    }
+    else {
+        return Evaluation::createVariable(value, 0);
+    }
+}
+
+// Unevenly spaced sampling points on [1, 1 + numSamples^2 / 4).
+template <class Scalar>
+Opm::Tabulated1DFunction<Scalar> makeTable(const std::size_t numSamples)
+{
+    std::vector<Scalar> x(numSamples), y(numSamples);
+    for (std::size_t i = 0; i < numSamples; ++i) {
+        x[i] = 1 + Scalar(i*i)/4 + Scalar(i)/8;
+        y[i] = std::sin(x[i]) + x[i]/2;
+    }
+
+    return { x, y, /*sortInputs=*/false };
+}
+
+// Positions on, between and outside the sampling points.
+template <class Evaluation, class Scalar>
+std::vector<Evaluation> makePositions(const Opm::Tabulated1DFunction<Scalar>& table,
+                                      const std::size_t n)
+{
+    const Scalar xMin = table.xMin();
+    const Scalar xMax = table.xMax();
+    std::vector<Evaluation> x;
+    x.reserve(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        if (k % 5 == 0) {
+            x.push_back(variable<Evaluation>(table.xAt((k / 5) % table.numSamples())));
+        }
+        else {
+            const Scalar s = Scalar(k % 53)/52;
+            x.push_back(variable<Evaluation>(xMin - 1 + s*(xMax - xMin + 2)));
+        }
+    }
+
+    return x;
+}
+
+template <class Evaluation, class Scalar>
+void checkBatch(const Opm::Tabulated1DFunction<Scalar>& table, const std::size_t n)
+{
+    const auto x = makePositions<Evaluation>(table, n);
+
+    std::vector<Evaluation> result(n);
+    table.eval(std::span<const Evaluation>{x}, std::span<Evaluation>{result},
+               /*extrapolate=*/true);
+
+    for (std::size_t k = 0; k < n; ++k) {
+        checkClose(result[k], table.eval(x[k], /*extrapolate=*/true));
+    }
+
+    const auto batch = std::min(n, Opm::Tabulated1DFunction<Scalar>::maxBatchSize);
+    std::vector<unsigned> segIdx(batch);
+    table.findSegmentIndices(std::span<const Evaluation>{x}.first(batch),
+                             std::span<unsigned>{segIdx},
+                             /*extrapolate=*/true);
+
+    for (std::size_t k = 0; k < batch; ++k) {
+        BOOST_CHECK_EQUAL(segIdx[k], table.findSegmentIndex(x[k], /*extrapolate=*/true).value);
+    }
+}
+
+} // Anonymous namespace
+
+using Types = boost::mpl::list<float,double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchEval, Scalar, Types)
+{
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+
+    // Two and three sampling points are special cases of the search.
+    for (const std::size_t numSamples : { 2, 3, 4, 5, 8, 37 }) {
+        BOOST_TEST_MESSAGE("Number of sampling points " << numSamples);
+
+        const auto table = makeTable<Scalar>(numSamples);
+
+        // Empty, partial, one full and several batches.
+        for (const std::size_t n : { 0, 1, 17, 64, 3*64 + 5 }) {
+            checkBatch<Scalar>(table, n);
+            checkBatch<Eval>(table, n);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchRange, Scalar, Types)
+{
+    const auto table = makeTable<Scalar>(10);
+
+    // Positions in the tabulated range, including its ends.
+    std::vector<Scalar> x = { table.xMin(), table.xAt(4), table.xMax() };
+    std::vector<Scalar> result(x.size());
+    table.eval(std::span<const Scalar>{x}, std::span<Scalar>{result});
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        checkClose(result[k], table.eval(x[k]));
+    }
+
+    // Positions outside the range require extrapolation...
+    x.push_back(table.xMax() + 1);
+    result.resize(x.size());
+    BOOST_CHECK_THROW(table.eval(std::span<const Scalar>{x}, std::span<Scalar>{result}),
+                      std::logic_error);
+
+    // ...and non-finite positions are never allowed.
+    x.back() = std::numeric_limits<Scalar>::quiet_NaN();
+    BOOST_CHECK_THROW(table.eval(std::span<const Scalar>{x}, std::span<Scalar>{result},
+                                 /*extrapolate=*/true),
+                      std::runtime_error);
+}
@@ -23,6 +23,7 @@
 #define BOOST_TEST_MODULE MLLayerTest
 #include <boost/test/unit_test.hpp>
 
+#include <opm/material/densead/Evaluation.hpp>
 #include <opm/ml/ml_model.hpp>
 
 #include <cmath>
@@ -197,3 +198,95 @@ BOOST_AUTO_TEST_CASE(NNLayerDenseApply)
     };
     check_vector_close(out, expected);
 }
+
+namespace {
+
+    template <class Evaluation>
+    Opm::ML::NNLayerDense<Evaluation> makeBatchTestLayer()
+    {
+        using Opm::ML::Tensor;
+
+        // Dense: 5 inputs, 3 outputs
+        Tensor<float> W(5, 3);
+        for (int i = 0; i < 5; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                W(i, j) = 0.25f*(i + 1) - 0.5f*j;
+            }
+        }
+
+        Tensor<float> b(3);
+        b(0) = 0.5; b(1) = -1.0; b(2) = 0.25;
+
+        return { W, b, Opm::ML::ActivationType::kTanh };
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(NNLayerDenseApplyBatch)
+{
+    using Opm::ML::Tensor;
+
+    auto layer = makeBatchTestLayer<double>();
+
+    // Number of rows not a multiple of the kernel's row block.
+    const int numRows = 7;
+    Tensor<double> in(numRows, 5);
+    for (int r = 0; r < numRows; ++r) {
+        for (int i = 0; i < 5; ++i) {
+            in(r, i) = 0.1*(r - 3) + 0.05*i + 0.013;
+        }
+    }
+
+    Tensor<double> out;
+    BOOST_REQUIRE(layer.applyBatch(in, out));
+    BOOST_REQUIRE_EQUAL(out.dims_.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out.dims_[0], numRows);
+    BOOST_REQUIRE_EQUAL(out.dims_[1], 3);
+
+    for (int r = 0; r < numRows; ++r) {
+        Tensor<double> row_in(5), row_out;
+        for (int i = 0; i < 5; ++i) {
+            row_in(i) = in(r, i);
+        }
+
+        BOOST_REQUIRE(layer.apply(row_in, row_out));
+        check_vector_close(row_out, { out(r, 0), out(r, 1), out(r, 2) }, 1e-12);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NNLayerDenseApplyBatchDerivatives)
+{
+    using Opm::ML::Tensor;
+    using Eval = Opm::DenseAd::Evaluation<double, 2>;
+
+    auto layer = makeBatchTestLayer<Eval>();
+
+    const int numRows = 6;
+    Tensor<Eval> in(numRows, 5);
+    for (int r = 0; r < numRows; ++r) {
+        for (int i = 0; i < 5; ++i) {
+            in(r, i) = 0.1*(r - 3) + 0.05*i + 0.013;
+            in(r, i).setDerivative(0, 1.0 + i);
+            in(r, i).setDerivative(1, 0.5*r);
+        }
+    }
+
+    Tensor<Eval> out;
+    BOOST_REQUIRE(layer.applyBatch(in, out));
+    BOOST_REQUIRE_EQUAL(out.dims_[0], numRows);
+    BOOST_REQUIRE_EQUAL(out.dims_[1], 3);
+
+    for (int r = 0; r < numRows; ++r) {
+        Tensor<Eval> row_in(5), row_out;
+        for (int i = 0; i < 5; ++i) {
+            row_in(i) = in(r, i);
+        }
+
+        BOOST_REQUIRE(layer.apply(row_in, row_out));
+        for (int j = 0; j < 3; ++j) {
+            BOOST_CHECK_CLOSE(out(r, j).value(), row_out(j).value(), 1e-10);
+            BOOST_CHECK_CLOSE(out(r, j).derivative(0), row_out(j).derivative(0), 1e-10);
+            BOOST_CHECK_CLOSE(out(r, j).derivative(1), row_out(j).derivative(1), 1e-10);
+        }
+    }
+}
@@ -36,7 +36,11 @@
 #include <tests/ml/ml_tools/include/test_dense_activation_10.hpp>
 #include <tests/ml/ml_tools/include/test_scalingdense_10x1.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <filesystem>
+#include <string>
 
 #include <fmt/format.h>
 
@@ -178,6 +182,60 @@ bool tensor_test()
     return true;
 }
 
+// Compares applyBatch() with apply() on each row, for batches which are
+// empty, within one block of rows, and several blocks with a partial last
+// block.
+template <class Evaluation>
+bool apply_batch_test(const std::string& model_name, const int num_in)
+{
+    std::printf("TEST apply_batch_test %s\n", model_name.c_str());
+
+    NNModel<Evaluation> model;
+    OPM_ERROR_IF(!model.loadModel(std::filesystem::current_path() / "ml/ml_tools/models" / (model_name + ".model")),
+                 "Failed to load model");
+
+    for (const int num_rows : {0, 1, 64, 2*64 + 17}) {
+        Tensor<Evaluation> in(num_rows, num_in);
+        for (int r = 0; r < num_rows; r++) {
+            for (int i = 0; i < num_in; i++) {
+                in(r, i) = Evaluation::createVariable(std::sin(0.7*r + 1.3*i), 0);
+            }
+        }
+
+        Tensor<Evaluation> out;
+        OPM_ERROR_IF(!model.applyBatch(in, out), "Failed to apply batch");
+        OPM_ERROR_IF(out.dims_.size() != 2 || out.dims_[0] != num_rows,
+                     fmt::format("\n Expected {} output rows", num_rows));
+
+        Tensor<Evaluation> row_in(num_in);
+        Tensor<Evaluation> row_out;
+        OPM_ERROR_IF(!model.apply(row_in, row_out), "Failed to apply");
+        OPM_ERROR_IF(out.dims_[1] != row_out.dims_[0],
+                     fmt::format("\n Expected {} outputs per row, got {}",
+                                 row_out.dims_[0], out.dims_[1]));
+
+        for (int r = 0; r < num_rows; r++) {
+            for (int i = 0; i < num_in; i++) {
+                row_in(i) = in(r, i);
+            }
+
+            OPM_ERROR_IF(!model.apply(row_in, row_out), "Failed to apply");
+            for (int j = 0; j < row_out.dims_[0]; j++) {
+                const auto& expected = row_out(j);
+                const auto& actual = out(r, j);
+                const auto scale = std::max(1.0, std::fabs(expected.value()));
+                const auto scale_d = std::max(1.0, std::fabs(expected.derivative(0)));
+                OPM_ERROR_IF(std::fabs(actual.value() - expected.value()) > 1e-12*scale ||
+                             std::fabs(actual.derivative(0) - expected.derivative(0)) > 1e-12*scale_d,
+                             fmt::format("\n Row {} output {}: expected {} got {}",
+                                         r, j, expected.value(), actual.value()));
+            }
+        }
+    }
+
+    return true;
+}
+
 } // namespace Opm
 
 int main()
@@ -196,6 +254,9 @@ int main()
         test_dense_10x10x10<Evaluation>(&load_time, &apply_time);
         test_dense_activation_10<Evaluation>(&load_time, &apply_time);
         test_scalingdense_10x1<Evaluation>(&load_time, &apply_time);
+        apply_batch_test<Evaluation>("test_dense_10x10x10", 10);
+        apply_batch_test<Evaluation>("test_dense_activation_10", 10);
+        apply_batch_test<Evaluation>("test_scalingdense_10x1", 1);
     }
     catch(...) {
         return 1;
@@ -41,10 +41,12 @@
 
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actdims.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionAST.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionParser.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionProgram.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
@@ -72,10 +74,12 @@
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -1962,6 +1966,136 @@ BOOST_AUTO_TEST_CASE(ParseNestedExpression)
                                   expected     .begin(), expected     .end());
 }
 
+BOOST_AUTO_TEST_CASE(Compiled_Condition_Matches_AST)
+{
+    using namespace std::string_literals;
+
+    const auto conditions = std::vector<std::vector<std::string>> {
+        { "FOPR"s, ">"s, "100"s },
+        { "WOPR"s, "OP1"s, ">"s, "1.0"s },
+        { "WOPR"s, "*"s, ">"s, "1.0"s, "AND"s, "WWCT"s, "*"s, "<"s, "0.50"s },
+        { "WOPR"s, "*"s, ">"s, "1.0"s, "OR"s, "WWCT"s, "*"s, "<"s, "0.50"s },
+        { "FOPR"s, ">"s, "100"s, "OR"s, "WWCT"s, "OP*"s, ">"s, "0.9"s },
+        { "FOPR"s, ">"s, "100"s, "OR"s, "FWCT"s, ">"s, "0.5"s, "OR"s, "WOPR"s, "*LIST"s, ">"s, "1.0"s },
+        { "FOPR"s, "<"s, "100"s, "AND"s, "WOPR"s, "\\*P*"s, ">"s, "1.0"s },
+        { "FWCT"s, ">"s, "0.5"s, "AND"s,
+          "("s, "WOPR"s, "OP*"s, ">"s, "1.0"s, "OR"s, "GWIR"s, "G1"s, "<"s, "11.0"s, ")"s, "AND"s,
+          "WWCT"s, "*"s, ">="s, "0.1"s },
+        { "("s, "FOPR"s, ">"s, "100"s, "OR"s, "WWCT"s, "*"s, ">"s, "2"s, ")"s, "AND"s,
+          "WOPR"s, "OP*"s, ">"s, "0.5"s },
+        { "MNTH"s, "="s, "4.3"s, "OR"s, "MNTH"s, ">"s, "JUN"s },
+    };
+
+    auto st = SummaryState { TimeService::now(), 0.0 };
+    auto wlm = WListManager{};
+    wlm.newList("*LIST", {"OP2", "IN1"});
+
+    auto nodes = std::vector<std::unique_ptr<Action::ASTNode>>{};
+    auto programs = std::vector<std::unique_ptr<Action::Program>>{};
+    for (const auto& tokens : conditions) {
+        nodes.push_back(Action::Parser::parseCondition(tokens));
+        programs.push_back(Action::Program::compile(*nodes.back()));
+
+        BOOST_REQUIRE_MESSAGE(programs.back() != nullptr,
+                              "Condition must be compilable");
+    }
+
+    const auto check = [&conditions, &nodes, &programs](const Action::Context& context)
+    {
+        for (auto i = 0*conditions.size(); i < conditions.size(); ++i) {
+            const auto expect = nodes[i]->eval(context);
+
+            BOOST_CHECK_MESSAGE(programs[i]->eval(context) == expect,
+                                "Compiled condition must match AST evaluation");
+            BOOST_CHECK_MESSAGE(Action::AST { conditions[i] }.eval(context) == expect,
+                                "AST must evaluate compiled condition");
+        }
+    };
+
+    const auto fill = [&st](const double scale)
+    {
+        st.update("FOPR", 150.0*scale);
+        st.update("FWCT", 0.6*scale);
+        st.update("MNTH", 4);
+        st.update_group_var("G1", "GWIR", 12.0*scale);
+
+        st.update_well_var("OP1", "WOPR", 2.0*scale);
+        st.update_well_var("OP2", "WOPR", 0.75*scale);
+        st.update_well_var("IN1", "WOPR", 0.0);
+        st.update_well_var("OP1", "WWCT", 0.95*scale);
+        st.update_well_var("OP2", "WWCT", 0.25*scale);
+        st.update_well_var("IN1", "WWCT", 0.0);
+    };
+
+    for (const auto scale : { 1.0, 0.5, 2.0, 0.0 }) {
+        fill(scale);
+
+        auto context = Action::Context { st, wlm };
+        check(context);
+
+        context.add("MNTH", 7);
+        check(context);
+    }
+
+    // Wells added after compilation must be picked up by the cached
+    // name pattern matches.
+    st.update_well_var("OP3", "WOPR", 5.0);
+    st.update_well_var("OP3", "WWCT", 0.05);
+    wlm.addWListWell("OP3", "*LIST");
+    check(Action::Context { st, wlm });
+
+    // A single program may be evaluated concurrently.  Alternate between
+    // two well sets so that threads also replace cached selections.
+    {
+        const auto context = Action::Context { st, wlm };
+
+        auto expect = std::vector<Action::Result>{};
+        for (const auto& node : nodes) {
+            expect.push_back(node->eval(context));
+        }
+
+        auto wlm2 = wlm;
+        wlm2.addWListWell("OP1", "*LIST");
+        auto st2 = st;
+        st2.update_well_var("OP4", "WOPR", 3.0);
+        st2.update_well_var("OP4", "WWCT", 0.15);
+        const auto context2 = Action::Context { st2, wlm2 };
+
+        auto expect2 = std::vector<Action::Result>{};
+        for (const auto& node : nodes) {
+            expect2.push_back(node->eval(context2));
+        }
+
+        auto mismatches = std::atomic<int>{0};
+        auto threads = std::vector<std::thread>{};
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t]()
+            {
+                for (int rep = 0; rep < 50; ++rep) {
+                    const auto second = ((rep + t) % 2) == 1;
+                    for (auto i = 0*programs.size(); i < programs.size(); ++i) {
+                        const auto res = programs[i]->eval(second ? context2 : context);
+                        if (! (res == (second ? expect2[i] : expect[i]))) {
+                            ++mismatches;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        BOOST_CHECK_EQUAL(mismatches.load(), 0);
+    }
+
+    // Conditions for which the AST evaluator raises an exception are not
+    // compiled.
+    BOOST_CHECK(Action::Program::compile(*Action::Parser::parseCondition
+                                         ({ "GWPR"s, "*"s, ">"s, "1.0"s })) == nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(RegionVector_In_Condition)
 {
     using namespace std::string_literals;
@@ -45,6 +45,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -337,6 +338,40 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(InternedNameAndDimensions) {
+    Dimension dim{ 100 };
+    Dimension defaultDim{ 1 };
+
+    DeckItem item1( "HEI", double(), { dim }, { defaultDim } );
+    DeckItem item2( std::string { "HEI" }, double(), { Dimension{ 100 } }, { Dimension{ 1 } } );
+    DeckItem item3( "HEI", double(), { defaultDim }, { defaultDim } );
+
+    BOOST_CHECK_EQUAL( &item1.name(), &item2.name() );
+    BOOST_CHECK_EQUAL( &item1.getActiveDimensions(), &item2.getActiveDimensions() );
+    BOOST_CHECK( &item1.getActiveDimensions() != &item3.getActiveDimensions() );
+
+    // Interned dimensions are shared, but values are not.
+    item1.push_back( 2.0 );
+    item2.push_backDefault( 2.0 );
+
+    BOOST_CHECK_EQUAL( 200 , item1.getSIDouble(0) );
+    BOOST_CHECK_EQUAL( 2   , item2.getSIDouble(0) );
+    BOOST_CHECK_EQUAL( 1U  , item3.getActiveDimensions().size() );
+    BOOST_CHECK_EQUAL( 0U  , item3.data_size() );
+
+    // Context dependent dimensions have no SI scaling, but are interned.
+    const Dimension contextDim{ std::numeric_limits<double>::quiet_NaN() };
+
+    DeckItem item4( "RATE", double(), { contextDim }, { contextDim } );
+    DeckItem item5( "RATE", double(), { contextDim }, { contextDim } );
+
+    BOOST_CHECK_EQUAL( &item4.getActiveDimensions(), &item5.getActiveDimensions() );
+
+    item4.push_back( 30.0 );
+    BOOST_CHECK_EQUAL( 30.0 , item4.get<double>(0) );
+    BOOST_CHECK_THROW( item4.getSIDouble(0), std::logic_error );
+}
+
 BOOST_AUTO_TEST_CASE(HasValue) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(0) );
@@ -42,6 +42,7 @@
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+#include <cmath>
 #include <cstddef>
 #include <cstdio>
 #include <ctime>
@@ -1602,6 +1603,70 @@ BOOST_AUTO_TEST_CASE(regularCartGrid) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(ActiveCellArrays) {
+    const auto regular = Opm::EclipseGrid(3, 4, 2, 25.0, 35.0, 2.0);
+
+    auto zcorn = regular.getZCORN();
+    for (std::size_t n = 0; n < zcorn.size(); ++n) {
+        zcorn[n] += 0.25 * (n % 5);
+    }
+
+    std::vector<int> actnum(regular.getCartesianSize(), 1);
+    actnum[1] = 0;
+    actnum[14] = 0;
+
+    Opm::EclipseGrid grid(regular.getNXYZ(), regular.getCOORD(), zcorn, actnum.data());
+    BOOST_REQUIRE_EQUAL(grid.getNumActive(), 22U);
+
+    std::vector<double> volume, depth, thickness;
+    std::vector<std::array<double, 3>> dims;
+    for (std::size_t a = 0; a < grid.getNumActive(); ++a) {
+        const auto g = grid.getGlobalIndex(a);
+        volume.push_back(grid.getCellVolume(g));
+        depth.push_back(grid.getCellDepth(g));
+        thickness.push_back(grid.getCellThickness(g));
+        dims.push_back(grid.getCellDims(g));
+    }
+
+    const auto& cellVolume = grid.activeVolume();
+    const auto cellDepth = grid.activeCellDepth();
+    const auto cellDims = grid.activeCellDims();
+
+    BOOST_REQUIRE_EQUAL(cellVolume.size(), grid.getNumActive());
+    BOOST_REQUIRE_EQUAL(cellDepth.size(), grid.getNumActive());
+    for (const auto& v : cellDims) {
+        BOOST_REQUIRE_EQUAL(v.size(), grid.getNumActive());
+    }
+
+    for (std::size_t a = 0; a < grid.getNumActive(); ++a) {
+        const auto g = grid.getGlobalIndex(a);
+
+        BOOST_CHECK_EQUAL(cellVolume[a], volume[a]);
+        BOOST_CHECK_EQUAL(cellDepth[a], depth[a]);
+        BOOST_CHECK_EQUAL(cellDims[2][a], thickness[a]);
+        for (std::size_t d = 0; d < 3; ++d) {
+            BOOST_CHECK_EQUAL(cellDims[d][a], dims[a][d]);
+        }
+
+        // Per-cell queries once bulk volumes are cached.
+        BOOST_CHECK_EQUAL(grid.getCellVolume(g), volume[a]);
+        BOOST_CHECK_EQUAL(grid.getCellDepth(g), depth[a]);
+        BOOST_CHECK_EQUAL(grid.getCellThickness(g), thickness[a]);
+        BOOST_CHECK(grid.getCellDims(g) == dims[a]);
+    }
+
+    // Copies share the cached volumes until the set of active cells
+    // changes.
+    const auto copy = grid;
+    BOOST_CHECK_EQUAL(&copy.activeVolume(), &grid.activeVolume());
+
+    grid.resetACTNUM();
+    BOOST_CHECK_EQUAL(grid.activeVolume().size(), grid.getCartesianSize());
+    BOOST_CHECK_EQUAL(grid.activeCellDepth().size(), grid.getCartesianSize());
+    BOOST_CHECK_EQUAL(grid.activeVolume()[1], grid.getCellVolume(1));
+    BOOST_CHECK_EQUAL(copy.activeVolume().size(), 22U);
+}
+
 BOOST_AUTO_TEST_CASE(CellDepthOverride_FromEDIT_DEPTHKeyword)
 {
     const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
@@ -1664,6 +1729,11 @@ END
     // EQUALS modifies only cell (2,1,1).
     BOOST_CHECK_CLOSE(grid.getCellDepth(1), 2000.0, 1e-12);
     BOOST_CHECK_CLOSE(grid.getCellDepth(1, 0, 0), 2000.0, 1e-12);
+
+    const auto depth = grid.activeCellDepth();
+    BOOST_REQUIRE_EQUAL(depth.size(), 2U);
+    BOOST_CHECK_CLOSE(depth[0], 105.0, 1e-12);
+    BOOST_CHECK_CLOSE(depth[1], 2000.0, 1e-12);
 }
 
 BOOST_AUTO_TEST_CASE(ZcornMapper) {
@@ -2895,6 +2965,16 @@ BOOST_AUTO_TEST_CASE(TESTCP_ACTNUM_AQUNUM) {
     for (std::size_t n=0; n< grid_actnum.size(); n++) {
         BOOST_CHECK_EQUAL( grid_actnum2[n], desired_actnum[n] );
     }
+
+    // Numerical aquifer cells report the aquifer depth, also in bulk.
+    const auto depth = grid.activeCellDepth();
+    BOOST_REQUIRE_EQUAL( depth.size(), grid.getNumActive() );
+    for (std::size_t a = 0; a < grid.getNumActive(); a++) {
+        BOOST_CHECK_EQUAL( depth[a], grid.getCellDepth(grid.getGlobalIndex(a)) );
+    }
+
+    BOOST_CHECK_CLOSE( depth[0], 2585.0, 1e-12 );
+    BOOST_CHECK_CLOSE( depth[1], 2585.0, 1e-12 );
 }
 
 BOOST_AUTO_TEST_CASE(TEST_altGridConstructors) {
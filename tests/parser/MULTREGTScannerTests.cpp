@@ -42,6 +42,7 @@
 #include <array>
 #include <initializer_list>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 BOOST_AUTO_TEST_SUITE(Basic)
@@ -802,6 +803,16 @@ namespace {
         double nnc(const std::array<int,3>& c1,
                    const std::array<int,3>& c2) const;
 
+        struct Connection
+        {
+            std::array<int,3> c1;
+            std::array<int,3> c2;
+            Opm::FaceDir::DirEnum direction;
+        };
+
+        /// Multipliers of all connections from a single batched call.
+        std::vector<double> batched(const std::vector<Connection>& conns) const;
+
     private:
         Opm::EclipseGrid grid_;
         Opm::FieldPropsManager fp_;
@@ -832,6 +843,25 @@ namespace {
                                     this->grid_.getGlobalIndex(c2[0], c2[1], c2[2]));
     }
 
+    std::vector<double>
+    TMultRegion::batched(const std::vector<Connection>& conns) const
+    {
+        auto c1 = std::vector<std::size_t>{};
+        auto c2 = std::vector<std::size_t>{};
+        auto dir = std::vector<Opm::FaceDir::DirEnum>{};
+
+        for (const auto& conn : conns) {
+            c1.push_back(this->grid_.getGlobalIndex(conn.c1[0], conn.c1[1], conn.c1[2]));
+            c2.push_back(this->grid_.getGlobalIndex(conn.c2[0], conn.c2[1], conn.c2[2]));
+            dir.push_back(conn.direction);
+        }
+
+        auto mult = std::vector<double>(conns.size(), -1.0);
+        this->scanner_.getRegionMultipliers(c1, c2, dir, mult);
+
+        return mult;
+    }
+
     Opm::Deck setup(const std::string& regsets,
                     const std::string& multregt)
     {
@@ -892,6 +922,15 @@ FLUXNUM
 1 5*2 / -- K=2
 )" };
         }
+
+        // Regions 1, 2 and 'large' in MULTNUM.
+        std::string three_regions(const int large)
+        {
+            const auto r = std::to_string(large);
+            return "MULTNUM\n"
+                "1 2 2 3*" + r + "   -- K=1\n"
+                "1 2 2 3*" + r + " / -- K=2\n\n";
+        }
     } // namespace Regions
 
     namespace Multregt {
@@ -926,6 +965,17 @@ MULTREGT
 /
 )" };
         }
+
+        std::string directional(const int large)
+        {
+            const auto r = std::to_string(large);
+            return "\nMULTREGT\n"
+                "  1 2  0.5   'Y'  'ALL' 'M' /\n"
+                "  2 " + r + " 0.25  'Y'  'ALL' 'M' /\n"
+                "  " + r + " " + r + " 0.1  'Z'  'ALL' 'M' /\n"
+                "  1 " + r + " 0.3   1*   'NNC' 'M' /\n"
+                "/\n";
+        }
     } // namespace Multregt
 } // Anonymous namespace
 
@@ -961,4 +1011,92 @@ BOOST_AUTO_TEST_CASE(Same_Conn_From_Multiple_Regsets)
     BOOST_CHECK_CLOSE(rmult.nnc({ 0, 1, 0 }, { 0, 0, 1 }), 0.05, 1.0e-8);
 }
 
+BOOST_AUTO_TEST_CASE(Batched_Connections)
+{
+    using Dir = Opm::FaceDir::DirEnum;
+
+    const auto conns = std::vector<TMultRegion::Connection> {
+        { { 0, 1, 0 }, { 0, 0, 1 }, Dir::YPlus  }, // NNC, regions (1,2) in both sets
+        { { 0, 0, 1 }, { 0, 1, 0 }, Dir::YMinus }, // Same NNC, reversed
+        { { 0, 0, 0 }, { 0, 2, 1 }, Dir::ZPlus  }, // NNC, regions (1,2) in both sets
+        { { 0, 0, 0 }, { 0, 1, 0 }, Dir::YPlus  }, // Neighbours
+        { { 0, 1, 0 }, { 0, 2, 1 }, Dir::YPlus  }, // NNC, same regions
+        { { 0, 0, 0 }, { 0, 0, 1 }, Dir::ZPlus  }, // Neighbours, same regions
+    };
+
+    {
+        const auto rmult = TMultRegion { setup(Regions::same(), Multregt::repeated()) };
+        const auto expect = std::vector { 0.1, 0.1, 0.1, 1.0, 1.0, 1.0 };
+
+        const auto mult = rmult.batched(conns);
+        BOOST_CHECK_EQUAL_COLLECTIONS(mult.begin(), mult.end(), expect.begin(), expect.end());
+    }
+
+    {
+        // The MULTNUM record replaces the FLUXNUM record for region pair
+        // (1,2), and the MULTNUM regions of these connections are (2,3).
+        const auto rmult = TMultRegion { setup(Regions::f_plus_one(), Multregt::repeated_different_regsets()) };
+        const auto expect = std::vector { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+        const auto mult = rmult.batched(conns);
+        BOOST_CHECK_EQUAL_COLLECTIONS(mult.begin(), mult.end(), expect.begin(), expect.end());
+    }
+
+    {
+        const auto rmult = TMultRegion { setup(Regions::f_plus_one(), Multregt::same_but_different()) };
+        const auto expect = std::vector { 0.05, 0.05, 0.05, 1.0, 1.0, 1.0 };
+
+        const auto mult = rmult.batched(conns);
+        BOOST_CHECK_EQUAL(mult.size(), expect.size());
+        for (auto i = 0*mult.size(); i < mult.size(); ++i) {
+            BOOST_CHECK_CLOSE(mult[i], expect[i], 1.0e-8);
+        }
+    }
+
+    {
+        const auto rmult = TMultRegion { setup(Regions::f_plus_one(), Multregt::none()) };
+        BOOST_CHECK(rmult.batched({}).empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Batched_Directional_Dense_And_Hashed)
+{
+    using Dir = Opm::FaceDir::DirEnum;
+
+    const auto conns = std::vector<TMultRegion::Connection> {
+        { { 0, 0, 0 }, { 0, 1, 0 }, Dir::YPlus  }, // (1,2), 'Y'
+        { { 0, 1, 0 }, { 0, 0, 0 }, Dir::YMinus }, // (2,1), 'Y'
+        { { 0, 0, 0 }, { 0, 1, 0 }, Dir::XPlus  }, // (1,2), wrong direction
+        { { 0, 2, 0 }, { 0, 3, 0 }, Dir::YPlus  }, // (2,L), 'Y', (L,L) is 'Z' only
+        { { 0, 2, 1 }, { 0, 3, 1 }, Dir::ZPlus  }, // (2,L) is 'Y' only, (L,L) applies
+        { { 0, 3, 0 }, { 0, 3, 1 }, Dir::ZPlus  }, // (L,L), applied once
+        { { 0, 2, 0 }, { 0, 2, 1 }, Dir::ZPlus  }, // (2,2), no record
+        { { 0, 0, 0 }, { 0, 3, 1 }, Dir::YPlus  }, // NNC (1,L)
+        { { 0, 0, 0 }, { 0, 3, 1 }, Dir::ZPlus  }, // NNC (1,L) and (L,L)
+        { { 0, 0, 0 }, { 0, 0, 1 }, Dir::ZPlus  }, // (1,1), no record
+    };
+
+    const auto expect = std::vector {
+        0.5, 0.5, 1.0, 0.25, 0.1, 0.1, 1.0, 0.3, 0.03, 1.0,
+    };
+
+    // Four records for region IDs up to 2000 or 3000 are too sparse for
+    // dense look-up tables.  The scanner uses hash tables instead.
+    for (const auto large : { 3, 2000, 3000 }) {
+        BOOST_TEST_MESSAGE("Largest region ID " << large);
+
+        const auto rmult = TMultRegion {
+            setup(Regions::three_regions(large), Multregt::directional(large))
+        };
+
+        const auto mult = rmult.batched(conns);
+        BOOST_CHECK_EQUAL(mult.size(), expect.size());
+        for (auto i = 0*mult.size(); i < mult.size(); ++i) {
+            BOOST_CHECK_CLOSE(mult[i], expect[i], 1.0e-8);
+            BOOST_CHECK_CLOSE(rmult.regular(conns[i].c1, conns[i].c2, conns[i].direction),
+                              expect[i], 1.0e-8);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // MultiRegSet
@@ -24,7 +24,10 @@
 #include <boost/version.hpp>
 
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <opm/common/utility/FileSystem.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
@@ -115,6 +118,126 @@ BOOST_AUTO_TEST_CASE(ParserKeyword_includeValid) {
 
 
 
+BOOST_AUTO_TEST_CASE(ParserKeyword_includePrefetch) {
+    for (const auto* dataFile : { "includeValid.data",
+                                  "PATHSInInclude.data",
+                                  "includeSymlinkTestdata/symlink3/case.data" })
+    {
+        std::filesystem::path inputFilePath(prefix() + dataFile);
+
+        Opm::Parser parser;
+        const auto expect = parser.parseFile(inputFilePath.string());
+
+        parser.includePrefetch(4);
+        const auto deck = parser.parseFile(inputFilePath.string());
+
+        BOOST_CHECK_MESSAGE(deck == expect, "Prefetched includes must not change deck " << dataFile);
+        BOOST_CHECK_EQUAL(deck.size(), expect.size());
+    }
+}
+
+
+
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_deckCache) {
+    std::filesystem::path inputFilePath(prefix() + "PATHSInInclude.data");
+    const auto cacheDir = std::filesystem::temp_directory_path() / Opm::unique_path("opm-deck-cache-%%%%-%%%%");
+
+    Opm::Parser parser;
+    const auto expect = parser.parseFile(inputFilePath.string());
+
+    parser.cacheDirectory(cacheDir.string());
+    const auto stored = parser.parseFile(inputFilePath.string());
+    BOOST_CHECK(stored == expect);
+    BOOST_CHECK_EQUAL(parser.cacheHits(), std::size_t{0});
+    BOOST_CHECK_EQUAL(std::distance(std::filesystem::directory_iterator(cacheDir),
+                                    std::filesystem::directory_iterator()), 1);
+
+    const auto loaded = parser.parseFile(inputFilePath.string());
+    BOOST_CHECK_EQUAL(parser.cacheHits(), std::size_t{1});
+    BOOST_CHECK(loaded == expect);
+    BOOST_CHECK_EQUAL(loaded.tree().root(), expect.tree().root());
+
+    std::filesystem::remove_all(cacheDir);
+}
+
+
+namespace {
+
+void writeFile(const std::filesystem::path& fname, const std::string& content)
+{
+    std::ofstream os(fname);
+    os << content;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_deckCacheInvalidation) {
+    const auto workDir = std::filesystem::temp_directory_path() / Opm::unique_path("opm-deck-cache-%%%%-%%%%");
+    const auto cacheDir = workDir / "cache";
+    std::filesystem::create_directories(workDir);
+
+    const auto dataFile = (workDir / "CASE.DATA").string();
+    writeFile(dataFile, "RUNSPEC\nINCLUDE\n 'PHASES.INC' /\nINCLUDE\n 'MISSING.INC' /\n");
+    writeFile(workDir / "PHASES.INC", "OIL\n");
+
+    Opm::Parser parser;
+    parser.cacheDirectory(cacheDir.string());
+
+    Opm::ParseContext parseContext;
+    parseContext.update(Opm::ParseContext::PARSE_MISSING_INCLUDE, Opm::InputErrorAction::WARN);
+
+    auto parse = [&parser, &parseContext, &dataFile](std::size_t& numWarnings)
+    {
+        Opm::ErrorGuard errors;
+        auto deck = parser.parseFile(dataFile, parseContext, errors, {});
+        numWarnings = errors.warnings().size();
+        return deck;
+    };
+
+    // Missing include file is recorded, and its warning replayed.
+    auto numWarnings = std::size_t{0};
+    {
+        const auto deck = parse(numWarnings);
+        BOOST_CHECK_EQUAL(parser.cacheHits(), std::size_t{0});
+        BOOST_CHECK_EQUAL(numWarnings, std::size_t{1});
+        BOOST_CHECK(deck.hasKeyword("OIL"));
+    }
+    {
+        const auto deck = parse(numWarnings);
+        BOOST_CHECK_EQUAL(parser.cacheHits(), std::size_t{1});
+        BOOST_CHECK_EQUAL(numWarnings, std::size_t{1});
+        BOOST_CHECK(deck.hasKeyword("OIL"));
+    }
+
+    // Edited include file, same size.
+    writeFile(workDir / "PHASES.INC", "GAS\n");
+    {
+        const auto deck = parse(numWarnings);
+        BOOST_CHECK_EQUAL(parser.cacheHits(), std::size_t{1});
+        BOOST_CHECK(deck.hasKeyword("GAS"));
+        BOOST_CHECK(! deck.hasKeyword("OIL"));
+    }
+    {
+        const auto deck = parse(numWarnings);
+        BOOST_CHECK_EQUAL(parser.cacheHits(), std::size_t{2});
+        BOOST_CHECK(deck.hasKeyword("GAS"));
+    }
+
+    // Previously missing include file now exists.
+    writeFile(workDir / "MISSING.INC", "WATER\n");
+    {
+        const auto deck = parse(numWarnings);
+        BOOST_CHECK_EQUAL(parser.cacheHits(), std::size_t{2});
+        BOOST_CHECK_EQUAL(numWarnings, std::size_t{0});
+        BOOST_CHECK(deck.hasKeyword("WATER"));
+    }
+
+    std::filesystem::remove_all(workDir);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(ParserKeyword_includeWrongCase) {
     std::filesystem::path inputFile1Path(prefix() + "includeWrongCase1.data");
     std::filesystem::path inputFile2Path(prefix() + "includeWrongCase2.data");
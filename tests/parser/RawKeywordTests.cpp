@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <boost/test/unit_test.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
+#include <opm/common/utility/OpmInputError.hpp>
 
 #include "../../opm/input/eclipse/Parser/raw/RawEnums.hpp"
 #include "../../opm/input/eclipse/Parser/raw/RawKeyword.hpp"
@@ -98,3 +99,37 @@ BOOST_AUTO_TEST_CASE(IsFinished) {
         BOOST_CHECK(kw5.isFinished());
     }
 }
+
+BOOST_AUTO_TEST_CASE(RawRecordElements) {
+    RawRecord rec(" 1  2.5 'A B' 3*4,\n 5 ", KeywordLocation("KW", "file", 100 ));
+    BOOST_CHECK_EQUAL(rec.size(), 5U);
+    BOOST_CHECK_EQUAL(rec.max_size(), 5U);
+    BOOST_CHECK_EQUAL(rec.getItem(2), "'A B'");
+    BOOST_CHECK_EQUAL(rec.getItem(4), "5");
+    BOOST_CHECK_THROW(rec.getItem(5), std::out_of_range);
+
+    BOOST_CHECK_EQUAL(rec.front(), "1");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "1");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "2.5");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "'A B'");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "3*4");
+    BOOST_CHECK_EQUAL(rec.size(), 1U);
+
+    rec.push_front("4", 2);
+    BOOST_CHECK_EQUAL(rec.size(), 3U);
+    BOOST_CHECK_EQUAL(rec.max_size(), 7U);
+    BOOST_CHECK_EQUAL(rec.getItem(1), "4");
+    BOOST_CHECK_EQUAL(rec.getItem(2), "5");
+
+    BOOST_CHECK_EQUAL(rec.pop_front(), "4");
+    BOOST_CHECK_EQUAL(rec.front(), "4");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "4");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "5");
+    BOOST_CHECK_EQUAL(rec.size(), 0U);
+
+    RawRecord text(" 1  2 ", KeywordLocation("KW", "file", 100 ), true);
+    BOOST_CHECK_EQUAL(text.size(), 1U);
+    BOOST_CHECK_EQUAL(text.pop_front(), " 1  2 ");
+
+    BOOST_CHECK_THROW(RawRecord("1 'A", KeywordLocation("KW", "file", 100 )), OpmInputError);
+}
@@ -18,6 +18,7 @@
  */
 
 #define BOOST_TEST_MODULE ParserTests
+#include <cmath>
 #include <stdexcept>
 #include <boost/test/unit_test.hpp>
 
@@ -125,3 +126,33 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "'123*456'" ) ) );
 }
+
+BOOST_AUTO_TEST_CASE( readValueToken_common_forms ) {
+    // Converted values are correctly rounded, i.e., identical to the
+    // compiler's interpretation of the same literal.
+    BOOST_CHECK_EQUAL( 0.1, Opm::readValueToken<double>( "0.1" ) );
+    BOOST_CHECK_EQUAL( 1500.1234, Opm::readValueToken<double>( "1500.1234" ) );
+    BOOST_CHECK_EQUAL( -1.5e3, Opm::readValueToken<double>( "-1.5E+03" ) );
+    BOOST_CHECK_EQUAL( 2.0e-3, Opm::readValueToken<double>( "2.0D-3" ) );
+    BOOST_CHECK_EQUAL( 2.0e-3, Opm::readValueToken<double>( "+2.0d-3" ) );
+    BOOST_CHECK_EQUAL( 0.5, Opm::readValueToken<double>( ".5" ) );
+    BOOST_CHECK_EQUAL( 5.0, Opm::readValueToken<double>( "5." ) );
+    BOOST_CHECK_EQUAL( 1.0e5, Opm::readValueToken<double>( "1.e5" ) );
+    BOOST_CHECK_EQUAL( 0.30000000000000004, Opm::readValueToken<double>( "0.30000000000000004" ) );
+    BOOST_CHECK_EQUAL( 1234567890123456789.0, Opm::readValueToken<double>( "1234567890123456789" ) );
+    BOOST_CHECK_EQUAL( 6.02214076e23, Opm::readValueToken<double>( "6.02214076D23" ) );
+    BOOST_CHECK_EQUAL( 1.0e-30, Opm::readValueToken<double>( "0.000000000000000000000000000001" ) );
+    BOOST_CHECK( std::signbit( Opm::readValueToken<double>( "-0.0" ) ) );
+
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "." ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "1e" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "1E+" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "+-1" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "1.0-5" ), std::invalid_argument );
+
+    BOOST_CHECK_EQUAL( 2147483647, Opm::readValueToken<int>( "2147483647" ) );
+    BOOST_CHECK_EQUAL( -2147483647 - 1, Opm::readValueToken<int>( "-2147483648" ) );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "2147483648" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "+-3" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "1e3" ), std::invalid_argument );
+}
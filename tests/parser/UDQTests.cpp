@@ -43,9 +43,11 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
@@ -1905,6 +1907,346 @@ BOOST_AUTO_TEST_CASE(DECK_TEST) {
         BOOST_CHECK( res[index].get() == (300 - 150)*0.90);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_COMPILED_EVAL)
+{
+    const KeywordLocation location{};
+    const UDQParams udqp;
+    const UDQFunctionTable udqft(udqp);
+
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2", "P3", "P4"}));
+
+    auto group_order = GroupOrder { std::size_t{3} };
+    group_order.add("G1");
+    group_order.add("G2");
+
+    UDQContext context(udqft, wm, group_order, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    // P4 has no WOPR value.
+    st.update_well_var("P1", "WOPR", 100.0);
+    st.update_well_var("P2", "WOPR", 200.0);
+    st.update_well_var("P3", "WOPR", 0.0);
+    st.update_well_var("P1", "WWPR", 10.0);
+    st.update_well_var("P2", "WWPR", 20.0);
+    st.update_well_var("P3", "WWPR", 30.0);
+    st.update_well_var("P4", "WWPR", 40.0);
+    st.update_group_var("G1", "GOPR", 123.0);
+    st.update_group_var("G2", "GOPR", 321.0);
+    st.update("FOPR", 1000.0);
+
+    const auto compiled = std::vector<std::pair<std::string, std::vector<std::string>>> {
+        { "WUA", { "WOPR", "+", "WWPR", "*", "2" } },
+        { "WUB", { "(", "WOPR", "-", "250", ")", "/", "WWPR" } },
+        { "WUC", { "SUM", "(", "WOPR", ")", "/", "WOPR" } },
+        { "WUD", { "NINT", "(", "WWPR", "/", "3", ")" } },
+        { "WUE", { "WOPR", "P1", "*", "2" } },
+        { "WUF", { "WOPR", ">", "150" } },
+        { "WUG", { "ABS", "(", "WOPR", "-", "WWPR", ")", "^", "0.5" } },
+        { "WUH", { "IDV", "(", "WOPR", ")" } },
+        { "FUA", { "SUM", "(", "WOPR", ")", "+", "FOPR" } },
+        { "FUB", { "AVEA", "(", "WWPR", ")", "*", "2" } },
+        { "FUC", { "MAX", "(", "GOPR", ")", "-", "MIN", "(", "GOPR", ")" } },
+        { "GUA", { "GOPR", "*", "0.5", "+", "10" } },
+        { "GUB", { "GOPR", "G1", "/", "GOPR" } },
+        { "WUI", { "WUA", "+", "WUH" } },
+        { "GUC", { "GUA", "-", "GOPR" } },
+    };
+
+    const auto ast_only = std::vector<std::pair<std::string, std::vector<std::string>>> {
+        { "WUX", { "WOPR", "'P*'" } },
+        { "WUY", { "SORTA", "(", "WWPR", ")" } },
+        { "WUZ", { "WOPR", "UADD", "WWPR" } },
+    };
+
+    auto scratch = UDQScratch{};
+    scratch.prepare(context);
+
+    auto check_define = [&](const std::string& keyword,
+                            const std::vector<std::string>& tokens,
+                            const bool expect_compiled)
+    {
+        BOOST_TEST_MESSAGE("Checking " << keyword);
+
+        const UDQDefine def(udqp, keyword, 0, location, tokens);
+        BOOST_CHECK_EQUAL(def.compiled(), expect_compiled);
+
+        const auto expect = def.eval(context);
+        def.eval_update(0, context, scratch);
+
+        if (def.var_type() == UDQVarType::FIELD_VAR) {
+            BOOST_CHECK_EQUAL(udq_state.has(keyword), expect[0].defined());
+            if (expect[0].defined()) {
+                BOOST_CHECK_EQUAL(udq_state.get(keyword), expect[0].get());
+                BOOST_CHECK_EQUAL(st.get(keyword), expect[0].get());
+            }
+
+            return;
+        }
+
+        const auto is_well = def.var_type() == UDQVarType::WELL_VAR;
+        const auto names = is_well ? wm.wells() : std::vector<std::string>{ "G1", "G2" };
+
+        for (const auto& name : names) {
+            const auto& elm = expect[name];
+            const auto has = is_well
+                ? udq_state.has_well_var(name, keyword)
+                : udq_state.has_group_var(name, keyword);
+
+            BOOST_CHECK_MESSAGE(has == elm.defined(),
+                                keyword << ":" << name << " definedness mismatch");
+
+            const auto value = is_well
+                ? udq_state.get_well_var(name, keyword)
+                : udq_state.get_group_var(name, keyword);
+            const auto summary = is_well
+                ? st.get_well_var(name, keyword)
+                : st.get_group_var(name, keyword);
+
+            if (elm.defined()) {
+                BOOST_CHECK_EQUAL(value, elm.get());
+                BOOST_CHECK_EQUAL(summary, elm.get());
+            }
+            else {
+                BOOST_CHECK_EQUAL(value, udqp.undefinedValue());
+                BOOST_CHECK_EQUAL(summary, udqp.undefinedValue());
+            }
+        }
+    };
+
+    for (const auto& [keyword, tokens] : compiled) {
+        check_define(keyword, tokens, true);
+    }
+
+    for (const auto& [keyword, tokens] : ast_only) {
+        check_define(keyword, tokens, false);
+    }
+
+    // Invalid arguments are diagnosed by the AST evaluator.
+    {
+        const UDQDefine def(udqp, "WULN", 0, location, { "LN", "(", "WOPR", ")" });
+        BOOST_CHECK(def.compiled());
+        BOOST_CHECK_THROW(def.eval_update(0, context, scratch), std::exception);
+    }
+
+    // Compiled results must follow changes to the summary state.
+    {
+        const UDQDefine def(udqp, "WUA", 0, location, { "WOPR", "+", "WWPR", "*", "2" });
+
+        st.update_well_var("P4", "WOPR", 50.0);
+        def.eval_update(1, context, scratch);
+
+        BOOST_CHECK(udq_state.has_well_var("P4", "WUA"));
+        BOOST_CHECK_EQUAL(udq_state.get_well_var("P4", "WUA"), 50.0 + 2*40.0);
+    }
+
+    // Bulk look-ups agree with per-well look-ups, also for wells which
+    // were unknown when the IDs were resolved.
+    {
+        const auto wells = std::vector<std::string> { "P1", "P4", "P5" };
+
+        auto ids = std::vector<std::optional<std::size_t>>{};
+        context.well_ids(wells, ids);
+        BOOST_CHECK(ids[0].has_value());
+        BOOST_CHECK(! ids[2].has_value());
+
+        st.update_well_var("P5", "WOPR", 500.0);
+
+        auto values = std::vector<double>(wells.size());
+        for (const auto* var : { "WOPR", "WWPR", "WUA", "WUH" }) {
+            context.get_well_var(var, wells, ids, values.data());
+
+            for (auto i = 0*wells.size(); i < wells.size(); ++i) {
+                const auto expect = context.get_well_var(wells[i], var);
+
+                BOOST_CHECK_MESSAGE(std::isnan(values[i]) == ! expect.has_value(),
+                                    var << ":" << wells[i] << " definedness mismatch");
+
+                if (expect.has_value()) {
+                    BOOST_CHECK_EQUAL(values[i], *expect);
+                }
+            }
+        }
+
+        BOOST_CHECK_THROW(context.get_well_var("WGOR", wells, ids, values.data()),
+                          std::logic_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_DEPENDENCY_GRAPH)
+{
+    const KeywordLocation location{};
+    const UDQParams udqp;
+    const UDQFunctionTable udqft(udqp);
+
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2"}));
+
+    auto group_order = GroupOrder { std::size_t{2} };
+    group_order.add("G1");
+
+    UDQContext context(udqft, wm, group_order, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 100.0);
+    st.update_well_var("P2", "WOPR", 200.0);
+    st.update("FOPR", 1000.0);
+
+    const auto defines = std::vector<UDQDefine> {
+        { udqp, "WUA", 0, location, { "WOPR", "*", "2" } },
+        { udqp, "FUB", 0, location, { "SUM", "(", "WUA", ")" } },
+        { udqp, "FUC", 0, location, { "FOPR", "+", "1" } },
+        { udqp, "WUD", 0, location, { "WUA", "+", "FUB" } },
+        { udqp, "FUE", 0, location, { "FUF", "+", "1" } },    // Previous FUF
+        { udqp, "FUF", 0, location, { "FOPR", "*", "3" } },
+        { udqp, "FUS", 0, location, { "FUS", "+", "1" } },    // Always evaluated
+    };
+
+    auto graph = UDQDependencyGraph{};
+    {
+        auto ptrs = std::vector<const UDQDefine*>{};
+        for (const auto& def : defines) {
+            ptrs.push_back(&def);
+        }
+
+        graph.build(ptrs);
+    }
+
+    BOOST_CHECK_EQUAL(graph.num_levels(), std::size_t{3});
+    BOOST_CHECK_EQUAL(graph.level("WUA").value(), std::size_t{0});
+    BOOST_CHECK_EQUAL(graph.level("FUB").value(), std::size_t{1});
+    BOOST_CHECK_EQUAL(graph.level("FUC").value(), std::size_t{0});
+    BOOST_CHECK_EQUAL(graph.level("WUD").value(), std::size_t{2});
+    BOOST_CHECK_EQUAL(graph.level("FUE").value(), std::size_t{0});
+    BOOST_CHECK_EQUAL(graph.level("FUF").value(), std::size_t{0});
+    BOOST_CHECK(!graph.level("FUX").has_value());
+
+    using Names = std::vector<std::string>;
+    auto check_evaluated = [&graph](const std::size_t report_step,
+                                    UDQContext& ctx, UDQState& state,
+                                    const Names& expect)
+    {
+        graph.eval(report_step, state, ctx);
+
+        const auto evaluated = graph.evaluated();
+        BOOST_CHECK_EQUAL_COLLECTIONS(evaluated.begin(), evaluated.end(),
+                                      expect.begin(), expect.end());
+    };
+
+    check_evaluated(0, context, udq_state, { "WUA", "FUC", "FUE", "FUF", "FUS", "FUB", "WUD" });
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("P1", "WUD"), 200.0 + 600.0);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("P2", "WUD"), 400.0 + 600.0);
+    BOOST_CHECK(!udq_state.has("FUE"));
+
+    // FUE saw the previous, undefined, value of FUF.
+    check_evaluated(0, context, udq_state, { "FUE", "FUS" });
+    BOOST_CHECK_EQUAL(udq_state.get("FUE"), 3001.0);
+
+    check_evaluated(0, context, udq_state, { "FUS" });
+
+    // Assigning the same value is not a change.
+    st.update_well_var("P2", "WOPR", 200.0);
+    check_evaluated(0, context, udq_state, { "FUS" });
+
+    // Changes propagate through dependent UDQs.
+    st.update_well_var("P2", "WOPR", 250.0);
+    check_evaluated(0, context, udq_state, { "WUA", "FUS", "FUB", "WUD" });
+    BOOST_CHECK_EQUAL(udq_state.get("FUB"), 700.0);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("P1", "WUD"), 200.0 + 700.0);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("P2", "WUD"), 500.0 + 700.0);
+
+    st.update("FOPR", 2000.0);
+    check_evaluated(0, context, udq_state, { "FUC", "FUF", "FUS" });
+    BOOST_CHECK_EQUAL(udq_state.get("FUC"), 2001.0);
+    BOOST_CHECK_EQUAL(udq_state.get("FUE"), 3001.0);
+
+    check_evaluated(0, context, udq_state, { "FUE", "FUS" });
+    BOOST_CHECK_EQUAL(udq_state.get("FUE"), 6001.0);
+
+    // Values overwritten outside of the UDQ evaluation are restored.
+    st.update_well_var("P1", "WUD", 0.0);
+    check_evaluated(0, context, udq_state, { "FUS" , "WUD" });
+
+    // New report step invalidates all recorded stamps.
+    check_evaluated(1, context, udq_state, { "WUA", "FUC", "FUE", "FUF", "FUS", "FUB", "WUD" });
+
+    // So does a new well.
+    WellMatcher wm3(NameOrder({"P1", "P2", "P3"}));
+    UDQContext context3(udqft, wm3, group_order, {}, UDQContext::MatcherFactories{}, st, udq_state);
+    check_evaluated(1, context3, udq_state, { "WUA", "FUC", "FUE", "FUF", "FUS", "FUB", "WUD" });
+    BOOST_CHECK(!udq_state.has_well_var("P3", "WUD"));
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("P1", "WUD"), 200.0 + 700.0);
+
+    // The schedule is a cache, so copies start out empty.
+    const auto copy = graph;
+    BOOST_CHECK(copy.empty());
+    BOOST_CHECK(!graph.empty());
+
+    // Preparing for a known version of the definitions keeps the recorded
+    // stamps, also when the definitions are a different copy.
+    const auto defines2 = defines;
+    auto ptrs2 = std::vector<const UDQDefine*>{};
+    for (const auto& def : defines2) {
+        ptrs2.push_back(&def);
+    }
+
+    graph.prepare(ptrs2, 17);
+    check_evaluated(1, context3, udq_state, { "WUA", "FUC", "FUE", "FUF", "FUS", "FUB", "WUD" });
+    graph.prepare(ptrs2, 17);
+    check_evaluated(1, context3, udq_state, { "FUS" });
+
+    // A new version rebuilds the schedule.
+    graph.prepare(ptrs2, 18);
+    check_evaluated(1, context3, udq_state, { "WUA", "FUC", "FUE", "FUF", "FUS", "FUB", "WUD" });
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_DEPENDENCY_GRAPH_IN_STATE)
+{
+    const KeywordLocation location{};
+    const UDQParams udqp;
+
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2"}));
+
+    auto group_order = GroupOrder { std::size_t{2} };
+    group_order.add("G1");
+
+    st.update_well_var("P1", "WOPR", 100.0);
+    st.update_well_var("P2", "WOPR", 200.0);
+
+    UDQConfig udq(udqp);
+    udq.add_define("FUA", location, { "SUM", "(", "WOPR", ")" }, 0);
+    udq.add_define("FUB", location, { "FUA", "*", "2" }, 0);
+
+    auto eval = [&](const UDQConfig& config, UDQState& state)
+    {
+        config.eval(0, wm, group_order, {}, {}, st, state);
+        return state.dependency_graph().evaluated();
+    };
+
+    using Names = std::vector<std::string>;
+
+    // The evaluation schedule, and the record of which UDQs are up to
+    // date, belongs to the UDQState rather than to the const UDQConfig.
+    UDQState state1(udqp.undefinedValue());
+    UDQState state2(udqp.undefinedValue());
+
+    BOOST_CHECK(eval(udq, state1) == Names({ "FUA", "FUB" }));
+    BOOST_CHECK(eval(udq, state1).empty());
+    BOOST_CHECK(eval(udq, state2) == Names({ "FUA", "FUB" }));
+    BOOST_CHECK_EQUAL(state2.get("FUB"), 600.0);
+
+    // Copies of the configuration share the schedule version.
+    const auto udq_copy = udq;
+    BOOST_CHECK(eval(udq_copy, state1).empty());
+
+    // Redefining a UDQ renews the version.
+    auto udq2 = udq;
+    udq2.add_define("FUB", location, { "FUA", "*", "3" }, 0);
+    BOOST_CHECK(eval(udq2, state1) == Names({ "FUA", "FUB" }));
+    BOOST_CHECK_EQUAL(state1.get("FUB"), 900.0);
+}
+
 BOOST_AUTO_TEST_CASE(UDQPARSE_TEST1)
 {
     const KeywordLocation location{};
@@ -0,0 +1,383 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE Test Chunked Summary
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/ChunkedSmry.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+using Opm::EclIO::ChunkedESmry;
+using Opm::EclIO::ChunkedSmryOutput;
+using Opm::EclIO::ESmry;
+
+namespace {
+
+const std::vector<std::string> keys  { "TIME", "FOPR", "WBHP:PROD", "FPR" };
+const std::vector<std::string> units { "DAYS", "SM3/DAY", "BARSA", "BARSA" };
+const std::vector<int> start { 1, 1, 2020, 0, 0, 0, 0 };
+
+struct Series
+{
+    std::vector<float> time;
+    std::vector<float> fopr;
+    std::vector<float> wbhp;
+    std::vector<float> fpr;
+    std::vector<int> rstep;
+};
+
+Series makeSeries(const std::size_t nstep)
+{
+    Series s;
+
+    for (std::size_t i = 0; i < nstep; ++i) {
+        s.time.push_back(0.5f * (i + 1));
+
+        // Piecewise constant rate, smooth pressure and a constant
+        // vector to exercise both block encodings.
+        s.fopr.push_back((i < nstep / 2) ? 1000.0f : 750.0f);
+        s.wbhp.push_back(250.0f - 0.37f * i);
+        s.fpr.push_back(300.0f);
+
+        s.rstep.push_back(static_cast<int>(i / 4) + 1);
+    }
+
+    return s;
+}
+
+void writeSeries(const std::string& filename, const Series& s,
+                 const std::size_t chunkSize, const bool compress)
+{
+    ChunkedSmryOutput out(filename, keys, units, start, chunkSize, compress);
+
+    for (std::size_t i = 0; i < s.time.size(); ++i) {
+        const bool last = (i + 1 == s.time.size());
+        out.write({ s.time[i], s.fopr[i], s.wbhp[i], s.fpr[i] }, s.rstep[i], last);
+    }
+
+    BOOST_CHECK_EQUAL(out.numberOfTimeSteps(), s.time.size());
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    WorkArea work;
+
+    const auto s = makeSeries(45);
+
+    for (const bool compress : { true, false }) {
+        const std::string filename = compress ? "PACKED.CSMRY" : "RAW.CSMRY";
+
+        writeSeries(filename, s, 8, compress);
+
+        ChunkedESmry smry(filename);
+
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), std::size_t{45});
+        BOOST_CHECK_EQUAL(smry.numberOfVectors(), keys.size());
+        BOOST_CHECK(smry.keywordList() == keys);
+        BOOST_CHECK(smry.start_v() == start);
+
+        BOOST_CHECK(smry.hasKey("WBHP:PROD"));
+        BOOST_CHECK(!smry.hasKey("WBHP:INJ"));
+        BOOST_CHECK_EQUAL(smry.get_unit("FOPR"), "SM3/DAY");
+
+        BOOST_CHECK(smry.get("TIME") == s.time);
+        BOOST_CHECK(smry.get("FOPR") == s.fopr);
+        BOOST_CHECK(smry.get("WBHP:PROD") == s.wbhp);
+        BOOST_CHECK(smry.get("FPR") == s.fpr);
+
+        const auto wkeys = smry.keywordList("W*");
+        BOOST_REQUIRE_EQUAL(wkeys.size(), std::size_t{1});
+        BOOST_CHECK_EQUAL(wkeys[0], "WBHP:PROD");
+
+        BOOST_CHECK_THROW(smry.get("WBHP:INJ"), std::invalid_argument);
+    }
+
+    // Delta coding of the mostly constant vectors must pay off.
+    BOOST_CHECK(std::filesystem::file_size("PACKED.CSMRY") <
+                std::filesystem::file_size("RAW.CSMRY"));
+}
+
+BOOST_AUTO_TEST_CASE(TimeWindow)
+{
+    WorkArea work;
+
+    const auto s = makeSeries(45);
+    writeSeries("WINDOW.CSMRY", s, 8, true);
+
+    ChunkedESmry smry("WINDOW.CSMRY");
+
+    // Window spanning three chunks.
+    {
+        const auto wbhp = smry.get("WBHP:PROD", 6, 21);
+        const std::vector<float> ref(s.wbhp.begin() + 6, s.wbhp.begin() + 21);
+        BOOST_CHECK(wbhp == ref);
+    }
+
+    // Window within the last, partial, chunk and clamped at the end.
+    {
+        const auto time = smry.get("TIME", 41, 100);
+        const std::vector<float> ref(s.time.begin() + 41, s.time.end());
+        BOOST_CHECK(time == ref);
+    }
+
+    BOOST_CHECK(smry.get("TIME", 20, 20).empty());
+    BOOST_CHECK(smry.get("TIME", 50, 60).empty());
+
+    const auto& seqIndex = smry.reportStepIndices();
+    BOOST_REQUIRE_EQUAL(seqIndex.size(), std::size_t{12});
+    BOOST_CHECK_EQUAL(seqIndex.front(), 3);
+    BOOST_CHECK_EQUAL(seqIndex.back(), 44);
+
+    const auto time_rs = smry.get_at_rstep("TIME");
+    BOOST_REQUIRE_EQUAL(time_rs.size(), seqIndex.size());
+    for (std::size_t i = 0; i < seqIndex.size(); ++i) {
+        BOOST_CHECK_EQUAL(time_rs[i], s.time[seqIndex[i]]);
+    }
+
+    const auto dates = smry.dates();
+    BOOST_REQUIRE_EQUAL(dates.size(), s.time.size());
+    BOOST_CHECK(dates.front() - smry.startdate() == std::chrono::hours(12));
+}
+
+BOOST_AUTO_TEST_CASE(PartialFile)
+{
+    WorkArea work;
+
+    const auto s = makeSeries(20);
+
+    // Header and footer are in place before the first chunk is written.
+    ChunkedSmryOutput out("PARTIAL.CSMRY", keys, units, start, 8, true);
+    {
+        ChunkedESmry smry("PARTIAL.CSMRY");
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), std::size_t{0});
+        BOOST_CHECK(smry.get("TIME").empty());
+    }
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        out.write({ s.time[i], s.fopr[i], s.wbhp[i], s.fpr[i] }, s.rstep[i], false);
+    }
+
+    // One full chunk written, two time steps pending.
+    {
+        ChunkedESmry smry("PARTIAL.CSMRY");
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), std::size_t{8});
+    }
+
+    out.flush();
+    {
+        ChunkedESmry smry("PARTIAL.CSMRY");
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), std::size_t{10});
+
+        const std::vector<float> ref(s.fopr.begin(), s.fopr.begin() + 10);
+        BOOST_CHECK(smry.get("FOPR") == ref);
+    }
+
+    BOOST_CHECK_THROW(out.write({ 1.0f, 2.0f }, 1, false), std::invalid_argument);
+    BOOST_CHECK_THROW(ChunkedESmry("NO_SUCH_FILE.CSMRY"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(InterruptedFlush)
+{
+    WorkArea work;
+
+    const auto s = makeSeries(12);
+
+    ChunkedSmryOutput out("APPEND.CSMRY", keys, units, start, 8, true);
+    for (std::size_t i = 0; i < 8; ++i) {
+        out.write({ s.time[i], s.fopr[i], s.wbhp[i], s.fpr[i] }, s.rstep[i], false);
+    }
+
+    const auto size1 = std::filesystem::file_size("APPEND.CSMRY");
+
+    for (std::size_t i = 8; i < 12; ++i) {
+        out.write({ s.time[i], s.fopr[i], s.wbhp[i], s.fpr[i] }, s.rstep[i], false);
+    }
+    out.flush();
+
+    BOOST_CHECK(std::filesystem::file_size("APPEND.CSMRY") > size1);
+
+    // A flush never writes over existing bytes, so cutting the file at
+    // its previous size leaves the first chunk and its footer intact.
+    std::filesystem::copy_file("APPEND.CSMRY", "CUT.CSMRY");
+    std::filesystem::resize_file("CUT.CSMRY", size1);
+
+    {
+        ChunkedESmry smry("CUT.CSMRY");
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), std::size_t{8});
+
+        const std::vector<float> ref(s.wbhp.begin(), s.wbhp.begin() + 8);
+        BOOST_CHECK(smry.get("WBHP:PROD") == ref);
+    }
+
+    {
+        ChunkedESmry smry("APPEND.CSMRY");
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), std::size_t{12});
+        BOOST_CHECK(smry.get("WBHP:PROD") == s.wbhp);
+    }
+
+    // Cutting the file during the second flush, i.e., within its vector
+    // blocks or its trailer, leaves a partial chunk after the first
+    // trailer.  The reader falls back to that trailer.
+    const auto size2 = std::filesystem::file_size("APPEND.CSMRY");
+    for (const auto cut : { size1 + 3, (size1 + size2) / 2, size2 - 3 }) {
+        std::filesystem::remove("CUT.CSMRY");
+        std::filesystem::copy_file("APPEND.CSMRY", "CUT.CSMRY");
+        std::filesystem::resize_file("CUT.CSMRY", cut);
+
+        ChunkedESmry smry("CUT.CSMRY");
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), std::size_t{8});
+
+        const std::vector<float> ref(s.wbhp.begin(), s.wbhp.begin() + 8);
+        BOOST_CHECK(smry.get("WBHP:PROD") == ref);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CorruptBlockSize)
+{
+    WorkArea work;
+
+    const auto s = makeSeries(8);
+    writeSeries("CORRUPT.CSMRY", s, 8, true);
+
+    auto getU64 = [](std::fstream& f, const std::uint64_t offset)
+    {
+        unsigned char bytes[8];
+        f.seekg(static_cast<std::streamoff>(offset));
+        f.read(reinterpret_cast<char*>(bytes), sizeof bytes);
+
+        auto v = std::uint64_t{0};
+        for (int i = 7; i >= 0; --i) {
+            v = (v << 8) | bytes[i];
+        }
+
+        return v;
+    };
+
+    // Trailer -> footer -> chunk index.  Overwrite the size of the first
+    // vector block with a value exceeding the file size.
+    {
+        const auto fileSize = std::filesystem::file_size("CORRUPT.CSMRY");
+        std::fstream f("CORRUPT.CSMRY", std::ios::in | std::ios::out | std::ios::binary);
+
+        const auto footer = getU64(f, fileSize - 16);
+        const auto index = getU64(f, footer);
+
+        const char huge[4] = { '\xff', '\xff', '\xff', '\x7f' };
+        f.seekp(static_cast<std::streamoff>(index + 4 * s.time.size() + 8));
+        f.write(huge, sizeof huge);
+    }
+
+    ChunkedESmry smry("CORRUPT.CSMRY");
+    BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), s.time.size());
+    BOOST_CHECK_THROW(smry.get("TIME"), std::runtime_error);
+    BOOST_CHECK(smry.get("FOPR") == s.fopr);
+}
+
+BOOST_AUTO_TEST_CASE(ConstantFlushSize)
+{
+    WorkArea work;
+
+    const auto s = makeSeries(50);
+
+    // Keys and units are written once, so each flush of a single,
+    // uncompressed, time step appends the same number of bytes however
+    // many chunks precede it.
+    ChunkedSmryOutput out("FLUSH.CSMRY", keys, units, start, 1, false);
+    std::vector<std::uintmax_t> sizes { std::filesystem::file_size("FLUSH.CSMRY") };
+    for (std::size_t i = 0; i < s.time.size(); ++i) {
+        out.write({ s.time[i], s.fopr[i], s.wbhp[i], s.fpr[i] }, s.rstep[i], false);
+        sizes.push_back(std::filesystem::file_size("FLUSH.CSMRY"));
+    }
+
+    const auto increment = sizes[1] - sizes[0];
+    for (std::size_t i = 2; i < sizes.size(); ++i) {
+        BOOST_CHECK_EQUAL(sizes[i] - sizes[i - 1], increment);
+    }
+
+    ChunkedESmry smry("FLUSH.CSMRY");
+    BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), s.time.size());
+    BOOST_CHECK(smry.keywordList() == keys);
+    BOOST_CHECK(smry.get("WBHP:PROD") == s.wbhp);
+    BOOST_CHECK(smry.get("FOPR", 20, 30) ==
+                std::vector<float>(s.fopr.begin() + 20, s.fopr.begin() + 30));
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentReads)
+{
+    WorkArea work;
+
+    const auto s = makeSeries(100);
+    writeSeries("CONCURRENT.CSMRY", s, 7, true);
+
+    const ChunkedESmry smry("CONCURRENT.CSMRY");
+
+    const std::vector<std::vector<float>> expect { s.time, s.fopr, s.wbhp, s.fpr };
+    std::vector<int> ok(8, 0);
+
+    {
+        std::vector<std::thread> readers;
+        for (std::size_t t = 0; t < ok.size(); ++t) {
+            readers.emplace_back([&smry, &expect, &ok, t]()
+            {
+                bool same = true;
+                for (int rep = 0; rep < 20; ++rep) {
+                    const auto k = (t + rep) % keys.size();
+                    same = same && (smry.get(keys[k]) == expect[k]);
+                }
+
+                ok[t] = same;
+            });
+        }
+
+        for (auto& reader : readers) {
+            reader.join();
+        }
+    }
+
+    for (const auto& o : ok) {
+        BOOST_CHECK(o);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NotAnESmry)
+{
+    WorkArea work;
+
+    writeSeries("CHUNKED.CSMRY", makeSeries(6), 4, true);
+    std::filesystem::copy_file("CHUNKED.CSMRY", "CHUNKED.SMSPEC");
+
+    BOOST_CHECK_THROW(ESmry("CHUNKED.CSMRY"), std::invalid_argument);
+    BOOST_CHECK_THROW(ESmry("CHUNKED.SMSPEC"), std::invalid_argument);
+    BOOST_CHECK_THROW(ESmry("CHUNKED"), std::invalid_argument);
+}
@@ -254,6 +254,72 @@ BOOST_AUTO_TEST_CASE(TestERst_2) {
     BOOST_CHECK_EQUAL(compare_files(testFile, outFile), true);
 }
 
+BOOST_AUTO_TEST_CASE(TestERst_2_MemoryMapped) {
+
+    std::string testFile="SPE1_TESTCASE.UNRST";
+    std::string outFile="TEST.UNRST";
+
+    // same as TestERst_2, but reading input file through memory mapping
+
+    WorkArea work;
+    work.copyIn(testFile);
+    ERst rst1(testFile, EclFile::MemoryMapped{true});
+    BOOST_CHECK(rst1.memoryMapped());
+    {
+        EclOutput eclTest(outFile, false);
+
+        std::vector<int> seqnums = rst1.listOfReportStepNumbers();
+
+        for (std::size_t i = 0; i < seqnums.size(); i++) {
+            rst1.loadReportStepNumber(seqnums[i]);
+            auto rstArrays = rst1.listOfRstArrays(seqnums[i]);
+
+            for (auto& array : rstArrays) {
+                std::string name = std::get<0>(array);
+                eclArrType arrType = std::get<1>(array);
+                readAndWrite(eclTest, rst1, name, seqnums[i], arrType);
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL(compare_files(testFile, outFile), true);
+}
+
+BOOST_AUTO_TEST_CASE(TestERst_2_MemoryMapped_Parallel) {
+
+    std::string testFile="SPE1_TESTCASE.UNRST";
+    std::string outFile="TEST.UNRST";
+
+    // same as TestERst_2, but reading input file through memory mapping
+    // and loading report steps in parallel
+
+    WorkArea work;
+    work.copyIn(testFile);
+    ERst rst1(testFile, EclFile::MemoryMapped{true});
+    BOOST_CHECK(rst1.memoryMapped());
+
+    // read and decode arrays of each report step concurrently
+    rst1.setNumLoadThreads(3);
+    {
+        EclOutput eclTest(outFile, false);
+
+        std::vector<int> seqnums = rst1.listOfReportStepNumbers();
+
+        for (std::size_t i = 0; i < seqnums.size(); i++) {
+            rst1.loadReportStepNumber(seqnums[i]);
+            auto rstArrays = rst1.listOfRstArrays(seqnums[i]);
+
+            for (auto& array : rstArrays) {
+                std::string name = std::get<0>(array);
+                eclArrType arrType = std::get<1>(array);
+                readAndWrite(eclTest, rst1, name, seqnums[i], arrType);
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL(compare_files(testFile, outFile), true);
+}
+
 BOOST_AUTO_TEST_CASE(TestERst_3) {
 
     std::string testFile="SPE1_TESTCASE.FUNRST";
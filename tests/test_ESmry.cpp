@@ -364,6 +364,49 @@ BOOST_AUTO_TEST_CASE(TestESmry_4) {
 
 }
 
+BOOST_AUTO_TEST_CASE(TestESmry_TimeWindow) {
+
+    // Base run data plus restart run, window crossing the restart
+    // point at time step 62.
+
+    ESmry smry_ref("SPE1CASE1_RST60.SMSPEC",true);
+
+    const auto& time_ref = smry_ref.get("TIME");
+    const auto& wbhp_ref = smry_ref.get("WBHP:PROD");
+    const auto& fopt_ref = smry_ref.get("FOPT");
+
+    ESmry smry1("SPE1CASE1_RST60.SMSPEC",true);
+
+    const auto wbhp = smry1.get("WBHP:PROD", 50, 80);
+    BOOST_REQUIRE_EQUAL(wbhp.size(), 30U);
+    for (std::size_t n = 0; n < wbhp.size(); n++)
+        BOOST_CHECK_EQUAL(wbhp[n], wbhp_ref[50 + n]);
+
+    // Last steps, every third, clamped at the end of the run.
+    const auto window = smry1.get_multiple({"TIME", "FOPT"}, 100, 1000, 3);
+    BOOST_REQUIRE_EQUAL(window.size(), 2U);
+    BOOST_REQUIRE_EQUAL(window[0].size(), (time_ref.size() - 100 + 2) / 3);
+
+    for (std::size_t n = 0; n < window[0].size(); n++) {
+        BOOST_CHECK_EQUAL(window[0][n], time_ref[100 + 3*n]);
+        BOOST_CHECK_EQUAL(window[1][n], fopt_ref[100 + 3*n]);
+    }
+
+    const auto time_rstep_ref = smry_ref.get_at_rstep("TIME");
+    const auto time_rstep = smry1.get_at_rstep("TIME", 10, 40, 10);
+    BOOST_REQUIRE_EQUAL(time_rstep.size(), 3U);
+    for (std::size_t n = 0; n < time_rstep.size(); n++)
+        BOOST_CHECK_EQUAL(time_rstep[n], time_rstep_ref[10 + 10*n]);
+
+    // Window reads do not load the full vector, get() still does.
+    BOOST_CHECK(smry1.get("WBHP:PROD") == wbhp_ref);
+    BOOST_CHECK(smry1.get("WBHP:PROD", 0, 5) == std::vector<float>(wbhp_ref.begin(), wbhp_ref.begin() + 5));
+
+    BOOST_CHECK(smry1.get("TIME", 40, 40).empty());
+    BOOST_CHECK_THROW(smry1.get("TIME", 0, 10, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(smry1.get("NO_SUCH_KEY", 0, 10), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(TestESmry_5) {
 
     // file MODEL1_IX.SMSPEC and MODEL1_IX.UNSMRY are output from comercial simulator ix with
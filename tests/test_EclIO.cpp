@@ -34,7 +34,9 @@
 #include <tuple>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <numeric>
+#include <span>
 
 #include <math.h>
 #include <stdio.h>
@@ -93,6 +95,58 @@ void write_header(std::ofstream& ofileH, const std::string& arrName,
 
 } // Anonymous namespace
 
+BOOST_AUTO_TEST_CASE(TestFlipEndian_Bulk)
+{
+    // odd lengths to exercise both vectorised part and remainder
+
+    std::vector<int> ivect(37);
+    std::iota(ivect.begin(), ivect.end(), -17);
+
+    std::vector<double> dvect(23);
+    std::iota(dvect.begin(), dvect.end(), -3.25);
+
+    std::vector<float> fvect(19);
+    std::iota(fvect.begin(), fvect.end(), 1.5f);
+
+    {
+        auto flipped = ivect;
+        flipEndian(std::span<int>{ flipped });
+
+        for (std::size_t n = 0; n < ivect.size(); ++n) {
+            BOOST_CHECK_EQUAL(flipped[n], flipEndianInt(ivect[n]));
+        }
+
+        flipEndian(std::span<int>{ flipped });
+        BOOST_CHECK(flipped == ivect);
+    }
+
+    {
+        std::vector<double> flipped(dvect.size() + 2, 0.0);
+        flipEndian(std::span<const double>{ dvect }, std::span<double>{ flipped });
+
+        for (std::size_t n = 0; n < dvect.size(); ++n) {
+            const auto expect = flipEndianDouble(dvect[n]);
+            BOOST_CHECK(std::memcmp(&flipped[n], &expect, sizeof(double)) == 0);
+        }
+
+        BOOST_CHECK_EQUAL(flipped[dvect.size()], 0.0);
+
+        BOOST_CHECK_THROW(flipEndian(std::span<const double>{ dvect },
+                                     std::span<double>{ flipped }.first(3)),
+                          std::invalid_argument);
+    }
+
+    {
+        std::vector<float> flipped(fvect.size());
+        flipEndian(std::span<const float>{ fvect }, std::span<float>{ flipped });
+
+        for (std::size_t n = 0; n < fvect.size(); ++n) {
+            const auto expect = flipEndianFloat(fvect[n]);
+            BOOST_CHECK(std::memcmp(&flipped[n], &expect, sizeof(float)) == 0);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestEclFile_X231)
 {
     WorkArea work;
@@ -244,6 +298,78 @@ BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED)
 
 }
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryMapped)
+{
+    std::string testFile="ECLFILE.INIT";
+
+    // loading data both through file streams and memory mapping. Check
+    // that array lists and data vectors are identical
+
+    EclFile file1(testFile);
+    file1.loadData();
+
+    EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+    BOOST_CHECK(! file1.memoryMapped());
+    BOOST_CHECK(file2.memoryMapped());
+
+    BOOST_CHECK(file1.getList() == file2.getList());
+
+    BOOST_CHECK(file1.get<int>("ICON") == file2.get<int>("ICON"));
+    BOOST_CHECK(file1.get<float>("PORV") == file2.get<float>("PORV"));
+    BOOST_CHECK(file1.get<double>("XCON") == file2.get<double>("XCON"));
+    BOOST_CHECK(file1.get<bool>("LOGIHEAD") == file2.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(file1.get<std::string>("KEYWORDS") == file2.get<std::string>("KEYWORDS"));
+
+    BOOST_CHECK_EQUAL(file1.is_ix(), file2.is_ix());
+
+    // memory mapping is not used for formatted files
+
+    EclFile file3("ECLFILE.FINIT", EclFile::MemoryMapped{true});
+    BOOST_CHECK(! file3.memoryMapped());
+
+    // truncated file
+
+    WorkArea work;
+
+    {
+        std::ifstream ifileH(work.org_path("ECLFILE.INIT"), std::ios::binary);
+        std::vector<char> buffer(std::istreambuf_iterator<char>(ifileH), {});
+
+        std::ofstream ofileH("TRUNC.INIT", std::ios::binary);
+        ofileH.write(buffer.data(), 4000);
+    }
+
+    EclFile file4("TRUNC.INIT", EclFile::MemoryMapped{true});
+    BOOST_CHECK_THROW(file4.loadData(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_ParallelLoad)
+{
+    std::string testFile="ECLFILE.INIT";
+
+    EclFile file1(testFile);
+    file1.loadData();
+
+    BOOST_CHECK_EQUAL(file1.numLoadThreads(), 1);
+    BOOST_CHECK_THROW(file1.setNumLoadThreads(0), std::invalid_argument);
+
+    for (const bool mmap : { false, true }) {
+        EclFile file2(testFile, EclFile::MemoryMapped{mmap});
+        file2.setNumLoadThreads(4);
+
+        std::vector<int> arrIndex(file2.size());
+        std::iota(arrIndex.rbegin(), arrIndex.rend(), 0);
+        file2.loadData(arrIndex);
+
+        BOOST_CHECK(file1.get<int>("ICON") == file2.get<int>("ICON"));
+        BOOST_CHECK(file1.get<float>("PORV") == file2.get<float>("PORV"));
+        BOOST_CHECK(file1.get<double>("XCON") == file2.get<double>("XCON"));
+        BOOST_CHECK(file1.get<bool>("LOGIHEAD") == file2.get<bool>("LOGIHEAD"));
+        BOOST_CHECK(file1.get<std::string>("KEYWORDS") == file2.get<std::string>("KEYWORDS"));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestEclFile_IX)
 {
     // file MODEL1_IX.INIT is output from comercial simulator ix with
@@ -359,6 +485,51 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_not_finite)
     BOOST_CHECK_EQUAL(file1.size(), 2U);
 }
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_single_precision)
+{
+    // Values spanning several binary (1000 element) and formatted
+    // records.  Output must be identical to that of the equivalent float
+    // array.
+
+    std::vector<double> values(2345);
+    std::iota(values.begin(), values.end(), 0.0);
+    std::transform(values.begin(), values.end(), values.begin(),
+                   [](const double x) { return 1.0e5 * std::sin(x) / 3.0; });
+
+    const auto floats = std::vector<float>(values.begin(), values.end());
+
+    WorkArea work;
+    for (const auto formatted : { false, true }) {
+        const std::string floatFile  = formatted ? "FLOAT.FDAT"  : "FLOAT.DAT";
+        const std::string doubleFile = formatted ? "DOUBLE.FDAT" : "DOUBLE.DAT";
+
+        {
+            EclOutput eclTest(floatFile, formatted);
+            eclTest.write("PRESSURE", floats);
+            eclTest.write("EMPTY", std::vector<float>{});
+        }
+
+        {
+            EclOutput eclTest(doubleFile, formatted);
+            eclTest.writeSinglePrecision("PRESSURE", values);
+            eclTest.writeSinglePrecision("EMPTY", std::vector<double>{});
+        }
+
+        BOOST_CHECK_MESSAGE(compare_files(floatFile, doubleFile),
+                            "Single precision output must match float array output "
+                            "(formatted = " << std::boolalpha << formatted << ')');
+
+        if (! formatted) {
+            EclFile file1(doubleFile);
+            file1.loadData();
+
+            const auto& pressure = file1.get<float>("PRESSURE");
+            BOOST_CHECK_EQUAL_COLLECTIONS(pressure.begin(), pressure.end(),
+                                          floats.begin(), floats.end());
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_getList)
 {
     std::string inputFile="ECLFILE.INIT";
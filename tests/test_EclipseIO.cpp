@@ -57,9 +57,11 @@
 #include <cstddef>
 #include <fstream>
 #include <ios>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -243,6 +245,14 @@ void checkRestartFile( int timeStepIdx ) {
     }
 }
 
+std::vector<char> fileContents(const std::string& fname)
+{
+    std::ifstream is(fname, std::ios::binary);
+    BOOST_REQUIRE_MESSAGE(is.good(), "Unable to open " << fname);
+
+    return { std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{} };
+}
+
 time_t ecl_util_make_date( const int day, const int month, const int year )
 {
     const auto ymd = Opm::TimeStampUTC::YMD{ year, month, day };
@@ -300,7 +310,7 @@ WELSPECS
 /
 )" };
 
-    auto write_and_check = [&deckString]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&deckString]( int first = 1, int last = 5, bool async = false ) {
         const auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         const auto& eclGrid = es.getInputGrid();
@@ -310,6 +320,9 @@ WELSPECS
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        if (async) {
+            eclWriter.enableAsyncOutput();
+        }
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -357,7 +370,15 @@ WELSPECS
                                     first_step - start_time,
                                     std::move(restart_value));
 
-            checkRestartFile(i);
+            if (! async) {
+                checkRestartFile(i);
+            }
+        }
+
+        if (async) {
+            // Single fence after all steps have been queued.
+            eclWriter.flushOutput();
+            checkRestartFile(last - 1);
         }
 
         checkInitFile(deck, eGridProps);
@@ -432,6 +453,138 @@ WELSPECS
     // Verify that restarting a simulation, then writing fewer steps truncates
     // the file
     BOOST_CHECK_EQUAL(file_size, write_and_check(3, 5));
+
+    // Restart files written on a background thread must be identical to
+    // those written synchronously.
+    BOOST_CHECK_EQUAL(file_size, write_and_check(1, 5, true));
+}
+
+BOOST_AUTO_TEST_CASE(EclipseIOAsyncOutput)
+{
+    const auto deck = Parser().parseString(R"(RUNSPEC
+UNIFOUT
+OIL
+GAS
+WATER
+METRIC
+DIMENS
+3 3 3/
+START
+10 OCT 2008 /
+WELLDIMS
+2 1 1 2 /
+GRID
+DXV
+1.0 2.0 3.0 /
+DYV
+4.0 5.0 6.0 /
+DZV
+7.0 8.0 9.0 /
+TOPS
+9*100 /
+PORO
+27*0.15 /
+PERMX
+27*1 /
+PROPS
+REGIONS
+SOLUTION
+RPTRST
+BASIC=1
+/
+SUMMARY
+FOPR
+FOPT
+WOPR
+ 'PROD' /
+WBHP
+ /
+SCHEDULE
+WELSPECS
+'INJ' 'G' 1 1 2000 'GAS' /
+'PROD' 'G' 3 3 1000 'OIL' /
+/
+TSTEP
+1.0 2.0 3.0 4.0 5.0 6.0 7.0 /
+)");
+
+    auto es = EclipseState(deck);
+    es.getIOConfig().setBaseName("FOO");
+    const auto& eclGrid = es.getInputGrid();
+    const Schedule schedule(deck, es, std::make_shared<Python>());
+    const SummaryConfig summary_config(deck, schedule, es.fieldProps(), es.aquifer());
+
+    const auto fileNames = std::vector<std::string> {
+        "FOO.UNRST", "FOO.SMSPEC", "FOO.UNSMRY",
+    };
+
+    // Write report steps 1..6 without waiting for any output, then wait
+    // once.  The summary state changes between steps, so every pending
+    // restart file must hold the values current at its own step.  Returns
+    // the restart and summary file contents.
+    auto write = [&](const std::optional<std::size_t> maxPending)
+    {
+        WorkArea work_area("test_ecl_writer_async");
+
+        auto files = std::vector<std::vector<char>>{};
+        {
+            EclipseIO eclWriter(es, eclGrid, schedule, summary_config);
+            if (maxPending.has_value()) {
+                eclWriter.enableAsyncOutput(*maxPending);
+            }
+
+            eclWriter.writeInitial();
+
+            using measure = UnitSystem::measure;
+            using TargetType = data::TargetType;
+
+            SummaryState st(TimeService::from_time_t(schedule.getStartTime()), 0.0);
+            for (int i = 1; i < 7; ++i) {
+                st.update_elapsed(schedule.seconds(i) - schedule.seconds(i - 1));
+                st.update("FOPR", 100.0 * i);
+                st.update("FOPT", 100.0 * i);
+                st.update_well_var("PROD", "WOPR", 10.0 * i);
+                st.update_well_var("PROD", "WBHP", 200.0 + i);
+                st.update_well_var("INJ", "WBHP", 300.0 + i);
+
+                data::Solution sol = createBlackoilState(i, 3 * 3 * 3);
+                sol.insert("KRO", measure::identity, std::vector<double>(3*3*3, i), TargetType::RESTART_AUXILIARY);
+                sol.insert("KRG", measure::identity, std::vector<double>(3*3*3, i*10), TargetType::RESTART_AUXILIARY);
+
+                eclWriter.writeTimeStep(Action::State{},
+                                        WellTestState{},
+                                        st,
+                                        UDQState{1},
+                                        i,
+                                        false,
+                                        schedule.seconds(i),
+                                        RestartValue(sol, data::Wells{}, data::GroupAndNetworkValues{}, {}));
+            }
+
+            eclWriter.flushOutput();
+
+            // Read the files before the writer's destructor gets a chance
+            // to complete any output which flushOutput() missed.
+            checkRestartFile(6);
+            for (const auto& fname : fileNames) {
+                files.push_back(fileContents(fname));
+            }
+        }
+
+        return files;
+    };
+
+    const auto expect = write(std::nullopt);
+    for (const auto maxPending : { std::size_t{1}, std::size_t{2}, std::size_t{4} }) {
+        const auto files = write(maxPending);
+
+        BOOST_REQUIRE_EQUAL(files.size(), expect.size());
+        for (std::size_t f = 0; f < files.size(); ++f) {
+            BOOST_CHECK_MESSAGE(files[f] == expect[f],
+                                fileNames[f] << " written with maxPending = "
+                                << maxPending << " differs from synchronous output");
+        }
+    }
 }
 
 namespace {
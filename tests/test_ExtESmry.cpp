@@ -384,3 +384,49 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     for (std::size_t n = 63; n < fopt.size(); n++)
         BOOST_REQUIRE_CLOSE(fopt[n], fopt_rst_ref[n-63], 0.01);
 }
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_TimeWindow) {
+
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+    work.copyIn("SPE1CASE1_RST60.ESMRY");
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+    smry1.make_esmry_file();
+
+    ExtESmry esmry_ref("SPE1CASE1_RST60.ESMRY", true);
+    esmry_ref.loadData();
+
+    const auto time_ref = esmry_ref.get("TIME");
+    const auto wbhp_ref = esmry_ref.get("WBHP:PROD");
+    const auto fopt_ref = esmry_ref.get("FOPT");
+
+    ExtESmry esmry1("SPE1CASE1_RST60.ESMRY", true);
+
+    // Window crossing from base run into restart run.
+    const auto wbhp = esmry1.get("WBHP:PROD", 50, 80);
+    BOOST_REQUIRE_EQUAL(wbhp.size(), 30U);
+    for (std::size_t n = 0; n < wbhp.size(); n++)
+        BOOST_CHECK_EQUAL(wbhp[n], wbhp_ref[50 + n]);
+
+    // FOPT is not present in base run.
+    const auto window = esmry1.get_multiple({"TIME", "FOPT"}, 1, 1000, 7);
+    BOOST_REQUIRE_EQUAL(window.size(), 2U);
+    BOOST_REQUIRE_EQUAL(window[0].size(), (time_ref.size() - 1 + 6) / 7);
+
+    for (std::size_t n = 0; n < window[0].size(); n++) {
+        BOOST_CHECK_EQUAL(window[0][n], time_ref[1 + 7*n]);
+        BOOST_CHECK_EQUAL(window[1][n], fopt_ref[1 + 7*n]);
+    }
+
+    const auto time_rstep_ref = esmry_ref.get_at_rstep("TIME");
+    const auto time_rstep = esmry1.get_at_rstep("TIME", 55, 70, 5);
+    BOOST_REQUIRE_EQUAL(time_rstep.size(), 3U);
+    for (std::size_t n = 0; n < time_rstep.size(); n++)
+        BOOST_CHECK_EQUAL(time_rstep[n], time_rstep_ref[55 + 5*n]);
+
+    BOOST_CHECK(esmry1.get("TIME", 200, 300).empty());
+    BOOST_CHECK_THROW(esmry1.get("TIME", 0, 10, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(esmry1.get("NO_SUCH_KEY", 0, 10), std::invalid_argument);
+}
@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <fstream>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -1089,6 +1090,100 @@ BOOST_AUTO_TEST_CASE(Formatted_Separate)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Deferred)
+{
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified  { true };
+
+    auto writeStep = [](::Opm::EclIO::OutputStream::Restart& rst)
+    {
+        rst.write("I", std::vector<int>        {35, 51, 13});
+        rst.message("STARTSOL");
+        rst.write("L", std::vector<bool>       {true, true, true, false});
+        rst.writeSinglePrecision("S", std::vector<double>{17.29e-02, 1.4142});
+        rst.write("D", std::vector<double>     {0.6931, 1.6180, 123.45e6});
+        rst.message("ENDSOL");
+        rst.write("Z", std::vector<std::string>{"G1", "FIELD"});
+    };
+
+    const auto direct   = RSet("DIRECT");
+    const auto deferred = RSet("DEFERRED");
+
+    for (const auto* rset : { &direct, &deferred }) {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            *rset, 1, fmt, unif
+        };
+
+        rst.write("I", std::vector<int>{1, 7, 2, 9});
+    }
+
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            direct, 2, fmt, unif
+        };
+
+        writeStep(rst);
+    }
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(deferred, "UNRST");
+
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            deferred, 2, fmt, unif,
+            ::Opm::EclIO::OutputStream::Restart::Deferred{}
+        };
+
+        writeStep(rst);
+
+        // Nothing written before commit().
+        BOOST_CHECK(::Opm::EclIO::ERst{fname}.listOfReportStepNumbers() == std::vector<int>{1});
+
+        rst.commit();
+    }
+
+    {
+        auto rst = ::Opm::EclIO::ERst{fname};
+
+        const auto seqnum        = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2};
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+
+        const auto vectors        = rst.listOfRstArrays(2);
+        const auto expect_vectors = std::vector<Opm::EclIO::EclFile::EclEntry>{
+            Opm::EclIO::EclFile::EclEntry{"SEQNUM", Opm::EclIO::eclArrType::INTE, 1},
+            Opm::EclIO::EclFile::EclEntry{"I", Opm::EclIO::eclArrType::INTE, 3},
+            Opm::EclIO::EclFile::EclEntry{"STARTSOL", Opm::EclIO::eclArrType::MESS, 0},
+            Opm::EclIO::EclFile::EclEntry{"L", Opm::EclIO::eclArrType::LOGI, 4},
+            Opm::EclIO::EclFile::EclEntry{"S", Opm::EclIO::eclArrType::REAL, 2},
+            Opm::EclIO::EclFile::EclEntry{"D", Opm::EclIO::eclArrType::DOUB, 3},
+            Opm::EclIO::EclFile::EclEntry{"ENDSOL", Opm::EclIO::eclArrType::MESS, 0},
+            Opm::EclIO::EclFile::EclEntry{"Z", Opm::EclIO::eclArrType::CHAR, 2},
+        };
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(vectors.begin(), vectors.end(),
+                                      expect_vectors.begin(),
+                                      expect_vectors.end());
+    }
+
+    // Same file contents as direct output.
+    {
+        auto readFile = [](const std::string& fn)
+        {
+            std::ifstream is(fn, std::ios::binary);
+            return std::string { std::istreambuf_iterator<char>{is},
+                                 std::istreambuf_iterator<char>{} };
+        };
+
+        const auto expect = readFile(::Opm::EclIO::OutputStream::
+                                     outputFileName(direct, "UNRST"));
+        BOOST_CHECK(! expect.empty());
+        BOOST_CHECK(readFile(fname) == expect);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Class_Restart
 
 // ==========================================================================
@@ -23,6 +23,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <opm/output/data/DenseWells.hpp>
 #include <opm/output/data/Groups.hpp>
 #include <opm/output/data/GuideRateValue.hpp>
 #include <opm/output/data/Wells.hpp>
@@ -64,12 +65,14 @@
 #include <ctime>
 #include <exception>
 #include <filesystem>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -77,6 +80,10 @@
 
 #include <fmt/format.h>
 
+#if _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Opm;
 using rt = data::Rates::opt;
 using p_cmode = Opm::Group::ProductionCMode;
@@ -3780,6 +3787,50 @@ BOOST_AUTO_TEST_CASE(efficiency_factor)
         BOOST_CHECK_CLOSE( 200.1 * 0.2 * 0.01, ecl_sum_get_well_connection_var( resp, 1, "W_2", "COPT", 2, 1, 1 ), 1e-5 );
 }
 
+BOOST_AUTO_TEST_CASE(efficiency_scaling_factor_ministeps)
+{
+    // Dynamic efficiency scaling factors may change between ministeps of
+    // the same report step, even if the well and group structure does not.
+    setup cfg("test_efficiency_scaling_factor", "SUMMARY_EFF_FAC.DATA", false);
+
+    auto writer = out::Summary {
+        cfg.config, cfg.es, cfg.grid, cfg.schedule, cfg.name
+    };
+
+    auto st = SummaryState {
+        TimeService::now(), cfg.es.runspec().udqParams().undefinedValue()
+    };
+
+    auto wells = cfg.wells;
+
+    auto values = out::Summary::DynamicSimulatorState{};
+
+    values.well_solution = &wells;
+    values.wbp = &cfg.wbp;
+    values.group_and_nwrk_solution = &cfg.grp_nwrk;
+
+    writer.eval(/* report_step = */ 0, /* secs_elapsed = */ 0.0*day, values, st);
+    writer.eval(/* report_step = */ 1, /* secs_elapsed = */ 1.0*day, values, st);
+
+    /* WEFAC 0.2 assigned to W_2.
+     * W_2 assigned to group G2. GEFAC G2 = 0.01 */
+    BOOST_CHECK_CLOSE(20.1 * 0.2 * 0.01, st.get_well_var("W_2", "WOPT"), 1.0e-5);
+    BOOST_CHECK_CLOSE(10.1 + 20.1 * 0.2 * 0.01, st.get("FOPR"), 1.0e-5);
+
+    wells["W_2"].efficiency_scaling_factor = 0.5;
+    writer.eval(/* report_step = */ 1, /* secs_elapsed = */ 2.0*day, values, st);
+
+    BOOST_CHECK_CLOSE(20.1 * 0.2 * 0.01 * (1.0 + 0.5), st.get_well_var("W_2", "WOPT"), 1.0e-5);
+    BOOST_CHECK_CLOSE(10.1 + 20.1 * 0.2 * 0.01 * 0.5, st.get("FOPR"), 1.0e-5);
+    BOOST_CHECK_CLOSE(20.1, st.get_well_var("W_2", "WOPR"), 1.0e-5);
+
+    wells["W_2"].efficiency_scaling_factor = 1.0;
+    writer.eval(/* report_step = */ 1, /* secs_elapsed = */ 3.0*day, values, st);
+
+    BOOST_CHECK_CLOSE(20.1 * 0.2 * 0.01 * (2.0 + 0.5), st.get_well_var("W_2", "WOPT"), 1.0e-5);
+    BOOST_CHECK_CLOSE(10.1 + 20.1 * 0.2 * 0.01, st.get("FOPR"), 1.0e-5);
+}
+
 BOOST_AUTO_TEST_CASE(Test_SummaryState)
 {
     Opm::SummaryState st(TimeService::now(), 0.0);
@@ -4469,7 +4520,293 @@ BOOST_AUTO_TEST_SUITE_END() // Summary
 // ####################################################################
 
 namespace {
-    Opm::SummaryState calculateRestartVectors(const setup& config)
+    // Six producers with eleven well level vectors each, plus group, field
+    // and region level vectors, make up more than one chunk (64 vectors) of
+    // concurrently evaluated function relations.  ROEW reads COPT values of
+    // the same evaluation pass, and WPI of a well with an unsupported
+    // preferred phase throws.
+    std::string concurrentEvalDeck(const bool failingVector)
+    {
+        return fmt::format(R"(
+START
+10 MAI 2007 /
+RUNSPEC
+DIMENS
+ 6 1 1 /
+REGDIMS
+  2 /
+WELLDIMS
+ 6 1 2 3 /
+OIL
+GAS
+WATER
+UNIFOUT
+GRID
+DX
+6*1 /
+DY
+6*1 /
+DZ
+6*1 /
+TOPS
+6*1 /
+PERMX
+6*0.25 /
+COPY
+  PERMX PERMY /
+  PERMX PERMZ /
+/
+PORO
+6*0.2 /
+REGIONS
+FIPNUM
+3*1 3*2 /
+SUMMARY
+WOPR
+/
+WWPR
+/
+WGPR
+/
+WLPR
+/
+WOPT
+/
+WWPT
+/
+WGPT
+/
+WLPT
+/
+WBHP
+/
+WWCT
+/
+WGOR
+/
+GOPR
+/
+GWPR
+/
+GOPT
+/
+FOPR
+FWPR
+FGPR
+FOPT
+ROPR
+/
+ROEW
+/
+{}
+SCHEDULE
+GRUPTREE
+ 'G1' 'FIELD' /
+ 'G2' 'FIELD' /
+/
+WELSPECS
+ 'P1' 'G1' 1 1 1* 'OIL' /
+ 'P2' 'G1' 2 1 1* 'OIL' /
+ 'P3' 'G1' 3 1 1* 'OIL' /
+ 'P4' 'G2' 4 1 1* 'OIL' /
+ 'P5' 'G2' 5 1 1* 'OIL' /
+ 'P6' 'G2' 6 1 1* '{}' /
+/
+COMPDAT
+ 'P1' 0 0 1 1 /
+ 'P2' 0 0 1 1 /
+ 'P3' 0 0 1 1 /
+ 'P4' 0 0 1 1 /
+ 'P5' 0 0 1 1 /
+ 'P6' 0 0 1 1 /
+/
+WCONPROD
+ 'P*' 'OPEN' 'ORAT' 100 /
+/
+TSTEP
+1 /
+)", failingVector ? "WPI\n 'P6' /\n" : "",
+    failingVector ? "SOLVENT" : "OIL");
+    }
+
+    // Well Pi produces i SM3/DAY of oil, i/2 SM3/DAY of water and 10*i
+    // SM3/DAY of gas through a single connection in cell i.
+    data::Wells concurrentEvalWells()
+    {
+        auto wells = data::Wells{};
+
+        for (auto i = 1; i <= 6; ++i) {
+            auto& well = wells[fmt::format("P{}", i)];
+
+            well.rates.set(rt::oil, - 1.0*i*sm3_pr_day())
+                .set(rt::wat, - 0.5*i*sm3_pr_day())
+                .set(rt::gas, -10.0*i*sm3_pr_day());
+
+            well.bhp = (100.0 + i) * barsa();
+
+            auto& conn = well.connections.emplace_back();
+            conn.index = i - 1;
+            conn.rates = well.rates;
+        }
+
+        return wells;
+    }
+
+    // Parsed model and summary writer for the concurrent evaluation
+    // tests.  Kept separate from evaluation so that input errors are not
+    // mistaken for evaluation failures.
+    struct ConcurrentEvalCase
+    {
+        explicit ConcurrentEvalCase(const std::string& deck_string)
+            : deck   { Parser{}.parseString(deck_string) }
+            , es     { deck }
+            , sched  { deck, es, std::make_shared<Python>() }
+            , config { deck, sched, es.fieldProps(), es.aquifer() }
+            , writer { config, es, es.getInputGrid(), sched, "CONCURRENT_EVAL" }
+        {}
+
+        ConcurrentEvalCase(const ConcurrentEvalCase&) = delete;
+
+        // Evaluate summary vectors of two report steps using a particular
+        // number of threads.
+        SummaryState eval([[maybe_unused]] const int num_threads)
+        {
+            auto st = SummaryState {
+                TimeService::from_time_t(this->sched.getStartTime()),
+                this->es.runspec().udqParams().undefinedValue()
+            };
+
+            const auto wells = concurrentEvalWells();
+
+            auto initial = Inplace{};
+            initial.add("FIPNUM", Inplace::Phase::OIL, 1, 100.0*sm3());
+            initial.add("FIPNUM", Inplace::Phase::OIL, 2, 200.0*sm3());
+
+            auto values = out::Summary::DynamicSimulatorState{};
+            values.well_solution = &wells;
+            values.inplace.initial = &initial;
+
+#if _OPENMP
+            const auto max_threads = omp_get_max_threads();
+            omp_set_num_threads(num_threads);
+#endif
+
+            try {
+                this->writer.eval(/* report_step = */ 0, /* secs_elapsed = */ 0.0*day, values, st);
+                this->writer.eval(/* report_step = */ 1, /* secs_elapsed = */ 1.0*day, values, st);
+            }
+            catch (...) {
+#if _OPENMP
+                omp_set_num_threads(max_threads);
+#endif
+                throw;
+            }
+
+#if _OPENMP
+            omp_set_num_threads(max_threads);
+#endif
+
+            return st;
+        }
+
+        Deck deck;
+        EclipseState es;
+        Schedule sched;
+        SummaryConfig config;
+        out::Summary writer;
+    };
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Concurrent_Evaluation)
+
+BOOST_AUTO_TEST_CASE(Function_Relation_Values)
+{
+    WorkArea ta { "summary_concurrent_eval" };
+
+    auto model = ConcurrentEvalCase { concurrentEvalDeck(/* failingVector = */ false) };
+
+    const auto serial = model.eval(1);
+    const auto concurrent = model.eval(4);
+
+    for (auto i = 1; i <= 6; ++i) {
+        const auto well = fmt::format("P{}", i);
+
+        for (const auto* st : { &serial, &concurrent }) {
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WOPR"),  1.0*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WWPR"),  0.5*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WGPR"), 10.0*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WLPR"),  1.5*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WOPT"),  1.0*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WWPT"),  0.5*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WGPT"), 10.0*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WLPT"),  1.5*i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WBHP"), 100.0 + i, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WWCT"), 1.0 / 3.0, 1.0e-8);
+            BOOST_CHECK_CLOSE(st->get_well_var(well, "WGOR"), 10.0, 1.0e-8);
+        }
+    }
+
+    for (const auto* st : { &serial, &concurrent }) {
+        BOOST_CHECK_CLOSE(st->get_group_var("G1", "GOPR"),  6.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get_group_var("G2", "GOPR"), 15.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get_group_var("G2", "GWPR"),  7.5, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get_group_var("G2", "GOPT"), 15.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get("FOPR"),  21.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get("FWPR"),  10.5, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get("FGPR"), 210.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get("FOPT"),  21.0, 1.0e-8);
+
+        BOOST_CHECK_CLOSE(st->get_region_var("FIPNUM", "ROPR", 1),  6.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get_region_var("FIPNUM", "ROPR", 2), 15.0, 1.0e-8);
+
+        // ROEW = cumulative oil production from the region's connections
+        // (COPT) divided by the region's initial oil in place.
+        BOOST_CHECK_CLOSE(st->get_region_var("FIPNUM", "ROEW", 1),  6.0 / 100.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(st->get_region_var("FIPNUM", "ROEW", 2), 15.0 / 200.0, 1.0e-8);
+    }
+
+    BOOST_CHECK_MESSAGE(serial == concurrent,
+                        "Concurrent evaluation must match serial evaluation");
+}
+
+BOOST_AUTO_TEST_CASE(Function_Relation_Failure)
+{
+    WorkArea ta { "summary_concurrent_eval_failure" };
+
+    auto model = ConcurrentEvalCase { concurrentEvalDeck(/* failingVector = */ true) };
+
+    const auto is_preferred_phase_error = [](const std::invalid_argument& e)
+    {
+        return std::string_view { e.what() }.find("preferred") != std::string_view::npos;
+    };
+
+    // The failure is caught in the concurrent phase and raised again from
+    // the serial evaluation of the failing vector.
+    BOOST_CHECK_EXCEPTION(model.eval(1), std::invalid_argument, is_preferred_phase_error);
+    BOOST_CHECK_EXCEPTION(model.eval(4), std::invalid_argument, is_preferred_phase_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Concurrent_Evaluation
+
+// ####################################################################
+
+namespace {
+    data::DenseWells denseWellResults(const setup& config)
+    {
+        // Dense well results only hold wells known to the Schedule.
+        auto dense = data::DenseWells { config.schedule.wellNames() };
+
+        for (const auto& [name, well] : config.wells) {
+            if (dense.index(name).has_value()) {
+                dense.insert(name, well);
+            }
+        }
+
+        return dense;
+    }
+
+    Opm::SummaryState calculateRestartVectors(const setup& config,
+                                              const bool   denseWells = false)
     {
         // Intentional copy.
         auto smcfg = config.config;
@@ -4485,7 +4822,15 @@ namespace {
 
         auto values = out::Summary::DynamicSimulatorState{};
 
-        values.well_solution = &config.wells;
+        const auto dense = denseWells
+            ? denseWellResults(config) : data::DenseWells{};
+
+        if (denseWells) {
+            values.dense_well_solution = &dense;
+        }
+        else {
+            values.well_solution = &config.wells;
+        }
         values.wbp = &config.wbp;
         values.group_and_nwrk_solution = &config.grp_nwrk;
 
@@ -8134,6 +8479,28 @@ BOOST_AUTO_TEST_CASE(Write_Read)
     }
 }
 
+// ====================================================================
+
+BOOST_AUTO_TEST_CASE(Dense_Well_Results)
+{
+    for (const auto* deckFile : { "summary_deck.DATA", "SOFR_TEST.DATA" }) {
+        const auto config = setup { "test.Restart.Dense", deckFile };
+
+        const auto rstrt = calculateRestartVectors(config);
+        const auto dense = calculateRestartVectors(config, /* denseWells = */ true);
+
+        auto numValues = std::size_t{0};
+        for (const auto& [key, value] : rstrt) {
+            BOOST_TEST_INFO_SCOPE("Deck " << deckFile << ", key " << key);
+            BOOST_REQUIRE(dense.has(key));
+            BOOST_CHECK_EQUAL(dense.get(key), value);
+            ++numValues;
+        }
+
+        BOOST_CHECK_EQUAL(std::distance(dense.begin(), dense.end()), numValues);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Restart_Segment
 
 // =====================================================================
@@ -8227,6 +8594,200 @@ BOOST_AUTO_TEST_CASE(append_summary_state)
     BOOST_CHECK_EQUAL(st_both.get_group_var("G1", "WOPR"), 3000);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_Handles)
+{
+    SummaryState st(TimeService::now(), -1.0);
+
+    const auto wopr = st.well_var_handle("OP1", "WOPR");
+    const auto wopt = st.well_var_handle("OP1", "WOPT");
+    const auto gopt = st.group_var_handle("G1", "GOPT", SummaryConfigNode::Type::Total);
+    const auto wux  = st.well_var_handle("OP2", "WUX");
+
+    // Handles do not define values.
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK(!st.has_well_var("OP1", "WOPR"));
+    BOOST_CHECK(!st.has_well_var("WOPR"));
+    BOOST_CHECK_EQUAL(st.wells().size(), 0U);
+    BOOST_CHECK_THROW(st.get(wopr), std::invalid_argument);
+    BOOST_CHECK_EQUAL(st.get(wopr, 42.0), 42.0);
+    BOOST_CHECK_EQUAL(st.get(wux), -1.0);
+
+    st.update(wopr, 100.0);
+    st.update(wopr, 150.0);
+    st.update(wopt, 100.0);
+    st.update(wopt, 100.0);
+    st.update(gopt, 10.0);
+    st.update(gopt, 10.0);
+
+    BOOST_CHECK_EQUAL(st.get(wopr), 150.0);
+    BOOST_CHECK_EQUAL(st.get(wopt), 200.0);
+    BOOST_CHECK_EQUAL(st.get(gopt), 20.0);
+
+    // String API sees the same values.
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 150.0);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 200.0);
+    BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPT"), 20.0);
+    BOOST_CHECK(st.has("GOPT:G1"));
+    BOOST_CHECK_EQUAL(st.wells().size(), 1U);
+    BOOST_CHECK_EQUAL(st.groups().size(), 1U);
+
+    // And handles see values from the string API.
+    st.update_well_var("OP1", "WOPR", 75.0);
+    BOOST_CHECK_EQUAL(st.get(wopr), 75.0);
+
+    const auto wopr2 = st.well_var_handle("OP1", "WOPR");
+    BOOST_CHECK_EQUAL(wopr2.var, wopr.var);
+    BOOST_CHECK_EQUAL(wopr2.entity, wopr.entity);
+
+    // Handles remain valid in copies.
+    auto st2 = st;
+    BOOST_CHECK_EQUAL(st2.handle_stamp(), st.handle_stamp());
+    st2.update(wopt, 1.0);
+    BOOST_CHECK_EQUAL(st2.get(wopt), 201.0);
+    BOOST_CHECK_EQUAL(st.get(wopt), 200.0);
+
+    // New IDs renew the handle stamp, existing IDs do not.
+    const auto stamp = st.handle_stamp();
+    st.update_well_var("OP2", "WOPR", 1.0);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP2"), 1.0);
+    BOOST_CHECK_EQUAL(st.handle_stamp(), stamp);
+    st2.update_well_var("OP3", "WOPR", 1.0);
+    BOOST_CHECK(st2.handle_stamp() != stamp);
+    BOOST_CHECK_EQUAL(st.handle_stamp(), stamp);
+
+    BOOST_CHECK(st.erase_well_var("OP1", "WOPR"));
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK(st.erase_well_var("OP1", "WOPT"));
+    BOOST_CHECK_EQUAL(st.wells().size(), 1U);
+    BOOST_CHECK(st.has_well_var("OP2", "WOPR"));
+}
+
+BOOST_AUTO_TEST_CASE(SummaryState_Iteration)
+{
+    SummaryState st(TimeService::now(), -1.0);
+
+    st.update("FOPR", 150.0);
+    st.update_well_var("OP_1", "WOPR", 100.0);
+    st.update_well_var("OP_2", "WOPR", 50.0);
+    st.update_group_var("G1", "GOPR", 150.0);
+
+    const auto collect = [](const SummaryState& state)
+    {
+        std::map<std::string, double> items;
+        for (const auto& [key, value] : state) {
+            BOOST_CHECK_MESSAGE(items.emplace(key, value).second,
+                                "Key " << key << " visited more than once");
+        }
+
+        return items;
+    };
+
+    {
+        const auto items = collect(st);
+        const auto expect = std::map<std::string, double> {
+            { "FOPR", 150.0 }, { "WOPR:OP_1", 100.0 },
+            { "WOPR:OP_2", 50.0 }, { "GOPR:G1", 150.0 },
+        };
+
+        BOOST_CHECK(items == expect);
+        BOOST_CHECK_EQUAL(st.size(), items.size());
+        BOOST_CHECK_EQUAL(std::distance(st.begin(), st.end()), 4);
+    }
+
+    // Erasing the general key leaves the well level value in place.
+    BOOST_CHECK(st.erase("WOPR:OP_1"));
+    BOOST_CHECK(!st.has("WOPR:OP_1"));
+    BOOST_CHECK(!st.erase("WOPR:OP_1"));
+    BOOST_CHECK(st.has_well_var("OP_1", "WOPR"));
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_1", "WOPR"), 100.0);
+    BOOST_CHECK_EQUAL(st.size(), 3U);
+    BOOST_CHECK_EQUAL(collect(st).count("WOPR:OP_1"), 0U);
+
+    // ...and erase_well_var() requires the general key.
+    BOOST_CHECK(!st.erase_well_var("OP_1", "WOPR"));
+    BOOST_CHECK(st.has_well_var("OP_1", "WOPR"));
+
+    // Updating the well level value redefines the general key.
+    st.update_well_var("OP_1", "WOPR", 75.0);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP_1"), 75.0);
+    BOOST_CHECK_EQUAL(collect(st).at("WOPR:OP_1"), 75.0);
+    BOOST_CHECK_EQUAL(st.size(), 4U);
+
+    // Setting the general key does not alter the well level value.
+    st.set("WOPR:OP_2", 25.0);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP_2"), 25.0);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_2", "WOPR"), 50.0);
+    BOOST_CHECK_EQUAL(collect(st).at("WOPR:OP_2"), 25.0);
+    BOOST_CHECK_EQUAL(st.size(), 4U);
+
+    BOOST_CHECK(st.erase_well_var("OP_2", "WOPR"));
+    BOOST_CHECK(!st.has("WOPR:OP_2"));
+    BOOST_CHECK(!st.has_well_var("OP_2", "WOPR"));
+    BOOST_CHECK_EQUAL(st.size(), 3U);
+    BOOST_CHECK_EQUAL(collect(st).size(), 3U);
+
+    // Copies preserve the general view.
+    st.erase("GOPR:G1");
+    const auto st2 = st;
+    BOOST_CHECK(st2 == st);
+    BOOST_CHECK(collect(st2) == collect(st));
+    BOOST_CHECK(st2.has_group_var("G1", "GOPR"));
+    BOOST_CHECK(!st2.has("GOPR:G1"));
+}
+
+BOOST_AUTO_TEST_CASE(SummaryState_ChangeStamps)
+{
+    SummaryState st(TimeService::now(), -1.0);
+
+    st.update_well_var("OP1", "WOPR", 100.0);
+    st.update_group_var("G1", "GOPR", 50.0);
+    st.update("FOPR", 150.0);
+
+    const auto wopr = st.var_stamp("WOPR");
+    const auto gopr = st.var_stamp("GOPR");
+    const auto fopr = st.var_stamp("FOPR");
+    const auto other = st.var_stamp("FWPR");
+
+    // Same values are no change.
+    st.update_well_var("OP1", "WOPR", 100.0);
+    st.update_group_var("G1", "GOPR", 50.0);
+    st.update("FOPR", 150.0);
+    st.set("FOPR", 150.0);
+
+    BOOST_CHECK_EQUAL(st.var_stamp("WOPR"), wopr);
+    BOOST_CHECK_EQUAL(st.var_stamp("GOPR"), gopr);
+    BOOST_CHECK_EQUAL(st.var_stamp("FOPR"), fopr);
+
+    // Changing one variable leaves the others alone.
+    st.update_well_var("OP2", "WOPR", 100.0);
+    BOOST_CHECK(st.var_stamp("WOPR") != wopr);
+    BOOST_CHECK_EQUAL(st.var_stamp("GOPR"), gopr);
+    BOOST_CHECK_EQUAL(st.var_stamp("FWPR"), other);
+
+    // Cumulative quantities change on every non-zero update.
+    st.update("FOPT", 10.0);
+    const auto fopt = st.var_stamp("FOPT");
+    st.update("FOPT", 0.0);
+    BOOST_CHECK_EQUAL(st.var_stamp("FOPT"), fopt);
+    st.update("FOPT", 10.0);
+    BOOST_CHECK(st.var_stamp("FOPT") != fopt);
+
+    const auto gopr2 = st.var_stamp("GOPR");
+    BOOST_CHECK(st.erase_group_var("G1", "GOPR"));
+    BOOST_CHECK(st.var_stamp("GOPR") != gopr2);
+
+    // Copies share stamps until they diverge.
+    auto st2 = st;
+    BOOST_CHECK_EQUAL(st2.var_stamp("FOPR"), st.var_stamp("FOPR"));
+    st2.update("FOPR", 1.0);
+    st.update("FOPR", 2.0);
+    BOOST_CHECK(st2.var_stamp("FOPR") != st.var_stamp("FOPR"));
+
+    // Independent objects never share stamps.
+    SummaryState st3(TimeService::now(), -1.0);
+    BOOST_CHECK(st3.var_stamp("FWPR") != st.var_stamp("FWPR"));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary_State
 
 // ====================================================================
@@ -23,7 +23,10 @@
 #include <boost/test/unit_test.hpp>
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
+#include <opm/output/data/DenseWells.hpp>
 #include <opm/output/data/Wells.hpp>
 
 using namespace Opm;
@@ -130,3 +133,158 @@ BOOST_AUTO_TEST_CASE(get_connections) {
     BOOST_CHECK_EQUAL( 20.41, conn->rates.get(data::Rates::opt::wat));
     BOOST_CHECK_EQUAL( 22.41, conn->rates.get(data::Rates::opt::gas));
 }
+
+namespace {
+
+data::Segment segment(const std::size_t segNumber, const double pressure)
+{
+    auto seg = data::Segment::serializationTestObject();
+    seg.segNumber = segNumber;
+    seg.pressures[data::SegmentPressures::Value::Pressure] = pressure;
+
+    return seg;
+}
+
+data::Wells msWells()
+{
+    auto wells = data::Wells{};
+
+    auto& prod = wells["PROD"];
+    prod.rates.set(rt::oil, 123.4);
+    prod.bhp = 234.5;
+    prod.segments.emplace(3, segment(3, 30.0));
+    prod.segments.emplace(1, segment(1, 10.0));
+    prod.segments.emplace(2, segment(2, 20.0));
+
+    auto& inj = wells["INJ"];
+    inj.rates.set(rt::wat, -42.0);
+    inj.bhp = 345.6;
+
+    return wells;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(dense_wells_lookup)
+{
+    auto dense = data::DenseWells { std::vector<std::string> { "PROD", "OBS", "INJ" } };
+
+    BOOST_CHECK_EQUAL(dense.insert("INJ", msWells().at("INJ")), std::size_t{2});
+    BOOST_CHECK_EQUAL(dense.insert("PROD", msWells().at("PROD")), std::size_t{0});
+    BOOST_CHECK_THROW(dense.insert("INJ", data::Well{}), std::invalid_argument);
+    BOOST_CHECK_THROW(dense.insert("NO_SUCH_WELL", data::Well{}), std::invalid_argument);
+
+    BOOST_REQUIRE_EQUAL(dense.size(), std::size_t{3});
+    BOOST_CHECK_EQUAL(dense.name(0), "PROD");
+    BOOST_CHECK_EQUAL(dense.name(1), "OBS");
+    BOOST_CHECK_EQUAL(dense.name(2), "INJ");
+    BOOST_CHECK_MESSAGE(dense[0].segments.empty(),
+                        "Dense well results must not hold segments");
+
+    BOOST_CHECK(dense.hasResults(0));
+    BOOST_CHECK(! dense.hasResults(1));
+    BOOST_CHECK(dense.find("OBS") == nullptr);
+
+    BOOST_CHECK_EQUAL(*dense.index("INJ"), std::size_t{2});
+    BOOST_CHECK_MESSAGE(! dense.index("NO_SUCH_WELL").has_value(),
+                        "Unknown well must not have a sequence index");
+    BOOST_CHECK(dense.find("NO_SUCH_WELL") == nullptr);
+    BOOST_CHECK_EQUAL(dense.find("PROD")->bhp, 234.5);
+
+    BOOST_CHECK_EQUAL(dense.get("PROD", rt::oil), 123.4);
+    BOOST_CHECK_EQUAL(dense.get("INJ", rt::oil), 0.0);
+    BOOST_CHECK_EQUAL(dense.get("NO_SUCH_WELL", rt::wat), 0.0);
+
+    {
+        const auto segments = dense.segments(0);
+        BOOST_REQUIRE_EQUAL(segments.size(), std::size_t{3});
+
+        for (auto i = 0*segments.size(); i < segments.size(); ++i) {
+            BOOST_CHECK_EQUAL(segments[i].segNumber, i + 1);
+        }
+    }
+
+    BOOST_CHECK_MESSAGE(dense.segments(2).empty(),
+                        "Standard well must not have segments");
+    BOOST_CHECK_MESSAGE(dense.segments(1).empty(),
+                        "Well without results must not have segments");
+
+    BOOST_REQUIRE(dense.findSegment(0, 2) != nullptr);
+    BOOST_CHECK_EQUAL(dense.findSegment(0, 2)->pressures[data::SegmentPressures::Value::Pressure], 20.0);
+    BOOST_CHECK(dense.findSegment(0, 4) == nullptr);
+    BOOST_CHECK(dense.findSegment(2, 1) == nullptr);
+
+    const auto wells = dense.toWells();
+    BOOST_CHECK_MESSAGE(wells == msWells(),
+                        "Name-based view must match original well results");
+}
+
+BOOST_AUTO_TEST_CASE(dense_wells_pack_unpack)
+{
+    // Sequence index order, as in Schedule::wellNames().
+    const auto wellNames = std::vector<std::string> { "PROD", "INJ" };
+
+    const auto dense = data::DenseWells { wellNames, msWells() };
+    BOOST_CHECK_EQUAL(dense.name(0), "PROD");
+    BOOST_CHECK_EQUAL(dense.name(1), "INJ");
+
+    {
+        auto copy = data::DenseWells { wellNames };
+        copy.unpack(dense.pack());
+
+        BOOST_CHECK_MESSAGE(copy == dense, "Unpacked well results must match packed");
+    }
+
+    // Gather from two processes, with each well on a single process.
+    {
+        auto rank0 = data::DenseWells { wellNames };
+        rank0.insert("INJ", msWells().at("INJ"));
+
+        auto rank1 = data::DenseWells { wellNames };
+        rank1.insert("PROD", msWells().at("PROD"));
+
+        auto buffer = rank0.pack();
+        const auto buffer1 = rank1.pack();
+        buffer.insert(buffer.end(), buffer1.begin(), buffer1.end());
+
+        auto gathered = data::DenseWells { wellNames };
+        gathered.unpack(buffer);
+
+        // Slots are sequence indices, not rank or arrival order.
+        BOOST_REQUIRE_EQUAL(gathered.size(), wellNames.size());
+        for (auto seqIndex = 0*wellNames.size(); seqIndex < wellNames.size(); ++seqIndex) {
+            BOOST_CHECK_EQUAL(*gathered.index(wellNames[seqIndex]), seqIndex);
+            BOOST_CHECK_EQUAL(gathered.name(seqIndex), wellNames[seqIndex]);
+            BOOST_CHECK(gathered[seqIndex] == *dense.find(wellNames[seqIndex]));
+        }
+
+        BOOST_CHECK_MESSAGE(gathered == dense,
+                            "Gathered well results must match original");
+        BOOST_CHECK_MESSAGE(gathered.toWells() == msWells(),
+                            "Gathered well results must match original");
+
+        // Consistently duplicated results are accepted.
+        gathered.unpack(buffer1);
+        BOOST_CHECK_EQUAL(gathered.size(), std::size_t{2});
+
+        // Inconsistently duplicated results are not.
+        auto other = data::DenseWells { wellNames };
+        auto inj = msWells().at("INJ");
+        inj.bhp = 1.0;
+        other.insert("INJ", inj);
+
+        BOOST_CHECK_THROW(gathered.unpack(other.pack()), std::runtime_error);
+
+        // Nor are results from collections with different wells.
+        auto mismatch = data::DenseWells { std::vector<std::string> { "INJ", "PROD" } };
+        BOOST_CHECK_THROW(mismatch.unpack(rank1.pack()), std::invalid_argument);
+    }
+
+    {
+        const auto buffer = dense.pack();
+        auto copy = data::DenseWells { wellNames };
+
+        BOOST_CHECK_THROW(copy.unpack(std::span { buffer }.first(buffer.size() - 1)),
+                          std::invalid_argument);
+    }
+}
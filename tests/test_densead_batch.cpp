@@ -0,0 +1,256 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Unit tests for batches of evaluations in the localized automatic
+ *        differentiation (AD) framework.
+ *
+ * Every lane of a batch must give the same result as the corresponding
+ * single evaluation.
+ */
+#include "config.h"
+
+#define BOOST_TEST_MODULE DenseAdBatch
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/EvaluationBatch.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+#include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
+#include <opm/material/fluidmatrixinteractions/PiecewiseLinearTwoPhaseMaterial.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr int numDerivs = 3;
+constexpr int width = 8;
+
+using Eval = Opm::DenseAd::Evaluation<double, numDerivs>;
+using Batch = Opm::DenseAd::EvaluationBatch<double, numDerivs, width>;
+
+// Lane values which include zero, ties between the two inputs and lanes on
+// both sides of one.
+Batch makeBatch(const std::array<double, width>& values, int varIdx)
+{
+    auto result = Batch::createVariable(values, varIdx);
+    for (int k = 0; k < width; ++k) {
+        result.setDerivative(k, (varIdx + 1) % numDerivs, 0.25*k - 0.5);
+    }
+
+    return result;
+}
+
+const Batch x = makeBatch({ 0.0, 0.5, 1.0, 1.5, 2.0, 3.25, 0.125, 7.0 }, 0);
+const Batch y = makeBatch({ 1.0, 0.5, 2.0, 0.75, 2.0, 0.5, 4.0, 0.001 }, 1);
+
+// The lanes of a batch do the same operations in the same order as single
+// evaluations, but the compiler may still contract them differently.
+void checkClose(const double a, const double b)
+{
+    const double scale = std::max({ 1.0, std::abs(a), std::abs(b) });
+    BOOST_CHECK_MESSAGE(std::abs(a - b) <= 1.0e-13*scale,
+                        "difference between " << a << " and " << b << " too large");
+}
+
+void checkLanes(const Batch& batch, const std::array<Eval, width>& ref)
+{
+    for (int k = 0; k < width; ++k) {
+        checkClose(batch.value(k), ref[k].value());
+        for (int varIdx = 0; varIdx < numDerivs; ++varIdx) {
+            checkClose(batch.derivative(k, varIdx), ref[k].derivative(varIdx));
+        }
+    }
+}
+
+template <class BatchFn, class EvalFn>
+void checkFunction(BatchFn&& batchFn, EvalFn&& evalFn)
+{
+    std::array<Eval, width> ref;
+    for (int k = 0; k < width; ++k) {
+        ref[k] = evalFn(x.lane(k), y.lane(k));
+    }
+
+    checkLanes(batchFn(x, y), ref);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Lanes)
+{
+    auto eval = Eval::createVariable(2.5, 1);
+    eval.setDerivative(2, -1.0);
+
+    Batch batch(eval);
+    batch.setLane(3, Eval(4.0));
+
+    for (int k = 0; k < width; ++k) {
+        const auto lane = batch.lane(k);
+        BOOST_CHECK_EQUAL(lane.value(), (k == 3) ? 4.0 : 2.5);
+        BOOST_CHECK_EQUAL(lane.derivative(0), 0.0);
+        BOOST_CHECK_EQUAL(lane.derivative(1), (k == 3) ? 0.0 : 1.0);
+        BOOST_CHECK_EQUAL(lane.derivative(2), (k == 3) ? 0.0 : -1.0);
+    }
+
+    const Batch constant = 1.5;
+    for (int k = 0; k < width; ++k) {
+        BOOST_CHECK_EQUAL(constant.value(k), 1.5);
+        BOOST_CHECK_EQUAL(constant.derivative(k, 0), 0.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Operators)
+{
+    checkFunction([](const Batch& a, const Batch& b) { return a + b; },
+                  [](const Eval& a, const Eval& b) { return a + b; });
+    checkFunction([](const Batch& a, const Batch& b) { return a - b; },
+                  [](const Eval& a, const Eval& b) { return a - b; });
+    checkFunction([](const Batch& a, const Batch& b) { return a * b; },
+                  [](const Eval& a, const Eval& b) { return a * b; });
+    checkFunction([](const Batch& a, const Batch& b) { return b / (a + 1.0); },
+                  [](const Eval& a, const Eval& b) { return b / (a + 1.0); });
+    checkFunction([](const Batch& a, const Batch&) { return -a; },
+                  [](const Eval& a, const Eval&) { return -a; });
+
+    checkFunction([](const Batch& a, const Batch&) { return 2.0 + a - 3.0; },
+                  [](const Eval& a, const Eval&) { return 2.0 + a - 3.0; });
+    checkFunction([](const Batch& a, const Batch&) { return 1 - a; },
+                  [](const Eval& a, const Eval&) { return 1 - a; });
+    checkFunction([](const Batch& a, const Batch&) { return 0.3 * a * 7.0; },
+                  [](const Eval& a, const Eval&) { return 0.3 * a * 7.0; });
+    checkFunction([](const Batch&, const Batch& b) { return 3.0 / b / 7.0; },
+                  [](const Eval&, const Eval& b) { return 3.0 / b / 7.0; });
+
+    checkFunction([](Batch a, const Batch& b) { a += b; a -= 0.5; a *= b; a /= b; return a; },
+                  [](Eval a, const Eval& b) { a += b; a -= 0.5; a *= b; a /= b; return a; });
+
+    // one constant per lane
+    std::array<double, width> c;
+    for (int k = 0; k < width; ++k) {
+        c[k] = 0.5 + 0.375*k;
+    }
+
+    std::array<Eval, width> ref;
+    for (int k = 0; k < width; ++k) {
+        ref[k] = c[k] + x.lane(k)*c[k] - c[k]/y.lane(k) + (y.lane(k) - c[k])/c[k];
+    }
+    checkLanes(c + x*c - c/y + (y - c)/c, ref);
+}
+
+BOOST_AUTO_TEST_CASE(MathFunctions)
+{
+    checkFunction([](const Batch& a, const Batch&) { return Opm::abs(a - 1.0); },
+                  [](const Eval& a, const Eval&) { return Opm::abs(a - 1.0); });
+    checkFunction([](const Batch& a, const Batch& b) { return Opm::min(a, b); },
+                  [](const Eval& a, const Eval& b) { return Opm::min(a, b); });
+    checkFunction([](const Batch& a, const Batch& b) { return Opm::max(a, b); },
+                  [](const Eval& a, const Eval& b) { return Opm::max(a, b); });
+    checkFunction([](const Batch& a, const Batch&) { return Opm::min(a, 1.0); },
+                  [](const Eval& a, const Eval&) { return Opm::min(a, 1.0); });
+    checkFunction([](const Batch& a, const Batch&) { return Opm::max(1.0, a); },
+                  [](const Eval& a, const Eval&) { return Opm::max(1.0, a); });
+    checkFunction([](const Batch&, const Batch& b) { return Opm::sqrt(b); },
+                  [](const Eval&, const Eval& b) { return Opm::sqrt(b); });
+    checkFunction([](const Batch& a, const Batch&) { return Opm::exp(a); },
+                  [](const Eval& a, const Eval&) { return Opm::exp(a); });
+    checkFunction([](const Batch&, const Batch& b) { return Opm::log(b); },
+                  [](const Eval&, const Eval& b) { return Opm::log(b); });
+    checkFunction([](const Batch& a, const Batch&) { return Opm::pow(a, 2.5); },
+                  [](const Eval& a, const Eval&) { return Opm::pow(a, 2.5); });
+    checkFunction([](const Batch& a, const Batch&) { return Opm::pow(1.7, a); },
+                  [](const Eval& a, const Eval&) { return Opm::pow(1.7, a); });
+    checkFunction([](const Batch& a, const Batch& b) { return Opm::pow(a, b); },
+                  [](const Eval& a, const Eval& b) { return Opm::pow(a, b); });
+
+    BOOST_CHECK(Opm::isfinite(x));
+    BOOST_CHECK(!Opm::isnan(x));
+    BOOST_CHECK(!Opm::isfinite(Opm::log(x)));
+}
+
+BOOST_AUTO_TEST_CASE(PiecewiseLinearTwoPhaseMaterial)
+{
+    using Traits = Opm::TwoPhaseMaterialTraits<double, 0, 1>;
+    using MaterialLaw = Opm::PiecewiseLinearTwoPhaseMaterial<Traits>;
+
+    MaterialLaw::Params params;
+    params.setKrwSamples(std::vector<double>{ 0.2, 0.3, 0.5, 0.7, 0.8 },
+                         std::vector<double>{ 0.0, 0.05, 0.2, 0.5, 0.7 });
+    params.setKrnSamples(std::vector<double>{ 0.2, 0.4, 0.6, 0.8 },
+                         std::vector<double>{ 1.0, 0.5, 0.1, 0.0 });
+    params.setPcnwSamples(std::vector<double>{ 0.2, 0.4, 0.6, 0.8 },
+                          std::vector<double>{ 3.0e5, 1.0e5, 0.4e5, 0.0 });
+    params.finalize();
+
+    // Saturations below, on and above the sampling points.
+    const auto sw = makeBatch({ 0.1, 0.2, 0.25, 0.3, 0.55, 0.79, 0.8, 0.9 }, 0);
+    const auto pc = makeBatch({ 4.0e5, 3.0e5, 2.0e5, 1.0e5, 0.5e5, 0.1e5, 0.0, -1.0e5 }, 0);
+
+    std::array<Eval, width> krw, krn, pcnw, swInv;
+    for (int k = 0; k < width; ++k) {
+        krw[k] = MaterialLaw::twoPhaseSatKrw(params, sw.lane(k));
+        krn[k] = MaterialLaw::twoPhaseSatKrn(params, sw.lane(k));
+        pcnw[k] = MaterialLaw::twoPhaseSatPcnw(params, sw.lane(k));
+        swInv[k] = MaterialLaw::twoPhaseSatPcnwInv(params, pc.lane(k));
+    }
+
+    checkLanes(MaterialLaw::twoPhaseSatKrw(params, sw), krw);
+    checkLanes(MaterialLaw::twoPhaseSatKrn(params, sw), krn);
+    checkLanes(MaterialLaw::twoPhaseSatPcnw(params, sw), pcnw);
+    checkLanes(MaterialLaw::twoPhaseSatPcnwInv(params, pc), swInv);
+}
+
+BOOST_AUTO_TEST_CASE(UniformXTabulated2DFunction)
+{
+    using Table = Opm::UniformXTabulated2DFunction<double>;
+
+    for (const auto policy : { Table::Vertical, Table::LeftExtreme, Table::RightExtreme }) {
+        Table table(policy);
+        for (unsigned i = 0; i < 6; ++i) {
+            const double xPos = 0.5*i;
+            table.appendXPos(xPos);
+
+            const unsigned numY = 4 + i;
+            for (unsigned j = 0; j < numY; ++j) {
+                const double yPos = 0.2*i + j*(2.0/(numY - 1));
+                table.appendSamplePoint(i, yPos, std::sin(xPos) + yPos*yPos);
+            }
+        }
+
+        // Positions inside and outside of the tabulated range.
+        const auto xs = makeBatch({ -0.5, 0.0, 0.3, 0.75, 1.2, 2.0, 2.5, 3.1 }, 0);
+        const auto ys = makeBatch({ 0.1, -0.5, 1.0, 0.0, 2.7, 1.9, 0.6, 3.5 }, 1);
+
+        std::array<Eval, width> ref;
+        for (int k = 0; k < width; ++k) {
+            ref[k] = table.eval(xs.lane(k), ys.lane(k), /*extrapolate=*/true);
+        }
+
+        checkLanes(table.eval(xs, ys, /*extrapolate=*/true), ref);
+    }
+}